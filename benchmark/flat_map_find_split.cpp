@@ -0,0 +1,118 @@
+#include "common.hpp"
+
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include "nanobench.h"
+
+#include "sfl/small_flat_map.hpp"
+#include "sfl/small_flat_split_map.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Mapped type that is much larger than key type.
+template <std::size_t Size>
+struct payload
+{
+    unsigned char bytes[Size];
+
+    payload()
+    {
+        bytes[0] = 1;
+    }
+};
+
+template <typename Map>
+void find_random(ankerl::nanobench::Bench& bench, std::size_t n, int num_lookups)
+{
+    using key_type = typename Map::key_type;
+
+    const std::string title(name_of_type<Map>());
+
+    ankerl::nanobench::Rng rng;
+
+    std::vector<key_type> inserted;
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        inserted.push_back(key_type(rng()));
+    }
+
+    std::vector<typename Map::value_type> values;
+
+    for (const auto& key : inserted)
+    {
+        values.emplace_back(key, typename Map::mapped_type());
+    }
+
+    const Map map(values.begin(), values.end());
+
+    // Half of lookups are hits and half of lookups are misses.
+
+    std::vector<key_type> keys;
+
+    for (int i = 0; i < num_lookups; ++i)
+    {
+        if (i % 2 == 0)
+        {
+            keys.push_back(inserted[rng.bounded(std::uint32_t(inserted.size()))]);
+        }
+        else
+        {
+            keys.push_back(key_type(rng()));
+        }
+    }
+
+    bench.batch(num_lookups).unit("find").run
+    (
+        title,
+        [&]
+        {
+            int sum = 0;
+
+            for (const auto& key : keys)
+            {
+                const auto it = map.find(key);
+
+                if (it != map.end())
+                {
+                    sum += it->second.bytes[0];
+                }
+            }
+
+            ankerl::nanobench::doNotOptimizeAway(sum);
+        }
+    );
+}
+
+template <typename Key, std::size_t MappedSize>
+void find_random(ankerl::nanobench::Bench& bench, std::size_t n, int num_lookups)
+{
+    using mapped_type = payload<MappedSize>;
+
+    bench.title
+    (
+        "find (" + std::string(name_of_type<Key>()) +
+        ", sizeof(mapped_type) = " + std::to_string(MappedSize) +
+        ", size = " + std::to_string(n) + ")"
+    );
+
+    find_random<sfl::small_flat_map<Key, mapped_type, 0>>(bench, n, num_lookups);
+    find_random<sfl::small_flat_split_map<Key, mapped_type, 0>>(bench, n, num_lookups);
+}
+
+int main()
+{
+    constexpr int num_lookups = 100'000;
+
+    ankerl::nanobench::Bench bench;
+    bench.performanceCounters(false);
+    bench.warmup(3);
+    bench.epochs(10);
+
+    for (std::size_t n : {1'000, 100'000, 1'000'000})
+    {
+        find_random<std::uint64_t, 8>(bench, n, num_lookups);
+        find_random<std::uint64_t, 56>(bench, n, num_lookups);
+    }
+}
@@ -0,0 +1,88 @@
+#include "common.hpp"
+
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include "nanobench.h"
+
+#include "sfl/small_flat_map.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+template <typename Key, bool Lazy>
+using map_type = sfl::small_flat_map
+<
+    Key,
+    Key,
+    0,
+    std::less<Key>,
+    std::allocator<std::pair<Key, Key>>,
+    Lazy
+>;
+
+// Inserts `n` random keys one by one and then looks up each of them once,
+// like a write-heavy phase followed by a read-heavy phase.
+template <typename Key, bool Lazy>
+void insert_then_find(ankerl::nanobench::Bench& bench, const std::string& title, std::size_t n)
+{
+    ankerl::nanobench::Rng rng;
+
+    std::vector<Key> keys;
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        keys.push_back(Key(rng()));
+    }
+
+    bench.batch(n).unit("element").run
+    (
+        title,
+        [&]
+        {
+            map_type<Key, Lazy> map;
+
+            for (const auto& key : keys)
+            {
+                map.emplace(key, key);
+            }
+
+            std::size_t sum = 0;
+
+            for (auto it = map.begin(); it != map.end(); ++it)
+            {
+                sum += std::size_t(it->second);
+            }
+
+            for (const auto& key : keys)
+            {
+                sum += map.count(key);
+            }
+
+            ankerl::nanobench::doNotOptimizeAway(sum);
+        }
+    );
+}
+
+template <typename Key>
+void insert_then_find(ankerl::nanobench::Bench& bench, std::size_t n)
+{
+    bench.title("insert then find (" + std::string(name_of_type<Key>()) + ", n = " + std::to_string(n) + ")");
+
+    insert_then_find<Key, false>(bench, "small_flat_map", n);
+    insert_then_find<Key, true>(bench, "small_flat_map, Lazy", n);
+}
+
+int main()
+{
+    ankerl::nanobench::Bench bench;
+    bench.performanceCounters(false);
+    bench.warmup(1);
+    bench.epochs(5);
+
+    for (std::size_t n : {100, 1'000, 10'000, 100'000})
+    {
+        insert_then_find<std::uint32_t>(bench, n);
+        insert_then_find<std::uint64_t>(bench, n);
+    }
+}
@@ -0,0 +1,141 @@
+#include "common.hpp"
+
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include "nanobench.h"
+
+#include "sfl/small_flat_set.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Same as std::less, but it is a distinct type so containers using it
+// cannot use the fast path for arithmetic keys.
+template <typename T>
+struct scalar_less
+{
+    bool operator()(const T& x, const T& y) const
+    {
+        return x < y;
+    }
+};
+
+// Baseline: std::lower_bound over sorted std::vector.
+template <typename T>
+struct std_sorted_vector
+{
+    using key_type = T;
+
+    std::vector<T> v;
+
+    void insert(const std::vector<T>& keys)
+    {
+        v = keys;
+        std::sort(v.begin(), v.end());
+    }
+
+    typename std::vector<T>::const_iterator lower_bound(const T& x) const
+    {
+        return std::lower_bound(v.begin(), v.end(), x);
+    }
+
+    typename std::vector<T>::const_iterator end() const
+    {
+        return v.end();
+    }
+};
+
+template <typename T, typename Compare>
+struct sfl_set
+{
+    using key_type = T;
+
+    sfl::small_flat_set<T, 0, Compare> s;
+
+    void insert(const std::vector<T>& keys)
+    {
+        s.insert(keys.begin(), keys.end());
+    }
+
+    typename sfl::small_flat_set<T, 0, Compare>::const_iterator lower_bound(const T& x) const
+    {
+        return s.lower_bound(x);
+    }
+
+    typename sfl::small_flat_set<T, 0, Compare>::const_iterator end() const
+    {
+        return s.end();
+    }
+};
+
+template <typename Set>
+void lower_bound_random(ankerl::nanobench::Bench& bench, const std::string& title, std::size_t n, int num_lookups)
+{
+    using key_type = typename Set::key_type;
+
+    ankerl::nanobench::Rng rng;
+
+    std::vector<key_type> inserted;
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        inserted.push_back(key_type(rng()));
+    }
+
+    Set set;
+    set.insert(inserted);
+
+    std::vector<key_type> keys;
+
+    for (int i = 0; i < num_lookups; ++i)
+    {
+        keys.push_back(key_type(rng()));
+    }
+
+    bench.batch(num_lookups).unit("lower_bound").run
+    (
+        title,
+        [&]
+        {
+            std::size_t sum = 0;
+
+            for (const auto& key : keys)
+            {
+                sum += (set.lower_bound(key) != set.end());
+            }
+
+            ankerl::nanobench::doNotOptimizeAway(sum);
+        }
+    );
+}
+
+template <typename T>
+void lower_bound_random(ankerl::nanobench::Bench& bench, std::size_t n, int num_lookups)
+{
+    bench.title
+    (
+        "lower_bound (" + std::string(name_of_type<T>()) +
+        ", size = " + std::to_string(n) + ")"
+    );
+
+    lower_bound_random<std_sorted_vector<T>>(bench, "std::lower_bound", n, num_lookups);
+    lower_bound_random<sfl_set<T, std::less<T>>>(bench, "small_flat_set, std::less", n, num_lookups);
+    lower_bound_random<sfl_set<T, scalar_less<T>>>(bench, "small_flat_set, scalar_less", n, num_lookups);
+}
+
+int main()
+{
+    constexpr int num_lookups = 100'000;
+
+    ankerl::nanobench::Bench bench;
+    bench.performanceCounters(false);
+    bench.warmup(3);
+    bench.epochs(10);
+
+    for (std::size_t n : {8, 64, 512, 4'096, 32'768, 262'144, 1'048'576})
+    {
+        lower_bound_random<std::uint32_t>(bench, n, num_lookups);
+        lower_bound_random<std::uint64_t>(bench, n, num_lookups);
+    }
+}
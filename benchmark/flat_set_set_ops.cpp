@@ -0,0 +1,128 @@
+#include "common.hpp"
+
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include "nanobench.h"
+
+#include "sfl/small_flat_set.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <vector>
+
+template <typename Key>
+using set_type = sfl::small_flat_set<Key, 0>;
+
+template <typename Key>
+set_type<Key> make_set(ankerl::nanobench::Rng& rng, std::size_t n, std::size_t range)
+{
+    std::vector<Key> keys;
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        keys.push_back(Key(rng.bounded(std::uint32_t(range))));
+    }
+
+    return set_type<Key>(keys.begin(), keys.end());
+}
+
+// Compares member functions with standard algorithms writing into a vector
+// that is then adopted by the container.
+template <typename Key>
+void set_ops(ankerl::nanobench::Bench& bench, std::size_t n1, std::size_t n2)
+{
+    ankerl::nanobench::Rng rng;
+
+    const std::size_t range = 2 * std::max(n1, n2);
+
+    const set_type<Key> a = make_set<Key>(rng, n1, range);
+    const set_type<Key> b = make_set<Key>(rng, n2, range);
+
+    bench.title
+    (
+        "set operations (" + std::string(name_of_type<Key>()) +
+        ", n1 = " + std::to_string(n1) + ", n2 = " + std::to_string(n2) + ")"
+    );
+
+    bench.run
+    (
+        "std::set_intersection",
+        [&]
+        {
+            std::vector<Key> tmp;
+            std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(tmp));
+            set_type<Key> c(sfl::sorted_unique_t(), tmp.begin(), tmp.end());
+            ankerl::nanobench::doNotOptimizeAway(c);
+        }
+    );
+
+    bench.run
+    (
+        "set_intersection",
+        [&]
+        {
+            set_type<Key> c = a.set_intersection(b);
+            ankerl::nanobench::doNotOptimizeAway(c);
+        }
+    );
+
+    bench.run
+    (
+        "std::set_union",
+        [&]
+        {
+            std::vector<Key> tmp;
+            std::set_union(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(tmp));
+            set_type<Key> c(sfl::sorted_unique_t(), tmp.begin(), tmp.end());
+            ankerl::nanobench::doNotOptimizeAway(c);
+        }
+    );
+
+    bench.run
+    (
+        "set_union",
+        [&]
+        {
+            set_type<Key> c = a.set_union(b);
+            ankerl::nanobench::doNotOptimizeAway(c);
+        }
+    );
+
+    bench.run
+    (
+        "insert",
+        [&]
+        {
+            set_type<Key> c(a);
+            c.insert(sfl::sorted_unique_t(), b.begin(), b.end());
+            ankerl::nanobench::doNotOptimizeAway(c);
+        }
+    );
+
+    bench.run
+    (
+        "merge_from",
+        [&]
+        {
+            set_type<Key> c(a);
+            c.merge_from(b);
+            ankerl::nanobench::doNotOptimizeAway(c);
+        }
+    );
+}
+
+int main()
+{
+    ankerl::nanobench::Bench bench;
+    bench.performanceCounters(false);
+    bench.minEpochIterations(10);
+
+    for (std::size_t n : {1'000, 100'000})
+    {
+        set_ops<std::uint32_t>(bench, n, n);
+        set_ops<std::uint32_t>(bench, n / 100, n);
+        set_ops<std::uint64_t>(bench, n, n);
+        set_ops<std::uint64_t>(bench, n / 100, n);
+    }
+}
@@ -0,0 +1,73 @@
+#include "common.hpp"
+
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include "nanobench.h"
+
+#include "sfl/frozen_unordered_map.hpp"
+#include "sfl/static_unordered_flat_map.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+// Looks up random string keys, half of which are in the map. Both maps hold
+// the same string -> id dictionary.
+template <std::size_t N>
+void find(ankerl::nanobench::Bench& bench)
+{
+    using static_map_type = sfl::static_unordered_flat_map<std::string, int, N>;
+    using frozen_map_type = sfl::frozen_unordered_map<std::string, int, N>;
+
+    std::unique_ptr<static_map_type> static_map(new static_map_type());
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        static_map->emplace("identifier_" + std::to_string(i), int(i));
+    }
+
+    std::unique_ptr<frozen_map_type> frozen_map(new frozen_map_type(static_map->begin(), static_map->end()));
+
+    ankerl::nanobench::Rng rng;
+
+    std::vector<std::string> queries;
+
+    for (std::size_t i = 0; i < 1024; ++i)
+    {
+        const auto k = rng.bounded(std::uint32_t(2 * N));
+        queries.push_back((k < N ? "identifier_" : "missing_") + std::to_string(k));
+    }
+
+    bench.title("find (n = " + std::to_string(N) + ")");
+
+    std::size_t i = 0;
+
+    bench.run
+    (
+        "static_unordered_flat_map",
+        [&]
+        {
+            ankerl::nanobench::doNotOptimizeAway(static_map->find(queries[i++ % queries.size()]));
+        }
+    );
+
+    bench.run
+    (
+        "frozen_unordered_map",
+        [&]
+        {
+            ankerl::nanobench::doNotOptimizeAway(frozen_map->find(queries[i++ % queries.size()]));
+        }
+    );
+}
+
+int main()
+{
+    ankerl::nanobench::Bench bench;
+    bench.performanceCounters(false);
+    bench.minEpochIterations(100000);
+
+    find<8>(bench);
+    find<32>(bench);
+    find<128>(bench);
+    find<1024>(bench);
+}
@@ -0,0 +1,135 @@
+#include "common.hpp"
+
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include "nanobench.h"
+
+#include "sfl/static_flat_map.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+constexpr std::size_t N = 65536;
+
+struct record
+{
+    std::uint64_t a;
+    std::uint64_t b;
+};
+
+template <bool Freezable, bool Learned>
+using map_type = sfl::static_flat_map
+<
+    std::uint64_t,
+    record,
+    N,
+    std::less<std::uint64_t>,
+    Freezable,
+    Learned
+>;
+
+// Looks up random keys, half of which are in the map. Containers are
+// allocated on the heap because they are too large for the stack.
+template <bool Freezable, bool Learned>
+void find(ankerl::nanobench::Bench& bench, const std::string& title, const std::vector<std::uint64_t>& keys)
+{
+    std::unique_ptr<map_type<Freezable, Learned>> map(new map_type<Freezable, Learned>());
+
+    for (const auto& key : keys)
+    {
+        map->emplace(key, record{key, key});
+    }
+
+    if constexpr (Freezable)
+    {
+        map->freeze();
+    }
+
+    if constexpr (Learned)
+    {
+        map->fit();
+    }
+
+    ankerl::nanobench::Rng rng;
+
+    std::vector<std::uint64_t> queries;
+
+    for (std::size_t i = 0; i < 4096; ++i)
+    {
+        const std::uint64_t key = keys[rng.bounded(std::uint32_t(keys.size()))];
+        queries.push_back(key + (rng() & 1));
+    }
+
+    std::size_t i = 0;
+
+    bench.run
+    (
+        title,
+        [&]
+        {
+            ankerl::nanobench::doNotOptimizeAway(map->find(queries[i++ % queries.size()]));
+        }
+    );
+}
+
+void find(ankerl::nanobench::Bench& bench, const std::string& name, std::vector<std::uint64_t> keys)
+{
+    std::sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+
+    bench.title("find (" + name + ", n = " + std::to_string(keys.size()) + ")");
+
+    find<false, false>(bench, "binary search", keys);
+    find<true, false>(bench, "freeze", keys);
+    find<false, true>(bench, "fit", keys);
+}
+
+int main()
+{
+    ankerl::nanobench::Bench bench;
+    bench.performanceCounters(false);
+    bench.minEpochIterations(100000);
+
+    ankerl::nanobench::Rng rng;
+
+    // Timestamps in microseconds with irregular gaps.
+    {
+        std::vector<std::uint64_t> keys;
+
+        std::uint64_t t = 1700000000000000;
+
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            t += 1 + rng.bounded(2000);
+            keys.push_back(t);
+        }
+
+        find(bench, "timestamps", keys);
+    }
+
+    // Uniformly distributed 64-bit ids.
+    {
+        std::vector<std::uint64_t> keys;
+
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            keys.push_back(rng());
+        }
+
+        find(bench, "random ids", keys);
+    }
+
+    // Keys clustered in a few dense ranges.
+    {
+        std::vector<std::uint64_t> keys;
+
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            keys.push_back((std::uint64_t(rng.bounded(8)) << 40) + rng.bounded(1u << 20));
+        }
+
+        find(bench, "clusters", keys);
+    }
+}
@@ -0,0 +1,105 @@
+#include "common.hpp"
+
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include "nanobench.h"
+
+#include "sfl/small_vector.hpp"
+#include "sfl/tiny_vector.hpp"
+
+#include <cstdint>
+#include <vector>
+
+// Many small vectors of 32-bit integers. Smaller containers need less memory
+// for the outer vector, so more of them fit into cache.
+
+template <typename Vector>
+void emplace_back(ankerl::nanobench::Bench& bench, std::size_t num_vectors, std::size_t num_elements)
+{
+    const std::string title(std::string(name_of_type<Vector>()) + " (sizeof " + std::to_string(sizeof(Vector)) + ")");
+
+    bench.batch(num_vectors * num_elements).unit("emplace_back").run
+    (
+        title,
+        [&]
+        {
+            std::vector<Vector> vecs(num_vectors);
+
+            for (auto& vec : vecs)
+            {
+                for (std::size_t i = 0; i < num_elements; ++i)
+                {
+                    vec.emplace_back(std::uint32_t(i));
+                }
+            }
+
+            ankerl::nanobench::doNotOptimizeAway(vecs.back().size());
+        }
+    );
+}
+
+template <typename Vector>
+void iterate_all(ankerl::nanobench::Bench& bench, std::size_t num_vectors, std::size_t num_elements)
+{
+    const std::string title(std::string(name_of_type<Vector>()) + " (sizeof " + std::to_string(sizeof(Vector)) + ")");
+
+    std::vector<Vector> vecs(num_vectors);
+
+    for (auto& vec : vecs)
+    {
+        for (std::size_t i = 0; i < num_elements; ++i)
+        {
+            vec.emplace_back(std::uint32_t(i));
+        }
+    }
+
+    bench.batch(num_vectors * num_elements).unit("element").run
+    (
+        title,
+        [&]
+        {
+            std::uint64_t sum = 0;
+
+            for (const auto& vec : vecs)
+            {
+                for (const auto& x : vec)
+                {
+                    sum += x;
+                }
+            }
+
+            ankerl::nanobench::doNotOptimizeAway(sum);
+        }
+    );
+}
+
+int main()
+{
+    constexpr std::size_t num_vectors = 1'000'000;
+
+    for (std::size_t num_elements : {3, 8})
+    {
+        {
+            ankerl::nanobench::Bench bench;
+            bench.title("emplace_back (" + std::to_string(num_vectors) + " vectors, " + std::to_string(num_elements) + " elements each)");
+            bench.performanceCounters(false);
+            bench.epochs(5);
+            bench.minEpochIterations(5);
+
+            emplace_back<std::vector<std::uint32_t>>(bench, num_vectors, num_elements);
+            emplace_back<sfl::small_vector<std::uint32_t, 4>>(bench, num_vectors, num_elements);
+            emplace_back<sfl::tiny_vector<std::uint32_t, 4>>(bench, num_vectors, num_elements);
+        }
+
+        {
+            ankerl::nanobench::Bench bench;
+            bench.title("iterate all (" + std::to_string(num_vectors) + " vectors, " + std::to_string(num_elements) + " elements each)");
+            bench.performanceCounters(false);
+            bench.epochs(5);
+            bench.minEpochIterations(5);
+
+            iterate_all<std::vector<std::uint32_t>>(bench, num_vectors, num_elements);
+            iterate_all<sfl::small_vector<std::uint32_t, 4>>(bench, num_vectors, num_elements);
+            iterate_all<sfl::tiny_vector<std::uint32_t, 4>>(bench, num_vectors, num_elements);
+        }
+    }
+}
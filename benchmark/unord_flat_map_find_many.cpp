@@ -0,0 +1,111 @@
+#include "common.hpp"
+
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include "nanobench.h"
+
+#include "sfl/static_unordered_flat_map.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Same as std::equal_to, but it is a distinct type so containers using it
+// cannot use SIMD search nor hash query keys.
+template <typename T>
+struct scalar_equal
+{
+    bool operator()(const T& x, const T& y) const
+    {
+        return x == y;
+    }
+};
+
+template <typename Map>
+void find_batch(ankerl::nanobench::Bench& bench, std::size_t batch_size, bool batched)
+{
+    using key_type = typename Map::key_type;
+    using mapped_type = typename Map::mapped_type;
+
+    ankerl::nanobench::Rng rng;
+
+    Map map;
+
+    while (!map.full())
+    {
+        map.emplace(key_type(rng()), mapped_type());
+    }
+
+    // Half of lookups are hits and half of lookups are misses.
+
+    std::vector<key_type> keys;
+
+    for (std::size_t i = 0; i < batch_size; ++i)
+    {
+        if (i % 2 == 0)
+        {
+            keys.push_back(map.nth(rng.bounded(std::uint32_t(map.size())))->first);
+        }
+        else
+        {
+            keys.push_back(key_type(rng()));
+        }
+    }
+
+    std::vector<typename Map::const_iterator> result(batch_size);
+
+    bench.batch(batch_size).unit("key").run
+    (
+        std::string(batched ? "find_many " : "find      ") + std::string(name_of_type<typename Map::key_equal>()),
+        [&]
+        {
+            if (batched)
+            {
+                map.find_many(keys.begin(), keys.end(), result.begin());
+            }
+            else
+            {
+                for (std::size_t i = 0; i < batch_size; ++i)
+                {
+                    result[i] = map.find(keys[i]);
+                }
+            }
+
+            ankerl::nanobench::doNotOptimizeAway(result.front());
+        }
+    );
+}
+
+template <typename Key, std::size_t N>
+void find_batch(ankerl::nanobench::Bench& bench, std::size_t batch_size)
+{
+    bench.title
+    (
+        "find (" + std::string(name_of_type<Key>()) +
+        ", N = " + std::to_string(N) +
+        ", batch size = " + std::to_string(batch_size) + ")"
+    );
+
+    using simd_map = sfl::static_unordered_flat_map<Key, Key, N, std::equal_to<Key>>;
+    using scalar_map = sfl::static_unordered_flat_map<Key, Key, N, scalar_equal<Key>>;
+
+    find_batch<simd_map>(bench, batch_size, false);
+    find_batch<simd_map>(bench, batch_size, true);
+    find_batch<scalar_map>(bench, batch_size, false);
+    find_batch<scalar_map>(bench, batch_size, true);
+}
+
+int main()
+{
+    ankerl::nanobench::Bench bench;
+    bench.performanceCounters(false);
+    bench.warmup(3);
+    bench.epochs(10);
+    bench.minEpochIterations(100);
+
+    for (std::size_t batch_size : {4, 32, 256})
+    {
+        find_batch<std::uint32_t, 64>(bench, batch_size);
+        find_batch<std::uint32_t, 512>(bench, batch_size);
+        find_batch<std::uint64_t, 512>(bench, batch_size);
+    }
+}
@@ -0,0 +1,163 @@
+#include "common.hpp"
+
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include "nanobench.h"
+
+#include "sfl/small_unordered_flat_map.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+// Returns `num_lookups` indexes in range [0, n) with Zipf distribution
+// (index `k` has probability proportional to 1 / (k + 1)^s).
+std::vector<std::size_t> zipf_indexes(ankerl::nanobench::Rng& rng, std::size_t n, double s, int num_lookups)
+{
+    std::vector<double> cdf(n);
+
+    double sum = 0.0;
+
+    for (std::size_t k = 0; k < n; ++k)
+    {
+        sum += 1.0 / std::pow(double(k + 1), s);
+        cdf[k] = sum;
+    }
+
+    std::vector<std::size_t> indexes;
+
+    for (int i = 0; i < num_lookups; ++i)
+    {
+        const double u = rng.uniform01() * sum;
+        const auto it = std::lower_bound(cdf.begin(), cdf.end(), u);
+        indexes.push_back(std::min(std::size_t(it - cdf.begin()), n - 1));
+    }
+
+    return indexes;
+}
+
+template <typename Key>
+Key make_key(std::size_t i)
+{
+    if constexpr (std::is_same_v<Key, std::string>)
+    {
+        return "some rather long key " + std::to_string(i);
+    }
+    else
+    {
+        return Key(i);
+    }
+}
+
+enum class lookup { find, find_and_transpose, find_and_move_to_front };
+
+template <typename Map>
+void find_zipf(ankerl::nanobench::Bench& bench, std::size_t n, double s, int num_lookups, lookup how)
+{
+    using key_type = typename Map::key_type;
+
+    const char* const names[] = { "find", "find_and_transpose", "find_and_move_to_front" };
+
+    ankerl::nanobench::Rng rng;
+
+    // Hot keys are inserted at random positions, so plain `find` does not
+    // benefit from insertion order.
+
+    std::vector<key_type> keys;
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        keys.push_back(make_key<key_type>(i));
+    }
+
+    std::vector<std::size_t> order(n);
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        order[i] = i;
+    }
+
+    rng.shuffle(order);
+
+    Map map;
+
+    for (std::size_t i : order)
+    {
+        map.emplace(keys[i], int(i));
+    }
+
+    std::vector<key_type> lookups;
+
+    for (std::size_t i : zipf_indexes(rng, n, s, num_lookups))
+    {
+        lookups.push_back(keys[i]);
+    }
+
+    bench.batch(num_lookups).unit("find").run
+    (
+        names[int(how)],
+        [&]
+        {
+            int sum = 0;
+
+            for (const auto& key : lookups)
+            {
+                switch (how)
+                {
+                case lookup::find:
+                    sum += map.find(key)->second;
+                    break;
+                case lookup::find_and_transpose:
+                    sum += map.find_and_transpose(key)->second;
+                    break;
+                case lookup::find_and_move_to_front:
+                    sum += map.find_and_move_to_front(key)->second;
+                    break;
+                }
+            }
+
+            ankerl::nanobench::doNotOptimizeAway(sum);
+        }
+    );
+}
+
+template <typename Key>
+void find_zipf(ankerl::nanobench::Bench& bench, std::size_t n, double s, int num_lookups)
+{
+    using map_type = sfl::small_unordered_flat_map<Key, int, 16>;
+
+    bench.title
+    (
+        "find (" + std::string(name_of_type<Key>()) +
+        ", size = " + std::to_string(n) +
+        ", zipf s = " + std::to_string(s).substr(0, 3) + ")"
+    );
+
+    find_zipf<map_type>(bench, n, s, num_lookups, lookup::find);
+    find_zipf<map_type>(bench, n, s, num_lookups, lookup::find_and_transpose);
+    find_zipf<map_type>(bench, n, s, num_lookups, lookup::find_and_move_to_front);
+}
+
+int main()
+{
+    constexpr int num_lookups = 100'000;
+
+    ankerl::nanobench::Bench bench;
+    bench.performanceCounters(false);
+    bench.warmup(3);
+    bench.epochs(10);
+
+    for (std::size_t n : {64, 256, 1024})
+    {
+        for (double s : {0.8, 1.2})
+        {
+            find_zipf<std::string>(bench, n, s, num_lookups);
+        }
+    }
+
+    // Integral keys are searched using SIMD, which is hard to beat.
+    for (std::size_t n : {64, 1024})
+    {
+        find_zipf<long long>(bench, n, 1.2, num_lookups);
+    }
+}
@@ -0,0 +1,104 @@
+#include "common.hpp"
+
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include "nanobench.h"
+
+#include "sfl/static_unordered_flat_set.hpp"
+
+#include <cstdint>
+#include <vector>
+
+// Same as std::equal_to, but it is a distinct type so containers using it
+// cannot use SIMD search.
+template <typename T>
+struct scalar_equal
+{
+    bool operator()(const T& x, const T& y) const
+    {
+        return x == y;
+    }
+};
+
+template <typename Set>
+void find_random(ankerl::nanobench::Bench& bench, int num_lookups)
+{
+    using key_type = typename Set::key_type;
+
+    const std::string title(name_of_type<Set>());
+
+    ankerl::nanobench::Rng rng;
+
+    Set set;
+
+    while (!set.full())
+    {
+        set.emplace(key_type(rng()));
+    }
+
+    // Half of lookups are hits and half of lookups are misses.
+
+    std::vector<key_type> keys;
+
+    for (int i = 0; i < num_lookups; ++i)
+    {
+        if (i % 2 == 0)
+        {
+            keys.push_back(*set.nth(rng.bounded(std::uint32_t(set.size()))));
+        }
+        else
+        {
+            keys.push_back(key_type(rng()));
+        }
+    }
+
+    bench.batch(num_lookups).unit("find").run
+    (
+        title,
+        [&]
+        {
+            int count = 0;
+
+            for (const auto& key : keys)
+            {
+                count += set.find(key) != set.end();
+            }
+
+            ankerl::nanobench::doNotOptimizeAway(count);
+        }
+    );
+}
+
+template <typename Key, std::size_t N>
+void find_random(ankerl::nanobench::Bench& bench, int num_lookups)
+{
+    bench.title("find (" + std::string(name_of_type<Key>()) + ", N = " + std::to_string(N) + ")");
+
+    find_random<sfl::static_unordered_flat_set<Key, N, scalar_equal<Key>>>(bench, num_lookups);
+    find_random<sfl::static_unordered_flat_set<Key, N, std::equal_to<Key>>>(bench, num_lookups);
+}
+
+int main()
+{
+    constexpr int num_lookups = 100'000;
+
+    ankerl::nanobench::Bench bench;
+    bench.performanceCounters(false);
+    bench.warmup(3);
+    bench.epochs(10);
+
+    find_random<std::uint16_t, 8>(bench, num_lookups);
+    find_random<std::uint16_t, 64>(bench, num_lookups);
+    find_random<std::uint16_t, 256>(bench, num_lookups);
+
+    find_random<std::uint32_t, 8>(bench, num_lookups);
+    find_random<std::uint32_t, 16>(bench, num_lookups);
+    find_random<std::uint32_t, 32>(bench, num_lookups);
+    find_random<std::uint32_t, 64>(bench, num_lookups);
+    find_random<std::uint32_t, 256>(bench, num_lookups);
+
+    find_random<std::uint64_t, 8>(bench, num_lookups);
+    find_random<std::uint64_t, 64>(bench, num_lookups);
+    find_random<std::uint64_t, 256>(bench, num_lookups);
+
+    find_random<const void*, 64>(bench, num_lookups);
+}
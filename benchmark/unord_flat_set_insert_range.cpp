@@ -0,0 +1,71 @@
+#include "common.hpp"
+
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include "nanobench.h"
+
+#include "sfl/small_unordered_flat_set.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Same as std::equal_to, but it is a distinct type so containers using it
+// insert ranges element by element.
+template <typename T>
+struct scalar_equal
+{
+    bool operator()(const T& x, const T& y) const
+    {
+        return x == y;
+    }
+};
+
+template <typename Set>
+void insert_range_into(ankerl::nanobench::Bench& bench, std::size_t n)
+{
+    using key_type = typename Set::key_type;
+
+    ankerl::nanobench::Rng rng;
+
+    // About 10% of keys are duplicates.
+
+    std::vector<key_type> keys;
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        keys.push_back(key_type(rng.bounded(std::uint32_t(n * 5))));
+    }
+
+    bench.batch(n).unit("element").run
+    (
+        std::string(name_of_type<typename Set::key_equal>()),
+        [&]
+        {
+            Set set(keys.begin(), keys.end());
+            ankerl::nanobench::doNotOptimizeAway(set.size());
+        }
+    );
+}
+
+template <typename Key>
+void insert_range(ankerl::nanobench::Bench& bench, std::size_t n)
+{
+    bench.title("insert range (" + std::string(name_of_type<Key>()) + ", n = " + std::to_string(n) + ")");
+
+    insert_range_into<sfl::small_unordered_flat_set<Key, 0, scalar_equal<Key>>>(bench, n);
+    insert_range_into<sfl::small_unordered_flat_set<Key, 0, std::equal_to<Key>>>(bench, n);
+}
+
+int main()
+{
+    ankerl::nanobench::Bench bench;
+    bench.performanceCounters(false);
+    bench.warmup(1);
+    bench.epochs(5);
+
+    for (std::size_t n : {16, 100, 1000, 10000})
+    {
+        insert_range<std::uint32_t>(bench, n);
+        insert_range<std::uint64_t>(bench, n);
+    }
+}
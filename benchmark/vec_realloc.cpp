@@ -0,0 +1,89 @@
+#include "common.hpp"
+
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include "nanobench.h"
+
+#include "sfl/compact_vector.hpp"
+#include "sfl/realloc_allocator.hpp"
+#include "sfl/vector.hpp"
+
+#include <cstdint>
+#include <vector>
+
+// Containers that use sfl::realloc_allocator grow storage using realloc,
+// so elements are not copied and glibc can use mremap for huge blocks.
+
+template <typename Vector>
+void push_back(ankerl::nanobench::Bench& bench, std::size_t num_elements)
+{
+    using value_type = typename Vector::value_type;
+
+    const std::string title(name_of_type<Vector>());
+
+    bench.batch(num_elements).unit("push_back").run
+    (
+        title,
+        [&]
+        {
+            Vector vec;
+
+            for (std::size_t i = 0; i < num_elements; ++i)
+            {
+                vec.push_back(value_type(i));
+            }
+
+            ankerl::nanobench::doNotOptimizeAway(vec.size());
+        }
+    );
+}
+
+template <typename Vector>
+void resize(ankerl::nanobench::Bench& bench, std::size_t num_elements, std::size_t step)
+{
+    const std::string title(name_of_type<Vector>());
+
+    bench.batch(num_elements / step).unit("resize").run
+    (
+        title,
+        [&]
+        {
+            Vector vec;
+
+            for (std::size_t n = step; n <= num_elements; n += step)
+            {
+                vec.resize(n);
+            }
+
+            ankerl::nanobench::doNotOptimizeAway(vec.size());
+        }
+    );
+}
+
+int main()
+{
+    {
+        constexpr std::size_t num_elements = 64 * 1024 * 1024; // 256 MB
+
+        ankerl::nanobench::Bench bench;
+        bench.title("push_back (" + std::to_string(num_elements) + " floats)");
+        bench.performanceCounters(false);
+        bench.epochs(3);
+
+        push_back<std::vector<float>>(bench, num_elements);
+        push_back<sfl::vector<float>>(bench, num_elements);
+        push_back<sfl::vector<float, sfl::realloc_allocator<float>>>(bench, num_elements);
+    }
+
+    {
+        constexpr std::size_t num_elements = 256 * 1024 * 1024; // 256 MB
+        constexpr std::size_t step = 4 * 1024 * 1024;
+
+        ankerl::nanobench::Bench bench;
+        bench.title("resize in steps of " + std::to_string(step) + " (" + std::to_string(num_elements) + " bytes)");
+        bench.performanceCounters(false);
+        bench.epochs(3);
+
+        resize<sfl::compact_vector<std::uint8_t>>(bench, num_elements, step);
+        resize<sfl::compact_vector<std::uint8_t, sfl::realloc_allocator<std::uint8_t>>>(bench, num_elements, step);
+    }
+}
@@ -0,0 +1,95 @@
+#include "common.hpp"
+
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include "nanobench.h"
+
+#include "sfl/devector.hpp"
+#include "sfl/small_vector.hpp"
+#include "sfl/vector.hpp"
+
+#include <memory>
+#include <vector>
+
+// Element type is std::unique_ptr<int>, which is trivially relocatable, so
+// sfl containers relocate elements with memcpy/memmove.
+
+template <typename Vector>
+void emplace_back(ankerl::nanobench::Bench& bench, int num_elements)
+{
+    const std::string title(name_of_type<Vector>());
+
+    bench.batch(num_elements).unit("emplace_back").run
+    (
+        title,
+        [&]
+        {
+            Vector vec;
+
+            for (int i = 0; i < num_elements; ++i)
+            {
+                vec.emplace_back(new int(i));
+            }
+
+            ankerl::nanobench::doNotOptimizeAway(vec.size());
+        }
+    );
+}
+
+template <typename Vector>
+void emplace_and_erase_at_random(ankerl::nanobench::Bench& bench, int num_elements)
+{
+    const std::string title(name_of_type<Vector>());
+
+    ankerl::nanobench::Rng rng;
+
+    Vector vec;
+
+    for (int i = 0; i < num_elements; ++i)
+    {
+        vec.emplace_back(new int(i));
+    }
+
+    bench.batch(2).unit("emplace+erase").run
+    (
+        title,
+        [&]
+        {
+            vec.emplace(vec.begin() + rng.bounded(num_elements), new int(0));
+            vec.erase(vec.begin() + rng.bounded(num_elements));
+
+            ankerl::nanobench::doNotOptimizeAway(vec.size());
+        }
+    );
+}
+
+int main()
+{
+    constexpr int num_elements = 100'000;
+
+    using element_type = std::unique_ptr<int>;
+
+    {
+        ankerl::nanobench::Bench bench;
+        bench.title("emplace_back (" + std::to_string(num_elements) + " elements)");
+        bench.performanceCounters(false);
+        bench.warmup(3);
+        bench.epochs(10);
+
+        emplace_back<std::vector<element_type>>(bench, num_elements);
+        emplace_back<sfl::vector<element_type>>(bench, num_elements);
+        emplace_back<sfl::small_vector<element_type, 16>>(bench, num_elements);
+        emplace_back<sfl::devector<element_type>>(bench, num_elements);
+    }
+
+    {
+        ankerl::nanobench::Bench bench;
+        bench.title("emplace and erase @ random position (" + std::to_string(num_elements) + " elements)");
+        bench.performanceCounters(false);
+        bench.minEpochIterations(1000);
+
+        emplace_and_erase_at_random<std::vector<element_type>>(bench, num_elements);
+        emplace_and_erase_at_random<sfl::vector<element_type>>(bench, num_elements);
+        emplace_and_erase_at_random<sfl::small_vector<element_type, 16>>(bench, num_elements);
+        emplace_and_erase_at_random<sfl::devector<element_type>>(bench, num_elements);
+    }
+}
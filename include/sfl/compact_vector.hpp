@@ -520,91 +520,13 @@ public:
             sfl::dtl::throw_length_error("sfl::compact_vector::emplace");
         }
 
-        pointer new_first = sfl::dtl::allocate(data_.ref_to_alloc(), new_size);
-        pointer new_last  = new_first;
-
-        SFL_TRY
-        {
-            // The order of operations is critical. First we will construct
-            // new element in new storage because arguments `args...` can
-            // contain reference to element in this container and after
-            // that we will move elements from old to new storage.
-
-            sfl::dtl::construct_at_a
-            (
-                data_.ref_to_alloc(),
-                new_first + offset,
-                std::forward<Args>(args)...
-            );
-
-            new_last = nullptr;
-
-            new_last = sfl::dtl::uninitialized_move_if_noexcept_a
-            (
-                data_.ref_to_alloc(),
-                data_.first_,
-                data_.first_ + offset,
-                new_first
-            );
-
-            ++new_last;
-
-            new_last = sfl::dtl::uninitialized_move_if_noexcept_a
-            (
-                data_.ref_to_alloc(),
-                data_.first_ + offset,
-                data_.last_,
-                new_last
-            );
-        }
-        SFL_CATCH (...)
-        {
-            if (new_last == nullptr)
-            {
-                sfl::dtl::destroy_at_a
-                (
-                    data_.ref_to_alloc(),
-                    new_first + offset
-                );
-            }
-            else
-            {
-                sfl::dtl::destroy_a
-                (
-                    data_.ref_to_alloc(),
-                    new_first,
-                    new_last
-                );
-            }
-
-            sfl::dtl::deallocate
-            (
-                data_.ref_to_alloc(),
-                new_first,
-                new_size
-            );
-
-            SFL_RETHROW;
-        }
-
-        sfl::dtl::destroy_a
-        (
-            data_.ref_to_alloc(),
-            data_.first_,
-            data_.last_
-        );
-
-        sfl::dtl::deallocate
+        return emplace_aux
         (
-            data_.ref_to_alloc(),
-            data_.first_,
-            data_.last_ - data_.first_
+            offset,
+            new_size,
+            sfl::dtl::is_reallocatable_a<allocator_type>(),
+            std::forward<Args>(args)...
         );
-
-        data_.first_ = new_first;
-        data_.last_  = new_last;
-
-        return begin() + offset;
     }
 
     iterator insert(const_iterator pos, const T& value)
@@ -753,6 +675,18 @@ public:
             sfl::dtl::throw_length_error("sfl::compact_vector::resize");
         }
 
+        if (n > size() && reallocate_storage(n, std::is_nothrow_default_constructible<value_type>()))
+        {
+            data_.last_ = sfl::dtl::uninitialized_default_construct_n_a
+            (
+                data_.ref_to_alloc(),
+                data_.last_,
+                n - size()
+            );
+
+            return;
+        }
+
         pointer new_first = sfl::dtl::allocate(data_.ref_to_alloc(), n);
         pointer new_last  = new_first;
 
@@ -835,6 +769,22 @@ public:
             sfl::dtl::throw_length_error("sfl::compact_vector::resize");
         }
 
+        // `value` can be a reference to an element in this container,
+        // which would be invalidated by `reallocate_storage`.
+        if (n > size() && !is_element(value) &&
+            reallocate_storage(n, std::is_nothrow_copy_constructible<value_type>()))
+        {
+            data_.last_ = sfl::dtl::uninitialized_fill_n_a
+            (
+                data_.ref_to_alloc(),
+                data_.last_,
+                n - size(),
+                value
+            );
+
+            return;
+        }
+
         pointer new_first = sfl::dtl::allocate(data_.ref_to_alloc(), n);
         pointer new_last  = new_first;
 
@@ -937,6 +887,194 @@ public:
 
 private:
 
+    template <typename... Args>
+    iterator emplace_aux(difference_type offset, size_type new_size, std::false_type, Args&&... args)
+    {
+        pointer new_first = sfl::dtl::allocate(data_.ref_to_alloc(), new_size);
+        pointer new_last  = new_first;
+
+        SFL_TRY
+        {
+            // The order of operations is critical. First we will construct
+            // new element in new storage because arguments `args...` can
+            // contain reference to element in this container and after
+            // that we will move elements from old to new storage.
+
+            sfl::dtl::construct_at_a
+            (
+                data_.ref_to_alloc(),
+                new_first + offset,
+                std::forward<Args>(args)...
+            );
+
+            new_last = nullptr;
+
+            new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+            (
+                data_.ref_to_alloc(),
+                data_.first_,
+                data_.first_ + offset,
+                new_first
+            );
+
+            ++new_last;
+
+            new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+            (
+                data_.ref_to_alloc(),
+                data_.first_ + offset,
+                data_.last_,
+                new_last
+            );
+        }
+        SFL_CATCH (...)
+        {
+            if (new_last == nullptr)
+            {
+                sfl::dtl::destroy_at_a
+                (
+                    data_.ref_to_alloc(),
+                    new_first + offset
+                );
+            }
+            else
+            {
+                sfl::dtl::destroy_a
+                (
+                    data_.ref_to_alloc(),
+                    new_first,
+                    new_last
+                );
+            }
+
+            sfl::dtl::deallocate
+            (
+                data_.ref_to_alloc(),
+                new_first,
+                new_size
+            );
+
+            SFL_RETHROW;
+        }
+
+        sfl::dtl::destroy_a
+        (
+            data_.ref_to_alloc(),
+            data_.first_,
+            data_.last_
+        );
+
+        sfl::dtl::deallocate
+        (
+            data_.ref_to_alloc(),
+            data_.first_,
+            data_.last_ - data_.first_
+        );
+
+        data_.first_ = new_first;
+        data_.last_  = new_last;
+
+        return begin() + offset;
+    }
+
+    template <typename... Args>
+    iterator emplace_aux(difference_type offset, size_type new_size, std::true_type, Args&&... args)
+    {
+        // `args...` can contain reference to element in this container, so
+        // we will construct new element in temporary storage first, then
+        // reallocate storage, and then relocate new element into place.
+
+        alignas(value_type) unsigned char buffer[sizeof(value_type)];
+
+        const pointer tmp = reinterpret_cast<pointer>(buffer);
+
+        sfl::dtl::construct_at_a
+        (
+            data_.ref_to_alloc(),
+            tmp,
+            std::forward<Args>(args)...
+        );
+
+        SFL_TRY
+        {
+            reallocate_storage(new_size, std::true_type());
+        }
+        SFL_CATCH (...)
+        {
+            sfl::dtl::destroy_at_a
+            (
+                data_.ref_to_alloc(),
+                tmp
+            );
+
+            SFL_RETHROW;
+        }
+
+        const pointer p = data_.first_ + offset;
+
+        data_.last_ = sfl::dtl::relocate_bytes(p, data_.last_, p + 1);
+
+        sfl::dtl::relocate_bytes(tmp, tmp + 1, p);
+
+        return iterator(p);
+    }
+
+    // Changes the size of storage to `new_size` using member function
+    // `reallocate` of the allocator (e.g. `realloc`), which does not need
+    // to copy elements. After that only the first `size()` elements are
+    // constructed and the caller must construct the rest without throwing.
+    // Returns false and does nothing if elements are not trivially
+    // relocatable, if the allocator does not have `reallocate`, or if
+    // `NothrowConstruct` is false.
+    template <typename NothrowConstruct>
+    bool reallocate_storage(size_type new_size, NothrowConstruct)
+    {
+        return reallocate_storage_aux
+        (
+            new_size,
+            std::integral_constant
+            <
+                bool,
+                NothrowConstruct::value &&
+                sfl::dtl::is_reallocatable_a<allocator_type>::value
+            >()
+        );
+    }
+
+    bool reallocate_storage_aux(size_type /*new_size*/, std::false_type)
+    {
+        return false;
+    }
+
+    bool reallocate_storage_aux(size_type new_size, std::true_type)
+    {
+        const size_type size = this->size();
+
+        const pointer new_first = sfl::dtl::reallocate
+        (
+            data_.ref_to_alloc(),
+            data_.first_,
+            size,
+            new_size
+        );
+
+        data_.first_ = new_first;
+        data_.last_  = new_first + size;
+
+        return true;
+    }
+
+    // Checks if `x` refers to an element of this container.
+    bool is_element(const value_type& x) const noexcept
+    {
+        const std::less<const value_type*> less;
+
+        const value_type* p = std::addressof(x);
+
+        return !less(p, sfl::dtl::to_address(data_.first_)) &&
+               less(p, sfl::dtl::to_address(data_.last_));
+    }
+
     void initialize_default_n(size_type n)
     {
         if (n > max_size())
@@ -1342,6 +1480,28 @@ private:
                 );
             }
 
+            // `value` can be a reference to an element in this container,
+            // which would be invalidated by `reallocate_storage`.
+            if (!is_element(value) &&
+                reallocate_storage(new_size, std::is_nothrow_copy_constructible<value_type>()))
+            {
+                const pointer p = data_.first_ + offset;
+
+                sfl::dtl::relocate_bytes(p, data_.last_, p + n);
+
+                sfl::dtl::uninitialized_fill_n_a
+                (
+                    data_.ref_to_alloc(),
+                    p,
+                    n,
+                    value
+                );
+
+                data_.last_ += n;
+
+                return begin() + offset;
+            }
+
             pointer new_first = sfl::dtl::allocate(data_.ref_to_alloc(), new_size);
             pointer new_last  = new_first;
 
@@ -41,7 +41,9 @@ void test_devector();
 namespace sfl
 {
 
-template <typename T, typename Allocator = std::allocator<T>>
+template < typename T,
+           typename Allocator = std::allocator<T>,
+           typename GrowthPolicy = sfl::geometric_growth<> >
 class devector
 {
     #ifdef SFL_TEST_DEVECTOR
@@ -53,6 +55,7 @@ public:
 
     using allocator_type         = Allocator;
     using allocator_traits       = std::allocator_traits<Allocator>;
+    using growth_policy          = GrowthPolicy;
     using value_type             = T;
     using size_type              = typename allocator_traits::size_type;
     using difference_type        = typename allocator_traits::difference_type;
@@ -433,16 +436,21 @@ public:
 
         if (new_capacity > size + available_front)
         {
-            const size_type n = available_back + new_capacity;
+            size_type n = available_back + GrowthPolicy::round
+            (
+                new_capacity,
+                max_size - available_back,
+                sizeof(value_type)
+            );
 
-            pointer new_bos   = sfl::dtl::allocate(data_.ref_to_alloc(), n);
+            pointer new_bos   = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), n);
             pointer new_eos   = new_bos + n;
             pointer new_first = new_eos - std::distance(data_.first_, data_.eos_);
             pointer new_last  = new_first;
 
             SFL_TRY
             {
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -462,7 +470,7 @@ public:
                 SFL_RETHROW;
             }
 
-            sfl::dtl::destroy_a
+            sfl::dtl::destroy_relocated_a
             (
                 data_.ref_to_alloc(),
                 data_.first_,
@@ -498,16 +506,21 @@ public:
 
         if (new_capacity > size + available_back)
         {
-            const size_type n = available_front + new_capacity;
+            size_type n = available_front + GrowthPolicy::round
+            (
+                new_capacity,
+                max_size - available_front,
+                sizeof(value_type)
+            );
 
-            pointer new_bos   = sfl::dtl::allocate(data_.ref_to_alloc(), n);
+            pointer new_bos   = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), n);
             pointer new_eos   = new_bos + n;
             pointer new_first = new_bos + std::distance(data_.bos_, data_.first_);
             pointer new_last  = new_first;
 
             SFL_TRY
             {
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -527,7 +540,7 @@ public:
                 SFL_RETHROW;
             }
 
-            sfl::dtl::destroy_a
+            sfl::dtl::destroy_relocated_a
             (
                 data_.ref_to_alloc(),
                 data_.first_,
@@ -561,7 +574,7 @@ public:
 
             SFL_TRY
             {
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -581,7 +594,7 @@ public:
                 SFL_RETHROW;
             }
 
-            sfl::dtl::destroy_a
+            sfl::dtl::destroy_relocated_a
             (
                 data_.ref_to_alloc(),
                 data_.first_,
@@ -815,19 +828,13 @@ public:
 
         if (dist_to_begin < dist_to_end)
         {
-            const pointer old_first = data_.first_;
-
-            data_.first_ = sfl::dtl::move_backward(data_.first_, p1, p2);
-
-            sfl::dtl::destroy_at_a(data_.ref_to_alloc(), old_first);
+            data_.first_ = sfl::dtl::erase_shift_right_a(data_.ref_to_alloc(), data_.first_, p1, p2);
 
             return iterator(p2);
         }
         else
         {
-            data_.last_ = sfl::dtl::move(p2, data_.last_, p1);
-
-            sfl::dtl::destroy_at_a(data_.ref_to_alloc(), data_.last_);
+            data_.last_ = sfl::dtl::erase_shift_left_a(data_.ref_to_alloc(), p1, p2, data_.last_);
 
             return iterator(p1);
         }
@@ -850,11 +857,7 @@ public:
             const pointer p1 = data_.first_ + std::distance(cbegin(), first);
             const pointer p2 = data_.first_ + std::distance(cbegin(), last);
 
-            const pointer new_first = sfl::dtl::move_backward(data_.first_, p1, p2);
-
-            sfl::dtl::destroy_a(data_.ref_to_alloc(), data_.first_, new_first);
-
-            data_.first_ = new_first;
+            data_.first_ = sfl::dtl::erase_shift_right_a(data_.ref_to_alloc(), data_.first_, p1, p2);
 
             return iterator(p2);
         }
@@ -863,11 +866,7 @@ public:
             const pointer p1 = data_.first_ + std::distance(cbegin(), first);
             const pointer p2 = data_.first_ + std::distance(cbegin(), last);
 
-            const pointer new_last = sfl::dtl::move(p2, data_.last_, p1);
-
-            sfl::dtl::destroy_a(data_.ref_to_alloc(), new_last, data_.last_);
-
-            data_.last_ = new_last;
+            data_.last_ = sfl::dtl::erase_shift_left_a(data_.ref_to_alloc(), p1, p2, data_.last_);
 
             return iterator(p1);
         }
@@ -1349,18 +1348,28 @@ private:
         const size_type capacity_front  = std::distance(data_.bos_, data_.last_);
         const size_type available_front = std::distance(data_.bos_, data_.first_);
 
-        if (num_additional_elements >= available_front)
-        {
-            return std::max
-            (
-                num_additional_elements - available_front,
-                capacity_front / 2
-            );
-        }
-        else
+        const size_type min_capacity_front = capacity_front +
+            (num_additional_elements >= available_front ? num_additional_elements - available_front : 0);
+
+        const size_type max_capacity_front = max_size() - (capacity() - capacity_front);
+
+        if (min_capacity_front > max_capacity_front)
         {
-            return capacity_front / 2;
+            // Caller throws length_error.
+            return min_capacity_front - capacity_front;
         }
+
+        const size_type new_capacity_front = GrowthPolicy::grow
+        (
+            capacity_front,
+            min_capacity_front,
+            max_capacity_front,
+            sizeof(value_type)
+        );
+
+        SFL_ASSERT(min_capacity_front <= new_capacity_front && new_capacity_front <= max_capacity_front);
+
+        return new_capacity_front - capacity_front;
     }
 
     size_type calculate_additional_capacity_for_grow_storage_back(size_type num_additional_elements)
@@ -1368,18 +1377,28 @@ private:
         const size_type capacity_back  = std::distance(data_.first_, data_.eos_);
         const size_type available_back = std::distance(data_.last_,  data_.eos_);
 
-        if (num_additional_elements >= available_back)
-        {
-            return std::max
-            (
-                num_additional_elements - available_back,
-                capacity_back / 2
-            );
-        }
-        else
+        const size_type min_capacity_back = capacity_back +
+            (num_additional_elements >= available_back ? num_additional_elements - available_back : 0);
+
+        const size_type max_capacity_back = max_size() - (capacity() - capacity_back);
+
+        if (min_capacity_back > max_capacity_back)
         {
-            return capacity_back / 2;
+            // Caller throws length_error.
+            return min_capacity_back - capacity_back;
         }
+
+        const size_type new_capacity_back = GrowthPolicy::grow
+        (
+            capacity_back,
+            min_capacity_back,
+            max_capacity_back,
+            sizeof(value_type)
+        );
+
+        SFL_ASSERT(min_capacity_back <= new_capacity_back && new_capacity_back <= max_capacity_back);
+
+        return new_capacity_back - capacity_back;
     }
 
     void reset(size_type new_cap = 0)
@@ -1425,16 +1444,16 @@ private:
             sfl::dtl::throw_length_error("sfl::devector::grow_storage_front");
         }
 
-        const size_type n = capacity + additional_capacity;
+        size_type n = capacity + additional_capacity;
 
-        pointer new_bos   = sfl::dtl::allocate(data_.ref_to_alloc(), n);
+        pointer new_bos   = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), n);
         pointer new_eos   = new_bos + n;
         pointer new_first = new_eos - std::distance(data_.first_, data_.eos_);
         pointer new_last  = new_first;
 
         SFL_TRY
         {
-            new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+            new_last = sfl::dtl::uninitialized_relocate_a
             (
                 data_.ref_to_alloc(),
                 data_.first_,
@@ -1454,7 +1473,7 @@ private:
             SFL_RETHROW;
         }
 
-        sfl::dtl::destroy_a
+        sfl::dtl::destroy_relocated_a
         (
             data_.ref_to_alloc(),
             data_.first_,
@@ -1484,16 +1503,16 @@ private:
             sfl::dtl::throw_length_error("sfl::devector::grow_storage_back");
         }
 
-        const size_type n = capacity + additional_capacity;
+        size_type n = capacity + additional_capacity;
 
-        pointer new_bos   = sfl::dtl::allocate(data_.ref_to_alloc(), n);
+        pointer new_bos   = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), n);
         pointer new_eos   = new_bos + n;
         pointer new_first = new_bos + std::distance(data_.bos_, data_.first_);
         pointer new_last  = new_first;
 
         SFL_TRY
         {
-            new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+            new_last = sfl::dtl::uninitialized_relocate_a
             (
                 data_.ref_to_alloc(),
                 data_.first_,
@@ -1513,7 +1532,7 @@ private:
             SFL_RETHROW;
         }
 
-        sfl::dtl::destroy_a
+        sfl::dtl::destroy_relocated_a
         (
             data_.ref_to_alloc(),
             data_.first_,
@@ -3875,9 +3894,9 @@ private:
 
         const size_type offset = std::distance(cbegin(), insert_pos);
 
-        const size_type new_cap = capacity() + additional_capacity;
+        size_type new_cap = capacity() + additional_capacity;
 
-        pointer new_bos   = sfl::dtl::allocate(data_.ref_to_alloc(), new_cap);
+        pointer new_bos   = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), new_cap);
         pointer new_eos   = new_bos + new_cap;
         pointer new_first = new_eos - std::distance(data_.last_, data_.eos_) - size() - insert_size;
         pointer new_last  = new_first;
@@ -3886,22 +3905,29 @@ private:
 
         SFL_TRY
         {
-            new_last = sfl::dtl::uninitialized_move_a
+            // New elements are created first so that existing elements
+            // can be relocated after that without further exceptions.
+
+            proxy.uninitialized_insert_n
             (
                 data_.ref_to_alloc(),
-                data_.first_,
-                data_.first_ + offset,
-                new_first
+                p,
+                insert_size
             );
 
-            new_last = proxy.uninitialized_insert_n
+            new_last = nullptr;
+
+            new_last = sfl::dtl::uninitialized_relocate_a
             (
                 data_.ref_to_alloc(),
-                new_last,
-                insert_size
+                data_.first_,
+                data_.first_ + offset,
+                new_first
             );
 
-            new_last = sfl::dtl::uninitialized_move_a
+            new_last += insert_size;
+
+            new_last = sfl::dtl::uninitialized_relocate_a
             (
                 data_.ref_to_alloc(),
                 data_.first_ + offset,
@@ -3911,12 +3937,24 @@ private:
         }
         SFL_CATCH (...)
         {
-            sfl::dtl::destroy_a
-            (
-                data_.ref_to_alloc(),
-                new_first,
-                new_last
-            );
+            if (new_last == nullptr)
+            {
+                sfl::dtl::destroy_n_a
+                (
+                    data_.ref_to_alloc(),
+                    p,
+                    insert_size
+                );
+            }
+            else
+            {
+                sfl::dtl::destroy_a
+                (
+                    data_.ref_to_alloc(),
+                    new_first,
+                    new_last
+                );
+            }
 
             sfl::dtl::deallocate
             (
@@ -3928,7 +3966,7 @@ private:
             SFL_RETHROW;
         }
 
-        sfl::dtl::destroy_a
+        sfl::dtl::destroy_relocated_a
         (
             data_.ref_to_alloc(),
             data_.first_,
@@ -3970,9 +4008,9 @@ private:
 
         const size_type offset = std::distance(cbegin(), insert_pos);
 
-        const size_type new_cap = capacity() + additional_capacity;
+        size_type new_cap = capacity() + additional_capacity;
 
-        pointer new_bos   = sfl::dtl::allocate(data_.ref_to_alloc(), new_cap);
+        pointer new_bos   = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), new_cap);
         pointer new_eos   = new_bos + new_cap;
         pointer new_first = new_bos + std::distance(data_.bos_, data_.first_);
         pointer new_last  = new_first;
@@ -3981,22 +4019,29 @@ private:
 
         SFL_TRY
         {
-            new_last = sfl::dtl::uninitialized_move_a
+            // New elements are created first so that existing elements
+            // can be relocated after that without further exceptions.
+
+            proxy.uninitialized_insert_n
             (
                 data_.ref_to_alloc(),
-                data_.first_,
-                data_.first_ + offset,
-                new_first
+                p,
+                insert_size
             );
 
-            new_last = proxy.uninitialized_insert_n
+            new_last = nullptr;
+
+            new_last = sfl::dtl::uninitialized_relocate_a
             (
                 data_.ref_to_alloc(),
-                new_last,
-                insert_size
+                data_.first_,
+                data_.first_ + offset,
+                new_first
             );
 
-            new_last = sfl::dtl::uninitialized_move_a
+            new_last += insert_size;
+
+            new_last = sfl::dtl::uninitialized_relocate_a
             (
                 data_.ref_to_alloc(),
                 data_.first_ + offset,
@@ -4006,12 +4051,24 @@ private:
         }
         SFL_CATCH (...)
         {
-            sfl::dtl::destroy_a
-            (
-                data_.ref_to_alloc(),
-                new_first,
-                new_last
-            );
+            if (new_last == nullptr)
+            {
+                sfl::dtl::destroy_n_a
+                (
+                    data_.ref_to_alloc(),
+                    p,
+                    insert_size
+                );
+            }
+            else
+            {
+                sfl::dtl::destroy_a
+                (
+                    data_.ref_to_alloc(),
+                    new_first,
+                    new_last
+                );
+            }
 
             sfl::dtl::deallocate
             (
@@ -4023,7 +4080,7 @@ private:
             SFL_RETHROW;
         }
 
-        sfl::dtl::destroy_a
+        sfl::dtl::destroy_relocated_a
         (
             data_.ref_to_alloc(),
             data_.first_,
@@ -4083,85 +4140,85 @@ private:
 // ---- NON-MEMBER FUNCTIONS --------------------------------------------------
 //
 
-template <typename T, typename A>
+template <typename T, typename A, typename G>
 SFL_NODISCARD
 bool operator==
 (
-    const devector<T, A>& x,
-    const devector<T, A>& y
+    const devector<T, A, G>& x,
+    const devector<T, A, G>& y
 )
 {
     return x.size() == y.size() && std::equal(x.begin(), x.end(), y.begin());
 }
 
-template <typename T, typename A>
+template <typename T, typename A, typename G>
 SFL_NODISCARD
 bool operator!=
 (
-    const devector<T, A>& x,
-    const devector<T, A>& y
+    const devector<T, A, G>& x,
+    const devector<T, A, G>& y
 )
 {
     return !(x == y);
 }
 
-template <typename T, typename A>
+template <typename T, typename A, typename G>
 SFL_NODISCARD
 bool operator<
 (
-    const devector<T, A>& x,
-    const devector<T, A>& y
+    const devector<T, A, G>& x,
+    const devector<T, A, G>& y
 )
 {
     return std::lexicographical_compare(x.begin(), x.end(), y.begin(), y.end());
 }
 
-template <typename T, typename A>
+template <typename T, typename A, typename G>
 SFL_NODISCARD
 bool operator>
 (
-    const devector<T, A>& x,
-    const devector<T, A>& y
+    const devector<T, A, G>& x,
+    const devector<T, A, G>& y
 )
 {
     return y < x;
 }
 
-template <typename T, typename A>
+template <typename T, typename A, typename G>
 SFL_NODISCARD
 bool operator<=
 (
-    const devector<T, A>& x,
-    const devector<T, A>& y
+    const devector<T, A, G>& x,
+    const devector<T, A, G>& y
 )
 {
     return !(y < x);
 }
 
-template <typename T, typename A>
+template <typename T, typename A, typename G>
 SFL_NODISCARD
 bool operator>=
 (
-    const devector<T, A>& x,
-    const devector<T, A>& y
+    const devector<T, A, G>& x,
+    const devector<T, A, G>& y
 )
 {
     return !(x < y);
 }
 
-template <typename T, typename A>
+template <typename T, typename A, typename G>
 void swap
 (
-    devector<T, A>& x,
-    devector<T, A>& y
+    devector<T, A, G>& x,
+    devector<T, A, G>& y
 )
 {
     x.swap(y);
 }
 
-template <typename T, typename A, typename U>
-typename devector<T, A>::size_type
-    erase(devector<T, A>& c, const U& value)
+template <typename T, typename A, typename G, typename U>
+typename devector<T, A, G>::size_type
+    erase(devector<T, A, G>& c, const U& value)
 {
     auto it = std::remove(c.begin(), c.end(), value);
     auto r = std::distance(it, c.end());
@@ -4169,9 +4226,9 @@ typename devector<T, A>::size_type
     return r;
 }
 
-template <typename T, typename A, typename Predicate>
-typename devector<T, A>::size_type
-    erase_if(devector<T, A>& c, Predicate pred)
+template <typename T, typename A, typename G, typename Predicate>
+typename devector<T, A, G>::size_type
+    erase_if(devector<T, A, G>& c, Predicate pred)
 {
     auto it = std::remove_if(c.begin(), c.end(), pred);
     auto r = std::distance(it, c.end());
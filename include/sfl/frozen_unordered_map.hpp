@@ -0,0 +1,993 @@
+//
+// Copyright (c) 2022 Slaven Falandys
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+//
+
+#ifndef SFL_FROZEN_UNORDERED_MAP_HPP_INCLUDED
+#define SFL_FROZEN_UNORDERED_MAP_HPP_INCLUDED
+
+#include "private.hpp"
+
+#include <algorithm>        // is_permutation
+#include <cstddef>          // size_t
+#include <functional>       // equal_to, hash
+#include <initializer_list> // initializer_list
+#include <iterator>         // distance, make_move_iterator
+#include <type_traits>      // is_integral, is_enum, is_nothrow_xxxxx
+#include <utility>          // forward, move, pair
+
+#ifdef SFL_TEST_FROZEN_UNORDERED_MAP
+void test_frozen_unordered_map();
+#endif
+
+namespace sfl
+{
+
+//
+// Default hash function of `frozen_unordered_map`. It is `constexpr` for
+// integral and enumeration types and for string-like types (types with
+// member functions `data()` and `size()` where `data()` returns pointer to
+// characters, e.g. `std::string_view`), so maps with such keys can be built
+// in constant expressions. All other types are hashed by `std::hash`.
+//
+template <typename Key, typename = void>
+struct frozen_hash
+{
+    std::size_t operator()(const Key& key) const
+    {
+        return std::hash<Key>()(key);
+    }
+};
+
+template <typename Key>
+struct frozen_hash
+<
+    Key,
+    sfl::dtl::enable_if_t<std::is_integral<Key>::value || std::is_enum<Key>::value>
+>
+{
+    constexpr std::size_t operator()(const Key& key) const noexcept
+    {
+        return static_cast<std::size_t>(key);
+    }
+};
+
+template <typename Key>
+struct frozen_hash
+<
+    Key,
+    sfl::dtl::enable_if_t<sfl::dtl::is_string_like<Key>::value>
+>
+{
+    SFL_CONSTEXPR_14
+    std::size_t operator()(const Key& key) const noexcept
+    {
+        return static_cast<std::size_t>(sfl::dtl::hash_chars(key.data(), key.size()));
+    }
+};
+
+template < typename Key,
+           typename T,
+           std::size_t N,
+           typename Hash = sfl::frozen_hash<Key>,
+           typename KeyEqual = std::equal_to<Key> >
+class frozen_unordered_map
+{
+    #ifdef SFL_TEST_FROZEN_UNORDERED_MAP
+    friend void ::test_frozen_unordered_map();
+    #endif
+
+    static_assert(N > 0, "N must be greater than zero.");
+
+public:
+
+    using key_type         = Key;
+    using mapped_type      = T;
+    using value_type       = std::pair<Key, T>;
+    using size_type        = std::size_t;
+    using difference_type  = std::ptrdiff_t;
+    using hasher           = Hash;
+    using key_equal        = KeyEqual;
+    using reference        = value_type&;
+    using const_reference  = const value_type&;
+    using pointer          = value_type*;
+    using const_pointer    = const value_type*;
+    using iterator         = sfl::dtl::normal_iterator<pointer, frozen_unordered_map>;
+    using const_iterator   = sfl::dtl::normal_iterator<const_pointer, frozen_unordered_map>;
+
+public:
+
+    static constexpr size_type static_capacity = N;
+
+private:
+
+    //
+    // Keys are hashed into `N` slots by a minimal perfect hash function built
+    // by the "hash and displace" method (CHD, PTHash). Keys are first split
+    // into buckets of about `keys_per_bucket` keys. Then, starting with the
+    // largest bucket, each bucket gets a small number (pilot) such that the
+    // positions of all its keys, computed from the hash and the pilot, are
+    // empty slots. Lookup computes bucket and position of the key and makes
+    // one comparison with the element stored in that slot.
+    //
+    static constexpr size_type keys_per_bucket = 4;
+
+    static constexpr size_type num_buckets = N / keys_per_bucket + 1;
+
+    // Search for pilot of a bucket gives up after this many attempts and
+    // restarts with another seed.
+    static constexpr size_type max_pilot = 16 * N + 64;
+
+    // Number of seeds tried before the map falls back to linear search.
+    static constexpr size_type max_seeds = 8;
+
+    using index_type = sfl::dtl::uint_for_t<N>;
+
+    using pilot_type = sfl::dtl::uint_for_t<max_pilot>;
+
+    // Like `key_equal` but with additional operators.
+    // For internal use only.
+    class ultra_equal : public key_equal
+    {
+    public:
+
+        SFL_CONSTEXPR_20
+        ultra_equal() noexcept(std::is_nothrow_default_constructible<key_equal>::value)
+        {}
+
+        SFL_CONSTEXPR_20
+        ultra_equal(const key_equal& e) noexcept(std::is_nothrow_copy_constructible<key_equal>::value)
+            : key_equal(e)
+        {}
+
+        SFL_CONSTEXPR_20
+        ultra_equal(key_equal&& e) noexcept(std::is_nothrow_move_constructible<key_equal>::value)
+            : key_equal(std::move(e))
+        {}
+
+        template <typename K>
+        SFL_CONSTEXPR_20
+        bool operator()(const value_type& x, const K& y) const
+        {
+            return key_equal::operator()(x.first, y);
+        }
+    };
+
+    // Wrapper around `hasher`. It keeps `hasher` and `key_equal` apart as
+    // base classes of `data`.
+    // For internal use only.
+    class ultra_hash : public hasher
+    {
+    public:
+
+        SFL_CONSTEXPR_20
+        ultra_hash() noexcept(std::is_nothrow_default_constructible<hasher>::value)
+        {}
+
+        SFL_CONSTEXPR_20
+        ultra_hash(const hasher& h) noexcept(std::is_nothrow_copy_constructible<hasher>::value)
+            : hasher(h)
+        {}
+
+        SFL_CONSTEXPR_20
+        ultra_hash(hasher&& h) noexcept(std::is_nothrow_move_constructible<hasher>::value)
+            : hasher(std::move(h))
+        {}
+    };
+
+    class data_base
+    {
+    public:
+
+        union
+        {
+            value_type first_[N];
+        };
+
+        pointer last_;
+
+        // Index of the element stored in each slot, or `N` if slot is empty.
+        index_type slots_[N];
+
+        pilot_type pilots_[num_buckets];
+
+        unsigned long long seed_;
+
+        // False if perfect hash function could not be built.
+        bool perfect_;
+
+        SFL_CONSTEXPR_20
+        data_base() noexcept
+            : last_(first_)
+            , slots_()
+            , pilots_()
+            , seed_(0)
+            , perfect_(false)
+        {
+            sfl::dtl::initialize_static_storage(first_, N);
+        }
+
+        #if defined(__clang__) && (__clang_major__ == 3) // For CentOS 7
+        SFL_CONSTEXPR_20
+        ~data_base()
+        {}
+        #else
+        SFL_CONSTEXPR_20
+        ~data_base() noexcept
+        {}
+        #endif
+    };
+
+    class data : public data_base, public ultra_hash, public ultra_equal
+    {
+    public:
+
+        SFL_CONSTEXPR_20
+        data() noexcept
+        (
+            std::is_nothrow_default_constructible<ultra_hash>::value &&
+            std::is_nothrow_default_constructible<ultra_equal>::value
+        )
+            : ultra_hash()
+            , ultra_equal()
+        {}
+
+        SFL_CONSTEXPR_20
+        data(const ultra_hash& hash, const ultra_equal& equal) noexcept
+        (
+            std::is_nothrow_copy_constructible<ultra_hash>::value &&
+            std::is_nothrow_copy_constructible<ultra_equal>::value
+        )
+            : ultra_hash(hash)
+            , ultra_equal(equal)
+        {}
+
+        SFL_CONSTEXPR_20
+        ultra_hash& ref_to_hash() noexcept
+        {
+            return *this;
+        }
+
+        SFL_CONSTEXPR_20
+        const ultra_hash& ref_to_hash() const noexcept
+        {
+            return *this;
+        }
+
+        SFL_CONSTEXPR_20
+        ultra_equal& ref_to_equal() noexcept
+        {
+            return *this;
+        }
+
+        SFL_CONSTEXPR_20
+        const ultra_equal& ref_to_equal() const noexcept
+        {
+            return *this;
+        }
+    };
+
+    data data_;
+
+    // Checks if heterogeneous lookup with key of type `K` is enabled.
+    // Both `Hash` and `KeyEqual` must have member `is_transparent`.
+    template <typename K>
+    using is_transparent_for = std::integral_constant
+    <
+        bool,
+        sfl::dtl::has_is_transparent<Hash, K>::value &&
+        sfl::dtl::has_is_transparent<KeyEqual, K>::value
+    >;
+
+public:
+
+    //
+    // ---- CONSTRUCTION AND DESTRUCTION --------------------------------------
+    //
+
+    SFL_CONSTEXPR_20
+    frozen_unordered_map() noexcept
+    (
+        std::is_nothrow_default_constructible<Hash>::value &&
+        std::is_nothrow_default_constructible<KeyEqual>::value
+    )
+        : data_()
+    {
+        build();
+    }
+
+    SFL_CONSTEXPR_20
+    explicit frozen_unordered_map(const Hash& hash, const KeyEqual& equal = KeyEqual())
+        : data_(hash, equal)
+    {
+        build();
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    SFL_CONSTEXPR_20
+    frozen_unordered_map(InputIt first, InputIt last)
+        : data_()
+    {
+        initialize_range(first, last);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    SFL_CONSTEXPR_20
+    frozen_unordered_map(InputIt first, InputIt last, const Hash& hash, const KeyEqual& equal = KeyEqual())
+        : data_(hash, equal)
+    {
+        initialize_range(first, last);
+    }
+
+    SFL_CONSTEXPR_20
+    frozen_unordered_map(std::initializer_list<value_type> ilist)
+        : frozen_unordered_map(ilist.begin(), ilist.end())
+    {}
+
+    SFL_CONSTEXPR_20
+    frozen_unordered_map(std::initializer_list<value_type> ilist, const Hash& hash, const KeyEqual& equal = KeyEqual())
+        : frozen_unordered_map(ilist.begin(), ilist.end(), hash, equal)
+    {}
+
+    SFL_CONSTEXPR_20
+    frozen_unordered_map(const frozen_unordered_map& other)
+        : data_(other.data_.ref_to_hash(), other.data_.ref_to_equal())
+    {
+        data_.last_ = sfl::dtl::uninitialized_copy
+        (
+            pointer(other.data_.first_),
+            pointer(other.data_.last_),
+            data_.first_
+        );
+
+        copy_table(other);
+    }
+
+    SFL_CONSTEXPR_20
+    frozen_unordered_map(frozen_unordered_map&& other)
+        : data_(other.data_.ref_to_hash(), other.data_.ref_to_equal())
+    {
+        data_.last_ = sfl::dtl::uninitialized_move
+        (
+            std::make_move_iterator(pointer(other.data_.first_)),
+            std::make_move_iterator(pointer(other.data_.last_)),
+            data_.first_
+        );
+
+        copy_table(other);
+    }
+
+    SFL_CONSTEXPR_20
+    ~frozen_unordered_map()
+    {
+        sfl::dtl::destroy(data_.first_, data_.last_);
+    }
+
+    //
+    // ---- ASSIGNMENT --------------------------------------------------------
+    //
+
+    SFL_CONSTEXPR_20
+    frozen_unordered_map& operator=(const frozen_unordered_map& other)
+    {
+        if (this != &other)
+        {
+            data_.ref_to_hash() = other.data_.ref_to_hash();
+            data_.ref_to_equal() = other.data_.ref_to_equal();
+
+            assign_range
+            (
+                pointer(other.data_.first_),
+                pointer(other.data_.last_)
+            );
+
+            copy_table(other);
+        }
+
+        return *this;
+    }
+
+    SFL_CONSTEXPR_20
+    frozen_unordered_map& operator=(frozen_unordered_map&& other)
+    {
+        data_.ref_to_hash() = other.data_.ref_to_hash();
+        data_.ref_to_equal() = other.data_.ref_to_equal();
+
+        assign_range
+        (
+            std::make_move_iterator(pointer(other.data_.first_)),
+            std::make_move_iterator(pointer(other.data_.last_))
+        );
+
+        copy_table(other);
+
+        return *this;
+    }
+
+    //
+    // ---- HASH POLICY -------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    SFL_CONSTEXPR_20
+    hasher hash_function() const
+    {
+        return data_.ref_to_hash();
+    }
+
+    SFL_NODISCARD
+    SFL_CONSTEXPR_20
+    key_equal key_eq() const
+    {
+        return data_.ref_to_equal();
+    }
+
+    // Returns true if lookup uses perfect hash function. It is false if
+    // `Hash` returns the same value for two different keys, or if pilot
+    // search failed for all `max_seeds` seeds (unlikely unless `Hash`
+    // distributes keys poorly). Lookup is linear search in both cases.
+    SFL_NODISCARD
+    SFL_CONSTEXPR_20
+    bool perfect() const noexcept
+    {
+        return data_.perfect_;
+    }
+
+    //
+    // ---- ITERATORS ---------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    SFL_CONSTEXPR_20
+    iterator begin() noexcept
+    {
+        return iterator(data_.first_);
+    }
+
+    SFL_NODISCARD
+    SFL_CONSTEXPR_20
+    const_iterator begin() const noexcept
+    {
+        return const_iterator(data_.first_);
+    }
+
+    SFL_NODISCARD
+    SFL_CONSTEXPR_20
+    const_iterator cbegin() const noexcept
+    {
+        return const_iterator(data_.first_);
+    }
+
+    SFL_NODISCARD
+    SFL_CONSTEXPR_20
+    iterator end() noexcept
+    {
+        return iterator(data_.last_);
+    }
+
+    SFL_NODISCARD
+    SFL_CONSTEXPR_20
+    const_iterator end() const noexcept
+    {
+        return const_iterator(data_.last_);
+    }
+
+    SFL_NODISCARD
+    SFL_CONSTEXPR_20
+    const_iterator cend() const noexcept
+    {
+        return const_iterator(data_.last_);
+    }
+
+    SFL_NODISCARD
+    SFL_CONSTEXPR_20
+    iterator nth(size_type pos) noexcept
+    {
+        SFL_ASSERT(pos <= size());
+        return iterator(data_.first_ + pos);
+    }
+
+    SFL_NODISCARD
+    SFL_CONSTEXPR_20
+    const_iterator nth(size_type pos) const noexcept
+    {
+        SFL_ASSERT(pos <= size());
+        return const_iterator(data_.first_ + pos);
+    }
+
+    SFL_NODISCARD
+    SFL_CONSTEXPR_20
+    size_type index_of(const_iterator pos) const noexcept
+    {
+        SFL_ASSERT(cbegin() <= pos && pos <= cend());
+        return std::distance(cbegin(), pos);
+    }
+
+    //
+    // ---- SIZE AND CAPACITY -------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    SFL_CONSTEXPR_20
+    bool empty() const noexcept
+    {
+        return data_.first_ == data_.last_;
+    }
+
+    SFL_NODISCARD
+    SFL_CONSTEXPR_20
+    size_type size() const noexcept
+    {
+        return std::distance(begin(), end());
+    }
+
+    SFL_NODISCARD
+    static constexpr size_type max_size() noexcept
+    {
+        return N;
+    }
+
+    SFL_NODISCARD
+    static constexpr size_type capacity() noexcept
+    {
+        return N;
+    }
+
+    //
+    // ---- LOOKUP ------------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    SFL_CONSTEXPR_20
+    iterator find(const Key& key)
+    {
+        return nth(find_index(key));
+    }
+
+    SFL_NODISCARD
+    SFL_CONSTEXPR_20
+    const_iterator find(const Key& key) const
+    {
+        return nth(find_index(key));
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<is_transparent_for<K>::value>* = nullptr>
+    SFL_NODISCARD
+    SFL_CONSTEXPR_20
+    iterator find(const K& x)
+    {
+        return nth(find_index(x));
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<is_transparent_for<K>::value>* = nullptr>
+    SFL_NODISCARD
+    SFL_CONSTEXPR_20
+    const_iterator find(const K& x) const
+    {
+        return nth(find_index(x));
+    }
+
+    SFL_NODISCARD
+    SFL_CONSTEXPR_20
+    size_type count(const Key& key) const
+    {
+        return find_index(key) != size();
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<is_transparent_for<K>::value>* = nullptr>
+    SFL_NODISCARD
+    SFL_CONSTEXPR_20
+    size_type count(const K& x) const
+    {
+        return find_index(x) != size();
+    }
+
+    SFL_NODISCARD
+    SFL_CONSTEXPR_20
+    bool contains(const Key& key) const
+    {
+        return find_index(key) != size();
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<is_transparent_for<K>::value>* = nullptr>
+    SFL_NODISCARD
+    SFL_CONSTEXPR_20
+    bool contains(const K& x) const
+    {
+        return find_index(x) != size();
+    }
+
+    //
+    // ---- ELEMENT ACCESS ----------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    SFL_CONSTEXPR_20
+    T& at(const Key& key)
+    {
+        auto it = find(key);
+
+        if (it == end())
+        {
+            sfl::dtl::throw_out_of_range("sfl::frozen_unordered_map::at");
+        }
+
+        return it->second;
+    }
+
+    SFL_NODISCARD
+    SFL_CONSTEXPR_20
+    const T& at(const Key& key) const
+    {
+        auto it = find(key);
+
+        if (it == end())
+        {
+            sfl::dtl::throw_out_of_range("sfl::frozen_unordered_map::at");
+        }
+
+        return it->second;
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<is_transparent_for<K>::value>* = nullptr>
+    SFL_NODISCARD
+    SFL_CONSTEXPR_20
+    T& at(const K& x)
+    {
+        auto it = find(x);
+
+        if (it == end())
+        {
+            sfl::dtl::throw_out_of_range("sfl::frozen_unordered_map::at");
+        }
+
+        return it->second;
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<is_transparent_for<K>::value>* = nullptr>
+    SFL_NODISCARD
+    SFL_CONSTEXPR_20
+    const T& at(const K& x) const
+    {
+        auto it = find(x);
+
+        if (it == end())
+        {
+            sfl::dtl::throw_out_of_range("sfl::frozen_unordered_map::at");
+        }
+
+        return it->second;
+    }
+
+    SFL_NODISCARD
+    SFL_CONSTEXPR_20
+    value_type* data() noexcept
+    {
+        return data_.first_;
+    }
+
+    SFL_NODISCARD
+    SFL_CONSTEXPR_20
+    const value_type* data() const noexcept
+    {
+        return data_.first_;
+    }
+
+private:
+
+    template <typename K>
+    SFL_CONSTEXPR_20
+    unsigned long long hash_of(const K& key) const
+    {
+        return sfl::dtl::hash_avalanche(data_.ref_to_hash()(key) ^ data_.seed_);
+    }
+
+    SFL_CONSTEXPR_20
+    static size_type bucket_of(unsigned long long h) noexcept
+    {
+        return size_type(h % num_buckets);
+    }
+
+    SFL_CONSTEXPR_20
+    static size_type slot_of(unsigned long long h, size_type pilot) noexcept
+    {
+        return size_type(sfl::dtl::hash_avalanche(h ^ (pilot * 0x9E3779B97F4A7C15ULL)) % N);
+    }
+
+    // Returns index of the element with key equivalent to `key`, or `size()`
+    // if there is no such element.
+    template <typename K>
+    SFL_CONSTEXPR_20
+    size_type find_index(const K& key) const
+    {
+        const size_type n = size();
+
+        if (data_.perfect_)
+        {
+            const unsigned long long h = hash_of(key);
+
+            const size_type i = data_.slots_[slot_of(h, data_.pilots_[bucket_of(h)])];
+
+            return (i != N && data_.ref_to_equal()(data_.first_[i], key)) ? i : n;
+        }
+
+        for (size_type i = 0; i < n; ++i)
+        {
+            if (data_.ref_to_equal()(data_.first_[i], key))
+            {
+                return i;
+            }
+        }
+
+        return n;
+    }
+
+    template <typename InputIt>
+    SFL_CONSTEXPR_20
+    void initialize_range(InputIt first, InputIt last)
+    {
+        SFL_TRY
+        {
+            while (first != last)
+            {
+                SFL_ASSERT(size() < capacity());
+                sfl::dtl::construct_at(data_.last_, *first);
+                ++data_.last_;
+                ++first;
+            }
+
+            build();
+        }
+        SFL_CATCH (...)
+        {
+            sfl::dtl::destroy(data_.first_, data_.last_);
+            SFL_RETHROW;
+        }
+    }
+
+    template <typename ForwardIt>
+    SFL_CONSTEXPR_20
+    void assign_range(ForwardIt first, ForwardIt last)
+    {
+        SFL_ASSERT(size_type(std::distance(first, last)) <= capacity());
+
+        // Table is not valid while elements are replaced.
+        data_.perfect_ = false;
+
+        sfl::dtl::destroy(data_.first_, data_.last_);
+
+        data_.last_ = data_.first_;
+
+        data_.last_ = sfl::dtl::uninitialized_copy(first, last, data_.first_);
+    }
+
+    SFL_CONSTEXPR_20
+    void copy_table(const frozen_unordered_map& other) noexcept
+    {
+        sfl::dtl::copy(other.data_.slots_, other.data_.slots_ + N, data_.slots_);
+        sfl::dtl::copy(other.data_.pilots_, other.data_.pilots_ + num_buckets, data_.pilots_);
+        data_.seed_ = other.data_.seed_;
+        data_.perfect_ = other.data_.perfect_;
+    }
+
+    // Removes duplicates and builds perfect hash function. If two different
+    // keys have the same hash, or if no seed out of `max_seeds` yields a
+    // table, the map falls back to linear search.
+    SFL_CONSTEXPR_20
+    void build()
+    {
+        data_.perfect_ = false;
+
+        if (!remove_duplicates())
+        {
+            return;
+        }
+
+        for (size_type i = 0; i < max_seeds; ++i)
+        {
+            data_.seed_ = sfl::dtl::hash_avalanche(i);
+
+            if (build_table())
+            {
+                data_.perfect_ = true;
+                return;
+            }
+        }
+    }
+
+    // Removes all elements whose key is equivalent to the key of a preceding
+    // element. Elements are sorted by hash, so equivalent keys are adjacent.
+    // Returns false if different keys have the same hash.
+    SFL_CONSTEXPR_20
+    bool remove_duplicates()
+    {
+        const auto& hash = data_.ref_to_hash();
+
+        auto less = [&hash](const value_type& x, const value_type& y)
+        {
+            return hash(x.first) < hash(y.first);
+        };
+
+        sfl::dtl::stable_sort_in_place(data_.first_, data_.last_, less);
+
+        bool distinct_hashes = true;
+
+        pointer out = data_.first_;
+
+        for (pointer run = data_.first_; run != data_.last_; )
+        {
+            const std::size_t h = hash(run->first);
+
+            const pointer run_out = out;
+
+            for (; run != data_.last_ && hash(run->first) == h; ++run)
+            {
+                pointer p = run_out;
+
+                while (p != out && !data_.ref_to_equal()(*p, run->first))
+                {
+                    ++p;
+                }
+
+                if (p == out)
+                {
+                    if (out != run)
+                    {
+                        *out = std::move(*run);
+                    }
+
+                    ++out;
+                }
+            }
+
+            distinct_hashes = distinct_hashes && out - run_out == 1;
+        }
+
+        sfl::dtl::destroy(out, data_.last_);
+
+        data_.last_ = out;
+
+        return distinct_hashes;
+    }
+
+    // Builds perfect hash function using the current seed.
+    // Returns false if a pilot was not found for some bucket.
+    SFL_CONSTEXPR_20
+    bool build_table()
+    {
+        const size_type n = size();
+
+        // Count keys in each bucket.
+        sfl::dtl::fill(data_.pilots_, data_.pilots_ + num_buckets, pilot_type(0));
+
+        for (size_type i = 0; i < n; ++i)
+        {
+            ++data_.pilots_[bucket_of(hash_of(data_.first_[i].first))];
+        }
+
+        // Sort elements by bucket, larger buckets first, so that the keys of
+        // each bucket are adjacent and larger buckets are placed while most
+        // slots are still empty.
+        auto less = [this](const value_type& x, const value_type& y)
+        {
+            const size_type bx = bucket_of(hash_of(x.first));
+            const size_type by = bucket_of(hash_of(y.first));
+
+            if (data_.pilots_[bx] != data_.pilots_[by])
+            {
+                return data_.pilots_[bx] > data_.pilots_[by];
+            }
+
+            return bx < by;
+        };
+
+        sfl::dtl::stable_sort_in_place(data_.first_, data_.last_, less);
+
+        sfl::dtl::fill(data_.slots_, data_.slots_ + N, index_type(N));
+
+        for (size_type first = 0; first < n; )
+        {
+            const size_type bucket = bucket_of(hash_of(data_.first_[first].first));
+
+            size_type last = first + 1;
+
+            while (last < n && bucket_of(hash_of(data_.first_[last].first)) == bucket)
+            {
+                ++last;
+            }
+
+            size_type pilot = 0;
+
+            while (!place_bucket(first, last, pilot))
+            {
+                if (++pilot == max_pilot)
+                {
+                    return false;
+                }
+            }
+
+            // Count of keys is no longer needed by `less`.
+            data_.pilots_[bucket] = pilot_type(pilot);
+
+            first = last;
+        }
+
+        return true;
+    }
+
+    // Places elements in range [first, last) into slots given by `pilot`.
+    // Returns false and leaves slots unchanged if some slot is not empty.
+    SFL_CONSTEXPR_20
+    bool place_bucket(size_type first, size_type last, size_type pilot)
+    {
+        for (size_type i = first; i < last; ++i)
+        {
+            const size_type slot = slot_of(hash_of(data_.first_[i].first), pilot);
+
+            if (data_.slots_[slot] != N)
+            {
+                for (size_type j = first; j < i; ++j)
+                {
+                    data_.slots_[slot_of(hash_of(data_.first_[j].first), pilot)] = index_type(N);
+                }
+
+                return false;
+            }
+
+            data_.slots_[slot] = index_type(i);
+        }
+
+        return true;
+    }
+};
+
+template <typename K, typename T, std::size_t N, typename H, typename E>
+SFL_NODISCARD
+SFL_CONSTEXPR_20
+bool operator==
+(
+    const frozen_unordered_map<K, T, N, H, E>& x,
+    const frozen_unordered_map<K, T, N, H, E>& y
+)
+{
+    return x.size() == y.size() && std::is_permutation(x.begin(), x.end(), y.begin());
+}
+
+template <typename K, typename T, std::size_t N, typename H, typename E>
+SFL_NODISCARD
+SFL_CONSTEXPR_20
+bool operator!=
+(
+    const frozen_unordered_map<K, T, N, H, E>& x,
+    const frozen_unordered_map<K, T, N, H, E>& y
+)
+{
+    return !(x == y);
+}
+
+} // namespace sfl
+
+#endif // SFL_FROZEN_UNORDERED_MAP_HPP_INCLUDED
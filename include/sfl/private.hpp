@@ -24,12 +24,33 @@
 #include <algorithm>    // move, copy, etc.
 #include <cassert>      // assert
 #include <cstddef>      // size_t
+#include <cstdint>      // uint8_t, uint16_t, uint32_t, uint64_t
 #include <cstdlib>      // abort
+#include <cstring>      // memcpy
+#include <functional>   // equal_to, hash
 #include <iterator>     // iterator_traits, xxxxx_iterator_tag
+#include <limits>       // numeric_limits
 #include <memory>       // addressof, allocator_traits, pointer_traits
+#include <new>          // bad_alloc
 #include <stdexcept>    // length_error, out_of_range
+#include <tuple>        // tuple, get
 #include <type_traits>  // enable_if, is_convertible, is_function, true_type...
-#include <utility>      // forward, move, move_if_noexcept
+#include <utility>      // forward, move, move_if_noexcept, pair
+
+#if !defined(SFL_NO_SIMD)
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #define SFL_SIMD_SSE2
+        #include <emmintrin.h>
+    #endif
+    #if defined(__AVX2__)
+        #define SFL_SIMD_AVX2
+        #include <immintrin.h>
+    #endif
+#endif
+
+#if defined(_MSC_VER)
+    #include <intrin.h> // _BitScanForward
+#endif
 
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
@@ -45,6 +66,12 @@
     #define SFL_CONSTEXPR_14
 #endif
 
+#if __cplusplus >= 202002L
+    #define SFL_CONSTEXPR_20 constexpr
+#else
+    #define SFL_CONSTEXPR_20
+#endif
+
 #if __cplusplus >= 201703L
     #define SFL_NODISCARD [[nodiscard]]
 #else
@@ -64,6 +91,62 @@
 namespace sfl
 {
 
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+// TRIVIALLY RELOCATABLE TRAIT
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+//
+// Checks if an object of type `T` can be relocated (moved to a new address
+// and destroyed at the old one) by copying its bytes. Defaults to trivially
+// copyable types. Users may specialize it for other types, e.g. for types
+// that own a resource through a pointer that does not point into the object
+// itself.
+//
+template <typename T>
+struct is_trivially_relocatable
+#if defined(__GNUC__) && !defined(__clang__) && (__GNUC__ < 5)
+    : std::integral_constant<bool, __has_trivial_copy(T) && __has_trivial_destructor(T)>
+#else
+    : std::is_trivially_copyable<T>
+#endif
+{};
+
+// std::unique_ptr with the default deleter holds only a pointer.
+template <typename T>
+struct is_trivially_relocatable<std::unique_ptr<T, std::default_delete<T>>>
+    : std::true_type
+{};
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+// ALLOCATOR USABLE SIZE TRAIT
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+//
+// Returns the number of elements that fit into the memory block `p`
+// returned by `allocate(n)`. Containers record the whole block as capacity
+// and pass that number to `deallocate`. The default returns `n`. Users may
+// specialize it for allocators backed by malloc, e.g. by returning
+// `malloc_usable_size(p) / sizeof(T)`. Allocators that have member function
+// `allocate_at_least` (C++23) do not need this trait.
+//
+template <typename Allocator>
+struct allocator_usable_size
+{
+    static typename std::allocator_traits<Allocator>::size_type
+    usable_size(const Allocator& a,
+                typename std::allocator_traits<Allocator>::pointer p,
+                typename std::allocator_traits<Allocator>::size_type n) noexcept
+    {
+        (void)a;
+        (void)p;
+        return n;
+    }
+};
+
 namespace dtl
 {
 
@@ -217,6 +300,131 @@ struct has_is_transparent<
     Type, SfinaeType, sfl::dtl::void_t<typename Type::is_transparent>
 > : std::true_type {};
 
+//
+// Checks if `T` is a character type.
+//
+template <typename T>
+struct is_char_type : std::integral_constant
+<
+    bool,
+    std::is_same<T, char>::value ||
+    std::is_same<T, signed char>::value ||
+    std::is_same<T, unsigned char>::value ||
+    #ifdef __cpp_char8_t
+    std::is_same<T, char8_t>::value ||
+    #endif
+    std::is_same<T, wchar_t>::value ||
+    std::is_same<T, char16_t>::value ||
+    std::is_same<T, char32_t>::value
+> {};
+
+//
+// Checks if `T` is a string-like type, i.e. if it has member functions
+// `data()` and `size()` and `data()` returns pointer to characters
+// (e.g. `std::string` and `std::string_view`).
+//
+template <typename T, typename = void>
+struct is_string_like : std::false_type {};
+
+template <typename T>
+struct is_string_like<
+    T,
+    sfl::dtl::void_t<
+        decltype(std::declval<const T&>().data()),
+        decltype(std::declval<const T&>().size())
+    >
+> : std::integral_constant
+<
+    bool,
+    std::is_pointer<decltype(std::declval<const T&>().data())>::value &&
+    sfl::dtl::is_char_type<
+        typename std::remove_cv<
+            typename std::remove_pointer<decltype(std::declval<const T&>().data())>::type
+        >::type
+    >::value
+> {};
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+// KEY EXTRACTION
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+//
+// Checks if key of element constructed from `Args...` can be taken directly
+// from arguments, so containers with unique keys can search for the key
+// before constructing the element. This is the case if arguments are:
+//
+//  - for sets: a single key;
+//  - for maps: a key and anything, a pair whose first member is a key, or
+//    `std::piecewise_construct`, a tuple containing only a key and a tuple.
+//
+// Types are compared after removing references and cv-qualifiers, so keys
+// that would be converted are not extracted.
+//
+template <typename Key, typename... Args>
+struct is_set_key_extractable : std::false_type {};
+
+template <typename Key, typename Arg>
+struct is_set_key_extractable<Key, Arg>
+    : std::is_same<sfl::dtl::remove_cvref_t<Arg>, Key> {};
+
+template <typename Key, typename T>
+struct is_map_key_extractable_pair : std::false_type {};
+
+template <typename Key, typename K, typename T>
+struct is_map_key_extractable_pair<Key, std::pair<K, T>>
+    : std::is_same<typename std::remove_cv<K>::type, Key> {};
+
+template <typename Key, typename T>
+struct is_map_key_extractable_tuple : std::false_type {};
+
+template <typename Key, typename K>
+struct is_map_key_extractable_tuple<Key, std::tuple<K>>
+    : std::is_same<sfl::dtl::remove_cvref_t<K>, Key> {};
+
+template <typename Key, typename... Args>
+struct is_map_key_extractable : std::false_type {};
+
+template <typename Key, typename Arg>
+struct is_map_key_extractable<Key, Arg>
+    : is_map_key_extractable_pair<Key, sfl::dtl::remove_cvref_t<Arg>> {};
+
+template <typename Key, typename Arg1, typename Arg2>
+struct is_map_key_extractable<Key, Arg1, Arg2>
+    : std::is_same<sfl::dtl::remove_cvref_t<Arg1>, Key> {};
+
+template <typename Key, typename Arg1, typename Arg2, typename Arg3>
+struct is_map_key_extractable<Key, Arg1, Arg2, Arg3> : std::integral_constant
+<
+    bool,
+    std::is_same<sfl::dtl::remove_cvref_t<Arg1>, std::piecewise_construct_t>::value &&
+    is_map_key_extractable_tuple<Key, sfl::dtl::remove_cvref_t<Arg2>>::value
+> {};
+
+template <typename K, typename T>
+SFL_CONSTEXPR_14
+const K& extract_map_key(const std::pair<K, T>& value) noexcept
+{
+    return value.first;
+}
+
+template <typename K, typename T>
+SFL_CONSTEXPR_14
+const K& extract_map_key(const K& key, const T&) noexcept
+{
+    return key;
+}
+
+template <typename K, typename Tuple>
+SFL_CONSTEXPR_14
+const sfl::dtl::remove_cvref_t<K>& extract_map_key(std::piecewise_construct_t,
+                                                   const std::tuple<K>& key_args,
+                                                   const Tuple&) noexcept
+{
+    return std::get<0>(key_args);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
 // POINTER TRAITS
@@ -274,6 +482,7 @@ public:
 
 private:
 
+    SFL_CONSTEXPR_20
     explicit normal_iterator(const Iterator& it) noexcept
         : it_(it)
     {}
@@ -281,11 +490,13 @@ private:
 public:
 
     // Default constructor
+    SFL_CONSTEXPR_20
     normal_iterator() noexcept
         : it_()
     {}
 
     // Copy constructor
+    SFL_CONSTEXPR_20
     normal_iterator(const normal_iterator& other) noexcept
         : it_(other.it_)
     {}
@@ -293,11 +504,13 @@ public:
     // Converting constructor (from iterator to const_iterator)
     template <typename OtherIterator,
               sfl::dtl::enable_if_t<std::is_convertible<OtherIterator, Iterator>::value>* = nullptr>
+    SFL_CONSTEXPR_20
     normal_iterator(const normal_iterator<OtherIterator, Container>& other) noexcept
         : it_(other.it_)
     {}
 
     // Copy assignment operator
+    SFL_CONSTEXPR_20
     normal_iterator& operator=(const normal_iterator& other) noexcept
     {
         it_ = other.it_;
@@ -305,23 +518,27 @@ public:
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     reference operator*() const noexcept
     {
         return *it_;
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     pointer operator->() const noexcept
     {
         return sfl::dtl::to_address(it_);
     }
 
+    SFL_CONSTEXPR_20
     normal_iterator& operator++() noexcept
     {
         ++it_;
         return *this;
     }
 
+    SFL_CONSTEXPR_20
     normal_iterator operator++(int) noexcept
     {
         auto temp = *this;
@@ -329,12 +546,14 @@ public:
         return temp;
     }
 
+    SFL_CONSTEXPR_20
     normal_iterator& operator--() noexcept
     {
         --it_;
         return *this;
     }
 
+    SFL_CONSTEXPR_20
     normal_iterator operator--(int) noexcept
     {
         auto temp = *this;
@@ -342,12 +561,14 @@ public:
         return temp;
     }
 
+    SFL_CONSTEXPR_20
     normal_iterator& operator+=(difference_type n) noexcept
     {
         it_ += n;
         return *this;
     }
 
+    SFL_CONSTEXPR_20
     normal_iterator& operator-=(difference_type n) noexcept
     {
         it_ -= n;
@@ -355,66 +576,77 @@ public:
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     normal_iterator operator+(difference_type n) const noexcept
     {
         return normal_iterator(it_ + n);
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     normal_iterator operator-(difference_type n) const noexcept
     {
         return normal_iterator(it_ - n);
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     reference operator[](difference_type n) const noexcept
     {
         return it_[n];
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     friend normal_iterator operator+(difference_type n, const normal_iterator& it) noexcept
     {
         return it + n;
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     friend difference_type operator-(const normal_iterator& x, const normal_iterator& y) noexcept
     {
         return x.it_ - y.it_;
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     friend bool operator==(const normal_iterator& x, const normal_iterator& y) noexcept
     {
         return x.it_ == y.it_;
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     friend bool operator!=(const normal_iterator& x, const normal_iterator& y) noexcept
     {
         return !(x == y);
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     friend bool operator<(const normal_iterator& x, const normal_iterator& y) noexcept
     {
         return x.it_ < y.it_;
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     friend bool operator>(const normal_iterator& x, const normal_iterator& y) noexcept
     {
         return y < x;
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     friend bool operator<=(const normal_iterator& x, const normal_iterator& y) noexcept
     {
         return !(y < x);
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     friend bool operator>=(const normal_iterator& x, const normal_iterator& y) noexcept
     {
         return !(x < y);
@@ -682,249 +914,416 @@ struct segmented_iterator_traits<sfl::dtl::segmented_iterator<SegmentIterator, L
     }
 };
 
-///////////////////////////////////////////////////////////////////////////////
-///////////////////////////////////////////////////////////////////////////////
-// INITIALIZED MEMORY ALGORITHMS
-///////////////////////////////////////////////////////////////////////////////
-///////////////////////////////////////////////////////////////////////////////
-
-template <typename InputIt, typename OutputIt,
-          sfl::dtl::enable_if_t< (!sfl::dtl::is_segmented_iterator<InputIt>::value &&
-                                  !sfl::dtl::is_segmented_iterator<OutputIt>::value) ||
-                                 (!sfl::dtl::is_segmented_iterator<InputIt>::value &&
-                                   sfl::dtl::is_segmented_iterator<OutputIt>::value &&
-                                  !sfl::dtl::is_random_access_iterator<InputIt>::value) >* = nullptr>
-OutputIt copy(InputIt first, InputIt last, OutputIt d_first)
+// Iterator over two parallel arrays, one holding keys and another holding
+// mapped values. Dereferencing returns a proxy pair of references, similar
+// to C++23 `std::flat_map`. Keys are never modifiable through iterator.
+// `Mapped` is either `T` (iterator) or `const T` (const_iterator).
+template <typename Key, typename Mapped, typename Container>
+class split_iterator
 {
-    return std::copy(first, last, d_first);
-}
+    template <typename, typename, typename>
+    friend class split_iterator;
 
-template <typename InputIt, typename OutputIt,
-          sfl::dtl::enable_if_t< !sfl::dtl::is_segmented_iterator<InputIt>::value &&
-                                  sfl::dtl::is_segmented_iterator<OutputIt>::value &&
-                                  sfl::dtl::is_random_access_iterator<InputIt>::value >* = nullptr>
-OutputIt copy(InputIt first, InputIt last, OutputIt d_first)
-{
-    using traits = sfl::dtl::segmented_iterator_traits<OutputIt>;
+    friend Container;
 
-    if (first == last)
-    {
-        return d_first;
-    }
-    else
-    {
-        auto curr = first;
+private:
 
-        auto d_local = traits::local(d_first);
-        auto d_seg   = traits::segment(d_first);
+    const Key* key_;
+    Mapped*    mapped_;
 
-        while (true)
-        {
-            using difference_type =
-                typename std::iterator_traits<InputIt>::difference_type;
+public:
 
-            const auto count = std::min<difference_type>
-            (
-                std::distance(curr, last),
-                std::distance(d_local, traits::end(d_seg))
-            );
+    using difference_type   = std::ptrdiff_t;
+    using value_type        = std::pair<Key, typename std::remove_const<Mapped>::type>;
+    using reference         = std::pair<const Key&, Mapped&>;
+    using iterator_category = std::random_access_iterator_tag;
 
-            const auto next = curr + count;
+    // Result of `operator->`. Holds proxy reference by value.
+    class pointer
+    {
+        friend class split_iterator;
 
-            d_local = sfl::dtl::copy
-            (
-                curr,
-                next,
-                d_local
-            );
+    private:
 
-            curr = next;
+        reference ref_;
 
-            if (curr == last)
-            {
-                return traits::compose(d_seg, d_local);
-            }
+        explicit pointer(const reference& ref) noexcept
+            : ref_(ref)
+        {}
 
-            ++d_seg;
+    public:
 
-            d_local = traits::begin(d_seg);
+        const reference* operator->() const noexcept
+        {
+            return std::addressof(ref_);
         }
-    }
-}
+    };
 
-template <typename InputIt, typename OutputIt,
-          sfl::dtl::enable_if_t< sfl::dtl::is_segmented_iterator<InputIt>::value >* = nullptr>
-OutputIt copy(InputIt first, InputIt last, OutputIt d_first)
-{
-    using traits = sfl::dtl::segmented_iterator_traits<InputIt>;
+private:
 
-    auto first_seg = traits::segment(first);
-    auto last_seg  = traits::segment(last);
+    explicit split_iterator(const Key* key, Mapped* mapped) noexcept
+        : key_(key)
+        , mapped_(mapped)
+    {}
 
-    if (first_seg == last_seg)
-    {
-        return sfl::dtl::copy
-        (
-            traits::local(first),
-            traits::local(last),
-            d_first
-        );
-    }
-    else
-    {
-        d_first = sfl::dtl::copy
-        (
-            traits::local(first),
-            traits::end(first_seg),
-            d_first
-        );
+public:
 
-        ++first_seg;
+    // Default constructor
+    split_iterator() noexcept
+        : key_(nullptr)
+        , mapped_(nullptr)
+    {}
 
-        while (first_seg != last_seg)
-        {
-            d_first = sfl::dtl::copy
-            (
-                traits::begin(first_seg),
-                traits::end(first_seg),
-                d_first
-            );
+    // Copy constructor
+    split_iterator(const split_iterator& other) noexcept
+        : key_(other.key_)
+        , mapped_(other.mapped_)
+    {}
 
-            ++first_seg;
-        }
+    // Converting constructor (from iterator to const_iterator)
+    template <typename OtherMapped,
+              sfl::dtl::enable_if_t<std::is_convertible<OtherMapped*, Mapped*>::value>* = nullptr>
+    split_iterator(const split_iterator<Key, OtherMapped, Container>& other) noexcept
+        : key_(other.key_)
+        , mapped_(other.mapped_)
+    {}
 
-        d_first = sfl::dtl::copy
-        (
-            traits::begin(last_seg),
-            traits::local(last),
-            d_first
-        );
+    // Copy assignment operator
+    split_iterator& operator=(const split_iterator& other) noexcept
+    {
+        key_    = other.key_;
+        mapped_ = other.mapped_;
+        return *this;
+    }
 
-        return d_first;
+    SFL_NODISCARD
+    reference operator*() const noexcept
+    {
+        return reference(*key_, *mapped_);
     }
-}
 
-template <typename InputIt, typename Size, typename OutputIt>
-OutputIt copy_n(InputIt first, Size count, OutputIt d_first)
-{
-    return std::copy_n(first, count, d_first);
-}
+    SFL_NODISCARD
+    pointer operator->() const noexcept
+    {
+        return pointer(**this);
+    }
 
-template <typename BidirIt1, typename BidirIt2,
-          sfl::dtl::enable_if_t< (!sfl::dtl::is_segmented_iterator<BidirIt1>::value &&
-                                  !sfl::dtl::is_segmented_iterator<BidirIt2>::value) ||
-                                 (!sfl::dtl::is_segmented_iterator<BidirIt1>::value &&
-                                   sfl::dtl::is_segmented_iterator<BidirIt2>::value &&
-                                  !sfl::dtl::is_random_access_iterator<BidirIt1>::value) >* = nullptr>
-BidirIt2 copy_backward(BidirIt1 first, BidirIt1 last, BidirIt2 d_last)
-{
-    return std::copy_backward(first, last, d_last);
-}
+    split_iterator& operator++() noexcept
+    {
+        ++key_;
+        ++mapped_;
+        return *this;
+    }
 
-template <typename BidirIt1, typename BidirIt2,
-          sfl::dtl::enable_if_t< !sfl::dtl::is_segmented_iterator<BidirIt1>::value &&
-                                  sfl::dtl::is_segmented_iterator<BidirIt2>::value &&
-                                  sfl::dtl::is_random_access_iterator<BidirIt1>::value>* = nullptr>
-BidirIt2 copy_backward(BidirIt1 first, BidirIt1 last, BidirIt2 d_last)
-{
-    using traits = sfl::dtl::segmented_iterator_traits<BidirIt2>;
+    split_iterator operator++(int) noexcept
+    {
+        auto temp = *this;
+        ++*this;
+        return temp;
+    }
 
-    if (first == last)
+    split_iterator& operator--() noexcept
     {
-        return d_last;
+        --key_;
+        --mapped_;
+        return *this;
     }
-    else
+
+    split_iterator operator--(int) noexcept
     {
-        auto curr = last;
+        auto temp = *this;
+        --*this;
+        return temp;
+    }
 
-        auto d_local = traits::local(d_last);
-        auto d_seg   = traits::segment(d_last);
+    split_iterator& operator+=(difference_type n) noexcept
+    {
+        key_    += n;
+        mapped_ += n;
+        return *this;
+    }
 
-        while (true)
-        {
-            using difference_type =
-                typename std::iterator_traits<BidirIt1>::difference_type;
+    split_iterator& operator-=(difference_type n) noexcept
+    {
+        key_    -= n;
+        mapped_ -= n;
+        return *this;
+    }
 
-            const auto count = std::min<difference_type>
-            (
-                std::distance(first, curr),
-                std::distance(traits::begin(d_seg), d_local)
-            );
+    SFL_NODISCARD
+    split_iterator operator+(difference_type n) const noexcept
+    {
+        return split_iterator(key_ + n, mapped_ + n);
+    }
 
-            const auto prev = curr - count;
+    SFL_NODISCARD
+    split_iterator operator-(difference_type n) const noexcept
+    {
+        return split_iterator(key_ - n, mapped_ - n);
+    }
 
-            d_local = sfl::dtl::copy_backward
-            (
-                prev,
-                curr,
-                d_local
-            );
+    SFL_NODISCARD
+    reference operator[](difference_type n) const noexcept
+    {
+        return reference(key_[n], mapped_[n]);
+    }
 
-            curr = prev;
+    SFL_NODISCARD
+    friend split_iterator operator+(difference_type n, const split_iterator& it) noexcept
+    {
+        return it + n;
+    }
 
-            if (curr == first)
-            {
-                return traits::compose(d_seg, d_local);
-            }
+    SFL_NODISCARD
+    friend difference_type operator-(const split_iterator& x, const split_iterator& y) noexcept
+    {
+        return x.key_ - y.key_;
+    }
 
-            --d_seg;
+    SFL_NODISCARD
+    friend bool operator==(const split_iterator& x, const split_iterator& y) noexcept
+    {
+        return x.key_ == y.key_;
+    }
 
-            d_local = traits::end(d_seg);
-        }
+    SFL_NODISCARD
+    friend bool operator!=(const split_iterator& x, const split_iterator& y) noexcept
+    {
+        return !(x == y);
     }
-}
 
-template <typename BidirIt1, typename BidirIt2,
-          sfl::dtl::enable_if_t< sfl::dtl::is_segmented_iterator<BidirIt1>::value >* = nullptr>
-BidirIt2 copy_backward(BidirIt1 first, BidirIt1 last, BidirIt2 d_last)
+    SFL_NODISCARD
+    friend bool operator<(const split_iterator& x, const split_iterator& y) noexcept
+    {
+        return x.key_ < y.key_;
+    }
+
+    SFL_NODISCARD
+    friend bool operator>(const split_iterator& x, const split_iterator& y) noexcept
+    {
+        return y < x;
+    }
+
+    SFL_NODISCARD
+    friend bool operator<=(const split_iterator& x, const split_iterator& y) noexcept
+    {
+        return !(y < x);
+    }
+
+    SFL_NODISCARD
+    friend bool operator>=(const split_iterator& x, const split_iterator& y) noexcept
+    {
+        return !(x < y);
+    }
+};
+
+// Proxy reference returned by `split_zip_iterator`. Unlike reference of
+// `split_iterator`, it allows keys to be modified, so elements of two
+// parallel arrays can be moved and swapped together. For internal use only.
+template <typename Key, typename T>
+class split_zip_reference
 {
-    using traits = sfl::dtl::segmented_iterator_traits<BidirIt1>;
+public:
 
-    auto first_seg = traits::segment(first);
-    auto last_seg  = traits::segment(last);
+    Key& first;
+    T&   second;
 
-    if (first_seg == last_seg)
+    split_zip_reference(Key& key, T& mapped) noexcept
+        : first(key)
+        , second(mapped)
+    {}
+
+    split_zip_reference(const split_zip_reference& other) noexcept
+        : first(other.first)
+        , second(other.second)
+    {}
+
+    // Copy assignment operator copies referenced elements.
+    split_zip_reference& operator=(const split_zip_reference& other)
     {
-        return sfl::dtl::copy_backward
-        (
-            traits::local(first),
-            traits::local(last),
-            d_last
-        );
+        first  = other.first;
+        second = other.second;
+        return *this;
     }
-    else
+
+    // Move assignment operator moves referenced elements.
+    split_zip_reference& operator=(split_zip_reference&& other)
     {
-        d_last = sfl::dtl::copy_backward
-        (
-            traits::begin(last_seg),
-            traits::local(last),
-            d_last
-        );
+        first  = std::move(other.first);
+        second = std::move(other.second);
+        return *this;
+    }
 
-        --last_seg;
+    split_zip_reference& operator=(std::pair<Key, T>&& value)
+    {
+        first  = std::move(value.first);
+        second = std::move(value.second);
+        return *this;
+    }
 
-        while (first_seg != last_seg)
-        {
-            d_last = sfl::dtl::copy_backward
-            (
-                traits::begin(last_seg),
-                traits::end(last_seg),
-                d_last
-            );
+    // Moves referenced elements into a temporary pair.
+    operator std::pair<Key, T>() &&
+    {
+        return std::pair<Key, T>(std::move(first), std::move(second));
+    }
 
-            --last_seg;
-        }
+    friend void swap(split_zip_reference x, split_zip_reference y)
+    {
+        using std::swap;
+        swap(x.first, y.first);
+        swap(x.second, y.second);
+    }
+};
 
-        d_last = sfl::dtl::copy_backward
-        (
-            traits::local(first),
-            traits::end(last_seg),
-            d_last
-        );
+// Mutable iterator over two parallel arrays, one holding keys and another
+// holding mapped values. Sorted split containers use it to sort and merge
+// elements in place. For internal use only.
+template <typename Key, typename T>
+class split_zip_iterator
+{
+private:
 
-        return d_last;
+    Key* key_;
+    T*   mapped_;
+
+public:
+
+    using difference_type   = std::ptrdiff_t;
+    using value_type        = std::pair<Key, T>;
+    using pointer           = void;
+    using reference         = split_zip_reference<Key, T>;
+    using iterator_category = std::random_access_iterator_tag;
+
+    split_zip_iterator() noexcept
+        : key_(nullptr)
+        , mapped_(nullptr)
+    {}
+
+    split_zip_iterator(Key* key, T* mapped) noexcept
+        : key_(key)
+        , mapped_(mapped)
+    {}
+
+    SFL_NODISCARD
+    reference operator*() const noexcept
+    {
+        return reference(*key_, *mapped_);
+    }
+
+    SFL_NODISCARD
+    reference operator[](difference_type n) const noexcept
+    {
+        return reference(key_[n], mapped_[n]);
+    }
+
+    split_zip_iterator& operator++() noexcept
+    {
+        ++key_;
+        ++mapped_;
+        return *this;
+    }
+
+    split_zip_iterator operator++(int) noexcept
+    {
+        auto temp = *this;
+        ++*this;
+        return temp;
+    }
+
+    split_zip_iterator& operator--() noexcept
+    {
+        --key_;
+        --mapped_;
+        return *this;
+    }
+
+    split_zip_iterator operator--(int) noexcept
+    {
+        auto temp = *this;
+        --*this;
+        return temp;
+    }
+
+    split_zip_iterator& operator+=(difference_type n) noexcept
+    {
+        key_    += n;
+        mapped_ += n;
+        return *this;
+    }
+
+    split_zip_iterator& operator-=(difference_type n) noexcept
+    {
+        key_    -= n;
+        mapped_ -= n;
+        return *this;
+    }
+
+    SFL_NODISCARD
+    split_zip_iterator operator+(difference_type n) const noexcept
+    {
+        return split_zip_iterator(key_ + n, mapped_ + n);
+    }
+
+    SFL_NODISCARD
+    split_zip_iterator operator-(difference_type n) const noexcept
+    {
+        return split_zip_iterator(key_ - n, mapped_ - n);
+    }
+
+    SFL_NODISCARD
+    friend split_zip_iterator operator+(difference_type n, const split_zip_iterator& it) noexcept
+    {
+        return it + n;
+    }
+
+    SFL_NODISCARD
+    friend difference_type operator-(const split_zip_iterator& x, const split_zip_iterator& y) noexcept
+    {
+        return x.key_ - y.key_;
+    }
+
+    SFL_NODISCARD
+    friend bool operator==(const split_zip_iterator& x, const split_zip_iterator& y) noexcept
+    {
+        return x.key_ == y.key_;
+    }
+
+    SFL_NODISCARD
+    friend bool operator!=(const split_zip_iterator& x, const split_zip_iterator& y) noexcept
+    {
+        return !(x == y);
+    }
+
+    SFL_NODISCARD
+    friend bool operator<(const split_zip_iterator& x, const split_zip_iterator& y) noexcept
+    {
+        return x.key_ < y.key_;
     }
-}
+
+    SFL_NODISCARD
+    friend bool operator>(const split_zip_iterator& x, const split_zip_iterator& y) noexcept
+    {
+        return y < x;
+    }
+
+    SFL_NODISCARD
+    friend bool operator<=(const split_zip_iterator& x, const split_zip_iterator& y) noexcept
+    {
+        return !(y < x);
+    }
+
+    SFL_NODISCARD
+    friend bool operator>=(const split_zip_iterator& x, const split_zip_iterator& y) noexcept
+    {
+        return !(x < y);
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+// INITIALIZED MEMORY ALGORITHMS
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
 
 template <typename InputIt, typename OutputIt,
           sfl::dtl::enable_if_t< (!sfl::dtl::is_segmented_iterator<InputIt>::value &&
@@ -932,16 +1331,18 @@ template <typename InputIt, typename OutputIt,
                                  (!sfl::dtl::is_segmented_iterator<InputIt>::value &&
                                    sfl::dtl::is_segmented_iterator<OutputIt>::value &&
                                   !sfl::dtl::is_random_access_iterator<InputIt>::value) >* = nullptr>
-OutputIt move(InputIt first, InputIt last, OutputIt d_first)
+SFL_CONSTEXPR_20
+OutputIt copy(InputIt first, InputIt last, OutputIt d_first)
 {
-    return std::move(first, last, d_first);
+    return std::copy(first, last, d_first);
 }
 
 template <typename InputIt, typename OutputIt,
           sfl::dtl::enable_if_t< !sfl::dtl::is_segmented_iterator<InputIt>::value &&
                                   sfl::dtl::is_segmented_iterator<OutputIt>::value &&
                                   sfl::dtl::is_random_access_iterator<InputIt>::value >* = nullptr>
-OutputIt move(InputIt first, InputIt last, OutputIt d_first)
+SFL_CONSTEXPR_20
+OutputIt copy(InputIt first, InputIt last, OutputIt d_first)
 {
     using traits = sfl::dtl::segmented_iterator_traits<OutputIt>;
 
@@ -969,7 +1370,7 @@ OutputIt move(InputIt first, InputIt last, OutputIt d_first)
 
             const auto next = curr + count;
 
-            d_local = sfl::dtl::move
+            d_local = sfl::dtl::copy
             (
                 curr,
                 next,
@@ -992,7 +1393,8 @@ OutputIt move(InputIt first, InputIt last, OutputIt d_first)
 
 template <typename InputIt, typename OutputIt,
           sfl::dtl::enable_if_t< sfl::dtl::is_segmented_iterator<InputIt>::value >* = nullptr>
-OutputIt move(InputIt first, InputIt last, OutputIt d_first)
+SFL_CONSTEXPR_20
+OutputIt copy(InputIt first, InputIt last, OutputIt d_first)
 {
     using traits = sfl::dtl::segmented_iterator_traits<InputIt>;
 
@@ -1001,7 +1403,7 @@ OutputIt move(InputIt first, InputIt last, OutputIt d_first)
 
     if (first_seg == last_seg)
     {
-        return sfl::dtl::move
+        return sfl::dtl::copy
         (
             traits::local(first),
             traits::local(last),
@@ -1010,7 +1412,7 @@ OutputIt move(InputIt first, InputIt last, OutputIt d_first)
     }
     else
     {
-        d_first = sfl::dtl::move
+        d_first = sfl::dtl::copy
         (
             traits::local(first),
             traits::end(first_seg),
@@ -1021,7 +1423,7 @@ OutputIt move(InputIt first, InputIt last, OutputIt d_first)
 
         while (first_seg != last_seg)
         {
-            d_first = sfl::dtl::move
+            d_first = sfl::dtl::copy
             (
                 traits::begin(first_seg),
                 traits::end(first_seg),
@@ -1031,7 +1433,7 @@ OutputIt move(InputIt first, InputIt last, OutputIt d_first)
             ++first_seg;
         }
 
-        d_first = sfl::dtl::move
+        d_first = sfl::dtl::copy
         (
             traits::begin(last_seg),
             traits::local(last),
@@ -1042,22 +1444,28 @@ OutputIt move(InputIt first, InputIt last, OutputIt d_first)
     }
 }
 
+template <typename InputIt, typename Size, typename OutputIt>
+OutputIt copy_n(InputIt first, Size count, OutputIt d_first)
+{
+    return std::copy_n(first, count, d_first);
+}
+
 template <typename BidirIt1, typename BidirIt2,
           sfl::dtl::enable_if_t< (!sfl::dtl::is_segmented_iterator<BidirIt1>::value &&
                                   !sfl::dtl::is_segmented_iterator<BidirIt2>::value) ||
                                  (!sfl::dtl::is_segmented_iterator<BidirIt1>::value &&
                                    sfl::dtl::is_segmented_iterator<BidirIt2>::value &&
                                   !sfl::dtl::is_random_access_iterator<BidirIt1>::value) >* = nullptr>
-BidirIt2 move_backward(BidirIt1 first, BidirIt1 last, BidirIt2 d_last)
+BidirIt2 copy_backward(BidirIt1 first, BidirIt1 last, BidirIt2 d_last)
 {
-    return std::move_backward(first, last, d_last);
+    return std::copy_backward(first, last, d_last);
 }
 
 template <typename BidirIt1, typename BidirIt2,
           sfl::dtl::enable_if_t< !sfl::dtl::is_segmented_iterator<BidirIt1>::value &&
                                   sfl::dtl::is_segmented_iterator<BidirIt2>::value &&
-                                  sfl::dtl::is_random_access_iterator<BidirIt1>::value >* = nullptr>
-BidirIt2 move_backward(BidirIt1 first, BidirIt1 last, BidirIt2 d_last)
+                                  sfl::dtl::is_random_access_iterator<BidirIt1>::value>* = nullptr>
+BidirIt2 copy_backward(BidirIt1 first, BidirIt1 last, BidirIt2 d_last)
 {
     using traits = sfl::dtl::segmented_iterator_traits<BidirIt2>;
 
@@ -1085,7 +1493,7 @@ BidirIt2 move_backward(BidirIt1 first, BidirIt1 last, BidirIt2 d_last)
 
             const auto prev = curr - count;
 
-            d_local = sfl::dtl::move_backward
+            d_local = sfl::dtl::copy_backward
             (
                 prev,
                 curr,
@@ -1108,7 +1516,7 @@ BidirIt2 move_backward(BidirIt1 first, BidirIt1 last, BidirIt2 d_last)
 
 template <typename BidirIt1, typename BidirIt2,
           sfl::dtl::enable_if_t< sfl::dtl::is_segmented_iterator<BidirIt1>::value >* = nullptr>
-BidirIt2 move_backward(BidirIt1 first, BidirIt1 last, BidirIt2 d_last)
+BidirIt2 copy_backward(BidirIt1 first, BidirIt1 last, BidirIt2 d_last)
 {
     using traits = sfl::dtl::segmented_iterator_traits<BidirIt1>;
 
@@ -1117,7 +1525,7 @@ BidirIt2 move_backward(BidirIt1 first, BidirIt1 last, BidirIt2 d_last)
 
     if (first_seg == last_seg)
     {
-        return sfl::dtl::move_backward
+        return sfl::dtl::copy_backward
         (
             traits::local(first),
             traits::local(last),
@@ -1126,7 +1534,7 @@ BidirIt2 move_backward(BidirIt1 first, BidirIt1 last, BidirIt2 d_last)
     }
     else
     {
-        d_last = sfl::dtl::move_backward
+        d_last = sfl::dtl::copy_backward
         (
             traits::begin(last_seg),
             traits::local(last),
@@ -1137,7 +1545,7 @@ BidirIt2 move_backward(BidirIt1 first, BidirIt1 last, BidirIt2 d_last)
 
         while (first_seg != last_seg)
         {
-            d_last = sfl::dtl::move_backward
+            d_last = sfl::dtl::copy_backward
             (
                 traits::begin(last_seg),
                 traits::end(last_seg),
@@ -1147,7 +1555,7 @@ BidirIt2 move_backward(BidirIt1 first, BidirIt1 last, BidirIt2 d_last)
             --last_seg;
         }
 
-        d_last = sfl::dtl::move_backward
+        d_last = sfl::dtl::copy_backward
         (
             traits::local(first),
             traits::end(last_seg),
@@ -1158,197 +1566,543 @@ BidirIt2 move_backward(BidirIt1 first, BidirIt1 last, BidirIt2 d_last)
     }
 }
 
-template <typename ForwardIt, typename T,
-          sfl::dtl::enable_if_t< !sfl::dtl::is_segmented_iterator<ForwardIt>::value >* = nullptr>
-void fill(ForwardIt first, ForwardIt last, const T& value)
+template <typename InputIt, typename OutputIt,
+          sfl::dtl::enable_if_t< (!sfl::dtl::is_segmented_iterator<InputIt>::value &&
+                                  !sfl::dtl::is_segmented_iterator<OutputIt>::value) ||
+                                 (!sfl::dtl::is_segmented_iterator<InputIt>::value &&
+                                   sfl::dtl::is_segmented_iterator<OutputIt>::value &&
+                                  !sfl::dtl::is_random_access_iterator<InputIt>::value) >* = nullptr>
+SFL_CONSTEXPR_20
+OutputIt move(InputIt first, InputIt last, OutputIt d_first)
 {
-    std::fill(first, last, value);
+    return std::move(first, last, d_first);
 }
 
-template <typename ForwardIt, typename T,
-          sfl::dtl::enable_if_t< sfl::dtl::is_segmented_iterator<ForwardIt>::value >* = nullptr>
-void fill(ForwardIt first, ForwardIt last, const T& value)
+template <typename InputIt, typename OutputIt,
+          sfl::dtl::enable_if_t< !sfl::dtl::is_segmented_iterator<InputIt>::value &&
+                                  sfl::dtl::is_segmented_iterator<OutputIt>::value &&
+                                  sfl::dtl::is_random_access_iterator<InputIt>::value >* = nullptr>
+SFL_CONSTEXPR_20
+OutputIt move(InputIt first, InputIt last, OutputIt d_first)
 {
-    using traits = sfl::dtl::segmented_iterator_traits<ForwardIt>;
+    using traits = sfl::dtl::segmented_iterator_traits<OutputIt>;
+
+    if (first == last)
+    {
+        return d_first;
+    }
+    else
+    {
+        auto curr = first;
+
+        auto d_local = traits::local(d_first);
+        auto d_seg   = traits::segment(d_first);
+
+        while (true)
+        {
+            using difference_type =
+                typename std::iterator_traits<InputIt>::difference_type;
+
+            const auto count = std::min<difference_type>
+            (
+                std::distance(curr, last),
+                std::distance(d_local, traits::end(d_seg))
+            );
+
+            const auto next = curr + count;
+
+            d_local = sfl::dtl::move
+            (
+                curr,
+                next,
+                d_local
+            );
+
+            curr = next;
+
+            if (curr == last)
+            {
+                return traits::compose(d_seg, d_local);
+            }
+
+            ++d_seg;
+
+            d_local = traits::begin(d_seg);
+        }
+    }
+}
+
+template <typename InputIt, typename OutputIt,
+          sfl::dtl::enable_if_t< sfl::dtl::is_segmented_iterator<InputIt>::value >* = nullptr>
+SFL_CONSTEXPR_20
+OutputIt move(InputIt first, InputIt last, OutputIt d_first)
+{
+    using traits = sfl::dtl::segmented_iterator_traits<InputIt>;
 
     auto first_seg = traits::segment(first);
     auto last_seg  = traits::segment(last);
 
     if (first_seg == last_seg)
     {
-        sfl::dtl::fill
+        return sfl::dtl::move
         (
             traits::local(first),
             traits::local(last),
-            value
+            d_first
         );
     }
     else
     {
-        sfl::dtl::fill
+        d_first = sfl::dtl::move
         (
             traits::local(first),
             traits::end(first_seg),
-            value
+            d_first
         );
 
         ++first_seg;
 
         while (first_seg != last_seg)
         {
-            sfl::dtl::fill
+            d_first = sfl::dtl::move
             (
                 traits::begin(first_seg),
                 traits::end(first_seg),
-                value
+                d_first
             );
 
             ++first_seg;
         }
 
-        sfl::dtl::fill
+        d_first = sfl::dtl::move
         (
             traits::begin(last_seg),
             traits::local(last),
-            value
+            d_first
         );
+
+        return d_first;
     }
 }
 
-template <typename OutputIt, typename Size, typename T>
-OutputIt fill_n(OutputIt first, Size count, const T& value)
+template <typename BidirIt1, typename BidirIt2,
+          sfl::dtl::enable_if_t< (!sfl::dtl::is_segmented_iterator<BidirIt1>::value &&
+                                  !sfl::dtl::is_segmented_iterator<BidirIt2>::value) ||
+                                 (!sfl::dtl::is_segmented_iterator<BidirIt1>::value &&
+                                   sfl::dtl::is_segmented_iterator<BidirIt2>::value &&
+                                  !sfl::dtl::is_random_access_iterator<BidirIt1>::value) >* = nullptr>
+SFL_CONSTEXPR_20
+BidirIt2 move_backward(BidirIt1 first, BidirIt1 last, BidirIt2 d_last)
 {
-    return std::fill_n(first, count, value);
+    return std::move_backward(first, last, d_last);
 }
 
-///////////////////////////////////////////////////////////////////////////////
-///////////////////////////////////////////////////////////////////////////////
-// UNINITIALIZED MEMORY ALGORITHMS
-///////////////////////////////////////////////////////////////////////////////
-///////////////////////////////////////////////////////////////////////////////
-
-template <typename Allocator, typename Size>
-auto allocate(Allocator& a, Size n) -> typename std::allocator_traits<Allocator>::pointer
+template <typename BidirIt1, typename BidirIt2,
+          sfl::dtl::enable_if_t< !sfl::dtl::is_segmented_iterator<BidirIt1>::value &&
+                                  sfl::dtl::is_segmented_iterator<BidirIt2>::value &&
+                                  sfl::dtl::is_random_access_iterator<BidirIt1>::value >* = nullptr>
+SFL_CONSTEXPR_20
+BidirIt2 move_backward(BidirIt1 first, BidirIt1 last, BidirIt2 d_last)
 {
-    if (n != 0)
-    {
-        return std::allocator_traits<Allocator>::allocate(a, n);
-    }
-    return nullptr;
-}
+    using traits = sfl::dtl::segmented_iterator_traits<BidirIt2>;
 
-template <typename Allocator, typename Pointer, typename Size>
-void deallocate(Allocator& a, Pointer p, Size n) noexcept
-{
-    if (p != nullptr)
+    if (first == last)
     {
-        std::allocator_traits<Allocator>::deallocate(a, p, n);
+        return d_last;
     }
-}
+    else
+    {
+        auto curr = last;
 
-template <typename Allocator, typename Pointer, typename... Args>
-void construct_at_a(Allocator& a, Pointer p, Args&&... args)
-{
-    std::allocator_traits<Allocator>::construct
-    (
-        a,
-        sfl::dtl::to_address(p),
-        std::forward<Args>(args)...
-    );
-}
+        auto d_local = traits::local(d_last);
+        auto d_seg   = traits::segment(d_last);
 
-template <typename Allocator, typename Pointer>
-void destroy_at_a(Allocator& a, Pointer p) noexcept
-{
-    std::allocator_traits<Allocator>::destroy
-    (
-        a,
-        sfl::dtl::to_address(p)
-    );
-}
+        while (true)
+        {
+            using difference_type =
+                typename std::iterator_traits<BidirIt1>::difference_type;
 
-template <typename Allocator, typename ForwardIt,
-          sfl::dtl::enable_if_t< !sfl::dtl::is_segmented_iterator<ForwardIt>::value >* = nullptr>
-void destroy_a(Allocator& a, ForwardIt first, ForwardIt last) noexcept
-{
-    while (first != last)
-    {
-        sfl::dtl::destroy_at_a(a, std::addressof(*first));
-        ++first;
+            const auto count = std::min<difference_type>
+            (
+                std::distance(first, curr),
+                std::distance(traits::begin(d_seg), d_local)
+            );
+
+            const auto prev = curr - count;
+
+            d_local = sfl::dtl::move_backward
+            (
+                prev,
+                curr,
+                d_local
+            );
+
+            curr = prev;
+
+            if (curr == first)
+            {
+                return traits::compose(d_seg, d_local);
+            }
+
+            --d_seg;
+
+            d_local = traits::end(d_seg);
+        }
     }
 }
 
-template <typename Allocator, typename ForwardIt,
-          sfl::dtl::enable_if_t< sfl::dtl::is_segmented_iterator<ForwardIt>::value >* = nullptr>
-void destroy_a(Allocator& a, ForwardIt first, ForwardIt last) noexcept
+template <typename BidirIt1, typename BidirIt2,
+          sfl::dtl::enable_if_t< sfl::dtl::is_segmented_iterator<BidirIt1>::value >* = nullptr>
+SFL_CONSTEXPR_20
+BidirIt2 move_backward(BidirIt1 first, BidirIt1 last, BidirIt2 d_last)
 {
-    using traits = sfl::dtl::segmented_iterator_traits<ForwardIt>;
+    using traits = sfl::dtl::segmented_iterator_traits<BidirIt1>;
 
     auto first_seg = traits::segment(first);
     auto last_seg  = traits::segment(last);
 
     if (first_seg == last_seg)
     {
-        sfl::dtl::destroy_a
+        return sfl::dtl::move_backward
         (
-            a,
             traits::local(first),
-            traits::local(last)
+            traits::local(last),
+            d_last
         );
     }
     else
     {
-        sfl::dtl::destroy_a
+        d_last = sfl::dtl::move_backward
         (
-            a,
-            traits::local(first),
-            traits::end(first_seg)
+            traits::begin(last_seg),
+            traits::local(last),
+            d_last
         );
 
-        ++first_seg;
+        --last_seg;
 
         while (first_seg != last_seg)
         {
-            sfl::dtl::destroy_a
+            d_last = sfl::dtl::move_backward
             (
-                a,
-                traits::begin(first_seg),
-                traits::end(first_seg)
+                traits::begin(last_seg),
+                traits::end(last_seg),
+                d_last
             );
 
-            ++first_seg;
+            --last_seg;
         }
 
-        sfl::dtl::destroy_a
+        d_last = sfl::dtl::move_backward
         (
-            a,
-            traits::begin(last_seg),
-            traits::local(last)
+            traits::local(first),
+            traits::end(last_seg),
+            d_last
         );
+
+        return d_last;
     }
 }
 
-template <typename Allocator, typename ForwardIt, typename Size,
+template <typename ForwardIt, typename T,
           sfl::dtl::enable_if_t< !sfl::dtl::is_segmented_iterator<ForwardIt>::value >* = nullptr>
-ForwardIt destroy_n_a(Allocator& a, ForwardIt first, Size n) noexcept
+SFL_CONSTEXPR_20
+void fill(ForwardIt first, ForwardIt last, const T& value)
 {
-    while (n > 0)
-    {
-        sfl::dtl::destroy_at_a(a, std::addressof(*first));
-        ++first;
-        --n;
-    }
-    return first;
+    std::fill(first, last, value);
 }
 
-template <typename Allocator, typename ForwardIt, typename Size,
+template <typename ForwardIt, typename T,
           sfl::dtl::enable_if_t< sfl::dtl::is_segmented_iterator<ForwardIt>::value >* = nullptr>
-ForwardIt destroy_n_a(Allocator& a, ForwardIt first, Size n) noexcept
+SFL_CONSTEXPR_20
+void fill(ForwardIt first, ForwardIt last, const T& value)
 {
     using traits = sfl::dtl::segmented_iterator_traits<ForwardIt>;
 
-    auto curr_local = traits::local(first);
-    auto curr_seg   = traits::segment(first);
+    auto first_seg = traits::segment(first);
+    auto last_seg  = traits::segment(last);
+
+    if (first_seg == last_seg)
+    {
+        sfl::dtl::fill
+        (
+            traits::local(first),
+            traits::local(last),
+            value
+        );
+    }
+    else
+    {
+        sfl::dtl::fill
+        (
+            traits::local(first),
+            traits::end(first_seg),
+            value
+        );
+
+        ++first_seg;
+
+        while (first_seg != last_seg)
+        {
+            sfl::dtl::fill
+            (
+                traits::begin(first_seg),
+                traits::end(first_seg),
+                value
+            );
+
+            ++first_seg;
+        }
+
+        sfl::dtl::fill
+        (
+            traits::begin(last_seg),
+            traits::local(last),
+            value
+        );
+    }
+}
+
+template <typename OutputIt, typename Size, typename T>
+OutputIt fill_n(OutputIt first, Size count, const T& value)
+{
+    return std::fill_n(first, count, value);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+// UNINITIALIZED MEMORY ALGORITHMS
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+template <typename Allocator, typename Size>
+auto allocate(Allocator& a, Size n) -> typename std::allocator_traits<Allocator>::pointer
+{
+    if (n != 0)
+    {
+        return std::allocator_traits<Allocator>::allocate(a, n);
+    }
+    return nullptr;
+}
+
+template <typename Allocator, typename = void>
+struct has_allocate_at_least : std::false_type {};
+
+template <typename Allocator>
+struct has_allocate_at_least
+<
+    Allocator,
+    sfl::dtl::void_t<
+        decltype(std::declval<Allocator&>().allocate_at_least(
+            std::declval<typename std::allocator_traits<Allocator>::size_type>()
+        ).count)
+    >
+> : std::true_type {};
+
+template <typename Allocator, typename Size>
+auto allocate_at_least(Allocator& a, Size& n, std::true_type)
+    -> typename std::allocator_traits<Allocator>::pointer
+{
+    auto result = a.allocate_at_least(n);
+    SFL_ASSERT(Size(result.count) >= n);
+    n = result.count;
+    return result.ptr;
+}
+
+template <typename Allocator, typename Size>
+auto allocate_at_least(Allocator& a, Size& n, std::false_type)
+    -> typename std::allocator_traits<Allocator>::pointer
+{
+    const auto p = std::allocator_traits<Allocator>::allocate(a, n);
+    const Size m = sfl::allocator_usable_size<Allocator>::usable_size(a, p, n);
+    SFL_ASSERT(m >= n);
+    n = m;
+    return p;
+}
+
+//
+// Allocates memory for at least `n` elements and sets `n` to the number of
+// elements that fit into the allocated block (capped at the maximal size of
+// containers). Uses member function `allocate_at_least` if the allocator
+// has it, or `sfl::allocator_usable_size` otherwise.
+//
+template <typename Allocator, typename Size>
+auto allocate_at_least(Allocator& a, Size& n) -> typename std::allocator_traits<Allocator>::pointer
+{
+    using traits = std::allocator_traits<Allocator>;
+    using value_type = typename traits::value_type;
+    using difference_type = typename traits::difference_type;
+
+    if (n == 0)
+    {
+        return nullptr;
+    }
+
+    const Size requested = n;
+
+    const auto p = sfl::dtl::allocate_at_least
+    (
+        a,
+        n,
+        sfl::dtl::has_allocate_at_least<Allocator>()
+    );
+
+    const Size max_n = std::min<Size>
+    (
+        traits::max_size(a),
+        std::numeric_limits<difference_type>::max() / sizeof(value_type)
+    );
+
+    n = std::max(requested, std::min(n, max_n));
+
+    return p;
+}
+
+template <typename Allocator, typename = void>
+struct has_reallocate : std::false_type {};
+
+template <typename Allocator>
+struct has_reallocate
+<
+    Allocator,
+    sfl::dtl::void_t<
+        decltype(std::declval<Allocator&>().reallocate(
+            std::declval<typename std::allocator_traits<Allocator>::pointer>(),
+            std::declval<typename std::allocator_traits<Allocator>::size_type>(),
+            std::declval<typename std::allocator_traits<Allocator>::size_type>()
+        ))
+    >
+> : std::true_type {};
+
+//
+// Changes the size of memory block `p` from `old_n` to `new_n` elements
+// using member function `reallocate` of the allocator (e.g. `realloc`).
+// Bytes of the block are preserved up to the smaller size, and the block
+// may be moved. If it throws, block `p` is still valid.
+//
+template <typename Allocator, typename Pointer, typename Size>
+Pointer reallocate(Allocator& a, Pointer p, Size old_n, Size new_n)
+{
+    if (p == nullptr)
+    {
+        return sfl::dtl::allocate(a, new_n);
+    }
+
+    return a.reallocate(p, old_n, new_n);
+}
+
+template <typename Allocator, typename Pointer, typename Size>
+void deallocate(Allocator& a, Pointer p, Size n) noexcept
+{
+    if (p != nullptr)
+    {
+        std::allocator_traits<Allocator>::deallocate(a, p, n);
+    }
+}
+
+template <typename Allocator, typename Pointer, typename... Args>
+void construct_at_a(Allocator& a, Pointer p, Args&&... args)
+{
+    std::allocator_traits<Allocator>::construct
+    (
+        a,
+        sfl::dtl::to_address(p),
+        std::forward<Args>(args)...
+    );
+}
+
+template <typename Allocator, typename Pointer>
+void destroy_at_a(Allocator& a, Pointer p) noexcept
+{
+    std::allocator_traits<Allocator>::destroy
+    (
+        a,
+        sfl::dtl::to_address(p)
+    );
+}
+
+template <typename Allocator, typename ForwardIt,
+          sfl::dtl::enable_if_t< !sfl::dtl::is_segmented_iterator<ForwardIt>::value >* = nullptr>
+void destroy_a(Allocator& a, ForwardIt first, ForwardIt last) noexcept
+{
+    while (first != last)
+    {
+        sfl::dtl::destroy_at_a(a, std::addressof(*first));
+        ++first;
+    }
+}
+
+template <typename Allocator, typename ForwardIt,
+          sfl::dtl::enable_if_t< sfl::dtl::is_segmented_iterator<ForwardIt>::value >* = nullptr>
+void destroy_a(Allocator& a, ForwardIt first, ForwardIt last) noexcept
+{
+    using traits = sfl::dtl::segmented_iterator_traits<ForwardIt>;
+
+    auto first_seg = traits::segment(first);
+    auto last_seg  = traits::segment(last);
+
+    if (first_seg == last_seg)
+    {
+        sfl::dtl::destroy_a
+        (
+            a,
+            traits::local(first),
+            traits::local(last)
+        );
+    }
+    else
+    {
+        sfl::dtl::destroy_a
+        (
+            a,
+            traits::local(first),
+            traits::end(first_seg)
+        );
+
+        ++first_seg;
+
+        while (first_seg != last_seg)
+        {
+            sfl::dtl::destroy_a
+            (
+                a,
+                traits::begin(first_seg),
+                traits::end(first_seg)
+            );
+
+            ++first_seg;
+        }
+
+        sfl::dtl::destroy_a
+        (
+            a,
+            traits::begin(last_seg),
+            traits::local(last)
+        );
+    }
+}
+
+template <typename Allocator, typename ForwardIt, typename Size,
+          sfl::dtl::enable_if_t< !sfl::dtl::is_segmented_iterator<ForwardIt>::value >* = nullptr>
+ForwardIt destroy_n_a(Allocator& a, ForwardIt first, Size n) noexcept
+{
+    while (n > 0)
+    {
+        sfl::dtl::destroy_at_a(a, std::addressof(*first));
+        ++first;
+        --n;
+    }
+    return first;
+}
+
+template <typename Allocator, typename ForwardIt, typename Size,
+          sfl::dtl::enable_if_t< sfl::dtl::is_segmented_iterator<ForwardIt>::value >* = nullptr>
+ForwardIt destroy_n_a(Allocator& a, ForwardIt first, Size n) noexcept
+{
+    using traits = sfl::dtl::segmented_iterator_traits<ForwardIt>;
+
+    auto curr_local = traits::local(first);
+    auto curr_seg   = traits::segment(first);
 
     auto remainining = n;
 
@@ -2201,31 +2955,381 @@ ForwardIt uninitialized_move_if_noexcept_a(Allocator& a, InputIt first, InputIt
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
 
+//
+// Functions below relocate objects with memcpy/memmove when the value type
+// is trivially relocatable and the allocator constructs and destroys
+// objects in the default way (placement new and destructor call), and
+// fall back to element-wise moves otherwise.
+//
+
+template <typename Allocator>
+struct is_std_allocator : std::false_type {};
+
 template <typename T>
-void default_construct_at(T* p)
+struct is_std_allocator<std::allocator<T>> : std::true_type {};
+
+template <typename Allocator, typename = void>
+struct has_allocator_construct : std::false_type {};
+
+template <typename Allocator>
+struct has_allocator_construct
+<
+    Allocator,
+    sfl::dtl::void_t<
+        decltype(std::declval<Allocator&>().construct(
+            std::declval<typename std::allocator_traits<Allocator>::value_type*>(),
+            std::declval<typename std::allocator_traits<Allocator>::value_type&&>()
+        ))
+    >
+> : std::true_type {};
+
+template <typename Allocator, typename = void>
+struct has_allocator_destroy : std::false_type {};
+
+template <typename Allocator>
+struct has_allocator_destroy
+<
+    Allocator,
+    sfl::dtl::void_t<
+        decltype(std::declval<Allocator&>().destroy(
+            std::declval<typename std::allocator_traits<Allocator>::value_type*>()
+        ))
+    >
+> : std::true_type {};
+
+template <typename Allocator>
+struct is_trivially_relocatable_a : std::integral_constant
+<
+    bool,
+    sfl::is_trivially_relocatable<typename std::allocator_traits<Allocator>::value_type>::value &&
+    std::is_same
+    <
+        typename std::allocator_traits<Allocator>::pointer,
+        typename std::allocator_traits<Allocator>::value_type*
+    >::value &&
+    (
+        sfl::dtl::is_std_allocator<Allocator>::value ||
+        (
+            !sfl::dtl::has_allocator_construct<Allocator>::value &&
+            !sfl::dtl::has_allocator_destroy<Allocator>::value
+        )
+    )
+> {};
+
+//
+// Checks if storage can be grown with `sfl::dtl::reallocate`, i.e. if
+// elements are trivially relocatable by the allocator and the allocator
+// has member function `reallocate`.
+//
+template <typename Allocator>
+struct is_reallocatable_a : std::integral_constant
+<
+    bool,
+    sfl::dtl::is_trivially_relocatable_a<Allocator>::value &&
+    sfl::dtl::has_reallocate<Allocator>::value
+> {};
+
+//
+// Copies bytes of [first, last) to [d_first, d_first + n). Ranges may
+// overlap. Returns d_first + n.
+//
+template <typename Pointer>
+Pointer relocate_bytes(Pointer first, Pointer last, Pointer d_first) noexcept
 {
-    ::new (static_cast<void*>(p)) T;
+    using value_type = typename std::pointer_traits<Pointer>::element_type;
+
+    const auto n = std::distance(first, last);
+
+    if (n > 0)
+    {
+        std::memmove
+        (
+            static_cast<void*>(sfl::dtl::to_address(d_first)),
+            static_cast<const void*>(sfl::dtl::to_address(first)),
+            std::size_t(n) * sizeof(value_type)
+        );
+    }
+
+    return d_first + n;
 }
 
-template <typename T>
-void value_construct_at(T* p)
+template <typename Allocator, typename Pointer>
+Pointer uninitialized_relocate_a(Allocator& a, Pointer first, Pointer last, Pointer d_first, std::true_type) noexcept
 {
-    ::new (static_cast<void*>(p)) T();
+    sfl::dtl::ignore_unused(a);
+    return sfl::dtl::relocate_bytes(first, last, d_first);
 }
 
-template <typename T, typename... Args>
-void construct_at(T* p, Args&&... args)
+template <typename Allocator, typename Pointer>
+Pointer uninitialized_relocate_a(Allocator& a, Pointer first, Pointer last, Pointer d_first, std::false_type)
+{
+    return sfl::dtl::uninitialized_move_if_noexcept_a(a, first, last, d_first);
+}
+
+//
+// Relocates [first, last) to uninitialized storage starting at d_first.
+// Objects in the source range must be released with `destroy_relocated_a`
+// after this function returns. Returns the end of the destination range.
+//
+template <typename Allocator, typename Pointer>
+Pointer uninitialized_relocate_a(Allocator& a, Pointer first, Pointer last, Pointer d_first)
+{
+    return sfl::dtl::uninitialized_relocate_a
+    (
+        a,
+        first,
+        last,
+        d_first,
+        sfl::dtl::is_trivially_relocatable_a<Allocator>()
+    );
+}
+
+template <typename Allocator, typename Pointer>
+void destroy_relocated_a(Allocator& a, Pointer first, Pointer last, std::true_type) noexcept
+{
+    sfl::dtl::ignore_unused(a, first, last);
+}
+
+template <typename Allocator, typename Pointer>
+void destroy_relocated_a(Allocator& a, Pointer first, Pointer last, std::false_type) noexcept
+{
+    sfl::dtl::destroy_a(a, first, last);
+}
+
+//
+// Releases the source range of `uninitialized_relocate_a`.
+//
+template <typename Allocator, typename Pointer>
+void destroy_relocated_a(Allocator& a, Pointer first, Pointer last) noexcept
+{
+    sfl::dtl::destroy_relocated_a
+    (
+        a,
+        first,
+        last,
+        sfl::dtl::is_trivially_relocatable_a<Allocator>()
+    );
+}
+
+template <typename Allocator, typename Pointer>
+Pointer erase_shift_left_a(Allocator& a, Pointer first, Pointer last, Pointer end, std::true_type) noexcept
+{
+    sfl::dtl::destroy_a(a, first, last);
+    return sfl::dtl::relocate_bytes(last, end, first);
+}
+
+template <typename Allocator, typename Pointer>
+Pointer erase_shift_left_a(Allocator& a, Pointer first, Pointer last, Pointer end, std::false_type)
+{
+    const Pointer new_end = sfl::dtl::move(last, end, first);
+    sfl::dtl::destroy_a(a, new_end, end);
+    return new_end;
+}
+
+//
+// Erases [first, last) from [first, end) by shifting [last, end) to the
+// left. Returns the new end.
+//
+template <typename Allocator, typename Pointer>
+Pointer erase_shift_left_a(Allocator& a, Pointer first, Pointer last, Pointer end)
+{
+    return sfl::dtl::erase_shift_left_a
+    (
+        a,
+        first,
+        last,
+        end,
+        sfl::dtl::is_trivially_relocatable_a<Allocator>()
+    );
+}
+
+template <typename Allocator, typename Pointer>
+Pointer erase_shift_right_a(Allocator& a, Pointer begin, Pointer first, Pointer last, std::true_type) noexcept
+{
+    sfl::dtl::destroy_a(a, first, last);
+    const Pointer new_begin = begin + std::distance(first, last);
+    sfl::dtl::relocate_bytes(begin, first, new_begin);
+    return new_begin;
+}
+
+template <typename Allocator, typename Pointer>
+Pointer erase_shift_right_a(Allocator& a, Pointer begin, Pointer first, Pointer last, std::false_type)
+{
+    const Pointer new_begin = sfl::dtl::move_backward(begin, first, last);
+    sfl::dtl::destroy_a(a, begin, new_begin);
+    return new_begin;
+}
+
+//
+// Erases [first, last) from [begin, last) by shifting [begin, first) to the
+// right. Returns the new begin.
+//
+template <typename Allocator, typename Pointer>
+Pointer erase_shift_right_a(Allocator& a, Pointer begin, Pointer first, Pointer last)
+{
+    return sfl::dtl::erase_shift_right_a
+    (
+        a,
+        begin,
+        first,
+        last,
+        sfl::dtl::is_trivially_relocatable_a<Allocator>()
+    );
+}
+
+template <typename Allocator, typename Pointer>
+void insert_shift_right_a(Allocator& a, Pointer pos, Pointer& end,
+                          typename std::allocator_traits<Allocator>::value_type&& value,
+                          std::true_type) noexcept
+{
+    sfl::dtl::relocate_bytes(pos, end, pos + 1);
+    sfl::dtl::construct_at_a(a, pos, std::move(value));
+    ++end;
+}
+
+template <typename Allocator, typename Pointer>
+void insert_shift_right_a(Allocator& a, Pointer pos, Pointer& end,
+                          typename std::allocator_traits<Allocator>::value_type&& value,
+                          std::false_type)
+{
+    const Pointer old_end = end;
+
+    sfl::dtl::construct_at_a(a, end, std::move(*(end - 1)));
+
+    ++end;
+
+    sfl::dtl::move_backward(pos, old_end - 1, old_end);
+
+    *pos = std::move(value);
+}
+
+//
+// Inserts `value` at `pos` by shifting [pos, end) one position to the
+// right. There must be room for one more element at `end`, and `pos` must
+// be less than `end`. Updates `end`.
+//
+template <typename Allocator, typename Pointer>
+void insert_shift_right_a(Allocator& a, Pointer pos, Pointer& end,
+                          typename std::allocator_traits<Allocator>::value_type&& value)
+{
+    using value_type = typename std::allocator_traits<Allocator>::value_type;
+
+    sfl::dtl::insert_shift_right_a
+    (
+        a,
+        pos,
+        end,
+        std::move(value),
+        std::integral_constant
+        <
+            bool,
+            sfl::dtl::is_trivially_relocatable_a<Allocator>::value &&
+            std::is_nothrow_move_constructible<value_type>::value
+        >()
+    );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+//
+// Functions below can construct and destroy objects in constant evaluation
+// since C++20. Placement new cannot be used there, so std::construct_at is
+// used instead, and default initialization becomes value initialization
+// because reading an indeterminate value is not a constant expression.
+//
+
+template <typename T>
+SFL_CONSTEXPR_20
+void default_construct_at(T* p)
+{
+    #if __cplusplus >= 202002L
+    if (std::is_constant_evaluated())
+    {
+        std::construct_at(p);
+        return;
+    }
+    #endif
+
+    ::new (static_cast<void*>(p)) T;
+}
+
+template <typename T>
+SFL_CONSTEXPR_20
+void value_construct_at(T* p)
+{
+    #if __cplusplus >= 202002L
+    std::construct_at(p);
+    #else
+    ::new (static_cast<void*>(p)) T();
+    #endif
+}
+
+template <typename T, typename... Args>
+SFL_CONSTEXPR_20
+void construct_at(T* p, Args&&... args)
 {
+    #if __cplusplus >= 202002L
+    std::construct_at(p, std::forward<Args>(args)...);
+    #else
     ::new (static_cast<void*>(p)) T(std::forward<Args>(args)...);
+    #endif
 }
 
+//
+// In constant evaluation, storage of static containers must consist of live
+// objects only, so the destroyed object is replaced by a value-initialized
+// one. See `initialize_static_storage`.
+//
 template <typename T>
+SFL_CONSTEXPR_20
 void destroy_at(T* p) noexcept
 {
     p->~T();
+
+    #if __cplusplus >= 202002L
+    if constexpr (std::is_default_constructible<T>::value)
+    {
+        if (std::is_constant_evaluated())
+        {
+            std::construct_at(p);
+        }
+    }
+    #endif
+}
+
+//
+// Static containers keep elements in a union member array, so the storage
+// is not initialized at run time. A constant expression must not contain
+// uninitialized objects, so in constant evaluation all `n` objects are
+// value-initialized and elements are then constructed over them.
+//
+template <typename T>
+SFL_CONSTEXPR_20
+void initialize_static_storage(T* first, std::size_t n) noexcept
+{
+    #if __cplusplus >= 202002L
+    if constexpr (std::is_default_constructible<T>::value)
+    {
+        if (std::is_constant_evaluated())
+        {
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                std::construct_at(first + i);
+            }
+        }
+    }
+    else
+    {
+        sfl::dtl::ignore_unused(first, n);
+    }
+    #else
+    sfl::dtl::ignore_unused(first, n);
+    #endif
 }
 
 template <typename ForwardIt>
+SFL_CONSTEXPR_20
 void destroy(ForwardIt first, ForwardIt last) noexcept
 {
     while (first != last)
@@ -2236,6 +3340,7 @@ void destroy(ForwardIt first, ForwardIt last) noexcept
 }
 
 template <typename ForwardIt, typename Size>
+SFL_CONSTEXPR_20
 ForwardIt uninitialized_default_construct_n(ForwardIt first, Size n)
 {
     ForwardIt curr = first;
@@ -2257,6 +3362,7 @@ ForwardIt uninitialized_default_construct_n(ForwardIt first, Size n)
 }
 
 template <typename ForwardIt, typename Size>
+SFL_CONSTEXPR_20
 ForwardIt uninitialized_value_construct_n(ForwardIt first, Size n)
 {
     ForwardIt curr = first;
@@ -2278,6 +3384,7 @@ ForwardIt uninitialized_value_construct_n(ForwardIt first, Size n)
 }
 
 template <typename ForwardIt, typename T>
+SFL_CONSTEXPR_20
 void uninitialized_fill(ForwardIt first, ForwardIt last, const T& value)
 {
     ForwardIt curr = first;
@@ -2297,6 +3404,7 @@ void uninitialized_fill(ForwardIt first, ForwardIt last, const T& value)
 }
 
 template <typename ForwardIt, typename Size, typename T>
+SFL_CONSTEXPR_20
 ForwardIt uninitialized_fill_n(ForwardIt first, Size n, const T& value)
 {
     ForwardIt curr = first;
@@ -2318,6 +3426,7 @@ ForwardIt uninitialized_fill_n(ForwardIt first, Size n, const T& value)
 }
 
 template <typename InputIt, typename ForwardIt>
+SFL_CONSTEXPR_20
 ForwardIt uninitialized_copy(InputIt first, InputIt last, ForwardIt d_first)
 {
     ForwardIt d_curr = d_first;
@@ -2339,6 +3448,7 @@ ForwardIt uninitialized_copy(InputIt first, InputIt last, ForwardIt d_first)
 }
 
 template <typename InputIt, typename ForwardIt>
+SFL_CONSTEXPR_20
 ForwardIt uninitialized_move(InputIt first, InputIt last, ForwardIt d_first)
 {
     ForwardIt d_curr = d_first;
@@ -2361,130 +3471,2629 @@ ForwardIt uninitialized_move(InputIt first, InputIt last, ForwardIt d_first)
 
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
-// EXCEPTIONS
+// SIMD SEARCH
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
 
-[[noreturn]]
-inline void throw_length_error(const char* msg)
+//
+// Returns the number of trailing zero bits in `x`. The result is undefined
+// if `x` is zero.
+//
+inline unsigned count_trailing_zeros(unsigned x) noexcept
 {
-    #ifdef SFL_NO_EXCEPTIONS
-    sfl::dtl::ignore_unused(msg);
-    SFL_ASSERT(!"std::length_error thrown");
-    std::abort();
+    SFL_ASSERT(x != 0);
+
+    #if defined(__GNUC__) || defined(__clang__)
+    return unsigned(__builtin_ctz(x));
+    #elif defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, x);
+    return unsigned(index);
     #else
-    throw std::length_error(msg);
+    unsigned n = 0;
+    while ((x & 1u) == 0)
+    {
+        x >>= 1;
+        ++n;
+    }
+    return n;
     #endif
 }
 
-[[noreturn]]
-inline void throw_out_of_range(const char* msg)
+//
+// Returns the number of trailing zero bits in `x`. The result is undefined
+// if `x` is zero.
+//
+inline unsigned count_trailing_zeros(unsigned long long x) noexcept
 {
-    #ifdef SFL_NO_EXCEPTIONS
-    sfl::dtl::ignore_unused(msg);
-    SFL_ASSERT(!"std::out_of_range thrown");
-    std::abort();
+    SFL_ASSERT(x != 0);
+
+    #if defined(__GNUC__) || defined(__clang__)
+    return unsigned(__builtin_ctzll(x));
     #else
-    throw std::out_of_range(msg);
+    const unsigned lo = static_cast<unsigned>(x);
+    return lo != 0 ? sfl::dtl::count_trailing_zeros(lo)
+                   : 32 + sfl::dtl::count_trailing_zeros(static_cast<unsigned>(x >> 32));
     #endif
 }
 
-///////////////////////////////////////////////////////////////////////////////
-///////////////////////////////////////////////////////////////////////////////
-// INDEX SEQUENCE
-///////////////////////////////////////////////////////////////////////////////
-///////////////////////////////////////////////////////////////////////////////
+//
+// Mixes hash value by multiplying it by 64-bit golden ratio constant.
+// The most significant bits of the product depend on all bits of `h`, so
+// identity hashes of small integers (e.g. `std::hash<int>` in libstdc++)
+// are also spread over the whole range when the high bits are taken.
+//
+inline unsigned long long hash_mix(std::size_t h) noexcept
+{
+    return static_cast<unsigned long long>(h) * 0x9E3779B97F4A7C15ULL;
+}
 
-template <std::size_t... Ints>
-struct index_sequence
+//
+// Reduces mixed hash value to one-byte fingerprint, which is its most
+// significant byte.
+//
+inline unsigned char hash_fingerprint(unsigned long long mixed) noexcept
 {
-    using type = index_sequence;
-};
+    return static_cast<unsigned char>(mixed >> 56);
+}
 
-template <typename IndexSequence1, typename IndexSequence2>
-struct index_sequence_concat;
+//
+// Scans bytes in range [first, first + n) for bytes equal to `value`.
+// For each such byte, in increasing order of index `i`, calls `pred(i)`.
+// Returns the first index for which `pred` returned true, or `n` if there
+// is no such index.
+//
+// Uses AVX2 or SSE2 instructions if they are available at compile time.
+//
+template <typename Predicate>
+std::size_t find_byte_if(const unsigned char* first,
+                         std::size_t n,
+                         unsigned char value,
+                         Predicate&& pred)
+{
+    std::size_t i = 0;
 
-template <std::size_t... Ints1, std::size_t... Ints2>
-struct index_sequence_concat< sfl::dtl::index_sequence<Ints1...>,
-                              sfl::dtl::index_sequence<Ints2...> >
-    : sfl::dtl::index_sequence<Ints1..., (sizeof...(Ints1) + Ints2)...>
-{};
+    #if defined(SFL_SIMD_AVX2)
+    {
+        const __m256i needle = _mm256_set1_epi8(static_cast<char>(value));
 
-template <std::size_t N>
-struct make_index_sequence
-    : index_sequence_concat< typename sfl::dtl::index_sequence<N/2>::type,
-                             typename sfl::dtl::index_sequence<N - N/2>::type >::type
-{};
+        for (; n - i >= 32; i += 32)
+        {
+            const __m256i block = _mm256_loadu_si256
+            (
+                reinterpret_cast<const __m256i*>(first + i)
+            );
 
-template <>
-struct make_index_sequence<0> : sfl::dtl::index_sequence<>
-{};
+            unsigned mask = static_cast<unsigned>
+            (
+                _mm256_movemask_epi8(_mm256_cmpeq_epi8(block, needle))
+            );
 
-template <>
-struct make_index_sequence<1> : sfl::dtl::index_sequence<0>
-{};
+            while (mask != 0)
+            {
+                const std::size_t j = i + sfl::dtl::count_trailing_zeros(mask);
 
-template <typename... T>
-using index_sequence_for = sfl::dtl::make_index_sequence<sizeof...(T)>;
+                if (pred(j))
+                {
+                    return j;
+                }
 
-///////////////////////////////////////////////////////////////////////////////
-///////////////////////////////////////////////////////////////////////////////
-// SCOPE GUARD
-///////////////////////////////////////////////////////////////////////////////
-///////////////////////////////////////////////////////////////////////////////
+                mask &= mask - 1;
+            }
+        }
+    }
+    #endif
 
-template <typename Lambda>
-class scope_guard
-{
-private:
+    #if defined(SFL_SIMD_SSE2)
+    {
+        const __m128i needle = _mm_set1_epi8(static_cast<char>(value));
 
-    mutable bool dismissed_;
+        for (; n - i >= 16; i += 16)
+        {
+            const __m128i block = _mm_loadu_si128
+            (
+                reinterpret_cast<const __m128i*>(first + i)
+            );
 
-    Lambda lambda_;
+            unsigned mask = static_cast<unsigned>
+            (
+                _mm_movemask_epi8(_mm_cmpeq_epi8(block, needle))
+            );
 
-public:
+            while (mask != 0)
+            {
+                const std::size_t j = i + sfl::dtl::count_trailing_zeros(mask);
 
-    scope_guard(Lambda&& lambda)
-        : dismissed_(false)
-        , lambda_(std::forward<Lambda>(lambda))
-    {}
+                if (pred(j))
+                {
+                    return j;
+                }
 
-    scope_guard(const scope_guard& other) = delete;
+                mask &= mask - 1;
+            }
+        }
+    }
+    #endif
 
-    scope_guard(scope_guard&& other)
-        : dismissed_(other.dismissed_)
-        , lambda_(std::move(other.lambda_))
+    for (; i < n; ++i)
     {
-        other.dismissed_ = true;
+        if (first[i] == value && pred(i))
+        {
+            return i;
+        }
     }
 
-    scope_guard& operator=(const scope_guard& other) = delete;
+    return n;
+}
 
-    scope_guard& operator=(scope_guard&& other)
-    {
-        dismissed_ = other.dismissed_;
-        lambda_ = std::move(other.lambda_);
+//
+// Checks if objects of type `T` compared using `KeyEqual` are equal if and
+// only if their object representations are equal, so they can be searched
+// for using integer SIMD comparison.
+//
+// This is true for integral (except bool), enumeration and pointer types of
+// size 1, 2, 4 or 8 bytes compared using `std::equal_to`.
+//
+template <typename T, typename KeyEqual>
+struct is_simd_searchable : std::integral_constant
+<
+    bool,
+    (
+        (std::is_integral<T>::value && !std::is_same<T, bool>::value) ||
+        std::is_enum<T>::value ||
+        std::is_pointer<T>::value
+    ) &&
+    (
+        sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8
+    ) &&
+    (
+        std::is_same<KeyEqual, std::equal_to<T>>::value
+        #if __cplusplus >= 201402L
+        || std::is_same<KeyEqual, std::equal_to<>>::value
+        #endif
+    )
+> {};
+
+template <std::size_t Size>
+struct simd_uint;
+
+template <> struct simd_uint<1> { using type = std::uint8_t;  };
+template <> struct simd_uint<2> { using type = std::uint16_t; };
+template <> struct simd_uint<4> { using type = std::uint32_t; };
+template <> struct simd_uint<8> { using type = std::uint64_t; };
+
+//
+// Returns bit mask with bits set at positions 0, R, 2R, ... i.e. at positions
+// of the first byte of each R-byte record in the result of `movemask`.
+//
+constexpr unsigned simd_record_mask(std::size_t R) noexcept
+{
+    return R ==  1 ? 0xFFFFFFFFu :
+           R ==  2 ? 0x55555555u :
+           R ==  4 ? 0x11111111u :
+           R ==  8 ? 0x01010101u :
+                     0x00010001u;
+}
+
+#if defined(SFL_SIMD_SSE2)
+
+inline __m128i simd_set1(std::uint8_t x) noexcept
+{
+    return _mm_set1_epi8(static_cast<char>(x));
+}
+
+inline __m128i simd_set1(std::uint16_t x) noexcept
+{
+    return _mm_set1_epi16(static_cast<short>(x));
+}
+
+inline __m128i simd_set1(std::uint32_t x) noexcept
+{
+    return _mm_set1_epi32(static_cast<int>(x));
+}
+
+inline __m128i simd_set1(std::uint64_t x) noexcept
+{
+    return _mm_set1_epi64x(static_cast<long long>(x));
+}
+
+inline __m128i simd_cmpeq(__m128i a, __m128i b, std::integral_constant<std::size_t, 1>) noexcept
+{
+    return _mm_cmpeq_epi8(a, b);
+}
+
+inline __m128i simd_cmpeq(__m128i a, __m128i b, std::integral_constant<std::size_t, 2>) noexcept
+{
+    return _mm_cmpeq_epi16(a, b);
+}
+
+inline __m128i simd_cmpeq(__m128i a, __m128i b, std::integral_constant<std::size_t, 4>) noexcept
+{
+    return _mm_cmpeq_epi32(a, b);
+}
+
+inline __m128i simd_cmpeq(__m128i a, __m128i b, std::integral_constant<std::size_t, 8>) noexcept
+{
+    // SSE2 has no 64-bit comparison. Compare 32-bit halves and combine
+    // the result for each half with the result for its neighbour.
+    const __m128i c = _mm_cmpeq_epi32(a, b);
+    return _mm_and_si128(c, _mm_shuffle_epi32(c, _MM_SHUFFLE(2, 3, 0, 1)));
+}
+
+#endif // SFL_SIMD_SSE2
+
+#if defined(SFL_SIMD_AVX2)
+
+inline __m256i simd_set1_256(std::uint8_t x) noexcept
+{
+    return _mm256_set1_epi8(static_cast<char>(x));
+}
+
+inline __m256i simd_set1_256(std::uint16_t x) noexcept
+{
+    return _mm256_set1_epi16(static_cast<short>(x));
+}
+
+inline __m256i simd_set1_256(std::uint32_t x) noexcept
+{
+    return _mm256_set1_epi32(static_cast<int>(x));
+}
+
+inline __m256i simd_set1_256(std::uint64_t x) noexcept
+{
+    return _mm256_set1_epi64x(static_cast<long long>(x));
+}
+
+inline __m256i simd_cmpeq(__m256i a, __m256i b, std::integral_constant<std::size_t, 1>) noexcept
+{
+    return _mm256_cmpeq_epi8(a, b);
+}
+
+inline __m256i simd_cmpeq(__m256i a, __m256i b, std::integral_constant<std::size_t, 2>) noexcept
+{
+    return _mm256_cmpeq_epi16(a, b);
+}
+
+inline __m256i simd_cmpeq(__m256i a, __m256i b, std::integral_constant<std::size_t, 4>) noexcept
+{
+    return _mm256_cmpeq_epi32(a, b);
+}
+
+inline __m256i simd_cmpeq(__m256i a, __m256i b, std::integral_constant<std::size_t, 8>) noexcept
+{
+    return _mm256_cmpeq_epi64(a, b);
+}
+
+#endif // SFL_SIMD_AVX2
+
+//
+// Searches array of `n` records for the first record whose key is equal to
+// `value`. Each record consists of `Stride` objects of type `T` and its key
+// is the first one. `Stride` is 1 for arrays of keys (sets) and 2 for arrays
+// of pairs where mapped value has the same size as key (maps).
+// Returns index of the found record, or `n` if there is no such record.
+//
+// Type `T` must satisfy `is_simd_searchable`. Keys are compared bitwise,
+// 16 or 32 bytes per iteration if SSE2 or AVX2 is available.
+//
+template <std::size_t Stride, typename T>
+std::size_t find_equal(const T* first, std::size_t n, const T& value) noexcept
+{
+    static_assert(Stride == 1 || Stride == 2, "Invalid stride.");
+
+    constexpr std::size_t record_size = sizeof(T) * Stride;
+
+    std::size_t i = 0; // Offset in bytes
+
+    #if defined(SFL_SIMD_SSE2) || defined(SFL_SIMD_AVX2)
+    {
+        using size_constant = std::integral_constant<std::size_t, sizeof(T)>;
+        using uint_type = typename simd_uint<sizeof(T)>::type;
+
+        const unsigned char* bytes = reinterpret_cast<const unsigned char*>(first);
+
+        const std::size_t num_bytes = n * record_size;
+
+        constexpr unsigned record_mask = simd_record_mask(record_size);
+
+        uint_type bits;
+        std::memcpy(&bits, std::addressof(value), sizeof(T));
+
+        #if defined(SFL_SIMD_AVX2)
+        {
+            const __m256i needle = simd_set1_256(bits);
+
+            // Check 64 bytes per iteration until the first block containing
+            // equal key, which is then located by the following loop.
+            for (; num_bytes - i >= 64; i += 64)
+            {
+                const __m256i c0 = simd_cmpeq
+                (
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes + i)),
+                    needle,
+                    size_constant()
+                );
+
+                const __m256i c1 = simd_cmpeq
+                (
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes + i + 32)),
+                    needle,
+                    size_constant()
+                );
+
+                const unsigned mask = record_mask & static_cast<unsigned>
+                (
+                    _mm256_movemask_epi8(_mm256_or_si256(c0, c1))
+                );
+
+                if (mask != 0)
+                {
+                    break;
+                }
+            }
+
+            for (; num_bytes - i >= 32; i += 32)
+            {
+                const __m256i block = _mm256_loadu_si256
+                (
+                    reinterpret_cast<const __m256i*>(bytes + i)
+                );
+
+                const unsigned mask = record_mask & static_cast<unsigned>
+                (
+                    _mm256_movemask_epi8(simd_cmpeq(block, needle, size_constant()))
+                );
+
+                if (mask != 0)
+                {
+                    return (i + sfl::dtl::count_trailing_zeros(mask)) / record_size;
+                }
+            }
+        }
+        #endif
+
+        #if defined(SFL_SIMD_SSE2)
+        {
+            const __m128i needle = simd_set1(bits);
+
+            // Check 64 bytes per iteration until the first block containing
+            // equal key, which is then located by the following loop.
+            for (; num_bytes - i >= 64; i += 64)
+            {
+                const __m128i c0 = simd_cmpeq
+                (
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i)),
+                    needle,
+                    size_constant()
+                );
+
+                const __m128i c1 = simd_cmpeq
+                (
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i + 16)),
+                    needle,
+                    size_constant()
+                );
+
+                const __m128i c2 = simd_cmpeq
+                (
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i + 32)),
+                    needle,
+                    size_constant()
+                );
+
+                const __m128i c3 = simd_cmpeq
+                (
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i + 48)),
+                    needle,
+                    size_constant()
+                );
+
+                const unsigned mask = record_mask & static_cast<unsigned>
+                (
+                    _mm_movemask_epi8(_mm_or_si128(_mm_or_si128(c0, c1), _mm_or_si128(c2, c3)))
+                );
+
+                if (mask != 0)
+                {
+                    break;
+                }
+            }
+
+            for (; num_bytes - i >= 16; i += 16)
+            {
+                const __m128i block = _mm_loadu_si128
+                (
+                    reinterpret_cast<const __m128i*>(bytes + i)
+                );
+
+                const unsigned mask = record_mask & static_cast<unsigned>
+                (
+                    _mm_movemask_epi8(simd_cmpeq(block, needle, size_constant()))
+                );
+
+                if (mask != 0)
+                {
+                    return (i + sfl::dtl::count_trailing_zeros(mask)) / record_size;
+                }
+            }
+        }
+        #endif
+    }
+    #endif
+
+    for (std::size_t k = i / record_size; k < n; ++k)
+    {
+        if (first[k * Stride] == value)
+        {
+            return k;
+        }
+    }
+
+    return n;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+// BATCHED SEARCH
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+// Maximal number of query keys resolved by one pass over elements.
+constexpr std::size_t find_many_batch_size = 64;
+
+// Batches with more than this many query keys are hashed. Smaller batches
+// are searched key by key.
+constexpr std::size_t find_many_hash_threshold = 8;
+
+//
+// Checks if `std::hash<T>` is enabled, i.e. if it can be constructed and
+// called with `const T&`.
+//
+template <typename T, typename = void>
+struct has_std_hash : std::false_type {};
+
+template <typename T>
+struct has_std_hash<
+    T,
+    sfl::dtl::void_t<decltype(std::size_t(std::hash<T>()(std::declval<const T&>())))>
+> : std::true_type {};
+
+//
+// Checks if keys of type `T` compared using `KeyEqual` can be put into hash
+// table. This is true for keys that satisfy `is_simd_searchable`, which are
+// hashed bitwise, and for keys compared using `std::equal_to` if
+// `std::hash<T>` is enabled. `std::hash` must agree with `operator==`, so
+// equal keys always have equal hash values.
+//
+template <typename T, typename KeyEqual>
+struct is_hash_searchable : std::integral_constant
+<
+    bool,
+    sfl::dtl::is_simd_searchable<T, KeyEqual>::value ||
+    (
+        (
+            std::is_same<KeyEqual, std::equal_to<T>>::value
+            #if __cplusplus >= 201402L
+            || std::is_same<KeyEqual, std::equal_to<>>::value
+            #endif
+        ) &&
+        sfl::dtl::has_std_hash<T>::value
+    )
+> {};
+
+template <typename Key>
+unsigned long long key_hash(const Key& key, std::true_type) noexcept
+{
+    typename simd_uint<sizeof(Key)>::type bits;
+    std::memcpy(&bits, std::addressof(key), sizeof(Key));
+    return sfl::dtl::hash_mix(std::size_t(bits));
+}
+
+template <typename Key>
+unsigned long long key_hash(const Key& key, std::false_type)
+{
+    return sfl::dtl::hash_mix(std::hash<Key>()(key));
+}
+
+//
+// Returns mixed hash value of key that satisfies `is_hash_searchable`.
+// Scalar keys are hashed bitwise, other keys using `std::hash`.
+//
+template <typename Key>
+unsigned long long key_hash(const Key& key)
+{
+    return sfl::dtl::key_hash(key, sfl::dtl::is_simd_searchable<Key, std::equal_to<Key>>());
+}
+
+//
+// Hashes key to slot of open addressing table with
+// `2 * find_many_batch_size` slots.
+//
+template <typename Key>
+std::size_t find_many_slot(const Key& key)
+{
+    return std::size_t(sfl::dtl::key_hash(key) >> 57);
+}
+
+//
+// Searches array of `n` elements for `count` query keys pointed to by
+// `queries` in a single pass. Query keys are put into open addressing hash
+// table first, so each element is checked in O(1) time. Stores index of the
+// first matching element, or `n`, into `results`. Array `first_of` is used
+// as scratch space.
+//
+template <typename Key, typename KeyEqual, typename KeyAt>
+void find_many_hashed(const KeyEqual& equal,
+                      std::size_t n,
+                      KeyAt& key_at,
+                      const Key* const* queries,
+                      std::size_t count,
+                      std::size_t* results,
+                      std::size_t* first_of)
+{
+    constexpr std::size_t num_slots = 2 * find_many_batch_size;
+
+    // Slot holds index of query key plus one, or zero if it is empty.
+    // Repeated query key is not inserted; `first_of[q]` holds index of its
+    // first occurrence, so the result is copied at the end.
+    unsigned char slots[num_slots] = {};
+
+    std::size_t num_unique = 0;
+
+    for (std::size_t q = 0; q < count; ++q)
+    {
+        results[q] = n;
+
+        std::size_t s = sfl::dtl::find_many_slot(*queries[q]);
+
+        while (slots[s] != 0 && !equal(*queries[slots[s] - 1], *queries[q]))
+        {
+            s = (s + 1) % num_slots;
+        }
+
+        if (slots[s] == 0)
+        {
+            slots[s] = static_cast<unsigned char>(q + 1);
+            first_of[q] = q;
+            ++num_unique;
+        }
+        else
+        {
+            first_of[q] = slots[s] - 1;
+        }
+    }
+
+    for (std::size_t i = 0; i < n && num_unique != 0; ++i)
+    {
+        const Key& key = key_at(i);
+
+        std::size_t s = sfl::dtl::find_many_slot(key);
+
+        while (slots[s] != 0)
+        {
+            const std::size_t q = slots[s] - 1;
+
+            if (equal(key, *queries[q]))
+            {
+                if (results[q] == n)
+                {
+                    results[q] = i;
+                    --num_unique;
+                }
+
+                break;
+            }
+
+            s = (s + 1) % num_slots;
+        }
+    }
+
+    for (std::size_t q = 0; q < count; ++q)
+    {
+        results[q] = results[first_of[q]];
+    }
+}
+
+template <typename Key, typename KeyEqual, typename KeyAt, typename FindOne, typename ForwardIt, typename Output>
+void find_many(const KeyEqual& equal,
+               std::size_t n,
+               KeyAt& key_at,
+               FindOne& find_one,
+               ForwardIt first,
+               ForwardIt last,
+               Output& out,
+               std::false_type)
+{
+    sfl::dtl::ignore_unused(equal, n, key_at);
+
+    for (; first != last; ++first)
+    {
+        out(find_one(*first));
+    }
+}
+
+template <typename Key, typename KeyEqual, typename KeyAt, typename FindOne, typename ForwardIt, typename Output>
+void find_many(const KeyEqual& equal,
+               std::size_t n,
+               KeyAt& key_at,
+               FindOne& find_one,
+               ForwardIt first,
+               ForwardIt last,
+               Output& out,
+               std::true_type)
+{
+    const Key*  queries[find_many_batch_size];
+    std::size_t results[find_many_batch_size];
+    std::size_t first_of[find_many_batch_size];
+
+    while (first != last)
+    {
+        std::size_t count = 0;
+
+        for (; first != last && count < find_many_batch_size; ++first, ++count)
+        {
+            queries[count] = std::addressof(*first);
+        }
+
+        if (count > find_many_hash_threshold)
+        {
+            sfl::dtl::find_many_hashed(equal, n, key_at, queries, count, results, first_of);
+
+            for (std::size_t q = 0; q < count; ++q)
+            {
+                out(results[q]);
+            }
+        }
+        else
+        {
+            for (std::size_t q = 0; q < count; ++q)
+            {
+                out(find_one(*queries[q]));
+            }
+        }
+    }
+}
+
+//
+// Searches array of `n` elements for each key in range [first, last).
+// Function `key_at(i)` must return reference to key of element `i`, and
+// function `find_one(key)` must return index of the first element whose key
+// is equivalent to `key`, or `n` if there is no such element. For each
+// query key, in order, calls `out(i)` where `i` is that index.
+//
+// If keys satisfy `is_hash_searchable`, query keys are processed in batches
+// of up to `find_many_batch_size` keys. Large batches are put into a small
+// hash table and elements are scanned once per batch; the scan stops as
+// soon as all keys of the batch are found. Other keys and small batches are
+// searched for using `find_one`, which is faster than comparing each element
+// with every query key.
+//
+template <typename Key, typename KeyEqual, typename KeyAt, typename FindOne, typename ForwardIt, typename Output>
+void find_many(const KeyEqual& equal,
+               std::size_t n,
+               KeyAt&& key_at,
+               FindOne&& find_one,
+               ForwardIt first,
+               ForwardIt last,
+               Output&& out)
+{
+    static_assert
+    (
+        sfl::dtl::is_forward_iterator<ForwardIt>::value &&
+        std::is_same
+        <
+            typename std::remove_cv<typename std::iterator_traits<ForwardIt>::value_type>::type,
+            Key
+        >::value,
+        "ForwardIt must be forward iterator with value type key_type."
+    );
+
+    sfl::dtl::find_many<Key>
+    (
+        equal, n, key_at, find_one, first, last, out,
+        sfl::dtl::is_hash_searchable<Key, KeyEqual>()
+    );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+// EXCEPTIONS
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+[[noreturn]]
+inline void throw_length_error(const char* msg)
+{
+    #ifdef SFL_NO_EXCEPTIONS
+    sfl::dtl::ignore_unused(msg);
+    SFL_ASSERT(!"std::length_error thrown");
+    std::abort();
+    #else
+    throw std::length_error(msg);
+    #endif
+}
+
+[[noreturn]]
+inline void throw_bad_alloc()
+{
+    #ifdef SFL_NO_EXCEPTIONS
+    SFL_ASSERT(!"std::bad_alloc thrown");
+    std::abort();
+    #else
+    throw std::bad_alloc();
+    #endif
+}
+
+[[noreturn]]
+inline void throw_out_of_range(const char* msg)
+{
+    #ifdef SFL_NO_EXCEPTIONS
+    sfl::dtl::ignore_unused(msg);
+    SFL_ASSERT(!"std::out_of_range thrown");
+    std::abort();
+    #else
+    throw std::out_of_range(msg);
+    #endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+// INDEX SEQUENCE
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+template <std::size_t... Ints>
+struct index_sequence
+{
+    using type = index_sequence;
+};
+
+template <typename IndexSequence1, typename IndexSequence2>
+struct index_sequence_concat;
+
+template <std::size_t... Ints1, std::size_t... Ints2>
+struct index_sequence_concat< sfl::dtl::index_sequence<Ints1...>,
+                              sfl::dtl::index_sequence<Ints2...> >
+    : sfl::dtl::index_sequence<Ints1..., (sizeof...(Ints1) + Ints2)...>
+{};
+
+template <std::size_t N>
+struct make_index_sequence
+    : index_sequence_concat< typename sfl::dtl::index_sequence<N/2>::type,
+                             typename sfl::dtl::index_sequence<N - N/2>::type >::type
+{};
+
+template <>
+struct make_index_sequence<0> : sfl::dtl::index_sequence<>
+{};
+
+template <>
+struct make_index_sequence<1> : sfl::dtl::index_sequence<0>
+{};
+
+template <typename... T>
+using index_sequence_for = sfl::dtl::make_index_sequence<sizeof...(T)>;
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+// SCOPE GUARD
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+template <typename Lambda>
+class scope_guard
+{
+private:
+
+    mutable bool dismissed_;
+
+    Lambda lambda_;
+
+public:
+
+    scope_guard(Lambda&& lambda)
+        : dismissed_(false)
+        , lambda_(std::forward<Lambda>(lambda))
+    {}
+
+    scope_guard(const scope_guard& other) = delete;
+
+    scope_guard(scope_guard&& other)
+        : dismissed_(other.dismissed_)
+        , lambda_(std::move(other.lambda_))
+    {
+        other.dismissed_ = true;
+    }
+
+    scope_guard& operator=(const scope_guard& other) = delete;
+
+    scope_guard& operator=(scope_guard&& other)
+    {
+        dismissed_ = other.dismissed_;
+        lambda_ = std::move(other.lambda_);
         other.dismissed_ = true;
     }
 
-    ~scope_guard()
+    ~scope_guard()
+    {
+        if (!dismissed_)
+        {
+            lambda_();
+        }
+    }
+
+    void dismiss() const noexcept
+    {
+        dismissed_ = true;
+    }
+};
+
+template <typename Lambda>
+scope_guard<Lambda> make_scope_guard(Lambda&& lambda)
+{
+    return scope_guard<Lambda>(std::forward<Lambda>(lambda));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+// BULK INSERTION
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+//
+// Appends each element of range [first, last) whose key is not equivalent
+// to the key of any of `n` existing elements nor to the key of a preceding
+// element of the range. Function `key_at(i)` must return reference to key
+// of existing element `i`, `key_of(x)` must return reference to key of
+// value `x`, and `append(x)` must append value `x` after existing elements.
+// Keys must satisfy `is_hash_searchable`.
+//
+// Keys of all elements are put into temporary open addressing hash table
+// of element indexes allocated using `alloc`, so each element of the range
+// is checked in O(1) time. The table has at least `2 * (n + m)` slots, where
+// `m` is the number of elements in the range.
+//
+template <typename Key,
+          typename KeyEqual,
+          typename IndexAllocator,
+          typename KeyAt,
+          typename KeyOf,
+          typename Append,
+          typename ForwardIt>
+void insert_unique_hashed(const KeyEqual& equal,
+                          IndexAllocator& alloc,
+                          std::size_t n,
+                          std::size_t m,
+                          KeyAt&& key_at,
+                          KeyOf&& key_of,
+                          Append&& append,
+                          ForwardIt first,
+                          ForwardIt last)
+{
+    using index_type = typename std::allocator_traits<IndexAllocator>::value_type;
+
+    std::size_t num_slots = 16;
+    unsigned shift = 64 - 4;
+
+    while (num_slots / 2 < n + m)
+    {
+        num_slots *= 2;
+        --shift;
+    }
+
+    const auto table = sfl::dtl::allocate(alloc, num_slots);
+
+    const auto guard = sfl::dtl::make_scope_guard([&]()
+    {
+        sfl::dtl::deallocate(alloc, table, num_slots);
+    });
+
+    // Slot holds index of element plus one, or zero if it is empty.
+    index_type* const slots = sfl::dtl::to_address(table);
+
+    std::fill_n(slots, num_slots, index_type(0));
+
+    const std::size_t mask = num_slots - 1;
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        std::size_t s = std::size_t(sfl::dtl::key_hash(key_at(i)) >> shift);
+
+        while (slots[s] != 0)
+        {
+            s = (s + 1) & mask;
+        }
+
+        slots[s] = index_type(i + 1);
+    }
+
+    for (; first != last; ++first)
+    {
+        const Key& key = key_of(*first);
+
+        std::size_t s = std::size_t(sfl::dtl::key_hash(key) >> shift);
+
+        while (slots[s] != 0 && !equal(key_at(slots[s] - 1), key))
+        {
+            s = (s + 1) & mask;
+        }
+
+        if (slots[s] == 0)
+        {
+            append(*first);
+            slots[s] = index_type(++n);
+        }
+    }
+}
+
+//
+// Same as above, but without dynamic memory allocation. Range is processed
+// in batches of up to `find_many_batch_size` elements. Keys of a batch are
+// put into a small hash table on stack, and existing elements are scanned
+// once per batch.
+//
+template <typename Key,
+          typename KeyEqual,
+          typename KeyAt,
+          typename KeyOf,
+          typename Append,
+          typename ForwardIt>
+void insert_unique_batched(const KeyEqual& equal,
+                           std::size_t n,
+                           KeyAt&& key_at,
+                           KeyOf&& key_of,
+                           Append&& append,
+                           ForwardIt first,
+                           ForwardIt last)
+{
+    constexpr std::size_t num_slots = 2 * find_many_batch_size;
+
+    ForwardIt batch[find_many_batch_size];
+    bool      keep[find_many_batch_size];
+
+    while (first != last)
+    {
+        // Slot holds index of element of the batch plus one, or zero if it
+        // is empty. Repeated key is not inserted and its element is dropped.
+        unsigned char slots[num_slots] = {};
+
+        std::size_t count = 0;
+        std::size_t num_kept = 0;
+
+        for (; first != last && count < find_many_batch_size; ++first, ++count)
+        {
+            const Key& key = key_of(*first);
+
+            std::size_t s = sfl::dtl::find_many_slot(key);
+
+            while (slots[s] != 0 && !equal(key_of(*batch[slots[s] - 1]), key))
+            {
+                s = (s + 1) % num_slots;
+            }
+
+            batch[count] = first;
+            keep[count] = slots[s] == 0;
+
+            if (keep[count])
+            {
+                slots[s] = static_cast<unsigned char>(count + 1);
+                ++num_kept;
+            }
+        }
+
+        for (std::size_t i = 0; i < n && num_kept != 0; ++i)
+        {
+            const Key& key = key_at(i);
+
+            std::size_t s = sfl::dtl::find_many_slot(key);
+
+            while (slots[s] != 0)
+            {
+                const std::size_t q = slots[s] - 1;
+
+                if (equal(key, key_of(*batch[q])))
+                {
+                    if (keep[q])
+                    {
+                        keep[q] = false;
+                        --num_kept;
+                    }
+
+                    break;
+                }
+
+                s = (s + 1) % num_slots;
+            }
+        }
+
+        for (std::size_t q = 0; q < count; ++q)
+        {
+            if (keep[q])
+            {
+                append(*batch[q]);
+                ++n;
+            }
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+// SORTED BULK INSERTION
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+//
+// Reverses range [first, last). Unlike std::reverse, elements are swapped
+// using unqualified `swap`, so proxy iterators are supported too.
+//
+template <typename RandomIt>
+SFL_CONSTEXPR_20
+void reverse(RandomIt first, RandomIt last)
+{
+    using std::swap;
+
+    while (first < last && first < --last)
+    {
+        swap(*first, *last);
+        ++first;
+    }
+}
+
+//
+// Rotates range [first, last) so that `middle` becomes the first element.
+// Returns iterator to the new position of `*first`. Unlike std::rotate,
+// elements are swapped using unqualified `swap`, so proxy iterators are
+// supported too.
+//
+template <typename RandomIt>
+SFL_CONSTEXPR_20
+RandomIt rotate(RandomIt first, RandomIt middle, RandomIt last)
+{
+    sfl::dtl::reverse(first, middle);
+    sfl::dtl::reverse(middle, last);
+    sfl::dtl::reverse(first, last);
+    return first + (last - middle);
+}
+
+//
+// Merges two consecutive sorted ranges [first, middle) and [middle, last)
+// into one sorted range [first, last). The merge is stable: equivalent
+// elements from the first range precede elements from the second range.
+//
+// Unlike std::inplace_merge, this function never allocates a temporary
+// buffer. It uses SymMerge algorithm (Kim and Kutzner, 2004) which makes
+// O(m * log(n / m + 1)) comparisons and O((n + m) * log(n + m)) moves,
+// where `m` and `n` are sizes of the shorter and longer range.
+//
+template <typename RandomIt, typename Compare>
+SFL_CONSTEXPR_20
+void merge_in_place(RandomIt first, RandomIt middle, RandomIt last, Compare& comp)
+{
+    using difference_type = typename std::iterator_traits<RandomIt>::difference_type;
+
+    if (first == middle || middle == last || !comp(*middle, *(middle - 1)))
+    {
+        return;
+    }
+
+    if (middle - first == 1)
+    {
+        const RandomIt pos = std::lower_bound(middle, last, *first, comp);
+        sfl::dtl::rotate(first, middle, pos);
+        return;
+    }
+
+    if (last - middle == 1)
+    {
+        const RandomIt pos = std::upper_bound(first, middle, *middle, comp);
+        sfl::dtl::rotate(pos, middle, last);
+        return;
+    }
+
+    const difference_type a = 0;
+    const difference_type m = middle - first;
+    const difference_type b = last - first;
+
+    const difference_type mid = (a + b) / 2;
+    const difference_type n = mid + m;
+
+    difference_type start;
+    difference_type r;
+
+    if (m > mid)
+    {
+        start = n - b;
+        r = mid;
+    }
+    else
+    {
+        start = a;
+        r = m;
+    }
+
+    const difference_type p = n - 1;
+
+    while (start < r)
+    {
+        const difference_type c = (start + r) / 2;
+
+        if (!comp(first[p - c], first[c]))
+        {
+            start = c + 1;
+        }
+        else
+        {
+            r = c;
+        }
+    }
+
+    const difference_type end = n - start;
+
+    if (start < m && m < end)
+    {
+        sfl::dtl::rotate(first + start, first + m, first + end);
+    }
+
+    if (a < start && start < mid)
+    {
+        sfl::dtl::merge_in_place(first, first + start, first + mid, comp);
+    }
+
+    if (mid < end && end < b)
+    {
+        sfl::dtl::merge_in_place(first + mid, first + end, last, comp);
+    }
+}
+
+//
+// Sorts range [first, last) using insertion sort. The sort is stable.
+//
+template <typename RandomIt, typename Compare>
+SFL_CONSTEXPR_20
+void insertion_sort(RandomIt first, RandomIt last, Compare& comp)
+{
+    using value_type = typename std::iterator_traits<RandomIt>::value_type;
+
+    if (first == last)
+    {
+        return;
+    }
+
+    for (RandomIt it = first + 1; it != last; ++it)
+    {
+        if (comp(*it, *(it - 1)))
+        {
+            value_type tmp(std::move(*it));
+
+            RandomIt pos = it;
+
+            do
+            {
+                *pos = std::move(*(pos - 1));
+                --pos;
+            }
+            while (pos != first && comp(tmp, *(pos - 1)));
+
+            *pos = std::move(tmp);
+        }
+    }
+}
+
+//
+// Sorts range [first, last). The sort is stable. Unlike std::stable_sort,
+// this function never allocates a temporary buffer: short runs are sorted
+// using insertion sort and then merged using `merge_in_place`.
+//
+template <typename RandomIt, typename Compare>
+SFL_CONSTEXPR_20
+void stable_sort_in_place(RandomIt first, RandomIt last, Compare& comp)
+{
+    using difference_type = typename std::iterator_traits<RandomIt>::difference_type;
+
+    const difference_type block_size = 32;
+
+    const difference_type n = last - first;
+
+    for (difference_type i = 0; i < n; i += block_size)
+    {
+        sfl::dtl::insertion_sort(first + i, first + std::min(i + block_size, n), comp);
+    }
+
+    for (difference_type width = block_size; width < n; width *= 2)
+    {
+        for (difference_type i = 0; n - i > width; i += 2 * width)
+        {
+            sfl::dtl::merge_in_place
+            (
+                first + i,
+                first + i + width,
+                first + std::min(i + 2 * width, n),
+                comp
+            );
+        }
+    }
+}
+
+//
+// Removes all but the first element from every group of consecutive
+// equivalent elements in sorted range [first, last). Returns iterator
+// one past the last kept element. Elements after it are left in valid
+// but unspecified state.
+//
+template <typename RandomIt, typename Compare>
+SFL_CONSTEXPR_20
+RandomIt unique_sorted(RandomIt first, RandomIt last, Compare& comp)
+{
+    if (first == last)
+    {
+        return last;
+    }
+
+    RandomIt result = first;
+
+    while (++first != last)
+    {
+        if (comp(*result, *first))
+        {
+            if (++result != first)
+            {
+                *result = std::move(*first);
+            }
+        }
+    }
+
+    return ++result;
+}
+
+//
+// Merges two sorted ranges [first1, last1) and [first2, last2) into range
+// beginning at `d_first` by moving elements. The merge is stable: elements
+// from the first range precede equivalent elements from the second range.
+//
+template <typename InputIt1, typename InputIt2, typename OutputIt, typename Compare>
+OutputIt merge_move(InputIt1 first1, InputIt1 last1,
+                    InputIt2 first2, InputIt2 last2,
+                    OutputIt d_first, Compare& comp)
+{
+    while (first1 != last1 && first2 != last2)
+    {
+        if (comp(*first2, *first1))
+        {
+            *d_first = std::move(*first2);
+            ++first2;
+        }
+        else
+        {
+            *d_first = std::move(*first1);
+            ++first1;
+        }
+
+        ++d_first;
+    }
+
+    d_first = sfl::dtl::move(first1, last1, d_first);
+
+    return sfl::dtl::move(first2, last2, d_first);
+}
+
+//
+// Sorts range [first, last) of elements constructed by allocator `a`. The
+// sort is stable. Unlike `stable_sort_in_place`, this function allocates
+// a temporary buffer from `a` and merges runs into it and back, so it makes
+// O(n * log(n)) moves instead of O(n * log(n)^2).
+//
+// If an exception is thrown, elements are left in valid but unspecified
+// state.
+//
+template <typename Allocator, typename Pointer, typename Compare>
+void stable_sort_with_buffer(Allocator& a, Pointer first, Pointer last, Compare& comp)
+{
+    using size_type = typename std::allocator_traits<Allocator>::size_type;
+
+    const size_type block_size = 32;
+
+    const size_type n = std::distance(first, last);
+
+    for (size_type i = 0; i < n; i += block_size)
+    {
+        sfl::dtl::insertion_sort(first + i, first + std::min(i + block_size, n), comp);
+    }
+
+    if (n <= block_size)
+    {
+        return;
+    }
+
+    const Pointer buffer = sfl::dtl::allocate(a, n);
+
+    size_type constructed = 0;
+
+    SFL_TRY
+    {
+        for (; constructed != n; ++constructed)
+        {
+            sfl::dtl::construct_at_a(a, buffer + constructed, std::move(first[constructed]));
+        }
+
+        Pointer src = buffer;
+        Pointer dst = first;
+
+        for (size_type width = block_size; width < n; width *= 2)
+        {
+            for (size_type i = 0; i < n; i += 2 * width)
+            {
+                const size_type mid = std::min(i + width, n);
+                const size_type end = std::min(i + 2 * width, n);
+
+                sfl::dtl::merge_move(src + i, src + mid, src + mid, src + end, dst + i, comp);
+            }
+
+            std::swap(src, dst);
+        }
+
+        if (src != first)
+        {
+            sfl::dtl::move(buffer, buffer + n, first);
+        }
+    }
+    SFL_CATCH (...)
+    {
+        sfl::dtl::destroy_a(a, buffer, buffer + constructed);
+        sfl::dtl::deallocate(a, buffer, n);
+        SFL_RETHROW;
+    }
+
+    sfl::dtl::destroy_a(a, buffer, buffer + n);
+    sfl::dtl::deallocate(a, buffer, n);
+}
+
+//
+// Merges sorted range [middle, last) into sorted range [first, middle) of
+// elements constructed by allocator `a`, using temporary buffers from `a`.
+// Elements of [middle, last) precede equivalent elements of [first, middle).
+// If `unique` is true, elements of [middle, last) that are equivalent to an
+// element of [first, middle) are destroyed instead. Sets `last` to one past
+// the last element of the result.
+//
+// The function makes O(n + m) comparisons and moves, where `n` and `m` are
+// sizes of the two ranges. All comparisons are made before any element is
+// moved, so if comparison or allocation throws, both ranges are unchanged.
+// If moving an element of [middle, last) throws, [first, middle) is
+// unchanged and elements of [middle, last) are destroyed. If moving an
+// element of [first, middle) throws, all elements are destroyed. In both
+// cases `last` is set to one past the last remaining element.
+//
+template <typename Allocator, typename Pointer, typename Compare>
+void merge_with_buffer(Allocator& a, Pointer first, Pointer middle, Pointer& last,
+                       Compare& comp, bool unique)
+{
+    using allocator_traits = std::allocator_traits<Allocator>;
+    using value_type = typename allocator_traits::value_type;
+    using size_type = typename allocator_traits::size_type;
+    using index_allocator = typename allocator_traits::template rebind_alloc<size_type>;
+    using index_pointer = typename std::allocator_traits<index_allocator>::pointer;
+
+    const size_type npos = size_type(-1);
+
+    const size_type n = std::distance(first, middle);
+    const size_type m = std::distance(middle, last);
+
+    if (n == 0 || m == 0)
+    {
+        return;
+    }
+
+    index_allocator ia(a);
+
+    // Number of elements of [first, middle) that precede each element of
+    // [middle, last) in the result, or `npos` if that element is dropped.
+    index_pointer pos = nullptr;
+
+    Pointer buffer = nullptr;
+
+    // Number of kept elements and number of them moved to the buffer.
+    size_type k = 0;
+    size_type q = 0;
+
+    bool moving = false;
+
+    SFL_TRY
+    {
+        pos = sfl::dtl::allocate(ia, m);
+
+        size_type i = 0;
+
+        for (size_type j = 0; j != m; ++j)
+        {
+            while (i != n && comp(first[i], middle[j]))
+            {
+                ++i;
+            }
+
+            if (unique && i != n && !comp(middle[j], first[i]))
+            {
+                pos[j] = npos;
+            }
+            else
+            {
+                pos[j] = i;
+                ++k;
+            }
+        }
+
+        buffer = sfl::dtl::allocate(a, k);
+
+        moving = true;
+
+        // Positions of kept elements are packed to the front of `pos`.
+        for (size_type j = 0; j != m; ++j)
+        {
+            if (pos[j] != npos)
+            {
+                sfl::dtl::construct_at_a(a, buffer + q, std::move(middle[j]));
+                pos[q] = pos[j];
+                ++q;
+            }
+        }
+    }
+    SFL_CATCH (...)
+    {
+        if (moving)
+        {
+            sfl::dtl::destroy_a(a, middle, last);
+            last = middle;
+        }
+
+        sfl::dtl::destroy_a(a, buffer, buffer + q);
+        sfl::dtl::deallocate(a, buffer, k);
+        sfl::dtl::deallocate(ia, pos, m);
+        SFL_RETHROW;
+    }
+
+    sfl::dtl::destroy_a(a, middle, last);
+    last = middle;
+
+    // Elements are placed from back to front, so every position is written
+    // once. Positions at `middle` and above are not constructed yet; those
+    // in [tail, middle + k) already are.
+    Pointer tail = middle + k;
+
+    SFL_TRY
+    {
+        Pointer out = middle + k;
+
+        const auto place = [&](value_type& x)
+        {
+            --out;
+
+            if (out < middle)
+            {
+                *out = std::move(x);
+            }
+            else
+            {
+                sfl::dtl::construct_at_a(a, out, std::move(x));
+                tail = out;
+            }
+        };
+
+        size_type i = n;
+
+        for (size_type j = k; j-- != 0; )
+        {
+            while (i != pos[j])
+            {
+                --i;
+                place(first[i]);
+            }
+
+            place(buffer[j]);
+        }
+    }
+    SFL_CATCH (...)
+    {
+        // Order of elements is unknown, so they are all removed.
+        sfl::dtl::destroy_a(a, first, middle);
+        sfl::dtl::destroy_a(a, tail, middle + k);
+        last = first;
+
+        sfl::dtl::destroy_a(a, buffer, buffer + k);
+        sfl::dtl::deallocate(a, buffer, k);
+        sfl::dtl::deallocate(ia, pos, m);
+        SFL_RETHROW;
+    }
+
+    last = middle + k;
+
+    sfl::dtl::destroy_a(a, buffer, buffer + k);
+    sfl::dtl::deallocate(a, buffer, k);
+    sfl::dtl::deallocate(ia, pos, m);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+// EYTZINGER INDEX
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+//
+// Smallest unsigned integer type that can hold all values in range [0, N].
+//
+template <std::size_t N>
+using uint_for_t =
+    typename std::conditional<(N <= 0xFFu), std::uint8_t,
+    typename std::conditional<(N <= 0xFFFFu), std::uint16_t,
+    typename std::conditional<(N <= 0xFFFFFFFFu), std::uint32_t,
+    std::size_t>::type>::type>::type;
+
+//
+// Hints the processor that memory at `p` will be read soon.
+//
+SFL_CONSTEXPR_20
+inline void prefetch(const void* p) noexcept
+{
+    #if __cplusplus >= 202002L
+    if (std::is_constant_evaluated())
+    {
+        return;
+    }
+    #endif
+
+    #if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(p);
+    #elif defined(SFL_SIMD_SSE2)
+    _mm_prefetch(static_cast<const char*>(p), _MM_HINT_T0);
+    #else
+    (void)p;
+    #endif
+}
+
+//
+// Read-only search index for sorted flat containers. It holds copies of
+// up to N keys in Eytzinger (breadth-first) order: node `k` has children
+// `2k` and `2k + 1`, so the first levels of every search share a few cache
+// lines and deeper levels can be prefetched. Primary template is empty and
+// is used when the index is disabled.
+//
+template <typename Key, std::size_t N, bool Enabled>
+class eytzinger_index
+{
+public:
+
+    SFL_CONSTEXPR_20
+    bool indexed() const noexcept
+    {
+        return false;
+    }
+
+    SFL_CONSTEXPR_20
+    void clear_index() noexcept
+    {}
+
+    template <typename RandomIt, typename GetKey>
+    SFL_CONSTEXPR_20
+    void build_index(RandomIt, std::size_t, GetKey) noexcept
+    {}
+
+    // Never called because `indexed()` is always false.
+    template <typename K, typename Compare>
+    SFL_CONSTEXPR_20
+    std::size_t index_lower_bound(const K&, const Compare&) const noexcept
+    {
+        return 0;
+    }
+
+    // Never called because `indexed()` is always false.
+    template <typename K, typename Compare>
+    SFL_CONSTEXPR_20
+    std::size_t index_upper_bound(const K&, const Compare&) const noexcept
+    {
+        return 0;
+    }
+};
+
+template <typename Key, std::size_t N>
+class eytzinger_index<Key, N, true>
+{
+private:
+
+    using index_type = sfl::dtl::uint_for_t<N>;
+
+    // Search prefetches nodes four levels below the current node. They are
+    // stored contiguously starting at `16 * k`.
+    static constexpr std::size_t prefetch_distance = 16;
+
+    // Element at index 0 is not used.
+    union
+    {
+        Key keys_[N + 1];
+    };
+
+    // Position of `keys_[k]` in the sorted array.
+    index_type pos_[N + 1];
+
+    std::size_t size_;
+
+    bool indexed_;
+
+public:
+
+    eytzinger_index() noexcept
+        : size_(0)
+        , indexed_(false)
+    {}
+
+    eytzinger_index(const eytzinger_index&) = delete;
+
+    eytzinger_index& operator=(const eytzinger_index&) = delete;
+
+    #if defined(__clang__) && (__clang_major__ == 3) // For CentOS 7
+    ~eytzinger_index()
+    #else
+    ~eytzinger_index() noexcept
+    #endif
+    {
+        clear_index();
+    }
+
+    bool indexed() const noexcept
+    {
+        return indexed_;
+    }
+
+    void clear_index() noexcept
+    {
+        if (indexed_)
+        {
+            sfl::dtl::destroy(keys_ + 1, keys_ + 1 + size_);
+            size_ = 0;
+            indexed_ = false;
+        }
+    }
+
+    // Builds index of keys `get_key(first[0])`, ..., `get_key(first[n - 1])`,
+    // which must be sorted. If copying of a key throws, the index is empty.
+    template <typename RandomIt, typename GetKey>
+    void build_index(RandomIt first, std::size_t n, GetKey get_key)
+    {
+        SFL_ASSERT(n <= N);
+
+        clear_index();
+
+        std::size_t i = 0;
+
+        assign_positions(1, n, i);
+
+        std::size_t k = 1;
+
+        SFL_TRY
+        {
+            for (; k <= n; ++k)
+            {
+                sfl::dtl::construct_at(keys_ + k, get_key(first[pos_[k]]));
+            }
+        }
+        SFL_CATCH (...)
+        {
+            sfl::dtl::destroy(keys_ + 1, keys_ + k);
+            SFL_RETHROW;
+        }
+
+        size_ = n;
+        indexed_ = true;
+    }
+
+    // Returns position of the first key that is not less than `x`, or the
+    // number of keys if there is no such key.
+    template <typename K, typename Compare>
+    std::size_t index_lower_bound(const K& x, const Compare& comp) const
+    {
+        std::size_t k = 1;
+
+        while (k <= size_)
+        {
+            sfl::dtl::prefetch(keys_ + std::min(k * prefetch_distance, size_));
+            k = 2 * k + std::size_t(comp(keys_[k], x));
+        }
+
+        return position(k);
+    }
+
+    // Returns position of the first key that is greater than `x`, or the
+    // number of keys if there is no such key.
+    template <typename K, typename Compare>
+    std::size_t index_upper_bound(const K& x, const Compare& comp) const
+    {
+        std::size_t k = 1;
+
+        while (k <= size_)
+        {
+            sfl::dtl::prefetch(keys_ + std::min(k * prefetch_distance, size_));
+            k = 2 * k + std::size_t(!comp(x, keys_[k]));
+        }
+
+        return position(k);
+    }
+
+private:
+
+    // Assigns sorted positions to nodes of subtree `k` using in-order
+    // traversal. Recursion depth is log2(n).
+    void assign_positions(std::size_t k, std::size_t n, std::size_t& i) noexcept
+    {
+        if (k <= n)
+        {
+            assign_positions(2 * k, n, i);
+            pos_[k] = index_type(i++);
+            assign_positions(2 * k + 1, n, i);
+        }
+    }
+
+    // Search descends right at 1 bits of `k`. The result is the last node
+    // where it descended left, so trailing 1 bits and one 0 bit are removed.
+    std::size_t position(std::size_t k) const noexcept
+    {
+        k >>= sfl::dtl::count_trailing_zeros(static_cast<unsigned long long>(~k)) + 1;
+        return k == 0 ? size_ : std::size_t(pos_[k]);
+    }
+};
+
+//
+// Read-only learned search index for sorted flat containers with arithmetic
+// keys ordered by built-in operator <. Range of keys [min, max] is divided
+// into equally wide segments, and position of a key is predicted by linear
+// interpolation between positions of the first keys of its segment and of
+// the next segment. Each segment stores the largest prediction error of its
+// keys, so the key is searched for only in a few elements around predicted
+// position. This is a piecewise linear model of the distribution of keys:
+// for smooth distributions the window holds a few elements, and for any
+// distribution it is bounded by the segment. Primary template is empty and
+// is used when the index is disabled.
+//
+template <typename Key, std::size_t N, bool Enabled>
+class learned_index
+{
+public:
+
+    SFL_CONSTEXPR_20
+    bool fitted() const noexcept
+    {
+        return false;
+    }
+
+    SFL_CONSTEXPR_20
+    void clear_model() noexcept
+    {}
+
+    template <typename RandomIt, typename GetKey>
+    SFL_CONSTEXPR_20
+    void fit_model(RandomIt, std::size_t, GetKey) noexcept
+    {}
+
+    // Never called because `fitted()` is always false.
+    template <typename K>
+    SFL_CONSTEXPR_20
+    std::pair<std::size_t, std::size_t> model_window(const K&) const noexcept
+    {
+        return std::make_pair(std::size_t(0), std::size_t(0));
+    }
+};
+
+template <typename Key, std::size_t N>
+class learned_index<Key, N, true>
+{
+    static_assert
+    (
+        std::is_arithmetic<Key>::value && !std::is_same<Key, bool>::value,
+        "Key must be arithmetic type other than bool."
+    );
+
+private:
+
+    using index_type = sfl::dtl::uint_for_t<N>;
+
+    // Average number of keys per segment. Segments of all keys take about
+    // `4 * N / keys_per_segment` bytes for N up to 65535.
+    static constexpr std::size_t keys_per_segment = 32;
+
+    static constexpr std::size_t max_segments = N / keys_per_segment + 1;
+
+    struct segment
+    {
+        // Position of the first key in this segment or in any following
+        // segment, or the number of keys if there is no such key.
+        index_type first;
+
+        // Largest distance between predicted and actual position of keys
+        // in this segment.
+        index_type error;
+    };
+
+    // Element at index `segments_` only marks the end of the last segment.
+    segment segments_[max_segments + 1];
+
+    std::size_t segments_count_;
+
+    std::size_t size_;
+
+    Key min_;
+
+    Key max_;
+
+    // Number of segments per unit of distance from `min_`.
+    double scale_;
+
+    bool fitted_;
+
+public:
+
+    learned_index() noexcept
+        : segments_count_(0)
+        , size_(0)
+        , min_()
+        , max_()
+        , scale_(0)
+        , fitted_(false)
+    {}
+
+    learned_index(const learned_index&) = delete;
+
+    learned_index& operator=(const learned_index&) = delete;
+
+    bool fitted() const noexcept
+    {
+        return fitted_;
+    }
+
+    void clear_model() noexcept
+    {
+        fitted_ = false;
+    }
+
+    // Fits model to keys `get_key(first[0])`, ..., `get_key(first[n - 1])`,
+    // which must be sorted and unique.
+    template <typename RandomIt, typename GetKey>
+    void fit_model(RandomIt first, std::size_t n, GetKey get_key) noexcept
+    {
+        SFL_ASSERT(n <= N);
+
+        size_ = n;
+        segments_count_ = n / keys_per_segment + 1;
+
+        if (n == 0)
+        {
+            fitted_ = true;
+            return;
+        }
+
+        min_ = get_key(first[0]);
+        max_ = get_key(first[n - 1]);
+
+        const double span = distance(min_, max_);
+
+        scale_ = span > 0 ? double(segments_count_) / span : 0.0;
+
+        std::size_t s = 0;
+
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const std::size_t si = segment_of(distance(min_, get_key(first[i])) * scale_);
+
+            while (s <= si)
+            {
+                segments_[s].first = index_type(i);
+                segments_[s].error = 0;
+                ++s;
+            }
+        }
+
+        while (s <= segments_count_)
+        {
+            segments_[s].first = index_type(n);
+            segments_[s].error = 0;
+            ++s;
+        }
+
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const double y = distance(min_, get_key(first[i])) * scale_;
+
+            const std::size_t si = segment_of(y);
+
+            const std::size_t p = predict(si, y);
+
+            const std::size_t e = p < i ? i - p : p - i;
+
+            if (e > segments_[si].error)
+            {
+                segments_[si].error = index_type(e);
+            }
+        }
+
+        fitted_ = true;
+    }
+
+    // Returns range of positions [lo, hi) such that the position of the
+    // first key that is not less than `x` and the position of the first key
+    // that is greater than `x` are both in [lo, hi].
+    std::pair<std::size_t, std::size_t> model_window(const Key& x) const noexcept
+    {
+        // This also handles NaN.
+        if (size_ == 0 || !(min_ <= x))
+        {
+            return std::make_pair(std::size_t(0), std::size_t(0));
+        }
+
+        if (max_ < x)
+        {
+            return std::make_pair(size_, size_);
+        }
+
+        const double y = distance(min_, x) * scale_;
+
+        const std::size_t s = segment_of(y);
+
+        const std::size_t p = predict(s, y);
+
+        const std::size_t e = segments_[s].error;
+
+        return std::make_pair
+        (
+            std::max(std::size_t(segments_[s].first), p < e ? 0 : p - e),
+            std::min(std::size_t(segments_[s + 1].first), p + e + 1)
+        );
+    }
+
+    // Model is built only for keys of type `Key`. Other keys are searched
+    // for in all elements.
+    template <typename K,
+              sfl::dtl::enable_if_t<!std::is_same<K, Key>::value>* = nullptr>
+    std::pair<std::size_t, std::size_t> model_window(const K&) const noexcept
+    {
+        return std::make_pair(std::size_t(0), size_);
+    }
+
+private:
+
+    // Functions below are monotonic, so the order of predicted positions
+    // is the same as the order of keys, which bounds the prediction error
+    // of keys that are not in the container.
+
+    // Returns `y - x` as double. Requires `x <= y`.
+    template <typename K = Key,
+              sfl::dtl::enable_if_t<std::is_integral<K>::value>* = nullptr>
+    static double distance(const Key& x, const Key& y) noexcept
+    {
+        using unsigned_type = typename std::make_unsigned<Key>::type;
+        return double(unsigned_type(unsigned_type(y) - unsigned_type(x)));
+    }
+
+    template <typename K = Key,
+              sfl::dtl::enable_if_t<!std::is_integral<K>::value>* = nullptr>
+    static double distance(const Key& x, const Key& y) noexcept
+    {
+        return double(y - x);
+    }
+
+    std::size_t segment_of(double y) const noexcept
+    {
+        return y < double(segments_count_ - 1) ? std::size_t(y) : segments_count_ - 1;
+    }
+
+    std::size_t predict(std::size_t s, double y) const noexcept
+    {
+        const std::size_t first = segments_[s].first;
+        const std::size_t count = segments_[s + 1].first - first;
+        const double t = y - double(s);
+        return first + (t < 1.0 ? std::size_t(t * double(count)) : count);
+    }
+};
+
+//
+// Returns true if range [first, last) contains no equal elements. Makes
+// O(n^2) comparisons, so it is meant for assertions only.
+//
+template <typename ForwardIt, typename Equal>
+bool is_unique(ForwardIt first, ForwardIt last, Equal& equal)
+{
+    for (; first != last; ++first)
+    {
+        for (ForwardIt it = std::next(first); it != last; ++it)
+        {
+            if (equal(*first, *it))
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+//
+// Returns true if range [first, last) is sorted and contains no equivalent
+// elements.
+//
+template <typename ForwardIt, typename Compare>
+SFL_CONSTEXPR_20
+bool is_sorted_unique(ForwardIt first, ForwardIt last, Compare& comp)
+{
+    if (first == last)
+    {
+        return true;
+    }
+
+    ForwardIt next = first;
+
+    while (++next != last)
+    {
+        if (!comp(*first, *next))
+        {
+            return false;
+        }
+
+        first = next;
+    }
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+// PERFECT HASH
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+//
+// Mixes all bits of `x` into all bits of the result (finalizer of
+// SplitMix64). Unlike `hash_mix`, low bits of the result are as good as high
+// bits, so the result can be reduced modulo any number.
+//
+SFL_CONSTEXPR_14
+inline unsigned long long hash_avalanche(unsigned long long x) noexcept
+{
+    x ^= x >> 30;
+    x *= 0xBF58476D1CE4E5B9ULL;
+    x ^= x >> 27;
+    x *= 0x94D049BB133111EBULL;
+    x ^= x >> 31;
+    return x;
+}
+
+//
+// Computes FNV-1a hash of `n` characters starting at `p`.
+//
+template <typename CharT>
+SFL_CONSTEXPR_14
+unsigned long long hash_chars(const CharT* p, std::size_t n) noexcept
+{
+    using uchar_type = typename std::make_unsigned<CharT>::type;
+
+    unsigned long long h = 0xCBF29CE484222325ULL;
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        h ^= static_cast<unsigned long long>(static_cast<uchar_type>(p[i]));
+        h *= 0x100000001B3ULL;
+    }
+
+    return h;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+// BINARY SEARCH
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+//
+// True if `Compare` orders values of arithmetic type `T` using built-in
+// operator <, and values being searched for also have type `T`.
+//
+template <typename T, typename K, typename Compare>
+struct is_builtin_less : std::integral_constant
+<
+    bool,
+    std::is_arithmetic<T>::value &&
+    std::is_same<T, K>::value &&
+    (
+        std::is_same<sfl::dtl::remove_cvref_t<Compare>, std::less<T>>::value
+        #if __cplusplus >= 201402L
+        || std::is_same<sfl::dtl::remove_cvref_t<Compare>, std::less<>>::value
+        #endif
+    )
+> {};
+
+//
+// Search switches to linear scan when the number of remaining elements
+// is not greater than this threshold. Scan of arithmetic keys compiles to
+// a few vector instructions, so it pays off for longer ranges.
+//
+template <bool BuiltinLess>
+struct linear_search_threshold
+    : std::integral_constant<std::size_t, BuiltinLess ? 8 : 4>
+{};
+
+//
+// Prefetches element `it[n]` if elements are real objects, i.e. if the
+// iterator is not a proxy iterator.
+//
+template <typename RandomIt,
+          sfl::dtl::enable_if_t<std::is_lvalue_reference<typename std::iterator_traits<RandomIt>::reference>::value>* = nullptr>
+SFL_CONSTEXPR_20
+void prefetch_element(RandomIt it, std::size_t n) noexcept
+{
+    sfl::dtl::prefetch(std::addressof(it[n]));
+}
+
+template <typename RandomIt,
+          sfl::dtl::enable_if_t<!std::is_lvalue_reference<typename std::iterator_traits<RandomIt>::reference>::value>* = nullptr>
+SFL_CONSTEXPR_20
+void prefetch_element(RandomIt, std::size_t) noexcept
+{}
+
+//
+// Returns iterator to the first element in range [first, first + n) for
+// which `pred` returns false. The range must be partitioned by `pred`.
+//
+// The loop has no data-dependent branches: the position of the next probe
+// is selected by conditional move, so it does not suffer from branch
+// mispredictions on random keys. Both possible next probes are prefetched
+// before the current one is compared. When at most `Threshold` elements
+// remain, they are counted by linear scan.
+//
+template <std::size_t Threshold, typename RandomIt, typename Predicate>
+SFL_CONSTEXPR_20
+RandomIt branchless_partition_point(RandomIt first, std::size_t n, Predicate pred)
+{
+    using difference_type = typename std::iterator_traits<RandomIt>::difference_type;
+
+    static_assert(Threshold > 0, "Threshold must be greater than zero.");
+
+    while (n > Threshold)
+    {
+        const std::size_t half = n / 2;
+        const std::size_t rest = n - half;
+
+        sfl::dtl::prefetch_element(first, rest / 2);
+        sfl::dtl::prefetch_element(first, half + rest / 2);
+
+        first += pred(first[difference_type(half)]) ? difference_type(half) : difference_type(0);
+        n = rest;
+    }
+
+    std::size_t count = 0;
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        count += std::size_t(pred(first[difference_type(i)]));
+    }
+
+    return first + difference_type(count);
+}
+
+template <typename RandomIt, typename K, typename Compare,
+          sfl::dtl::enable_if_t<is_builtin_less<typename std::iterator_traits<RandomIt>::value_type, K, Compare>::value>* = nullptr>
+SFL_CONSTEXPR_20
+RandomIt lower_bound(RandomIt first, RandomIt last, const K& x, Compare&)
+{
+    using value_type = typename std::iterator_traits<RandomIt>::value_type;
+
+    return sfl::dtl::branchless_partition_point<linear_search_threshold<true>::value>
+    (
+        first,
+        std::size_t(last - first),
+        [&x](const value_type& y) { return y < x; }
+    );
+}
+
+template <typename RandomIt, typename K, typename Compare,
+          sfl::dtl::enable_if_t<!is_builtin_less<typename std::iterator_traits<RandomIt>::value_type, K, Compare>::value>* = nullptr>
+SFL_CONSTEXPR_20
+RandomIt lower_bound(RandomIt first, RandomIt last, const K& x, Compare& comp)
+{
+    using reference = typename std::iterator_traits<RandomIt>::reference;
+
+    return sfl::dtl::branchless_partition_point<linear_search_threshold<false>::value>
+    (
+        first,
+        std::size_t(last - first),
+        [&x, &comp](reference y) { return bool(comp(y, x)); }
+    );
+}
+
+template <typename RandomIt, typename K, typename Compare,
+          sfl::dtl::enable_if_t<is_builtin_less<typename std::iterator_traits<RandomIt>::value_type, K, Compare>::value>* = nullptr>
+SFL_CONSTEXPR_20
+RandomIt upper_bound(RandomIt first, RandomIt last, const K& x, Compare&)
+{
+    using value_type = typename std::iterator_traits<RandomIt>::value_type;
+
+    return sfl::dtl::branchless_partition_point<linear_search_threshold<true>::value>
+    (
+        first,
+        std::size_t(last - first),
+        [&x](const value_type& y) { return !(x < y); }
+    );
+}
+
+template <typename RandomIt, typename K, typename Compare,
+          sfl::dtl::enable_if_t<!is_builtin_less<typename std::iterator_traits<RandomIt>::value_type, K, Compare>::value>* = nullptr>
+SFL_CONSTEXPR_20
+RandomIt upper_bound(RandomIt first, RandomIt last, const K& x, Compare& comp)
+{
+    using reference = typename std::iterator_traits<RandomIt>::reference;
+
+    return sfl::dtl::branchless_partition_point<linear_search_threshold<false>::value>
+    (
+        first,
+        std::size_t(last - first),
+        [&x, &comp](reference y) { return !comp(x, y); }
+    );
+}
+
+//
+// Like std::equal_range, but uses branchless `lower_bound` and then
+// searches for the upper bound exponentially from the lower bound, since
+// equivalent elements are usually few (at most one in unique containers).
+//
+template <typename RandomIt, typename K, typename Compare>
+SFL_CONSTEXPR_20
+std::pair<RandomIt, RandomIt> equal_range(RandomIt first, RandomIt last, const K& x, Compare& comp)
+{
+    using difference_type = typename std::iterator_traits<RandomIt>::difference_type;
+
+    const RandomIt lower = sfl::dtl::lower_bound(first, last, x, comp);
+
+    if (lower == last || comp(x, *lower))
+    {
+        return std::make_pair(lower, lower);
+    }
+
+    const difference_type n = last - lower;
+
+    // Elements in range [lower, lower + bound / 2] are equivalent to `x`.
+    difference_type bound = 1;
+
+    while (bound < n && !comp(x, lower[bound]))
+    {
+        bound *= 2;
+    }
+
+    const RandomIt upper = sfl::dtl::upper_bound
+    (
+        lower + (bound / 2 + 1),
+        lower + std::min(bound, n),
+        x,
+        comp
+    );
+
+    return std::make_pair(lower, upper);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+// SET OPERATIONS
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+//
+// Set operations gallop over the larger range instead of scanning it
+// when it has more than this many times as many elements as the smaller.
+//
+constexpr std::size_t set_operation_gallop_ratio = 32;
+
+//
+// Like `lower_bound`, but searches exponentially from `first`, so it takes
+// O(log d) comparisons, where `d` is the distance from `first` to result.
+//
+template <typename RandomIt, typename K, typename Compare>
+SFL_CONSTEXPR_20
+RandomIt gallop_lower_bound(RandomIt first, RandomIt last, const K& x, Compare& comp)
+{
+    using difference_type = typename std::iterator_traits<RandomIt>::difference_type;
+
+    const difference_type n = last - first;
+
+    // Elements in range [first, first + bound / 2) are less than `x`.
+    difference_type bound = 1;
+
+    while (bound <= n && comp(first[bound - 1], x))
     {
-        if (!dismissed_)
+        bound *= 2;
+    }
+
+    return sfl::dtl::lower_bound
+    (
+        first + bound / 2,
+        first + std::min(bound, n),
+        x,
+        comp
+    );
+}
+
+//
+// Returns true if range [first1, last1) should be searched by galloping
+// for each element of range [first2, last2), rather than merged with it.
+//
+template <typename RandomIt1, typename RandomIt2>
+SFL_CONSTEXPR_20
+bool should_gallop(RandomIt1 first1, RandomIt1 last1, RandomIt2 first2, RandomIt2 last2) noexcept
+{
+    return std::size_t(last2 - first2) * set_operation_gallop_ratio < std::size_t(last1 - first1);
+}
+
+//
+// Linear merge steps for std::set_intersection and std::set_difference.
+// If keys are arithmetic and compared using built-in operator <, both
+// iterators are advanced without branches, so loop does not suffer from
+// branch mispredictions on random keys. Functions return the position in
+// the first range where the merge stopped.
+//
+
+template <typename RandomIt1, typename RandomIt2, typename Compare, typename Function>
+SFL_CONSTEXPR_20
+RandomIt1 intersection_merge(RandomIt1 first1, RandomIt1 last1,
+                             RandomIt2 first2, RandomIt2 last2,
+                             Compare&, Function& f, std::true_type)
+{
+    using value_type = typename std::iterator_traits<RandomIt1>::value_type;
+
+    while (first1 != last1 && first2 != last2)
+    {
+        const value_type a = *first1;
+        const value_type b = *first2;
+
+        if (!(a < b) && !(b < a))
         {
-            lambda_();
+            f(*first1);
         }
+
+        first1 += !(b < a);
+        first2 += !(a < b);
     }
 
-    void dismiss() const noexcept
+    return first1;
+}
+
+template <typename RandomIt1, typename RandomIt2, typename Compare, typename Function>
+SFL_CONSTEXPR_20
+RandomIt1 intersection_merge(RandomIt1 first1, RandomIt1 last1,
+                             RandomIt2 first2, RandomIt2 last2,
+                             Compare& comp, Function& f, std::false_type)
+{
+    while (first1 != last1 && first2 != last2)
     {
-        dismissed_ = true;
+        if (comp(*first1, *first2))
+        {
+            ++first1;
+        }
+        else if (comp(*first2, *first1))
+        {
+            ++first2;
+        }
+        else
+        {
+            f(*first1);
+            ++first1;
+            ++first2;
+        }
     }
-};
 
-template <typename Lambda>
-scope_guard<Lambda> make_scope_guard(Lambda&& lambda)
+    return first1;
+}
+
+template <typename RandomIt1, typename RandomIt2, typename Compare, typename Function>
+SFL_CONSTEXPR_20
+RandomIt1 difference_merge(RandomIt1 first1, RandomIt1 last1,
+                           RandomIt2 first2, RandomIt2 last2,
+                           Compare&, Function& f, std::true_type)
 {
-    return scope_guard<Lambda>(std::forward<Lambda>(lambda));
+    using value_type = typename std::iterator_traits<RandomIt1>::value_type;
+
+    while (first1 != last1 && first2 != last2)
+    {
+        const value_type a = *first1;
+        const value_type b = *first2;
+
+        if (a < b)
+        {
+            f(*first1);
+        }
+
+        first1 += !(b < a);
+        first2 += !(a < b);
+    }
+
+    return first1;
+}
+
+template <typename RandomIt1, typename RandomIt2, typename Compare, typename Function>
+SFL_CONSTEXPR_20
+RandomIt1 difference_merge(RandomIt1 first1, RandomIt1 last1,
+                           RandomIt2 first2, RandomIt2 last2,
+                           Compare& comp, Function& f, std::false_type)
+{
+    while (first1 != last1 && first2 != last2)
+    {
+        if (comp(*first1, *first2))
+        {
+            f(*first1);
+            ++first1;
+        }
+        else if (comp(*first2, *first1))
+        {
+            ++first2;
+        }
+        else
+        {
+            ++first1;
+            ++first2;
+        }
+    }
+
+    return first1;
+}
+
+//
+// Calls `f` for each element of sorted range [first1, last1) that is
+// also in sorted range [first2, last2), in order. Elements are matched like
+// in std::set_intersection, so an element equivalent to `k` elements of the
+// second range is visited only if it is among the first `k` such elements.
+//
+// If one range is much smaller than the other, each element of the smaller
+// range is searched for in the larger one by galloping, which takes
+// O(m * log(n / m)) comparisons instead of O(n + m).
+//
+template <typename RandomIt1, typename RandomIt2, typename Compare, typename Function>
+SFL_CONSTEXPR_20
+void for_each_intersection(RandomIt1 first1, RandomIt1 last1,
+                           RandomIt2 first2, RandomIt2 last2,
+                           Compare& comp, Function&& f)
+{
+    using value_type_1 = typename std::iterator_traits<RandomIt1>::value_type;
+    using value_type_2 = typename std::iterator_traits<RandomIt2>::value_type;
+
+    if (sfl::dtl::should_gallop(first2, last2, first1, last1))
+    {
+        for (; first1 != last1; ++first1)
+        {
+            first2 = sfl::dtl::gallop_lower_bound(first2, last2, *first1, comp);
+
+            if (first2 == last2)
+            {
+                return;
+            }
+
+            if (!comp(*first1, *first2))
+            {
+                f(*first1);
+                ++first2;
+            }
+        }
+    }
+    else if (sfl::dtl::should_gallop(first1, last1, first2, last2))
+    {
+        for (; first2 != last2; ++first2)
+        {
+            first1 = sfl::dtl::gallop_lower_bound(first1, last1, *first2, comp);
+
+            if (first1 == last1)
+            {
+                return;
+            }
+
+            if (!comp(*first2, *first1))
+            {
+                f(*first1);
+                ++first1;
+            }
+        }
+    }
+    else
+    {
+        sfl::dtl::intersection_merge
+        (
+            first1, last1, first2, last2, comp, f,
+            std::integral_constant<bool, is_builtin_less<value_type_1, value_type_2, Compare>::value>()
+        );
+    }
+}
+
+//
+// Calls `f` for each element of sorted range [first1, last1) that is not
+// in sorted range [first2, last2), in order. Elements are matched like in
+// std::set_difference.
+//
+// If the second range is much larger than the first one, it is searched
+// by galloping like in `for_each_intersection`.
+//
+template <typename RandomIt1, typename RandomIt2, typename Compare, typename Function>
+SFL_CONSTEXPR_20
+void for_each_difference(RandomIt1 first1, RandomIt1 last1,
+                         RandomIt2 first2, RandomIt2 last2,
+                         Compare& comp, Function&& f)
+{
+    using value_type_1 = typename std::iterator_traits<RandomIt1>::value_type;
+    using value_type_2 = typename std::iterator_traits<RandomIt2>::value_type;
+
+    if (sfl::dtl::should_gallop(first2, last2, first1, last1))
+    {
+        for (; first1 != last1; ++first1)
+        {
+            first2 = sfl::dtl::gallop_lower_bound(first2, last2, *first1, comp);
+
+            if (first2 == last2)
+            {
+                break;
+            }
+
+            if (comp(*first1, *first2))
+            {
+                f(*first1);
+            }
+            else
+            {
+                ++first2;
+            }
+        }
+    }
+    else
+    {
+        first1 = sfl::dtl::difference_merge
+        (
+            first1, last1, first2, last2, comp, f,
+            std::integral_constant<bool, is_builtin_less<value_type_1, value_type_2, Compare>::value>()
+        );
+    }
+
+    for (; first1 != last1; ++first1)
+    {
+        f(*first1);
+    }
+}
+
+//
+// Calls `f1` for each element of sorted range [first1, last1) and `f2` for
+// each element of sorted range [first2, last2) that is not in the first
+// range, in the order of std::set_union.
+//
+template <typename RandomIt1, typename RandomIt2, typename Compare,
+          typename Function1, typename Function2>
+SFL_CONSTEXPR_20
+void for_each_union(RandomIt1 first1, RandomIt1 last1,
+                    RandomIt2 first2, RandomIt2 last2,
+                    Compare& comp, Function1&& f1, Function2&& f2)
+{
+    while (first1 != last1 && first2 != last2)
+    {
+        if (comp(*first2, *first1))
+        {
+            f2(*first2);
+            ++first2;
+        }
+        else
+        {
+            if (!comp(*first1, *first2))
+            {
+                ++first2;
+            }
+
+            f1(*first1);
+            ++first1;
+        }
+    }
+
+    for (; first1 != last1; ++first1)
+    {
+        f1(*first1);
+    }
+
+    for (; first2 != last2; ++first2)
+    {
+        f2(*first2);
+    }
 }
 
 } // namespace dtl
@@ -2498,6 +6107,208 @@ scope_guard<Lambda> make_scope_guard(Lambda&& lambda)
 // Type used to tag that the inserted values should be default initialized.
 struct default_init_t { };
 
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+// SORTED RANGE TAGS
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+// Type used to tag that the inserted range is sorted and contains no
+// equivalent elements (flat maps and sets).
+struct sorted_unique_t { };
+
+// Type used to tag that the inserted range is sorted (flat multimaps and
+// multisets).
+struct sorted_equivalent_t { };
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+// GROWTH POLICIES
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+//
+// Growth policy determines the capacity of `vector`, `small_vector` and
+// `devector`. It is a type with two static member functions:
+//
+//   std::size_t grow(std::size_t capacity, std::size_t min_capacity,
+//                    std::size_t max_capacity, std::size_t value_size)
+//
+//     Returns the new capacity when the container must grow from `capacity`
+//     to at least `min_capacity` elements. The result must be in range
+//     [min_capacity, max_capacity].
+//
+//   std::size_t round(std::size_t capacity, std::size_t max_capacity,
+//                     std::size_t value_size)
+//
+//     Returns the capacity allocated by `reserve` when at least `capacity`
+//     elements are requested. The result must be in range
+//     [capacity, max_capacity].
+//
+// Parameter `value_size` is the size of element in bytes.
+//
+
+// Grows capacity by ratio Num/Den (default 1.5). Function `reserve`
+// allocates exactly the requested capacity.
+template <std::size_t Num = 3, std::size_t Den = 2>
+struct geometric_growth
+{
+    static_assert(Den > 0 && Num > Den, "Growth ratio must be greater than 1.");
+
+    static std::size_t grow(std::size_t capacity,
+                            std::size_t min_capacity,
+                            std::size_t max_capacity,
+                            std::size_t value_size) noexcept
+    {
+        sfl::dtl::ignore_unused(value_size);
+
+        constexpr std::size_t k = Num - Den;
+
+        if (capacity / Den > (max_capacity - capacity) / k)
+        {
+            return max_capacity;
+        }
+
+        const std::size_t growth = capacity / Den * k + capacity % Den * k / Den;
+
+        if (max_capacity - capacity < growth)
+        {
+            return max_capacity;
+        }
+
+        return std::max(min_capacity, capacity + growth);
+    }
+
+    static std::size_t round(std::size_t capacity,
+                             std::size_t max_capacity,
+                             std::size_t value_size) noexcept
+    {
+        sfl::dtl::ignore_unused(max_capacity, value_size);
+        return capacity;
+    }
+};
+
+// Grows capacity using policy `Base`, and then rounds the allocation size
+// up to a multiple of `PageSize` bytes if it is at least one page. Function
+// `reserve` rounds in the same way.
+template <typename Base = sfl::geometric_growth<>, std::size_t PageSize = 4096>
+struct page_rounded_growth
+{
+    static_assert(PageSize > 0, "Page size must be greater than 0.");
+
+    static std::size_t grow(std::size_t capacity,
+                            std::size_t min_capacity,
+                            std::size_t max_capacity,
+                            std::size_t value_size) noexcept
+    {
+        return round_up
+        (
+            Base::grow(capacity, min_capacity, max_capacity, value_size),
+            max_capacity,
+            value_size
+        );
+    }
+
+    static std::size_t round(std::size_t capacity,
+                             std::size_t max_capacity,
+                             std::size_t value_size) noexcept
+    {
+        return round_up
+        (
+            Base::round(capacity, max_capacity, value_size),
+            max_capacity,
+            value_size
+        );
+    }
+
+private:
+
+    static std::size_t round_up(std::size_t capacity,
+                                std::size_t max_capacity,
+                                std::size_t value_size) noexcept
+    {
+        const std::size_t bytes = capacity * value_size;
+
+        if (bytes < PageSize || bytes > std::size_t(-1) - PageSize)
+        {
+            return capacity;
+        }
+
+        const std::size_t rounded = (bytes + PageSize - 1) / PageSize * PageSize;
+
+        return std::min(max_capacity, rounded / value_size);
+    }
+};
+
+// Same as `page_rounded_growth`, but with 2 MiB huge pages.
+template <typename Base = sfl::geometric_growth<>>
+using huge_page_rounded_growth = sfl::page_rounded_growth<Base, 2 * 1024 * 1024>;
+
+// Grows capacity using policy `Base`, and then rounds the allocation size
+// up to the size classes used by common allocators (jemalloc, tcmalloc):
+// multiples of 16 bytes up to 128 bytes, then four classes per power of two.
+// Function `reserve` rounds in the same way.
+template <typename Base = sfl::geometric_growth<>>
+struct size_class_rounded_growth
+{
+    static std::size_t grow(std::size_t capacity,
+                            std::size_t min_capacity,
+                            std::size_t max_capacity,
+                            std::size_t value_size) noexcept
+    {
+        return round_up
+        (
+            Base::grow(capacity, min_capacity, max_capacity, value_size),
+            max_capacity,
+            value_size
+        );
+    }
+
+    static std::size_t round(std::size_t capacity,
+                             std::size_t max_capacity,
+                             std::size_t value_size) noexcept
+    {
+        return round_up
+        (
+            Base::round(capacity, max_capacity, value_size),
+            max_capacity,
+            value_size
+        );
+    }
+
+private:
+
+    static std::size_t round_up(std::size_t capacity,
+                                std::size_t max_capacity,
+                                std::size_t value_size) noexcept
+    {
+        const std::size_t bytes = capacity * value_size;
+
+        if (bytes == 0 || bytes > std::size_t(-1) / 2)
+        {
+            return capacity;
+        }
+
+        std::size_t step = 16;
+
+        if (bytes > 128)
+        {
+            std::size_t p = 128;
+
+            while (p * 2 < bytes)
+            {
+                p *= 2;
+            }
+
+            step = p / 4;
+        }
+
+        const std::size_t rounded = (bytes + step - 1) / step * step;
+
+        return std::min(max_capacity, rounded / value_size);
+    }
+};
+
 } // namespace sfl
 
 #endif // SFL_PRIVATE_HPP_INCLUDED
@@ -0,0 +1,140 @@
+//
+// Copyright (c) 2022 Slaven Falandys
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+//
+
+#ifndef SFL_REALLOC_ALLOCATOR_HPP_INCLUDED
+#define SFL_REALLOC_ALLOCATOR_HPP_INCLUDED
+
+#include "private.hpp"
+
+#include <cstddef>      // max_align_t, ptrdiff_t, size_t
+#include <cstdint>      // PTRDIFF_MAX
+#include <cstdlib>      // malloc, realloc, free
+#include <type_traits>  // true_type
+
+namespace sfl
+{
+
+//
+// Stateless allocator that uses `malloc`, `realloc` and `free`. It has
+// member function `reallocate`, so `vector` and `compact_vector` grow
+// storage of trivially relocatable elements using `realloc`. `realloc` can
+// extend the block in place, and glibc remaps huge blocks using `mremap`,
+// so elements are not copied and the old and the new block do not coexist.
+//
+template <typename T>
+class realloc_allocator
+{
+#if !(defined(__GNUC__) && !defined(__clang__) && (__GNUC__ < 5))
+    static_assert(alignof(T) <= alignof(std::max_align_t),
+                  "Over-aligned types are not supported.");
+#endif
+
+public:
+
+    using value_type      = T;
+    using pointer         = T*;
+    using const_pointer   = const T*;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    using propagate_on_container_move_assignment = std::true_type;
+    using is_always_equal                        = std::true_type;
+
+    template <typename U>
+    struct rebind
+    {
+        using other = realloc_allocator<U>;
+    };
+
+    realloc_allocator() noexcept
+    {}
+
+    template <typename U>
+    realloc_allocator(const realloc_allocator<U>& /*other*/) noexcept
+    {}
+
+    T* allocate(size_type n)
+    {
+        if (n > max_size())
+        {
+            sfl::dtl::throw_bad_alloc();
+        }
+
+        void* p = std::malloc(n * sizeof(T));
+
+        if (p == nullptr && n != 0)
+        {
+            sfl::dtl::throw_bad_alloc();
+        }
+
+        return static_cast<T*>(p);
+    }
+
+    void deallocate(T* p, size_type /*n*/) noexcept
+    {
+        std::free(p);
+    }
+
+    // Changes the size of block `p` from `old_n` to `new_n` elements.
+    // If it throws, block `p` is unchanged.
+    T* reallocate(T* p, size_type /*old_n*/, size_type new_n)
+    {
+        if (new_n > max_size())
+        {
+            sfl::dtl::throw_bad_alloc();
+        }
+
+        if (new_n == 0)
+        {
+            std::free(p);
+            return nullptr;
+        }
+
+        void* new_p = std::realloc(static_cast<void*>(p), new_n * sizeof(T));
+
+        if (new_p == nullptr)
+        {
+            sfl::dtl::throw_bad_alloc();
+        }
+
+        return static_cast<T*>(new_p);
+    }
+
+    size_type max_size() const noexcept
+    {
+        return std::size_t(PTRDIFF_MAX) / sizeof(T);
+    }
+
+    template <typename U>
+    friend bool operator==(const realloc_allocator& /*x*/, const realloc_allocator<U>& /*y*/) noexcept
+    {
+        return true;
+    }
+
+    template <typename U>
+    friend bool operator!=(const realloc_allocator& /*x*/, const realloc_allocator<U>& /*y*/) noexcept
+    {
+        return false;
+    }
+};
+
+} // namespace sfl
+
+#endif // SFL_REALLOC_ALLOCATOR_HPP_INCLUDED
@@ -1188,6 +1188,16 @@ private:
         return sfl::dtl::allocate(seg_alloc, n);
     }
 
+    // Allocates table for at least given number of elements (segments) and
+    // sets `n` to the number of elements that fit into allocated memory.
+    // It does not construct any element (segment).
+    //
+    segment_pointer allocate_table_at_least(size_type& n)
+    {
+        segment_allocator seg_alloc(data_.ref_to_alloc());
+        return sfl::dtl::allocate_at_least(seg_alloc, n);
+    }
+
     // Deallocates table.
     // It does not destroy_a any element (segment).
     // It only deallocates memory used by table.
@@ -1345,7 +1355,7 @@ private:
             const size_type table_capacity =
                 std::distance(data_.table_bos_, data_.table_eos_);
 
-            const size_type new_table_capacity = std::max
+            size_type new_table_capacity = std::max
             (
                 table_capacity + table_capacity / 2,
                 table_capacity - table_available_front + table_required_front
@@ -1361,7 +1371,7 @@ private:
 
             // Allocate new table. No effects if allocation fails.
             const segment_pointer new_table_bos =
-                allocate_table(new_table_capacity);
+                allocate_table_at_least(new_table_capacity);
 
             const segment_pointer new_table_eos =
                 new_table_bos + new_table_capacity;
@@ -1433,7 +1443,7 @@ private:
             const size_type table_capacity =
                 std::distance(data_.table_bos_, data_.table_eos_);
 
-            const size_type new_table_capacity = std::max
+            size_type new_table_capacity = std::max
             (
                 table_capacity + table_capacity / 2,
                 table_capacity - table_available_back + table_required_back
@@ -1449,7 +1459,7 @@ private:
 
             // Allocate new table. No effects if allocation fails.
             const segment_pointer new_table_bos =
-                allocate_table(new_table_capacity);
+                allocate_table_at_least(new_table_capacity);
 
             const segment_pointer new_table_eos =
                 new_table_bos + new_table_capacity;
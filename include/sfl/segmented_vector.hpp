@@ -820,6 +820,16 @@ private:
         return sfl::dtl::allocate(seg_alloc, n);
     }
 
+    // Allocates table for at least given number of elements (segments) and
+    // sets `n` to the number of elements that fit into allocated memory.
+    // It does not construct any element (segment).
+    //
+    segment_pointer allocate_table_at_least(size_type& n)
+    {
+        segment_allocator seg_alloc(data_.ref_to_alloc());
+        return sfl::dtl::allocate_at_least(seg_alloc, n);
+    }
+
     // Deallocates table.
     // It does not destroy_a any element (segment).
     // It only deallocates memory used by table.
@@ -974,7 +984,7 @@ private:
             const size_type table_capacity =
                 std::distance(data_.table_first_, data_.table_eos_);
 
-            const size_type new_table_capacity = std::max
+            size_type new_table_capacity = std::max
             (
                 table_capacity + table_capacity / 2,
                 table_capacity - table_available + table_required
@@ -990,7 +1000,7 @@ private:
 
             // Allocate new table. No effects if allocation fails.
             const segment_pointer new_table_first =
-                allocate_table(new_table_capacity);
+                allocate_table_at_least(new_table_capacity);
 
             const segment_pointer new_table_eos =
                 new_table_first + new_table_capacity;
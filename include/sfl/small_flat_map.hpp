@@ -22,8 +22,9 @@
 #define SFL_SMALL_FLAT_MAP_HPP_INCLUDED
 
 #include "private.hpp"
+#include "vector.hpp"
 
-#include <algorithm>        // copy, move, lower_bound, swap, swap_ranges
+#include <algorithm>        // copy, move, sort, swap, swap_ranges
 #include <cstddef>          // size_t
 #include <functional>       // equal_to, less
 #include <initializer_list> // initializer_list
@@ -45,7 +46,8 @@ template < typename Key,
            typename T,
            std::size_t N,
            typename Compare = std::less<Key>,
-           typename Allocator = std::allocator<std::pair<Key, T>> >
+           typename Allocator = std::allocator<std::pair<Key, T>>,
+           bool Lazy = false >
 class small_flat_map
 {
     #ifdef SFL_TEST_SMALL_FLAT_MAP
@@ -99,6 +101,8 @@ public:
 
     static constexpr size_type static_capacity = N;
 
+    static constexpr bool lazy = Lazy;
+
 private:
 
     // Like `value_compare` but with additional operators.
@@ -193,7 +197,49 @@ private:
         }
     };
 
-    class data : public data_base<(N > 0)>, public allocator_type, public ultra_compare
+    // Number of pending elements, i.e. elements inserted at the end of the
+    // storage but not yet merged into the sorted range. Pending elements form
+    // sorted runs whose lengths are the powers of two present in the binary
+    // representation of their number, longest run first.
+    template <bool IsLazy = Lazy, typename = void>
+    class pending_base
+    {
+    private:
+
+        size_type pending_;
+
+    public:
+
+        pending_base() noexcept
+            : pending_(0)
+        {}
+
+        size_type pending() const noexcept
+        {
+            return pending_;
+        }
+
+        void set_pending(size_type n) noexcept
+        {
+            pending_ = n;
+        }
+    };
+
+    template <typename Dummy>
+    class pending_base<false, Dummy>
+    {
+    public:
+
+        size_type pending() const noexcept
+        {
+            return 0;
+        }
+
+        void set_pending(size_type) noexcept
+        {}
+    };
+
+    class data : public data_base<(N > 0)>, public allocator_type, public ultra_compare, public pending_base<>
     {
     public:
 
@@ -364,6 +410,58 @@ public:
         : small_flat_map(ilist.begin(), ilist.end(), comp, alloc)
     {}
 
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    small_flat_map(sfl::sorted_unique_t, InputIt first, InputIt last)
+        : data_()
+    {
+        initialize_range(sfl::sorted_unique_t(), first, last);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    small_flat_map(sfl::sorted_unique_t, InputIt first, InputIt last, const Compare& comp)
+        : data_(comp)
+    {
+        initialize_range(sfl::sorted_unique_t(), first, last);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    small_flat_map(sfl::sorted_unique_t, InputIt first, InputIt last, const Allocator& alloc)
+        : data_(alloc)
+    {
+        initialize_range(sfl::sorted_unique_t(), first, last);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    small_flat_map(sfl::sorted_unique_t, InputIt first, InputIt last, const Compare& comp,
+                                                                      const Allocator& alloc)
+        : data_(comp, alloc)
+    {
+        initialize_range(sfl::sorted_unique_t(), first, last);
+    }
+
+    small_flat_map(sfl::sorted_unique_t, std::initializer_list<value_type> ilist)
+        : small_flat_map(sfl::sorted_unique_t(), ilist.begin(), ilist.end())
+    {}
+
+    small_flat_map(sfl::sorted_unique_t, std::initializer_list<value_type> ilist,
+                   const Compare& comp)
+        : small_flat_map(sfl::sorted_unique_t(), ilist.begin(), ilist.end(), comp)
+    {}
+
+    small_flat_map(sfl::sorted_unique_t, std::initializer_list<value_type> ilist,
+                   const Allocator& alloc)
+        : small_flat_map(sfl::sorted_unique_t(), ilist.begin(), ilist.end(), alloc)
+    {}
+
+    small_flat_map(sfl::sorted_unique_t, std::initializer_list<value_type> ilist,
+                   const Compare& comp, const Allocator& alloc)
+        : small_flat_map(sfl::sorted_unique_t(), ilist.begin(), ilist.end(), comp, alloc)
+    {}
+
     small_flat_map(const small_flat_map& other)
         : data_
         (
@@ -485,20 +583,23 @@ public:
     //
 
     SFL_NODISCARD
-    iterator begin() noexcept
+    iterator begin() noexcept(!Lazy)
     {
+        merge_pending();
         return iterator(data_.first_);
     }
 
     SFL_NODISCARD
     const_iterator begin() const noexcept
     {
+        SFL_ASSERT(pending() == 0);
         return const_iterator(data_.first_);
     }
 
     SFL_NODISCARD
     const_iterator cbegin() const noexcept
     {
+        SFL_ASSERT(pending() == 0);
         return const_iterator(data_.first_);
     }
 
@@ -521,25 +622,28 @@ public:
     }
 
     SFL_NODISCARD
-    reverse_iterator rbegin() noexcept
+    reverse_iterator rbegin() noexcept(!Lazy)
     {
+        merge_pending();
         return reverse_iterator(end());
     }
 
     SFL_NODISCARD
     const_reverse_iterator rbegin() const noexcept
     {
+        SFL_ASSERT(pending() == 0);
         return const_reverse_iterator(end());
     }
 
     SFL_NODISCARD
     const_reverse_iterator crbegin() const noexcept
     {
+        SFL_ASSERT(pending() == 0);
         return const_reverse_iterator(end());
     }
 
     SFL_NODISCARD
-    reverse_iterator rend() noexcept
+    reverse_iterator rend() noexcept(!Lazy)
     {
         return reverse_iterator(begin());
     }
@@ -557,9 +661,10 @@ public:
     }
 
     SFL_NODISCARD
-    iterator nth(size_type pos) noexcept
+    iterator nth(size_type pos) noexcept(!Lazy)
     {
         SFL_ASSERT(pos <= size());
+        merge_pending();
         return iterator(data_.first_ + pos);
     }
 
@@ -567,14 +672,15 @@ public:
     const_iterator nth(size_type pos) const noexcept
     {
         SFL_ASSERT(pos <= size());
+        SFL_ASSERT(pending() == 0);
         return const_iterator(data_.first_ + pos);
     }
 
     SFL_NODISCARD
     size_type index_of(const_iterator pos) const noexcept
     {
-        SFL_ASSERT(cbegin() <= pos && pos <= cend());
-        return std::distance(cbegin(), pos);
+        SFL_ASSERT(const_iterator(data_.first_) <= pos && pos <= cend());
+        return std::distance(const_iterator(data_.first_), pos);
     }
 
     //
@@ -829,19 +935,21 @@ public:
         );
 
         data_.last_ = data_.first_;
+
+        data_.set_pending(0);
     }
 
     template <typename... Args>
     std::pair<iterator, bool> emplace(Args&&... args)
     {
-        return insert_aux(value_type(std::forward<Args>(args)...));
+        return emplace_aux(std::forward<Args>(args)...);
     }
 
     template <typename... Args>
     iterator emplace_hint(const_iterator hint, Args&&... args)
     {
-        SFL_ASSERT(cbegin() <= hint && hint <= cend());
-        return insert_aux(hint, value_type(std::forward<Args>(args)...));
+        SFL_ASSERT(const_iterator(data_.first_) <= hint && hint <= cend());
+        return emplace_hint_aux(hint, std::forward<Args>(args)...);
     }
 
     std::pair<iterator, bool> insert(const value_type& value)
@@ -863,13 +971,13 @@ public:
 
     iterator insert(const_iterator hint, const value_type& value)
     {
-        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        SFL_ASSERT(const_iterator(data_.first_) <= hint && hint <= cend());
         return insert_aux(hint, value);
     }
 
     iterator insert(const_iterator hint, value_type&& value)
     {
-        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        SFL_ASSERT(const_iterator(data_.first_) <= hint && hint <= cend());
         return insert_aux(hint, std::move(value));
     }
 
@@ -877,7 +985,7 @@ public:
               sfl::dtl::enable_if_t<std::is_constructible<value_type, P>::value>* = nullptr>
     iterator insert(const_iterator hint, P&& value)
     {
-        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        SFL_ASSERT(const_iterator(data_.first_) <= hint && hint <= cend());
         return insert_aux(hint, value_type(std::forward<P>(value)));
     }
 
@@ -885,11 +993,7 @@ public:
               sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
     void insert(InputIt first, InputIt last)
     {
-        while (first != last)
-        {
-            insert(*first);
-            ++first;
-        }
+        insert_range_aux(first, last);
     }
 
     void insert(std::initializer_list<value_type> ilist)
@@ -897,6 +1001,18 @@ public:
         insert(ilist.begin(), ilist.end());
     }
 
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    void insert(sfl::sorted_unique_t, InputIt first, InputIt last)
+    {
+        insert_sorted_range_aux(first, last);
+    }
+
+    void insert(sfl::sorted_unique_t, std::initializer_list<value_type> ilist)
+    {
+        insert(sfl::sorted_unique_t(), ilist.begin(), ilist.end());
+    }
+
     template <typename M,
               sfl::dtl::enable_if_t<std::is_assignable<mapped_type&, M&&>::value>* = nullptr>
     std::pair<iterator, bool> insert_or_assign(const Key& key, M&& obj)
@@ -923,7 +1039,7 @@ public:
               sfl::dtl::enable_if_t<std::is_assignable<mapped_type&, M&&>::value>* = nullptr>
     iterator insert_or_assign(const_iterator hint, const Key& key, M&& obj)
     {
-        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        SFL_ASSERT(const_iterator(data_.first_) <= hint && hint <= cend());
         return insert_or_assign_aux(hint, key, std::forward<M>(obj));
     }
 
@@ -931,7 +1047,7 @@ public:
               sfl::dtl::enable_if_t<std::is_assignable<mapped_type&, M&&>::value>* = nullptr>
     iterator insert_or_assign(const_iterator hint, Key&& key, M&& obj)
     {
-        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        SFL_ASSERT(const_iterator(data_.first_) <= hint && hint <= cend());
         return insert_or_assign_aux(hint, std::move(key), std::forward<M>(obj));
     }
 
@@ -940,7 +1056,7 @@ public:
                                      std::is_assignable<mapped_type&, M&&>::value >* = nullptr>
     iterator insert_or_assign(const_iterator hint, K&& key, M&& obj)
     {
-        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        SFL_ASSERT(const_iterator(data_.first_) <= hint && hint <= cend());
         return insert_or_assign_aux(hint, std::forward<K>(key), std::forward<M>(obj));
     }
 
@@ -974,14 +1090,14 @@ public:
     template <typename... Args>
     iterator try_emplace(const_iterator hint, const Key& key, Args&&... args)
     {
-        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        SFL_ASSERT(const_iterator(data_.first_) <= hint && hint <= cend());
         return try_emplace_aux(hint, key, std::forward<Args>(args)...);
     }
 
     template <typename... Args>
     iterator try_emplace(const_iterator hint, Key&& key, Args&&... args)
     {
-        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        SFL_ASSERT(const_iterator(data_.first_) <= hint && hint <= cend());
         return try_emplace_aux(hint, std::move(key), std::forward<Args>(args)...);
     }
 
@@ -995,7 +1111,7 @@ public:
               >* = nullptr>
     iterator try_emplace(const_iterator hint, K&& key, Args&&... args)
     {
-        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        SFL_ASSERT(const_iterator(data_.first_) <= hint && hint <= cend());
         return try_emplace_aux(hint, std::forward<K>(key), std::forward<Args>(args)...);
     }
 
@@ -1006,9 +1122,15 @@ public:
 
     iterator erase(const_iterator pos)
     {
-        SFL_ASSERT(cbegin() <= pos && pos < cend());
+        SFL_ASSERT(const_iterator(data_.first_) <= pos && pos < cend());
+
+        const pointer p = data_.first_ + std::distance(const_iterator(data_.first_), pos);
 
-        const pointer p = data_.first_ + std::distance(cbegin(), pos);
+        if (p >= data_.last_ - data_.pending())
+        {
+            erase_pending(p);
+            return iterator(p);
+        }
 
         data_.last_ = sfl::dtl::move(p + 1, data_.last_, p);
 
@@ -1019,15 +1141,21 @@ public:
 
     iterator erase(const_iterator first, const_iterator last)
     {
-        SFL_ASSERT(cbegin() <= first && first <= last && last <= cend());
+        SFL_ASSERT(const_iterator(data_.first_) <= first && first <= last && last <= cend());
+
+        const pointer p1 = data_.first_ + std::distance(const_iterator(data_.first_), first);
+        const pointer p2 = data_.first_ + std::distance(const_iterator(data_.first_), last);
 
         if (first == last)
         {
-            return begin() + std::distance(cbegin(), first);
+            return iterator(p1);
         }
 
-        const pointer p1 = data_.first_ + std::distance(cbegin(), first);
-        const pointer p2 = data_.first_ + std::distance(cbegin(), last);
+        if (p2 > data_.last_ - data_.pending())
+        {
+            erase_pending(p1, p2);
+            return iterator(p1);
+        }
 
         const pointer new_last = sfl::dtl::move(p2, data_.last_, p1);
 
@@ -1089,6 +1217,10 @@ public:
 
         swap(this->data_.ref_to_comp(), other.data_.ref_to_comp());
 
+        const size_type this_pending = this->data_.pending();
+        this->data_.set_pending(other.data_.pending());
+        other.data_.set_pending(this_pending);
+
         if
         (
             this->data_.first_ == this->data_.internal_storage() &&
@@ -1224,6 +1356,91 @@ public:
         }
     }
 
+    // Moves all elements into a vector and leaves the container empty.
+    // Dynamically allocated storage is handed over to the vector as is.
+    sfl::vector<value_type, Allocator> extract()
+    {
+        merge_pending();
+
+        sfl::vector<value_type, Allocator> result(data_.ref_to_alloc());
+
+        if (data_.first_ == data_.internal_storage())
+        {
+            const size_type n = size();
+
+            if (n != 0)
+            {
+                const pointer new_first = sfl::dtl::allocate(data_.ref_to_alloc(), n);
+
+                pointer new_last = new_first;
+
+                SFL_TRY
+                {
+                    new_last = sfl::dtl::uninitialized_move_a
+                    (
+                        data_.ref_to_alloc(),
+                        data_.first_,
+                        data_.last_,
+                        new_first
+                    );
+                }
+                SFL_CATCH (...)
+                {
+                    sfl::dtl::deallocate(data_.ref_to_alloc(), new_first, n);
+                    SFL_RETHROW;
+                }
+
+                sfl::dtl::vector_access::adopt(result, new_first, new_last, new_first + n);
+
+                clear();
+            }
+        }
+        else
+        {
+            sfl::dtl::vector_access::adopt(result, data_.first_, data_.last_, data_.eos_);
+
+            data_.first_ = data_.internal_storage();
+            data_.last_  = data_.first_;
+            data_.eos_   = data_.first_ + N;
+        }
+
+        return result;
+    }
+
+    // Replaces all elements with elements of `cont`. Elements that fit into
+    // internal storage are moved there. Otherwise, if allocators compare
+    // equal, storage of `cont` is taken over as is.
+    void replace(sfl::vector<value_type, Allocator>&& cont)
+    {
+        SFL_ASSERT(sfl::dtl::is_sorted_unique(cont.begin(), cont.end(), data_.ref_to_comp()));
+
+        if (cont.size() > N && cont.get_allocator() == data_.ref_to_alloc())
+        {
+            reset();
+
+            sfl::dtl::vector_access::release(cont, data_.first_, data_.last_, data_.eos_);
+        }
+        else
+        {
+            if (cont.size() <= N)
+            {
+                reset();
+            }
+            else
+            {
+                clear();
+            }
+
+            assign_range
+            (
+                std::make_move_iterator(cont.begin()),
+                std::make_move_iterator(cont.end())
+            );
+
+            cont.clear();
+        }
+    }
+
     //
     // ---- LOOKUP ------------------------------------------------------------
     //
@@ -1231,13 +1448,13 @@ public:
     SFL_NODISCARD
     iterator lower_bound(const Key& key)
     {
-        return std::lower_bound(begin(), end(), key, data_.ref_to_comp());
+        return sfl::dtl::lower_bound(begin(), end(), key, data_.ref_to_comp());
     }
 
     SFL_NODISCARD
     const_iterator lower_bound(const Key& key) const
     {
-        return std::lower_bound(begin(), end(), key, data_.ref_to_comp());
+        return const_iterator(bound_aux(key, false));
     }
 
     template <typename K,
@@ -1245,7 +1462,7 @@ public:
     SFL_NODISCARD
     iterator lower_bound(const K& x)
     {
-        return std::lower_bound(begin(), end(), x, data_.ref_to_comp());
+        return sfl::dtl::lower_bound(begin(), end(), x, data_.ref_to_comp());
     }
 
     template <typename K,
@@ -1253,19 +1470,19 @@ public:
     SFL_NODISCARD
     const_iterator lower_bound(const K& x) const
     {
-        return std::lower_bound(begin(), end(), x, data_.ref_to_comp());
+        return const_iterator(bound_aux(x, false));
     }
 
     SFL_NODISCARD
     iterator upper_bound(const Key& key)
     {
-        return std::upper_bound(begin(), end(), key, data_.ref_to_comp());
+        return sfl::dtl::upper_bound(begin(), end(), key, data_.ref_to_comp());
     }
 
     SFL_NODISCARD
     const_iterator upper_bound(const Key& key) const
     {
-        return std::upper_bound(begin(), end(), key, data_.ref_to_comp());
+        return const_iterator(bound_aux(key, true));
     }
 
     template <typename K,
@@ -1273,7 +1490,7 @@ public:
     SFL_NODISCARD
     iterator upper_bound(const K& x)
     {
-        return std::upper_bound(begin(), end(), x, data_.ref_to_comp());
+        return sfl::dtl::upper_bound(begin(), end(), x, data_.ref_to_comp());
     }
 
     template <typename K,
@@ -1281,19 +1498,26 @@ public:
     SFL_NODISCARD
     const_iterator upper_bound(const K& x) const
     {
-        return std::upper_bound(begin(), end(), x, data_.ref_to_comp());
+        return const_iterator(bound_aux(x, true));
     }
 
     SFL_NODISCARD
     std::pair<iterator, iterator> equal_range(const Key& key)
     {
-        return std::equal_range(begin(), end(), key, data_.ref_to_comp());
+        return sfl::dtl::equal_range(begin(), end(), key, data_.ref_to_comp());
     }
 
     SFL_NODISCARD
     std::pair<const_iterator, const_iterator> equal_range(const Key& key) const
     {
-        return std::equal_range(begin(), end(), key, data_.ref_to_comp());
+        const pointer p = bound_aux(key, false);
+
+        if (p != data_.last_ && !data_.ref_to_comp()(key, *p))
+        {
+            return std::make_pair(const_iterator(p), const_iterator(p + 1));
+        }
+
+        return std::make_pair(const_iterator(p), const_iterator(p));
     }
 
     template <typename K,
@@ -1301,7 +1525,7 @@ public:
     SFL_NODISCARD
     std::pair<iterator, iterator> equal_range(const K& x)
     {
-        return std::equal_range(begin(), end(), x, data_.ref_to_comp());
+        return sfl::dtl::equal_range(begin(), end(), x, data_.ref_to_comp());
     }
 
     template <typename K,
@@ -1309,33 +1533,20 @@ public:
     SFL_NODISCARD
     std::pair<const_iterator, const_iterator> equal_range(const K& x) const
     {
-        return std::equal_range(begin(), end(), x, data_.ref_to_comp());
+        const std::pair<pointer, pointer> r = equal_range_aux(x);
+        return std::make_pair(const_iterator(r.first), const_iterator(r.second));
     }
 
     SFL_NODISCARD
     iterator find(const Key& key)
     {
-        auto it = lower_bound(key);
-
-        if (it != end() && data_.ref_to_comp()(key, *it))
-        {
-            it = end();
-        }
-
-        return it;
+        return iterator(find_aux(key));
     }
 
     SFL_NODISCARD
     const_iterator find(const Key& key) const
     {
-        auto it = lower_bound(key);
-
-        if (it != end() && data_.ref_to_comp()(key, *it))
-        {
-            it = end();
-        }
-
-        return it;
+        return const_iterator(find_aux(key));
     }
 
     template <typename K,
@@ -1343,14 +1554,7 @@ public:
     SFL_NODISCARD
     iterator find(const K& x)
     {
-        auto it = lower_bound(x);
-
-        if (it != end() && data_.ref_to_comp()(x, *it))
-        {
-            it = end();
-        }
-
-        return it;
+        return iterator(find_aux(x));
     }
 
     template <typename K,
@@ -1358,14 +1562,7 @@ public:
     SFL_NODISCARD
     const_iterator find(const K& x) const
     {
-        auto it = lower_bound(x);
-
-        if (it != end() && data_.ref_to_comp()(x, *it))
-        {
-            it = end();
-        }
-
-        return it;
+        return const_iterator(find_aux(x));
     }
 
     SFL_NODISCARD
@@ -1396,6 +1593,27 @@ public:
         return find(x) != end();
     }
 
+    //
+    // ---- PENDING ELEMENTS --------------------------------------------------
+    //
+
+    // Available only if `Lazy` is true. Merges pending elements into the
+    // sorted range. Non-const functions that expose the order of elements
+    // do this implicitly; const ones require that there are no pending
+    // elements.
+    template <bool L = Lazy,
+              sfl::dtl::enable_if_t<L>* = nullptr>
+    void flush()
+    {
+        merge_pending();
+    }
+
+    SFL_NODISCARD
+    size_type pending() const noexcept
+    {
+        return data_.pending();
+    }
+
     //
     // ---- ELEMENT ACCESS ----------------------------------------------------
     //
@@ -1477,14 +1695,16 @@ public:
     }
 
     SFL_NODISCARD
-    value_type* data() noexcept
+    value_type* data() noexcept(!Lazy)
     {
+        merge_pending();
         return sfl::dtl::to_address(data_.first_);
     }
 
     SFL_NODISCARD
     const value_type* data() const noexcept
     {
+        SFL_ASSERT(pending() == 0);
         return sfl::dtl::to_address(data_.first_);
     }
 
@@ -1545,6 +1765,8 @@ private:
         data_.last_  = data_.first_;
         data_.eos_   = data_.first_ + N;
 
+        data_.set_pending(0);
+
         if (new_cap > N)
         {
             data_.first_ = sfl::dtl::allocate(data_.ref_to_alloc(), new_cap);
@@ -1561,11 +1783,37 @@ private:
     {
         SFL_TRY
         {
-            while (first != last)
+            insert(first, last);
+        }
+        SFL_CATCH (...)
+        {
+            sfl::dtl::destroy_a
+            (
+                data_.ref_to_alloc(),
+                data_.first_,
+                data_.last_
+            );
+
+            if (data_.first_ != data_.internal_storage())
             {
-                insert(*first);
-                ++first;
+                sfl::dtl::deallocate
+                (
+                    data_.ref_to_alloc(),
+                    data_.first_,
+                    std::distance(data_.first_, data_.eos_)
+                );
             }
+
+            SFL_RETHROW;
+        }
+    }
+
+    template <typename InputIt>
+    void initialize_range(sfl::sorted_unique_t, InputIt first, InputIt last)
+    {
+        SFL_TRY
+        {
+            insert(sfl::sorted_unique_t(), first, last);
         }
         SFL_CATCH (...)
         {
@@ -1612,9 +1860,14 @@ private:
                 other.data_.last_,
                 data_.first_
             );
+
+            data_.set_pending(other.data_.pending());
+
+            merge_pending();
         }
         SFL_CATCH (...)
         {
+            // If merging failed, elements have already been destroyed.
             if (n > N)
             {
                 sfl::dtl::deallocate(data_.ref_to_alloc(), data_.first_, n);
@@ -1626,6 +1879,8 @@ private:
 
     void initialize_move(small_flat_map& other)
     {
+        other.merge_pending();
+
         if (other.data_.first_ == other.data_.internal_storage())
         {
             data_.last_ = sfl::dtl::uninitialized_move_a
@@ -1748,6 +2003,8 @@ private:
     {
         if (this != &other)
         {
+            data_.set_pending(0);
+
             if (allocator_traits::propagate_on_container_copy_assignment::value)
             {
                 if (data_.ref_to_alloc() != other.data_.ref_to_alloc())
@@ -1761,11 +2018,19 @@ private:
             data_.ref_to_comp() = other.data_.ref_to_comp();
 
             assign_range(other.data_.first_, other.data_.last_);
+
+            data_.set_pending(other.data_.pending());
+
+            merge_pending();
         }
     }
 
     void assign_move(small_flat_map& other)
     {
+        other.merge_pending();
+
+        data_.set_pending(0);
+
         if (allocator_traits::propagate_on_container_move_assignment::value)
         {
             if (data_.ref_to_alloc() != other.data_.ref_to_alloc())
@@ -1808,9 +2073,82 @@ private:
         }
     }
 
+    // Key is taken from arguments and searched for before the element is
+    // constructed, so nothing is constructed if the key already exists.
+    template <typename... Args,
+              sfl::dtl::enable_if_t<sfl::dtl::is_map_key_extractable<Key, Args...>::value>* = nullptr>
+    std::pair<iterator, bool> emplace_aux(Args&&... args)
+    {
+        const Key& key = sfl::dtl::extract_map_key(args...);
+
+        if (Lazy)
+        {
+            const pointer p = find_aux(key);
+
+            if (p == data_.last_)
+            {
+                const size_type pos = pending_insert_index(key);
+                return std::make_pair(insert_pending(pos, std::forward<Args>(args)...), true);
+            }
+
+            return std::make_pair(iterator(p), false);
+        }
+
+        auto it = lower_bound(key);
+
+        if (it == end() || data_.ref_to_comp()(key, *it))
+        {
+            return std::make_pair(emplace_exactly_at(it, std::forward<Args>(args)...), true);
+        }
+
+        return std::make_pair(it, false);
+    }
+
+    // Key cannot be taken from arguments, so the element is constructed
+    // first and then inserted.
+    template <typename... Args,
+              sfl::dtl::enable_if_t<!sfl::dtl::is_map_key_extractable<Key, Args...>::value>* = nullptr>
+    std::pair<iterator, bool> emplace_aux(Args&&... args)
+    {
+        return insert_aux(value_type(std::forward<Args>(args)...));
+    }
+
+    template <typename... Args,
+              sfl::dtl::enable_if_t<sfl::dtl::is_map_key_extractable<Key, Args...>::value>* = nullptr>
+    iterator emplace_hint_aux(const_iterator hint, Args&&... args)
+    {
+        if (!Lazy && is_insert_hint_good(hint, sfl::dtl::extract_map_key(args...)))
+        {
+            return emplace_exactly_at(hint, std::forward<Args>(args)...);
+        }
+
+        // Hint is not good. Use non-hinted function.
+        return emplace_aux(std::forward<Args>(args)...).first;
+    }
+
+    template <typename... Args,
+              sfl::dtl::enable_if_t<!sfl::dtl::is_map_key_extractable<Key, Args...>::value>* = nullptr>
+    iterator emplace_hint_aux(const_iterator hint, Args&&... args)
+    {
+        return insert_aux(hint, value_type(std::forward<Args>(args)...));
+    }
+
     template <typename Value>
     std::pair<iterator, bool> insert_aux(Value&& value)
     {
+        if (Lazy)
+        {
+            const pointer p = find_aux(value.first);
+
+            if (p == data_.last_)
+            {
+                const size_type pos = pending_insert_index(value.first);
+                return std::make_pair(insert_pending(pos, std::forward<Value>(value)), true);
+            }
+
+            return std::make_pair(iterator(p), false);
+        }
+
         auto it = lower_bound(value.first);
 
         if (it == end() || data_.ref_to_comp()(value, *it))
@@ -1824,7 +2162,7 @@ private:
     template <typename Value>
     iterator insert_aux(const_iterator hint, Value&& value)
     {
-        if (is_insert_hint_good(hint, value))
+        if (!Lazy && is_insert_hint_good(hint, value))
         {
             return insert_exactly_at(hint, std::forward<Value>(value));
         }
@@ -1836,21 +2174,43 @@ private:
     template <typename K, typename M>
     std::pair<iterator, bool> insert_or_assign_aux(K&& key, M&& obj)
     {
-        auto it = lower_bound(key);
-
-        if (it == end() || data_.ref_to_comp()(key, *it))
+        if (Lazy)
         {
-            return std::make_pair
-            (
-                insert_exactly_at
-                (
-                    it,
-                    value_type
+            const pointer p = find_aux(key);
+
+            if (p == data_.last_)
+            {
+                const size_type pos = pending_insert_index(key);
+
+                return std::make_pair
+                (
+                    insert_pending
                     (
+                        pos,
                         std::piecewise_construct,
                         std::forward_as_tuple(std::forward<K>(key)),
                         std::forward_as_tuple(std::forward<M>(obj))
-                    )
+                    ),
+                    true
+                );
+            }
+
+            p->second = std::forward<M>(obj);
+            return std::make_pair(iterator(p), false);
+        }
+
+        auto it = lower_bound(key);
+
+        if (it == end() || data_.ref_to_comp()(key, *it))
+        {
+            return std::make_pair
+            (
+                emplace_exactly_at
+                (
+                    it,
+                    std::piecewise_construct,
+                    std::forward_as_tuple(std::forward<K>(key)),
+                    std::forward_as_tuple(std::forward<M>(obj))
                 ),
                 true
             );
@@ -1863,17 +2223,14 @@ private:
     template <typename K, typename M>
     iterator insert_or_assign_aux(const_iterator hint, K&& key, M&& obj)
     {
-        if (is_insert_hint_good(hint, key))
+        if (!Lazy && is_insert_hint_good(hint, key))
         {
-            return insert_exactly_at
+            return emplace_exactly_at
             (
                 hint,
-                value_type
-                (
-                    std::piecewise_construct,
-                    std::forward_as_tuple(std::forward<K>(key)),
-                    std::forward_as_tuple(std::forward<M>(obj))
-                )
+                std::piecewise_construct,
+                std::forward_as_tuple(std::forward<K>(key)),
+                std::forward_as_tuple(std::forward<M>(obj))
             );
         }
 
@@ -1884,21 +2241,42 @@ private:
     template <typename K, typename... Args>
     std::pair<iterator, bool> try_emplace_aux(K&& key, Args&&... args)
     {
+        if (Lazy)
+        {
+            const pointer p = find_aux(key);
+
+            if (p == data_.last_)
+            {
+                const size_type pos = pending_insert_index(key);
+
+                return std::make_pair
+                (
+                    insert_pending
+                    (
+                        pos,
+                        std::piecewise_construct,
+                        std::forward_as_tuple(std::forward<K>(key)),
+                        std::forward_as_tuple(std::forward<Args>(args)...)
+                    ),
+                    true
+                );
+            }
+
+            return std::make_pair(iterator(p), false);
+        }
+
         auto it = lower_bound(key);
 
         if (it == end() || data_.ref_to_comp()(key, *it))
         {
             return std::make_pair
             (
-                insert_exactly_at
+                emplace_exactly_at
                 (
                     it,
-                    value_type
-                    (
-                        std::piecewise_construct,
-                        std::forward_as_tuple(std::forward<K>(key)),
-                        std::forward_as_tuple(std::forward<Args>(args)...)
-                    )
+                    std::piecewise_construct,
+                    std::forward_as_tuple(std::forward<K>(key)),
+                    std::forward_as_tuple(std::forward<Args>(args)...)
                 ),
                 true
             );
@@ -1910,17 +2288,14 @@ private:
     template <typename K, typename... Args>
     iterator try_emplace_aux(const_iterator hint, K&& key, Args&&... args)
     {
-        if (is_insert_hint_good(hint, key))
+        if (!Lazy && is_insert_hint_good(hint, key))
         {
-            return insert_exactly_at
+            return emplace_exactly_at
             (
                 hint,
-                value_type
-                (
-                    std::piecewise_construct,
-                    std::forward_as_tuple(std::forward<K>(key)),
-                    std::forward_as_tuple(std::forward<Args>(args)...)
-                )
+                std::piecewise_construct,
+                std::forward_as_tuple(std::forward<K>(key)),
+                std::forward_as_tuple(std::forward<Args>(args)...)
             );
         }
 
@@ -1928,12 +2303,174 @@ private:
         return try_emplace_aux(std::forward<K>(key), std::forward<Args>(args)...).first;
     }
 
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<!sfl::dtl::is_forward_iterator<InputIt>::value>* = nullptr>
+    void append_range(InputIt first, InputIt last)
+    {
+        while (first != last)
+        {
+            insert_exactly_at(cend(), *first);
+            ++first;
+        }
+    }
+
+    template <typename ForwardIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_forward_iterator<ForwardIt>::value>* = nullptr>
+    void append_range(ForwardIt first, ForwardIt last)
+    {
+        const size_type n = std::distance(first, last);
+
+        if (n > available())
+        {
+            reserve(calculate_new_capacity(n, "sfl::small_flat_map::append_range"));
+        }
+
+        data_.last_ = sfl::dtl::uninitialized_copy_a
+        (
+            data_.ref_to_alloc(),
+            first,
+            last,
+            data_.last_
+        );
+    }
+
+    // Appends all elements and then sorts and merges them at once using
+    // temporary buffers, which takes O(m * log(m) + n) element moves instead
+    // of O(n * m).
+    template <typename InputIt>
+    void insert_range_aux(InputIt first, InputIt last)
+    {
+        merge_pending();
+
+        const size_type old_size = size();
+
+        SFL_TRY
+        {
+            append_range(first, last);
+        }
+        SFL_CATCH (...)
+        {
+            erase(nth(old_size), cend());
+            SFL_RETHROW;
+        }
+
+        merge_appended(old_size);
+    }
+
+    // Appends all elements and merges them with existing elements. Unlike
+    // `insert_range_aux`, appended elements are not sorted because they
+    // must already be in order.
+    template <typename InputIt>
+    void insert_sorted_range_aux(InputIt first, InputIt last)
+    {
+        merge_pending();
+
+        const size_type old_size = size();
+
+        SFL_TRY
+        {
+            append_range(first, last);
+        }
+        SFL_CATCH (...)
+        {
+            erase(nth(old_size), cend());
+            SFL_RETHROW;
+        }
+
+        SFL_ASSERT(sfl::dtl::is_sorted_unique(data_.first_ + old_size, data_.last_, data_.ref_to_comp()));
+
+        merge_sorted_appended(old_size);
+    }
+
+    // Sorts elements at positions `pos` and above, removes duplicates among
+    // them and merges them with preceding elements, keeping only the first
+    // of equivalent elements. If an exception is thrown, new elements are
+    // removed and existing elements are kept.
+    void merge_appended(size_type pos)
+    {
+        const pointer mid = data_.first_ + pos;
+
+        SFL_TRY
+        {
+            sfl::dtl::stable_sort_with_buffer(data_.ref_to_alloc(), mid, data_.last_, data_.ref_to_comp());
+
+            const pointer new_last = sfl::dtl::unique_sorted
+            (
+                mid,
+                data_.last_,
+                data_.ref_to_comp()
+            );
+
+            erase(nth(std::distance(data_.first_, new_last)), cend());
+        }
+        SFL_CATCH (...)
+        {
+            erase(nth(pos), cend());
+            SFL_RETHROW;
+        }
+
+        merge_sorted_appended(pos);
+    }
+
+    // Merges sorted unique elements at positions `pos` and above with
+    // preceding elements, dropping new elements equivalent to existing ones.
+    // If an exception is thrown, new elements are removed and existing
+    // elements are kept, unless moving an existing element throws, in which
+    // case all elements are removed.
+    void merge_sorted_appended(size_type pos)
+    {
+        SFL_TRY
+        {
+            sfl::dtl::merge_with_buffer
+            (
+                data_.ref_to_alloc(),
+                data_.first_,
+                data_.first_ + pos,
+                data_.last_,
+                data_.ref_to_comp(),
+                true
+            );
+        }
+        SFL_CATCH (...)
+        {
+            if (data_.last_ > data_.first_ + pos)
+            {
+                sfl::dtl::destroy_a(data_.ref_to_alloc(), data_.first_ + pos, data_.last_);
+                data_.last_ = data_.first_ + pos;
+            }
+            SFL_RETHROW;
+        }
+    }
+
+    // Constructs new element from `args` directly in place if it goes to
+    // the end and there is room for it. Otherwise, element is constructed
+    // as a temporary before existing elements are moved.
+    template <typename... Args>
+    iterator emplace_exactly_at(const_iterator pos, Args&&... args)
+    {
+        if (pos == cend() && data_.last_ != data_.eos_)
+        {
+            sfl::dtl::construct_at_a
+            (
+                data_.ref_to_alloc(),
+                data_.last_,
+                std::forward<Args>(args)...
+            );
+
+            ++data_.last_;
+
+            return iterator(data_.last_ - 1);
+        }
+
+        return insert_exactly_at(pos, value_type(std::forward<Args>(args)...));
+    }
+
     template <typename Value>
     iterator insert_exactly_at(const_iterator pos, Value&& value)
     {
         if (data_.last_ != data_.eos_)
         {
-            const pointer p1 = data_.first_ + std::distance(cbegin(), pos);
+            const pointer p1 = data_.first_ + std::distance(const_iterator(data_.first_), pos);
 
             if (p1 == data_.last_)
             {
@@ -1975,7 +2512,7 @@ private:
         }
         else
         {
-            const difference_type offset = std::distance(cbegin(), pos);
+            const difference_type offset = std::distance(const_iterator(data_.first_), pos);
 
             const size_type new_cap =
                 calculate_new_capacity(1, "sfl::small_flat_map::insert_exactly_at");
@@ -2088,6 +2625,433 @@ private:
         }
     }
 
+    // Returns pointer to the element equivalent to `x` or `data_.last_`.
+    // Searches the sorted range and every run of pending elements, so it
+    // does not need to merge pending elements first.
+    template <typename K>
+    pointer find_aux(const K& x) const
+    {
+        size_type rest = data_.pending();
+
+        pointer run_last = data_.last_;
+
+        for (size_type len = 1; rest != 0; len <<= 1)
+        {
+            if (rest & len)
+            {
+                const pointer run_first = run_last - len;
+
+                const pointer p = sfl::dtl::lower_bound(run_first, run_last, x, data_.ref_to_comp());
+
+                if (p != run_last && !data_.ref_to_comp()(x, *p))
+                {
+                    return p;
+                }
+
+                run_last = run_first;
+                rest -= len;
+            }
+        }
+
+        const pointer p = sfl::dtl::lower_bound(data_.first_, run_last, x, data_.ref_to_comp());
+
+        if (p != run_last && !data_.ref_to_comp()(x, *p))
+        {
+            return p;
+        }
+
+        return data_.last_;
+    }
+
+    // Returns pointer to the least element with key that compares not less
+    // than `x`, or greater than `x` if `upper` is true, or `data_.last_` if
+    // there is no such element. Like `find_aux`, searches the sorted range
+    // and every run of pending elements without merging them.
+    template <typename K>
+    pointer bound_aux(const K& x, bool upper) const
+    {
+        size_type rest = data_.pending();
+
+        pointer run_last = data_.last_;
+
+        pointer result = data_.last_;
+
+        for (size_type len = 1; rest != 0; len <<= 1)
+        {
+            if (rest & len)
+            {
+                const pointer run_first = run_last - len;
+
+                const pointer p = upper
+                    ? sfl::dtl::upper_bound(run_first, run_last, x, data_.ref_to_comp())
+                    : sfl::dtl::lower_bound(run_first, run_last, x, data_.ref_to_comp());
+
+                if (p != run_last && (result == data_.last_ || data_.ref_to_comp()(*p, *result)))
+                {
+                    result = p;
+                }
+
+                run_last = run_first;
+                rest -= len;
+            }
+        }
+
+        const pointer p = upper
+            ? sfl::dtl::upper_bound(data_.first_, run_last, x, data_.ref_to_comp())
+            : sfl::dtl::lower_bound(data_.first_, run_last, x, data_.ref_to_comp());
+
+        if (p != run_last && (result == data_.last_ || data_.ref_to_comp()(*p, *result)))
+        {
+            result = p;
+        }
+
+        return result;
+    }
+
+    // Returns range of elements with key equivalent to `x`. If there are
+    // pending elements, searches the sorted range and every run of pending
+    // elements without merging them, and returns the equivalent elements of
+    // the range or run that holds the least of them. Several stored keys
+    // can be equivalent to heterogeneous `x`, so both ends are searched.
+    template <typename K>
+    std::pair<pointer, pointer> equal_range_aux(const K& x) const
+    {
+        if (data_.pending() == 0)
+        {
+            return sfl::dtl::equal_range(data_.first_, data_.last_, x, data_.ref_to_comp());
+        }
+
+        size_type rest = data_.pending();
+
+        pointer run_last = data_.last_;
+
+        std::pair<pointer, pointer> result(data_.last_, data_.last_);
+
+        for (size_type len = 1; rest != 0; len <<= 1)
+        {
+            if (rest & len)
+            {
+                const pointer run_first = run_last - len;
+
+                const std::pair<pointer, pointer> r =
+                    sfl::dtl::equal_range(run_first, run_last, x, data_.ref_to_comp());
+
+                if (r.first != r.second && (result.first == result.second || data_.ref_to_comp()(*r.first, *result.first)))
+                {
+                    result = r;
+                }
+
+                run_last = run_first;
+                rest -= len;
+            }
+        }
+
+        const std::pair<pointer, pointer> r =
+            sfl::dtl::equal_range(data_.first_, run_last, x, data_.ref_to_comp());
+
+        if (r.first != r.second && (result.first == result.second || data_.ref_to_comp()(*r.first, *result.first)))
+        {
+            result = r;
+        }
+
+        if (result.first == result.second)
+        {
+            const pointer p = bound_aux(x, false);
+            return std::make_pair(p, p);
+        }
+
+        return result;
+    }
+
+    // Returns index at which `insert_pending` will place new element with
+    // key `x`. The new element is inserted into the run merged from the
+    // last runs of lengths 1, 2, 4, ... for as long as such runs exist, so
+    // its index is the start of those runs plus the number of smaller
+    // elements in them.
+    template <typename K>
+    size_type pending_insert_index(const K& x) const
+    {
+        const size_type pending = data_.pending();
+
+        pointer run_last = data_.last_;
+
+        size_type num_less = 0;
+
+        for (size_type len = 1; pending & len; len <<= 1)
+        {
+            const pointer run_first = run_last - len;
+
+            num_less += std::distance
+            (
+                run_first,
+                sfl::dtl::lower_bound(run_first, run_last, x, data_.ref_to_comp())
+            );
+
+            run_last = run_first;
+        }
+
+        return std::distance(data_.first_, run_last) + num_less;
+    }
+
+    // Merges the last runs of lengths 1, 2, 4, ... into one run and inserts
+    // new element into it at index `pos`, like incrementing a binary
+    // counter. Every element takes part in O(log n) linear merges, so
+    // insertion takes amortized O(log n) element moves. If an exception is
+    // thrown, the new element is not inserted.
+    template <typename... Args>
+    iterator insert_pending(size_type pos, Args&&... args)
+    {
+        const size_type pending = data_.pending();
+
+        const size_type runs = pending & ~(pending + 1);
+
+        merge_runs(data_.last_ - runs, runs);
+
+        emplace_exactly_at(const_iterator(data_.first_ + pos), std::forward<Args>(args)...);
+
+        data_.set_pending(pending + 1);
+
+        return iterator(data_.first_ + pos);
+    }
+
+    // Erases pending element pointed to by `p`. The run that contained `p`
+    // is first merged with all following runs, and then the element is
+    // erased from the merged run. The result is again a valid sequence of
+    // runs for the decremented number of pending elements because it is
+    // sorted and shorter than the preceding run. If an exception is thrown,
+    // no element is erased.
+    void erase_pending(pointer p)
+    {
+        const size_type pending = data_.pending();
+
+        pointer run_first = data_.last_;
+
+        size_type len = 1;
+
+        for (;; len <<= 1)
+        {
+            if (pending & len)
+            {
+                run_first -= len;
+
+                if (p >= run_first)
+                {
+                    break;
+                }
+            }
+        }
+
+        // Index of the element in the merged run.
+        size_type index = std::distance(run_first, p);
+
+        pointer run_last = data_.last_;
+
+        for (size_type l = 1; l != len; l <<= 1)
+        {
+            if (pending & l)
+            {
+                const pointer first = run_last - l;
+
+                index += std::distance
+                (
+                    first,
+                    sfl::dtl::lower_bound(first, run_last, *p, data_.ref_to_comp())
+                );
+
+                run_last = first;
+            }
+        }
+
+        merge_runs(run_first, pending & (len - 1));
+
+        p = run_first + index;
+
+        data_.last_ = sfl::dtl::move(p + 1, data_.last_, p);
+
+        sfl::dtl::destroy_at_a(data_.ref_to_alloc(), data_.last_);
+
+        data_.set_pending(pending - 1);
+    }
+
+    // Erases elements in range [p1, p2) that overlaps pending elements.
+    // Remaining pending elements are sorted again as one run, which is a
+    // valid sequence of runs for any number of pending elements. All
+    // comparisons are made on an array of indices before any element is
+    // moved, so if comparison or allocation throws, no element is erased.
+    // If moving an element throws, pending elements are removed.
+    void erase_pending(pointer p1, pointer p2)
+    {
+        using index_allocator =
+            typename std::allocator_traits<allocator_type>::template rebind_alloc<size_type>;
+
+        using index_pointer =
+            typename std::allocator_traits<index_allocator>::pointer;
+
+        const pointer pending_first = data_.last_ - data_.pending();
+
+        // After erasing, pending elements are [new_first, data_.last_).
+        const pointer new_first = std::min(p1, pending_first);
+
+        const size_type n = data_.pending() - (p2 - std::max(p1, pending_first));
+
+        // Returns position of `i`-th remaining pending element before erasing.
+        const auto old_pos = [&](size_type i)
+        {
+            const pointer p = new_first + i;
+            return p < p1 ? p : p + (p2 - p1);
+        };
+
+        index_allocator ia(data_.ref_to_alloc());
+
+        const index_pointer index = sfl::dtl::allocate(ia, n);
+
+        pointer buffer = nullptr;
+
+        SFL_TRY
+        {
+            size_type* const idx = sfl::dtl::to_address(index);
+
+            for (size_type i = 0; i != n; ++i)
+            {
+                idx[i] = i;
+            }
+
+            std::sort
+            (
+                idx,
+                idx + n,
+                [&](size_type i, size_type j)
+                {
+                    return data_.ref_to_comp()(*old_pos(i), *old_pos(j));
+                }
+            );
+
+            buffer = sfl::dtl::allocate(data_.ref_to_alloc(), n);
+        }
+        SFL_CATCH (...)
+        {
+            sfl::dtl::deallocate(ia, index, n);
+            SFL_RETHROW;
+        }
+
+        const pointer new_last = sfl::dtl::move(p2, data_.last_, p1);
+
+        sfl::dtl::destroy_a(data_.ref_to_alloc(), new_last, data_.last_);
+
+        data_.last_ = new_last;
+
+        data_.set_pending(0);
+
+        size_type constructed = 0;
+
+        SFL_TRY
+        {
+            for (; constructed != n; ++constructed)
+            {
+                sfl::dtl::construct_at_a
+                (
+                    data_.ref_to_alloc(),
+                    buffer + constructed,
+                    std::move(new_first[index[constructed]])
+                );
+            }
+
+            sfl::dtl::move(buffer, buffer + n, new_first);
+        }
+        SFL_CATCH (...)
+        {
+            sfl::dtl::destroy_a(data_.ref_to_alloc(), new_first, data_.last_);
+            data_.last_ = new_first;
+
+            sfl::dtl::destroy_a(data_.ref_to_alloc(), buffer, buffer + constructed);
+            sfl::dtl::deallocate(data_.ref_to_alloc(), buffer, n);
+            sfl::dtl::deallocate(ia, index, n);
+            SFL_RETHROW;
+        }
+
+        sfl::dtl::destroy_a(data_.ref_to_alloc(), buffer, buffer + n);
+        sfl::dtl::deallocate(data_.ref_to_alloc(), buffer, n);
+        sfl::dtl::deallocate(ia, index, n);
+
+        data_.set_pending(n);
+    }
+
+    // Merges sorted range [first, data_.last_ - runs) with the following
+    // runs, whose lengths are the powers of two present in `runs`, shortest
+    // run first, using temporary buffers from the allocator. Merged runs
+    // form one sorted range at the end, which is again a valid sequence of
+    // runs for the same number of pending elements, so if comparison or
+    // allocation throws, no element is lost. If moving an element throws,
+    // elements of the runs being merged are removed; the remaining runs
+    // are left untouched and stay pending.
+    void merge_runs(pointer first, size_type runs)
+    {
+        const pointer last = data_.last_;
+
+        const pointer sorted_last = data_.last_ - data_.pending();
+
+        SFL_TRY
+        {
+            pointer run_last = data_.last_;
+
+            for (size_type len = 1; runs != 0; len <<= 1)
+            {
+                if (runs & len)
+                {
+                    const pointer run_first = run_last - len;
+
+                    sfl::dtl::merge_with_buffer
+                    (
+                        data_.ref_to_alloc(),
+                        run_first,
+                        run_last,
+                        data_.last_,
+                        data_.ref_to_comp(),
+                        false
+                    );
+
+                    run_last = run_first;
+                    runs -= len;
+                }
+            }
+
+            sfl::dtl::merge_with_buffer
+            (
+                data_.ref_to_alloc(),
+                first,
+                run_last,
+                data_.last_,
+                data_.ref_to_comp(),
+                false
+            );
+        }
+        SFL_CATCH (...)
+        {
+            if (data_.last_ != last)
+            {
+                // Elements are destroyed from the back, so the remaining
+                // pending elements are exactly the runs that were not
+                // merged yet, and their lengths are the bits of their count.
+                data_.set_pending
+                (
+                    data_.last_ > sorted_last ? data_.last_ - sorted_last : 0
+                );
+            }
+            SFL_RETHROW;
+        }
+    }
+
+    void merge_pending()
+    {
+        const size_type pending = data_.pending();
+
+        if (pending != 0)
+        {
+            merge_runs(data_.first_, pending);
+            data_.set_pending(0);
+        }
+    }
+
     template <typename Value>
     bool is_insert_hint_good(const_iterator hint, const Value& value)
     {
@@ -2100,86 +3064,88 @@ private:
 // ---- NON-MEMBER FUNCTIONS --------------------------------------------------
 //
 
-template <typename K, typename T, std::size_t N, typename C, typename A>
+template <typename K, typename T, std::size_t N, typename C, typename A, bool L>
 SFL_NODISCARD
 bool operator==
 (
-    const small_flat_map<K, T, N, C, A>& x,
-    const small_flat_map<K, T, N, C, A>& y
+    const small_flat_map<K, T, N, C, A, L>& x,
+    const small_flat_map<K, T, N, C, A, L>& y
 )
 {
-    return x.size() == y.size() && std::equal(x.begin(), x.end(), y.begin());
+    const auto x_first = x.begin();
+    const auto y_first = y.begin();
+    return x.size() == y.size() && std::equal(x_first, x.end(), y_first);
 }
 
-template <typename K, typename T, std::size_t N, typename C, typename A>
+template <typename K, typename T, std::size_t N, typename C, typename A, bool L>
 SFL_NODISCARD
 bool operator!=
 (
-    const small_flat_map<K, T, N, C, A>& x,
-    const small_flat_map<K, T, N, C, A>& y
+    const small_flat_map<K, T, N, C, A, L>& x,
+    const small_flat_map<K, T, N, C, A, L>& y
 )
 {
     return !(x == y);
 }
 
-template <typename K, typename T, std::size_t N, typename C, typename A>
+template <typename K, typename T, std::size_t N, typename C, typename A, bool L>
 SFL_NODISCARD
 bool operator<
 (
-    const small_flat_map<K, T, N, C, A>& x,
-    const small_flat_map<K, T, N, C, A>& y
+    const small_flat_map<K, T, N, C, A, L>& x,
+    const small_flat_map<K, T, N, C, A, L>& y
 )
 {
     return std::lexicographical_compare(x.begin(), x.end(), y.begin(), y.end());
 }
 
-template <typename K, typename T, std::size_t N, typename C, typename A>
+template <typename K, typename T, std::size_t N, typename C, typename A, bool L>
 SFL_NODISCARD
 bool operator>
 (
-    const small_flat_map<K, T, N, C, A>& x,
-    const small_flat_map<K, T, N, C, A>& y
+    const small_flat_map<K, T, N, C, A, L>& x,
+    const small_flat_map<K, T, N, C, A, L>& y
 )
 {
     return y < x;
 }
 
-template <typename K, typename T, std::size_t N, typename C, typename A>
+template <typename K, typename T, std::size_t N, typename C, typename A, bool L>
 SFL_NODISCARD
 bool operator<=
 (
-    const small_flat_map<K, T, N, C, A>& x,
-    const small_flat_map<K, T, N, C, A>& y
+    const small_flat_map<K, T, N, C, A, L>& x,
+    const small_flat_map<K, T, N, C, A, L>& y
 )
 {
     return !(y < x);
 }
 
-template <typename K, typename T, std::size_t N, typename C, typename A>
+template <typename K, typename T, std::size_t N, typename C, typename A, bool L>
 SFL_NODISCARD
 bool operator>=
 (
-    const small_flat_map<K, T, N, C, A>& x,
-    const small_flat_map<K, T, N, C, A>& y
+    const small_flat_map<K, T, N, C, A, L>& x,
+    const small_flat_map<K, T, N, C, A, L>& y
 )
 {
     return !(x < y);
 }
 
-template <typename K, typename T, std::size_t N, typename C, typename A>
+template <typename K, typename T, std::size_t N, typename C, typename A, bool L>
 void swap
 (
-    small_flat_map<K, T, N, C, A>& x,
-    small_flat_map<K, T, N, C, A>& y
+    small_flat_map<K, T, N, C, A, L>& x,
+    small_flat_map<K, T, N, C, A, L>& y
 )
 {
     x.swap(y);
 }
 
-template <typename K, typename T, std::size_t N, typename C, typename A,
+template <typename K, typename T, std::size_t N, typename C, typename A, bool L,
           typename Predicate>
-typename small_flat_map<K, T, N, C, A>::size_type
-    erase_if(small_flat_map<K, T, N, C, A>& c, Predicate pred)
+typename small_flat_map<K, T, N, C, A, L>::size_type
+    erase_if(small_flat_map<K, T, N, C, A, L>& c, Predicate pred)
 {
     auto old_size = c.size();
 
@@ -22,8 +22,9 @@
 #define SFL_SMALL_FLAT_MULTIMAP_HPP_INCLUDED
 
 #include "private.hpp"
+#include "vector.hpp"
 
-#include <algorithm>        // copy, move, lower_bound, swap, swap_ranges
+#include <algorithm>        // copy, move, reverse, rotate, swap, swap_ranges
 #include <cstddef>          // size_t
 #include <functional>       // equal_to, less
 #include <initializer_list> // initializer_list
@@ -364,6 +365,58 @@ public:
         : small_flat_multimap(ilist.begin(), ilist.end(), comp, alloc)
     {}
 
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    small_flat_multimap(sfl::sorted_equivalent_t, InputIt first, InputIt last)
+        : data_()
+    {
+        initialize_range(sfl::sorted_equivalent_t(), first, last);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    small_flat_multimap(sfl::sorted_equivalent_t, InputIt first, InputIt last, const Compare& comp)
+        : data_(comp)
+    {
+        initialize_range(sfl::sorted_equivalent_t(), first, last);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    small_flat_multimap(sfl::sorted_equivalent_t, InputIt first, InputIt last, const Allocator& alloc)
+        : data_(alloc)
+    {
+        initialize_range(sfl::sorted_equivalent_t(), first, last);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    small_flat_multimap(sfl::sorted_equivalent_t, InputIt first, InputIt last, const Compare& comp,
+                                                                               const Allocator& alloc)
+        : data_(comp, alloc)
+    {
+        initialize_range(sfl::sorted_equivalent_t(), first, last);
+    }
+
+    small_flat_multimap(sfl::sorted_equivalent_t, std::initializer_list<value_type> ilist)
+        : small_flat_multimap(sfl::sorted_equivalent_t(), ilist.begin(), ilist.end())
+    {}
+
+    small_flat_multimap(sfl::sorted_equivalent_t, std::initializer_list<value_type> ilist,
+                        const Compare& comp)
+        : small_flat_multimap(sfl::sorted_equivalent_t(), ilist.begin(), ilist.end(), comp)
+    {}
+
+    small_flat_multimap(sfl::sorted_equivalent_t, std::initializer_list<value_type> ilist,
+                        const Allocator& alloc)
+        : small_flat_multimap(sfl::sorted_equivalent_t(), ilist.begin(), ilist.end(), alloc)
+    {}
+
+    small_flat_multimap(sfl::sorted_equivalent_t, std::initializer_list<value_type> ilist,
+                        const Compare& comp, const Allocator& alloc)
+        : small_flat_multimap(sfl::sorted_equivalent_t(), ilist.begin(), ilist.end(), comp, alloc)
+    {}
+
     small_flat_multimap(const small_flat_multimap& other)
         : data_
         (
@@ -885,11 +938,7 @@ public:
               sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
     void insert(InputIt first, InputIt last)
     {
-        while (first != last)
-        {
-            insert(*first);
-            ++first;
-        }
+        insert_range_aux(first, last);
     }
 
     void insert(std::initializer_list<value_type> ilist)
@@ -897,6 +946,18 @@ public:
         insert(ilist.begin(), ilist.end());
     }
 
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    void insert(sfl::sorted_equivalent_t, InputIt first, InputIt last)
+    {
+        insert_sorted_range_aux(first, last);
+    }
+
+    void insert(sfl::sorted_equivalent_t, std::initializer_list<value_type> ilist)
+    {
+        insert(sfl::sorted_equivalent_t(), ilist.begin(), ilist.end());
+    }
+
     iterator erase(iterator pos)
     {
         return erase(const_iterator(pos));
@@ -1116,6 +1177,89 @@ public:
         }
     }
 
+    // Moves all elements into a vector and leaves the container empty.
+    // Dynamically allocated storage is handed over to the vector as is.
+    sfl::vector<value_type, Allocator> extract()
+    {
+        sfl::vector<value_type, Allocator> result(data_.ref_to_alloc());
+
+        if (data_.first_ == data_.internal_storage())
+        {
+            const size_type n = size();
+
+            if (n != 0)
+            {
+                const pointer new_first = sfl::dtl::allocate(data_.ref_to_alloc(), n);
+
+                pointer new_last = new_first;
+
+                SFL_TRY
+                {
+                    new_last = sfl::dtl::uninitialized_move_a
+                    (
+                        data_.ref_to_alloc(),
+                        data_.first_,
+                        data_.last_,
+                        new_first
+                    );
+                }
+                SFL_CATCH (...)
+                {
+                    sfl::dtl::deallocate(data_.ref_to_alloc(), new_first, n);
+                    SFL_RETHROW;
+                }
+
+                sfl::dtl::vector_access::adopt(result, new_first, new_last, new_first + n);
+
+                clear();
+            }
+        }
+        else
+        {
+            sfl::dtl::vector_access::adopt(result, data_.first_, data_.last_, data_.eos_);
+
+            data_.first_ = data_.internal_storage();
+            data_.last_  = data_.first_;
+            data_.eos_   = data_.first_ + N;
+        }
+
+        return result;
+    }
+
+    // Replaces all elements with elements of `cont`. Elements that fit into
+    // internal storage are moved there. Otherwise, if allocators compare
+    // equal, storage of `cont` is taken over as is.
+    void replace(sfl::vector<value_type, Allocator>&& cont)
+    {
+        SFL_ASSERT(std::is_sorted(cont.begin(), cont.end(), data_.ref_to_comp()));
+
+        if (cont.size() > N && cont.get_allocator() == data_.ref_to_alloc())
+        {
+            reset();
+
+            sfl::dtl::vector_access::release(cont, data_.first_, data_.last_, data_.eos_);
+        }
+        else
+        {
+            if (cont.size() <= N)
+            {
+                reset();
+            }
+            else
+            {
+                clear();
+            }
+
+            assign_range
+            (
+                std::make_move_iterator(cont.begin()),
+                std::make_move_iterator(cont.end())
+            );
+
+            cont.clear();
+        }
+    }
+
     //
     // ---- LOOKUP ------------------------------------------------------------
     //
@@ -1123,13 +1267,13 @@ public:
     SFL_NODISCARD
     iterator lower_bound(const Key& key)
     {
-        return std::lower_bound(begin(), end(), key, data_.ref_to_comp());
+        return sfl::dtl::lower_bound(begin(), end(), key, data_.ref_to_comp());
     }
 
     SFL_NODISCARD
     const_iterator lower_bound(const Key& key) const
     {
-        return std::lower_bound(begin(), end(), key, data_.ref_to_comp());
+        return sfl::dtl::lower_bound(begin(), end(), key, data_.ref_to_comp());
     }
 
     template <typename K,
@@ -1137,7 +1281,7 @@ public:
     SFL_NODISCARD
     iterator lower_bound(const K& x)
     {
-        return std::lower_bound(begin(), end(), x, data_.ref_to_comp());
+        return sfl::dtl::lower_bound(begin(), end(), x, data_.ref_to_comp());
     }
 
     template <typename K,
@@ -1145,19 +1289,19 @@ public:
     SFL_NODISCARD
     const_iterator lower_bound(const K& x) const
     {
-        return std::lower_bound(begin(), end(), x, data_.ref_to_comp());
+        return sfl::dtl::lower_bound(begin(), end(), x, data_.ref_to_comp());
     }
 
     SFL_NODISCARD
     iterator upper_bound(const Key& key)
     {
-        return std::upper_bound(begin(), end(), key, data_.ref_to_comp());
+        return sfl::dtl::upper_bound(begin(), end(), key, data_.ref_to_comp());
     }
 
     SFL_NODISCARD
     const_iterator upper_bound(const Key& key) const
     {
-        return std::upper_bound(begin(), end(), key, data_.ref_to_comp());
+        return sfl::dtl::upper_bound(begin(), end(), key, data_.ref_to_comp());
     }
 
     template <typename K,
@@ -1165,7 +1309,7 @@ public:
     SFL_NODISCARD
     iterator upper_bound(const K& x)
     {
-        return std::upper_bound(begin(), end(), x, data_.ref_to_comp());
+        return sfl::dtl::upper_bound(begin(), end(), x, data_.ref_to_comp());
     }
 
     template <typename K,
@@ -1173,19 +1317,19 @@ public:
     SFL_NODISCARD
     const_iterator upper_bound(const K& x) const
     {
-        return std::upper_bound(begin(), end(), x, data_.ref_to_comp());
+        return sfl::dtl::upper_bound(begin(), end(), x, data_.ref_to_comp());
     }
 
     SFL_NODISCARD
     std::pair<iterator, iterator> equal_range(const Key& key)
     {
-        return std::equal_range(begin(), end(), key, data_.ref_to_comp());
+        return sfl::dtl::equal_range(begin(), end(), key, data_.ref_to_comp());
     }
 
     SFL_NODISCARD
     std::pair<const_iterator, const_iterator> equal_range(const Key& key) const
     {
-        return std::equal_range(begin(), end(), key, data_.ref_to_comp());
+        return sfl::dtl::equal_range(begin(), end(), key, data_.ref_to_comp());
     }
 
     template <typename K,
@@ -1193,7 +1337,7 @@ public:
     SFL_NODISCARD
     std::pair<iterator, iterator> equal_range(const K& x)
     {
-        return std::equal_range(begin(), end(), x, data_.ref_to_comp());
+        return sfl::dtl::equal_range(begin(), end(), x, data_.ref_to_comp());
     }
 
     template <typename K,
@@ -1201,7 +1345,7 @@ public:
     SFL_NODISCARD
     std::pair<const_iterator, const_iterator> equal_range(const K& x) const
     {
-        return std::equal_range(begin(), end(), x, data_.ref_to_comp());
+        return sfl::dtl::equal_range(begin(), end(), x, data_.ref_to_comp());
     }
 
     SFL_NODISCARD
@@ -1379,11 +1523,37 @@ private:
     {
         SFL_TRY
         {
-            while (first != last)
+            insert(first, last);
+        }
+        SFL_CATCH (...)
+        {
+            sfl::dtl::destroy_a
+            (
+                data_.ref_to_alloc(),
+                data_.first_,
+                data_.last_
+            );
+
+            if (data_.first_ != data_.internal_storage())
             {
-                insert(*first);
-                ++first;
+                sfl::dtl::deallocate
+                (
+                    data_.ref_to_alloc(),
+                    data_.first_,
+                    std::distance(data_.first_, data_.eos_)
+                );
             }
+
+            SFL_RETHROW;
+        }
+    }
+
+    template <typename InputIt>
+    void initialize_range(sfl::sorted_equivalent_t, InputIt first, InputIt last)
+    {
+        SFL_TRY
+        {
+            insert(sfl::sorted_equivalent_t(), first, last);
         }
         SFL_CATCH (...)
         {
@@ -1644,6 +1814,134 @@ private:
         return insert_aux(std::forward<Value>(value));
     }
 
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<!sfl::dtl::is_forward_iterator<InputIt>::value>* = nullptr>
+    void append_range(InputIt first, InputIt last)
+    {
+        while (first != last)
+        {
+            insert_exactly_at(cend(), *first);
+            ++first;
+        }
+    }
+
+    template <typename ForwardIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_forward_iterator<ForwardIt>::value>* = nullptr>
+    void append_range(ForwardIt first, ForwardIt last)
+    {
+        const size_type n = std::distance(first, last);
+
+        if (n > available())
+        {
+            reserve(calculate_new_capacity(n, "sfl::small_flat_multimap::append_range"));
+        }
+
+        data_.last_ = sfl::dtl::uninitialized_copy_a
+        (
+            data_.ref_to_alloc(),
+            first,
+            last,
+            data_.last_
+        );
+    }
+
+    // Appends all elements and then sorts and merges them at once using
+    // temporary buffers, which takes O(m * log(m) + n) element moves instead
+    // of O(n * m).
+    template <typename InputIt>
+    void insert_range_aux(InputIt first, InputIt last)
+    {
+        const size_type old_size = size();
+
+        SFL_TRY
+        {
+            append_range(first, last);
+        }
+        SFL_CATCH (...)
+        {
+            erase(nth(old_size), cend());
+            SFL_RETHROW;
+        }
+
+        merge_appended(old_size);
+    }
+
+    // Appends all elements and merges them with existing elements. Unlike
+    // `insert_range_aux`, appended elements are not sorted because they
+    // must already be in order.
+    template <typename InputIt>
+    void insert_sorted_range_aux(InputIt first, InputIt last)
+    {
+        const size_type old_size = size();
+
+        SFL_TRY
+        {
+            append_range(first, last);
+        }
+        SFL_CATCH (...)
+        {
+            erase(nth(old_size), cend());
+            SFL_RETHROW;
+        }
+
+        SFL_ASSERT(std::is_sorted(data_.first_ + old_size, data_.last_, data_.ref_to_comp()));
+
+        merge_sorted_appended(old_size);
+    }
+
+    // Sorts elements at positions `pos` and above and merges them with
+    // preceding elements. Like single element insertion (which inserts at
+    // lower bound), new elements precede existing equivalent elements and
+    // later new elements precede earlier ones. If an exception is thrown,
+    // new elements are removed and existing elements are kept.
+    void merge_appended(size_type pos)
+    {
+        const pointer mid = data_.first_ + pos;
+
+        SFL_TRY
+        {
+            std::reverse(mid, data_.last_);
+            sfl::dtl::stable_sort_with_buffer(data_.ref_to_alloc(), mid, data_.last_, data_.ref_to_comp());
+        }
+        SFL_CATCH (...)
+        {
+            erase(nth(pos), cend());
+            SFL_RETHROW;
+        }
+
+        merge_sorted_appended(pos);
+    }
+
+    // Merges sorted elements at positions `pos` and above with preceding
+    // elements. New elements precede existing equivalent elements. If an
+    // exception is thrown, new elements are removed and existing elements
+    // are kept, unless moving an existing element throws, in which case all
+    // elements are removed.
+    void merge_sorted_appended(size_type pos)
+    {
+        SFL_TRY
+        {
+            sfl::dtl::merge_with_buffer
+            (
+                data_.ref_to_alloc(),
+                data_.first_,
+                data_.first_ + pos,
+                data_.last_,
+                data_.ref_to_comp(),
+                false
+            );
+        }
+        SFL_CATCH (...)
+        {
+            if (data_.last_ > data_.first_ + pos)
+            {
+                sfl::dtl::destroy_a(data_.ref_to_alloc(), data_.first_ + pos, data_.last_);
+                data_.last_ = data_.first_ + pos;
+            }
+            SFL_RETHROW;
+        }
+    }
+
     template <typename Value>
     iterator insert_exactly_at(const_iterator pos, Value&& value)
     {
@@ -0,0 +1,2518 @@
+//
+// Copyright (c) 2022 Slaven Falandys
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+//
+
+#ifndef SFL_SMALL_FLAT_SPLIT_MAP_HPP_INCLUDED
+#define SFL_SMALL_FLAT_SPLIT_MAP_HPP_INCLUDED
+
+#include "private.hpp"
+#include "vector.hpp"
+
+#include <algorithm>        // copy, equal, lexicographical_compare, swap_ranges
+#include <cstddef>          // size_t
+#include <functional>       // less
+#include <initializer_list> // initializer_list
+#include <iterator>         // distance, make_move_iterator, next, reverse_iterator
+#include <limits>           // numeric_limits
+#include <memory>           // allocator, allocator_traits, pointer_traits
+#include <type_traits>      // is_same, is_nothrow_xxxxx
+#include <tuple>            // forward_as_tuple
+#include <utility>          // forward, move, pair
+
+#ifdef SFL_TEST_SMALL_FLAT_SPLIT_MAP
+template <int>
+void test_small_flat_split_map();
+#endif
+
+namespace sfl
+{
+
+template < typename Key,
+           typename T,
+           std::size_t N,
+           typename Compare = std::less<Key>,
+           typename Allocator = std::allocator<std::pair<Key, T>> >
+class small_flat_split_map
+{
+    #ifdef SFL_TEST_SMALL_FLAT_SPLIT_MAP
+    template <int>
+    friend void ::test_small_flat_split_map();
+    #endif
+
+public:
+
+    using allocator_type         = Allocator;
+    using allocator_traits       = std::allocator_traits<allocator_type>;
+    using key_type               = Key;
+    using mapped_type            = T;
+    using value_type             = std::pair<Key, T>;
+    using size_type              = typename allocator_traits::size_type;
+    using difference_type        = typename allocator_traits::difference_type;
+    using key_compare            = Compare;
+    using reference              = std::pair<const Key&, T&>;
+    using const_reference        = std::pair<const Key&, const T&>;
+    using iterator               = sfl::dtl::split_iterator<Key, T, small_flat_split_map>;
+    using const_iterator         = sfl::dtl::split_iterator<Key, const T, small_flat_split_map>;
+    using reverse_iterator       = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    class value_compare : protected key_compare
+    {
+        friend class small_flat_split_map;
+
+    private:
+
+        value_compare(const key_compare& c) : key_compare(c)
+        {}
+
+    public:
+
+        bool operator()(const_reference x, const_reference y) const
+        {
+            return key_compare::operator()(x.first, y.first);
+        }
+    };
+
+    static_assert
+    (
+        std::is_same<typename Allocator::value_type, value_type>::value,
+        "Allocator::value_type must be same as sfl::small_flat_split_map::value_type."
+    );
+
+public:
+
+    static constexpr size_type static_capacity = N;
+
+    using key_container_type    = sfl::vector<Key, typename allocator_traits::template rebind_alloc<Key>>;
+    using mapped_container_type = sfl::vector<T, typename allocator_traits::template rebind_alloc<T>>;
+
+    // Keys and mapped values moved out of the container by `extract`.
+    struct containers
+    {
+        key_container_type    keys;
+        mapped_container_type values;
+    };
+
+private:
+
+    //
+    // Keys and mapped values are stored in two separate arrays in the same
+    // memory block. The array of keys is at the beginning of the block and
+    // the array of mapped values follows it (suitably aligned).
+    //
+    // Memory block for `n` elements is allocated as storage for `n` objects
+    // of type `value_type`, which is always enough because
+    // sizeof(value_type) >= round_up(sizeof(Key), alignof(T)) + sizeof(T).
+    //
+
+    using storage_pointer = typename allocator_traits::pointer;
+
+    // Iterator used to sort and merge keys and mapped values together.
+    using zip_iterator = sfl::dtl::split_zip_iterator<Key, T>;
+
+    // Compares elements referenced by `zip_iterator` by keys.
+    // For internal use only.
+    class element_compare
+    {
+    private:
+
+        const key_compare& comp_;
+
+    public:
+
+        explicit element_compare(const key_compare& comp) noexcept
+            : comp_(comp)
+        {}
+
+        template <typename X, typename Y>
+        bool operator()(const X& x, const Y& y) const
+        {
+            return comp_(x.first, y.first);
+        }
+    };
+
+    template <bool WithInternalStorage = true, typename = void>
+    class data_base
+    {
+    private:
+
+        union
+        {
+            value_type internal_storage_[N];
+        };
+
+    public:
+
+        storage_pointer first_;
+        size_type       size_;
+        size_type       capacity_;
+
+        data_base() noexcept
+            : first_(std::pointer_traits<storage_pointer>::pointer_to(*internal_storage_))
+            , size_(0)
+            , capacity_(N)
+        {}
+
+        #if defined(__clang__) && (__clang_major__ == 3) // For CentOS 7
+        ~data_base()
+        {}
+        #else
+        ~data_base() noexcept
+        {}
+        #endif
+
+        storage_pointer internal_storage() noexcept
+        {
+            return std::pointer_traits<storage_pointer>::pointer_to(*internal_storage_);
+        }
+    };
+
+    template <typename Dummy>
+    class data_base<false, Dummy>
+    {
+    public:
+
+        storage_pointer first_;
+        size_type       size_;
+        size_type       capacity_;
+
+        data_base() noexcept
+            : first_(nullptr)
+            , size_(0)
+            , capacity_(0)
+        {}
+
+        storage_pointer internal_storage() noexcept
+        {
+            return nullptr;
+        }
+    };
+
+    class data : public data_base<(N > 0)>, public allocator_type, public key_compare
+    {
+    public:
+
+        data() noexcept
+        (
+            std::is_nothrow_default_constructible<allocator_type>::value &&
+            std::is_nothrow_default_constructible<key_compare>::value
+        )
+            : allocator_type()
+            , key_compare()
+        {}
+
+        data(const key_compare& comp) noexcept
+        (
+            std::is_nothrow_default_constructible<allocator_type>::value &&
+            std::is_nothrow_copy_constructible<key_compare>::value
+        )
+            : allocator_type()
+            , key_compare(comp)
+        {}
+
+        data(const allocator_type& alloc) noexcept
+        (
+            std::is_nothrow_copy_constructible<allocator_type>::value &&
+            std::is_nothrow_default_constructible<key_compare>::value
+        )
+            : allocator_type(alloc)
+            , key_compare()
+        {}
+
+        data(const key_compare& comp, const allocator_type& alloc) noexcept
+        (
+            std::is_nothrow_copy_constructible<allocator_type>::value &&
+            std::is_nothrow_copy_constructible<key_compare>::value
+        )
+            : allocator_type(alloc)
+            , key_compare(comp)
+        {}
+
+        data(key_compare&& comp, allocator_type&& alloc) noexcept
+        (
+            std::is_nothrow_move_constructible<allocator_type>::value &&
+            std::is_nothrow_move_constructible<key_compare>::value
+        )
+            : allocator_type(std::move(alloc))
+            , key_compare(std::move(comp))
+        {}
+
+        data(key_compare&& comp, const allocator_type& alloc) noexcept
+        (
+            std::is_nothrow_copy_constructible<allocator_type>::value &&
+            std::is_nothrow_move_constructible<key_compare>::value
+        )
+            : allocator_type(alloc)
+            , key_compare(std::move(comp))
+        {}
+
+        allocator_type& ref_to_alloc() noexcept
+        {
+            return *this;
+        }
+
+        const allocator_type& ref_to_alloc() const noexcept
+        {
+            return *this;
+        }
+
+        key_compare& ref_to_comp() noexcept
+        {
+            return *this;
+        }
+
+        const key_compare& ref_to_comp() const noexcept
+        {
+            return *this;
+        }
+
+        // Returns pointer to the first key in the block that starts at `first`.
+        static Key* keys_of(storage_pointer first) noexcept
+        {
+            return reinterpret_cast<Key*>(sfl::dtl::to_address(first));
+        }
+
+        // Returns pointer to the first mapped value in the block that starts
+        // at `first` and has capacity for `cap` elements.
+        static T* mapped_of(storage_pointer first, size_type cap) noexcept
+        {
+            const size_type offset =
+                (cap * sizeof(Key) + alignof(T) - 1) / alignof(T) * alignof(T);
+
+            return reinterpret_cast<T*>
+            (
+                reinterpret_cast<unsigned char*>(sfl::dtl::to_address(first)) + offset
+            );
+        }
+
+        Key* keys() const noexcept
+        {
+            return keys_of(this->first_);
+        }
+
+        T* mapped() const noexcept
+        {
+            return mapped_of(this->first_, this->capacity_);
+        }
+    };
+
+    data data_;
+
+public:
+
+    //
+    // ---- CONSTRUCTION AND DESTRUCTION --------------------------------------
+    //
+
+    small_flat_split_map() noexcept
+    (
+        std::is_nothrow_default_constructible<Allocator>::value &&
+        std::is_nothrow_default_constructible<Compare>::value
+    )
+        : data_()
+    {}
+
+    explicit small_flat_split_map(const Compare& comp) noexcept
+    (
+        std::is_nothrow_default_constructible<Allocator>::value &&
+        std::is_nothrow_copy_constructible<Compare>::value
+    )
+        : data_(comp)
+    {}
+
+    explicit small_flat_split_map(const Allocator& alloc) noexcept
+    (
+        std::is_nothrow_copy_constructible<Allocator>::value &&
+        std::is_nothrow_default_constructible<Compare>::value
+    )
+        : data_(alloc)
+    {}
+
+    explicit small_flat_split_map(const Compare& comp, const Allocator& alloc) noexcept
+    (
+        std::is_nothrow_copy_constructible<Allocator>::value &&
+        std::is_nothrow_copy_constructible<Compare>::value
+    )
+        : data_(comp, alloc)
+    {}
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    small_flat_split_map(InputIt first, InputIt last)
+        : data_()
+    {
+        initialize_range(first, last);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    small_flat_split_map(InputIt first, InputIt last, const Compare& comp)
+        : data_(comp)
+    {
+        initialize_range(first, last);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    small_flat_split_map(InputIt first, InputIt last, const Allocator& alloc)
+        : data_(alloc)
+    {
+        initialize_range(first, last);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    small_flat_split_map(InputIt first, InputIt last, const Compare& comp,
+                                                      const Allocator& alloc)
+        : data_(comp, alloc)
+    {
+        initialize_range(first, last);
+    }
+
+    small_flat_split_map(std::initializer_list<value_type> ilist)
+        : small_flat_split_map(ilist.begin(), ilist.end())
+    {}
+
+    small_flat_split_map(std::initializer_list<value_type> ilist,
+                         const Compare& comp)
+        : small_flat_split_map(ilist.begin(), ilist.end(), comp)
+    {}
+
+    small_flat_split_map(std::initializer_list<value_type> ilist,
+                         const Allocator& alloc)
+        : small_flat_split_map(ilist.begin(), ilist.end(), alloc)
+    {}
+
+    small_flat_split_map(std::initializer_list<value_type> ilist,
+                         const Compare& comp, const Allocator& alloc)
+        : small_flat_split_map(ilist.begin(), ilist.end(), comp, alloc)
+    {}
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    small_flat_split_map(sfl::sorted_unique_t, InputIt first, InputIt last)
+        : data_()
+    {
+        initialize_range(sfl::sorted_unique_t(), first, last);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    small_flat_split_map(sfl::sorted_unique_t, InputIt first, InputIt last, const Compare& comp)
+        : data_(comp)
+    {
+        initialize_range(sfl::sorted_unique_t(), first, last);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    small_flat_split_map(sfl::sorted_unique_t, InputIt first, InputIt last, const Allocator& alloc)
+        : data_(alloc)
+    {
+        initialize_range(sfl::sorted_unique_t(), first, last);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    small_flat_split_map(sfl::sorted_unique_t, InputIt first, InputIt last, const Compare& comp,
+                                                                            const Allocator& alloc)
+        : data_(comp, alloc)
+    {
+        initialize_range(sfl::sorted_unique_t(), first, last);
+    }
+
+    small_flat_split_map(sfl::sorted_unique_t, std::initializer_list<value_type> ilist)
+        : small_flat_split_map(sfl::sorted_unique_t(), ilist.begin(), ilist.end())
+    {}
+
+    small_flat_split_map(sfl::sorted_unique_t, std::initializer_list<value_type> ilist,
+                         const Compare& comp)
+        : small_flat_split_map(sfl::sorted_unique_t(), ilist.begin(), ilist.end(), comp)
+    {}
+
+    small_flat_split_map(sfl::sorted_unique_t, std::initializer_list<value_type> ilist,
+                         const Allocator& alloc)
+        : small_flat_split_map(sfl::sorted_unique_t(), ilist.begin(), ilist.end(), alloc)
+    {}
+
+    small_flat_split_map(sfl::sorted_unique_t, std::initializer_list<value_type> ilist,
+                         const Compare& comp, const Allocator& alloc)
+        : small_flat_split_map(sfl::sorted_unique_t(), ilist.begin(), ilist.end(), comp, alloc)
+    {}
+
+    small_flat_split_map(const small_flat_split_map& other)
+        : data_
+        (
+            other.data_.ref_to_comp(),
+            allocator_traits::select_on_container_copy_construction
+            (
+                other.data_.ref_to_alloc()
+            )
+        )
+    {
+        initialize_copy(other);
+    }
+
+    small_flat_split_map(const small_flat_split_map& other, const Allocator& alloc)
+        : data_
+        (
+            other.data_.ref_to_comp(),
+            alloc
+        )
+    {
+        initialize_copy(other);
+    }
+
+    small_flat_split_map(small_flat_split_map&& other)
+        : data_
+        (
+            std::move(other.data_.ref_to_comp()),
+            std::move(other.data_.ref_to_alloc())
+        )
+    {
+        initialize_move(other);
+    }
+
+    small_flat_split_map(small_flat_split_map&& other, const Allocator& alloc)
+        : data_
+        (
+            std::move(other.data_.ref_to_comp()),
+            alloc
+        )
+    {
+        initialize_move(other);
+    }
+
+    ~small_flat_split_map()
+    {
+        destroy_all();
+        deallocate_storage();
+    }
+
+    //
+    // ---- ASSIGNMENT --------------------------------------------------------
+    //
+
+    small_flat_split_map& operator=(const small_flat_split_map& other)
+    {
+        assign_copy(other);
+        return *this;
+    }
+
+    small_flat_split_map& operator=(small_flat_split_map&& other)
+    {
+        assign_move(other);
+        return *this;
+    }
+
+    small_flat_split_map& operator=(std::initializer_list<value_type> ilist)
+    {
+        clear();
+        insert(ilist.begin(), ilist.end());
+        return *this;
+    }
+
+    //
+    // ---- ALLOCATOR ---------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    allocator_type get_allocator() const noexcept
+    {
+        return data_.ref_to_alloc();
+    }
+
+    //
+    // ---- KEY COMPARE -------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    key_compare key_comp() const
+    {
+        return data_.ref_to_comp();
+    }
+
+    //
+    // ---- VALUE COMPARE -----------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    value_compare value_comp() const
+    {
+        return value_compare(data_.ref_to_comp());
+    }
+
+    //
+    // ---- ITERATORS ---------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    iterator begin() noexcept
+    {
+        return nth(0);
+    }
+
+    SFL_NODISCARD
+    const_iterator begin() const noexcept
+    {
+        return nth(0);
+    }
+
+    SFL_NODISCARD
+    const_iterator cbegin() const noexcept
+    {
+        return nth(0);
+    }
+
+    SFL_NODISCARD
+    iterator end() noexcept
+    {
+        return nth(size());
+    }
+
+    SFL_NODISCARD
+    const_iterator end() const noexcept
+    {
+        return nth(size());
+    }
+
+    SFL_NODISCARD
+    const_iterator cend() const noexcept
+    {
+        return nth(size());
+    }
+
+    SFL_NODISCARD
+    reverse_iterator rbegin() noexcept
+    {
+        return reverse_iterator(end());
+    }
+
+    SFL_NODISCARD
+    const_reverse_iterator rbegin() const noexcept
+    {
+        return const_reverse_iterator(end());
+    }
+
+    SFL_NODISCARD
+    const_reverse_iterator crbegin() const noexcept
+    {
+        return const_reverse_iterator(end());
+    }
+
+    SFL_NODISCARD
+    reverse_iterator rend() noexcept
+    {
+        return reverse_iterator(begin());
+    }
+
+    SFL_NODISCARD
+    const_reverse_iterator rend() const noexcept
+    {
+        return const_reverse_iterator(begin());
+    }
+
+    SFL_NODISCARD
+    const_reverse_iterator crend() const noexcept
+    {
+        return const_reverse_iterator(begin());
+    }
+
+    SFL_NODISCARD
+    iterator nth(size_type pos) noexcept
+    {
+        SFL_ASSERT(pos <= size());
+        return iterator(data_.keys() + pos, data_.mapped() + pos);
+    }
+
+    SFL_NODISCARD
+    const_iterator nth(size_type pos) const noexcept
+    {
+        SFL_ASSERT(pos <= size());
+        return const_iterator(data_.keys() + pos, data_.mapped() + pos);
+    }
+
+    SFL_NODISCARD
+    size_type index_of(const_iterator pos) const noexcept
+    {
+        SFL_ASSERT(cbegin() <= pos && pos <= cend());
+        return pos.key_ - data_.keys();
+    }
+
+    //
+    // ---- SIZE AND CAPACITY -------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    bool empty() const noexcept
+    {
+        return data_.size_ == 0;
+    }
+
+    SFL_NODISCARD
+    size_type size() const noexcept
+    {
+        return data_.size_;
+    }
+
+    SFL_NODISCARD
+    size_type max_size() const noexcept
+    {
+        return std::min<size_type>
+        (
+            allocator_traits::max_size(data_.ref_to_alloc()),
+            std::numeric_limits<difference_type>::max() / sizeof(value_type)
+        );
+    }
+
+    SFL_NODISCARD
+    size_type capacity() const noexcept
+    {
+        return data_.capacity_;
+    }
+
+    SFL_NODISCARD
+    size_type available() const noexcept
+    {
+        return data_.capacity_ - data_.size_;
+    }
+
+    void reserve(size_type new_cap)
+    {
+        check_size(new_cap, "sfl::small_flat_split_map::reserve");
+
+        if (new_cap > capacity())
+        {
+            if (new_cap <= N)
+            {
+                if (data_.first_ == data_.internal_storage())
+                {
+                    // Do nothing. We are already using internal storage.
+                }
+                else
+                {
+                    // We are not using internal storage but new capacity
+                    // can fit in internal storage.
+                    reallocate(N);
+                }
+            }
+            else
+            {
+                reallocate(new_cap);
+            }
+        }
+    }
+
+    void shrink_to_fit()
+    {
+        const size_type new_cap = size();
+
+        if (new_cap < capacity())
+        {
+            if (new_cap <= N)
+            {
+                if (data_.first_ == data_.internal_storage())
+                {
+                    // Do nothing. We are already using internal storage.
+                }
+                else
+                {
+                    // We are not using internal storage but new capacity
+                    // can fit in internal storage.
+                    reallocate(N);
+                }
+            }
+            else
+            {
+                reallocate(new_cap);
+            }
+        }
+    }
+
+    //
+    // ---- MODIFIERS ---------------------------------------------------------
+    //
+
+    void clear() noexcept
+    {
+        destroy_all();
+        data_.size_ = 0;
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args)
+    {
+        return emplace_aux(std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    iterator emplace_hint(const_iterator hint, Args&&... args)
+    {
+        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        return emplace_hint_aux(hint, std::forward<Args>(args)...);
+    }
+
+    std::pair<iterator, bool> insert(const value_type& value)
+    {
+        return insert_aux(value);
+    }
+
+    std::pair<iterator, bool> insert(value_type&& value)
+    {
+        return insert_aux(std::move(value));
+    }
+
+    template <typename P,
+              sfl::dtl::enable_if_t<std::is_constructible<value_type, P&&>::value>* = nullptr>
+    std::pair<iterator, bool> insert(P&& value)
+    {
+        return insert_aux(value_type(std::forward<P>(value)));
+    }
+
+    iterator insert(const_iterator hint, const value_type& value)
+    {
+        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        return insert_aux(hint, value);
+    }
+
+    iterator insert(const_iterator hint, value_type&& value)
+    {
+        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        return insert_aux(hint, std::move(value));
+    }
+
+    template <typename P,
+              sfl::dtl::enable_if_t<std::is_constructible<value_type, P&&>::value>* = nullptr>
+    iterator insert(const_iterator hint, P&& value)
+    {
+        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        return insert_aux(hint, value_type(std::forward<P>(value)));
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    void insert(InputIt first, InputIt last)
+    {
+        insert_range_aux(first, last);
+    }
+
+    void insert(std::initializer_list<value_type> ilist)
+    {
+        insert(ilist.begin(), ilist.end());
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    void insert(sfl::sorted_unique_t, InputIt first, InputIt last)
+    {
+        insert_sorted_range_aux(first, last);
+    }
+
+    void insert(sfl::sorted_unique_t, std::initializer_list<value_type> ilist)
+    {
+        insert(sfl::sorted_unique_t(), ilist.begin(), ilist.end());
+    }
+
+    template <typename M,
+              sfl::dtl::enable_if_t<std::is_assignable<mapped_type&, M&&>::value>* = nullptr>
+    std::pair<iterator, bool> insert_or_assign(const Key& key, M&& obj)
+    {
+        return insert_or_assign_aux(key, std::forward<M>(obj));
+    }
+
+    template <typename M,
+              sfl::dtl::enable_if_t<std::is_assignable<mapped_type&, M&&>::value>* = nullptr>
+    std::pair<iterator, bool> insert_or_assign(Key&& key, M&& obj)
+    {
+        return insert_or_assign_aux(std::move(key), std::forward<M>(obj));
+    }
+
+    template <typename K, typename M,
+              sfl::dtl::enable_if_t< sfl::dtl::has_is_transparent<Compare, K>::value &&
+                                     std::is_assignable<mapped_type&, M&&>::value >* = nullptr>
+    std::pair<iterator, bool> insert_or_assign(K&& key, M&& obj)
+    {
+        return insert_or_assign_aux(std::forward<K>(key), std::forward<M>(obj));
+    }
+
+    template <typename M,
+              sfl::dtl::enable_if_t<std::is_assignable<mapped_type&, M&&>::value>* = nullptr>
+    iterator insert_or_assign(const_iterator hint, const Key& key, M&& obj)
+    {
+        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        return insert_or_assign_aux(hint, key, std::forward<M>(obj));
+    }
+
+    template <typename M,
+              sfl::dtl::enable_if_t<std::is_assignable<mapped_type&, M&&>::value>* = nullptr>
+    iterator insert_or_assign(const_iterator hint, Key&& key, M&& obj)
+    {
+        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        return insert_or_assign_aux(hint, std::move(key), std::forward<M>(obj));
+    }
+
+    template <typename K, typename M,
+              sfl::dtl::enable_if_t< sfl::dtl::has_is_transparent<Compare, K>::value &&
+                                     std::is_assignable<mapped_type&, M&&>::value >* = nullptr>
+    iterator insert_or_assign(const_iterator hint, K&& key, M&& obj)
+    {
+        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        return insert_or_assign_aux(hint, std::forward<K>(key), std::forward<M>(obj));
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args)
+    {
+        return try_emplace_aux(key, std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(Key&& key, Args&&... args)
+    {
+        return try_emplace_aux(std::move(key), std::forward<Args>(args)...);
+    }
+
+    template <typename K, typename... Args,
+              sfl::dtl::enable_if_t<
+                #if defined(__GNUC__) && !defined(__clang__) && (__GNUC__ < 7)
+                // This is workaround for GCC 4 bug on CentOS 7.
+                !std::is_same<sfl::dtl::remove_cvref_t<Key>, sfl::dtl::remove_cvref_t<K>>::value &&
+                #endif
+                sfl::dtl::has_is_transparent<Compare, K>::value &&
+                !std::is_convertible<K&&, const_iterator>::value &&
+                !std::is_convertible<K&&, iterator>::value
+              >* = nullptr>
+    std::pair<iterator, bool> try_emplace(K&& key, Args&&... args)
+    {
+        return try_emplace_aux(std::forward<K>(key), std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    iterator try_emplace(const_iterator hint, const Key& key, Args&&... args)
+    {
+        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        return try_emplace_aux(hint, key, std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    iterator try_emplace(const_iterator hint, Key&& key, Args&&... args)
+    {
+        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        return try_emplace_aux(hint, std::move(key), std::forward<Args>(args)...);
+    }
+
+    template <typename K, typename... Args,
+              sfl::dtl::enable_if_t<
+                #if defined(__GNUC__) && !defined(__clang__) && (__GNUC__ < 7)
+                // This is workaround for GCC 4 bug on CentOS 7.
+                !std::is_same<sfl::dtl::remove_cvref_t<Key>, sfl::dtl::remove_cvref_t<K>>::value &&
+                #endif
+                sfl::dtl::has_is_transparent<Compare, K>::value
+              >* = nullptr>
+    iterator try_emplace(const_iterator hint, K&& key, Args&&... args)
+    {
+        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        return try_emplace_aux(hint, std::forward<K>(key), std::forward<Args>(args)...);
+    }
+
+    iterator erase(iterator pos)
+    {
+        return erase(const_iterator(pos));
+    }
+
+    iterator erase(const_iterator pos)
+    {
+        SFL_ASSERT(cbegin() <= pos && pos < cend());
+
+        const size_type i = index_of(pos);
+
+        Key* const keys = data_.keys();
+        T* const mapped = data_.mapped();
+
+        sfl::dtl::move(keys + i + 1, keys + size(), keys + i);
+        sfl::dtl::move(mapped + i + 1, mapped + size(), mapped + i);
+
+        pop_back();
+
+        return nth(i);
+    }
+
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        SFL_ASSERT(cbegin() <= first && first <= last && last <= cend());
+
+        const size_type i = index_of(first);
+        const size_type j = index_of(last);
+
+        if (i == j)
+        {
+            return nth(i);
+        }
+
+        Key* const keys = data_.keys();
+        T* const mapped = data_.mapped();
+
+        sfl::dtl::move(keys + j, keys + size(), keys + i);
+        sfl::dtl::move(mapped + j, mapped + size(), mapped + i);
+
+        const size_type new_size = size() - (j - i);
+
+        sfl::dtl::destroy_a(data_.ref_to_alloc(), keys + new_size, keys + size());
+        sfl::dtl::destroy_a(data_.ref_to_alloc(), mapped + new_size, mapped + size());
+
+        data_.size_ = new_size;
+
+        return nth(i);
+    }
+
+    size_type erase(const Key& key)
+    {
+        auto it = find(key);
+
+        if (it == cend())
+        {
+            return 0;
+        }
+
+        erase(it);
+        return 1;
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    size_type erase(K&& x)
+    {
+        auto it = find(x);
+
+        if (it == cend())
+        {
+            return 0;
+        }
+
+        erase(it);
+        return 1;
+    }
+
+    void swap(small_flat_split_map& other)
+    {
+        if (this == &other)
+        {
+            return;
+        }
+
+        using std::swap;
+
+        SFL_ASSERT
+        (
+            allocator_traits::propagate_on_container_swap::value ||
+            this->data_.ref_to_alloc() == other.data_.ref_to_alloc()
+        );
+
+        // If this and other allocator compares equal then one allocator
+        // can deallocate memory allocated by another allocator.
+        // One allocator can safely destroy_a elements constructed by other
+        // allocator regardless the two allocators compare equal or not.
+
+        if (allocator_traits::propagate_on_container_swap::value)
+        {
+            swap(this->data_.ref_to_alloc(), other.data_.ref_to_alloc());
+        }
+
+        swap(this->data_.ref_to_comp(), other.data_.ref_to_comp());
+
+        if
+        (
+            this->data_.first_ == this->data_.internal_storage() &&
+            other.data_.first_ == other.data_.internal_storage()
+        )
+        {
+            if (this->size() <= other.size())
+            {
+                this->swap_internal(other);
+            }
+            else
+            {
+                other.swap_internal(*this);
+            }
+        }
+        else if
+        (
+            this->data_.first_ == this->data_.internal_storage() &&
+            other.data_.first_ != other.data_.internal_storage()
+        )
+        {
+            this->steal_heap_and_give_internal(other);
+        }
+        else if
+        (
+            this->data_.first_ != this->data_.internal_storage() &&
+            other.data_.first_ == other.data_.internal_storage()
+        )
+        {
+            other.steal_heap_and_give_internal(*this);
+        }
+        else
+        {
+            swap(this->data_.first_,    other.data_.first_);
+            swap(this->data_.size_,     other.data_.size_);
+            swap(this->data_.capacity_, other.data_.capacity_);
+        }
+    }
+
+    // Moves all keys and mapped values into two vectors and leaves the
+    // container empty. Keys and mapped values share one memory block that
+    // cannot be handed over, so they are moved one by one.
+    containers extract()
+    {
+        Key* const keys = data_.keys();
+        T* const mapped = data_.mapped();
+
+        containers result
+        {
+            key_container_type
+            (
+                std::make_move_iterator(keys),
+                std::make_move_iterator(keys + size()),
+                typename key_container_type::allocator_type(data_.ref_to_alloc())
+            ),
+            mapped_container_type
+            (
+                std::make_move_iterator(mapped),
+                std::make_move_iterator(mapped + size()),
+                typename mapped_container_type::allocator_type(data_.ref_to_alloc())
+            )
+        };
+
+        reset();
+
+        return result;
+    }
+
+    // Replaces all elements with keys and mapped values moved from `keys`
+    // and `values`.
+    void replace(key_container_type&& keys, mapped_container_type&& values)
+    {
+        SFL_ASSERT(keys.size() == values.size());
+        SFL_ASSERT(sfl::dtl::is_sorted_unique(keys.begin(), keys.end(), data_.ref_to_comp()));
+
+        assign_range
+        (
+            std::make_move_iterator(keys.begin()),
+            std::make_move_iterator(values.begin()),
+            keys.size()
+        );
+
+        keys.clear();
+        values.clear();
+    }
+
+    //
+    // ---- LOOKUP ------------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    iterator lower_bound(const Key& key)
+    {
+        return nth(lower_bound_index(key));
+    }
+
+    SFL_NODISCARD
+    const_iterator lower_bound(const Key& key) const
+    {
+        return nth(lower_bound_index(key));
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    SFL_NODISCARD
+    iterator lower_bound(const K& x)
+    {
+        return nth(lower_bound_index(x));
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    SFL_NODISCARD
+    const_iterator lower_bound(const K& x) const
+    {
+        return nth(lower_bound_index(x));
+    }
+
+    SFL_NODISCARD
+    iterator upper_bound(const Key& key)
+    {
+        return nth(upper_bound_index(key));
+    }
+
+    SFL_NODISCARD
+    const_iterator upper_bound(const Key& key) const
+    {
+        return nth(upper_bound_index(key));
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    SFL_NODISCARD
+    iterator upper_bound(const K& x)
+    {
+        return nth(upper_bound_index(x));
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    SFL_NODISCARD
+    const_iterator upper_bound(const K& x) const
+    {
+        return nth(upper_bound_index(x));
+    }
+
+    SFL_NODISCARD
+    std::pair<iterator, iterator> equal_range(const Key& key)
+    {
+        const auto r = equal_range_index(key);
+        return std::make_pair(nth(r.first), nth(r.second));
+    }
+
+    SFL_NODISCARD
+    std::pair<const_iterator, const_iterator> equal_range(const Key& key) const
+    {
+        const auto r = equal_range_index(key);
+        return std::make_pair(nth(r.first), nth(r.second));
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    SFL_NODISCARD
+    std::pair<iterator, iterator> equal_range(const K& x)
+    {
+        const auto r = equal_range_index(x);
+        return std::make_pair(nth(r.first), nth(r.second));
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    SFL_NODISCARD
+    std::pair<const_iterator, const_iterator> equal_range(const K& x) const
+    {
+        const auto r = equal_range_index(x);
+        return std::make_pair(nth(r.first), nth(r.second));
+    }
+
+    SFL_NODISCARD
+    iterator find(const Key& key)
+    {
+        return nth(find_index(key));
+    }
+
+    SFL_NODISCARD
+    const_iterator find(const Key& key) const
+    {
+        return nth(find_index(key));
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    SFL_NODISCARD
+    iterator find(const K& x)
+    {
+        return nth(find_index(x));
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    SFL_NODISCARD
+    const_iterator find(const K& x) const
+    {
+        return nth(find_index(x));
+    }
+
+    SFL_NODISCARD
+    size_type count(const Key& key) const
+    {
+        return find_index(key) != size();
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    SFL_NODISCARD
+    size_type count(const K& x) const
+    {
+        return find_index(x) != size();
+    }
+
+    SFL_NODISCARD
+    bool contains(const Key& key) const
+    {
+        return find_index(key) != size();
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    SFL_NODISCARD
+    bool contains(const K& x) const
+    {
+        return find_index(x) != size();
+    }
+
+    //
+    // ---- ELEMENT ACCESS ----------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    T& at(const Key& key)
+    {
+        const size_type i = find_index(key);
+
+        if (i == size())
+        {
+            sfl::dtl::throw_out_of_range("sfl::small_flat_split_map::at");
+        }
+
+        return data_.mapped()[i];
+    }
+
+    SFL_NODISCARD
+    const T& at(const Key& key) const
+    {
+        const size_type i = find_index(key);
+
+        if (i == size())
+        {
+            sfl::dtl::throw_out_of_range("sfl::small_flat_split_map::at");
+        }
+
+        return data_.mapped()[i];
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    SFL_NODISCARD
+    T& at(const K& x)
+    {
+        const size_type i = find_index(x);
+
+        if (i == size())
+        {
+            sfl::dtl::throw_out_of_range("sfl::small_flat_split_map::at");
+        }
+
+        return data_.mapped()[i];
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    SFL_NODISCARD
+    const T& at(const K& x) const
+    {
+        const size_type i = find_index(x);
+
+        if (i == size())
+        {
+            sfl::dtl::throw_out_of_range("sfl::small_flat_split_map::at");
+        }
+
+        return data_.mapped()[i];
+    }
+
+    SFL_NODISCARD
+    T& operator[](const Key& key)
+    {
+        return try_emplace(key).first->second;
+    }
+
+    SFL_NODISCARD
+    T& operator[](Key&& key)
+    {
+        return try_emplace(std::move(key)).first->second;
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    SFL_NODISCARD
+    T& operator[](K&& key)
+    {
+        return try_emplace(std::forward<K>(key)).first->second;
+    }
+
+    SFL_NODISCARD
+    const key_type* key_data() const noexcept
+    {
+        return data_.keys();
+    }
+
+    SFL_NODISCARD
+    mapped_type* mapped_data() noexcept
+    {
+        return data_.mapped();
+    }
+
+    SFL_NODISCARD
+    const mapped_type* mapped_data() const noexcept
+    {
+        return data_.mapped();
+    }
+
+private:
+
+    // Binary search touches only the array of keys.
+    template <typename K>
+    size_type lower_bound_index(const K& x) const
+    {
+        const Key* const keys = data_.keys();
+        return sfl::dtl::lower_bound(keys, keys + size(), x, data_.ref_to_comp()) - keys;
+    }
+
+    template <typename K>
+    size_type upper_bound_index(const K& x) const
+    {
+        const Key* const keys = data_.keys();
+        return sfl::dtl::upper_bound(keys, keys + size(), x, data_.ref_to_comp()) - keys;
+    }
+
+    std::pair<size_type, size_type> equal_range_index(const Key& key) const
+    {
+        // Keys are unique, so the range contains at most one element.
+        const size_type i = lower_bound_index(key);
+
+        if (i != size() && !data_.ref_to_comp()(key, data_.keys()[i]))
+        {
+            return std::make_pair(i, i + 1);
+        }
+
+        return std::make_pair(i, i);
+    }
+
+    // Several unique keys can be equivalent to `x` under transparent
+    // comparator, so upper end is searched for too.
+    template <typename K>
+    std::pair<size_type, size_type> equal_range_index(const K& x) const
+    {
+        const Key* const keys = data_.keys();
+        const size_type i = lower_bound_index(x);
+        const size_type j = sfl::dtl::upper_bound(keys + i, keys + size(), x, data_.ref_to_comp()) - keys;
+        return std::make_pair(i, j);
+    }
+
+    // Returns index of the element with key equivalent to `x`, or `size()`
+    // if there is no such element.
+    template <typename K>
+    size_type find_index(const K& x) const
+    {
+        const size_type i = lower_bound_index(x);
+
+        if (i != size() && data_.ref_to_comp()(x, data_.keys()[i]))
+        {
+            return size();
+        }
+
+        return i;
+    }
+
+    void check_size(size_type n, const char* msg)
+    {
+        if (n > max_size())
+        {
+            sfl::dtl::throw_length_error(msg);
+        }
+    }
+
+    size_type calculate_new_capacity(size_type num_additional_elements, const char* msg)
+    {
+        const size_type size = this->size();
+        const size_type capacity = this->capacity();
+        const size_type max_size = this->max_size();
+
+        if (max_size - size < num_additional_elements)
+        {
+            sfl::dtl::throw_length_error(msg);
+        }
+        else if (max_size - capacity < capacity / 2)
+        {
+            return max_size;
+        }
+        else if (size + num_additional_elements < capacity + capacity / 2)
+        {
+            return std::max(N, capacity + capacity / 2);
+        }
+        else
+        {
+            return std::max(N, size + num_additional_elements);
+        }
+    }
+
+    void destroy_all() noexcept
+    {
+        Key* const keys = data_.keys();
+        T* const mapped = data_.mapped();
+
+        sfl::dtl::destroy_a(data_.ref_to_alloc(), keys, keys + size());
+        sfl::dtl::destroy_a(data_.ref_to_alloc(), mapped, mapped + size());
+    }
+
+    void deallocate_storage() noexcept
+    {
+        if (data_.first_ != data_.internal_storage())
+        {
+            sfl::dtl::deallocate(data_.ref_to_alloc(), data_.first_, data_.capacity_);
+        }
+    }
+
+    // Returns storage for `new_cap` elements: internal storage if `new_cap`
+    // is equal to `N`, otherwise newly allocated storage.
+    storage_pointer allocate_storage(size_type new_cap)
+    {
+        if (new_cap == N)
+        {
+            return data_.internal_storage();
+        }
+
+        return sfl::dtl::allocate(data_.ref_to_alloc(), new_cap);
+    }
+
+    void deallocate_storage(storage_pointer first, size_type cap) noexcept
+    {
+        if (first != data_.internal_storage())
+        {
+            sfl::dtl::deallocate(data_.ref_to_alloc(), first, cap);
+        }
+    }
+
+    // Moves (or copies, if move constructor is not noexcept) elements at
+    // positions [first, last) into uninitialized arrays `new_keys` and
+    // `new_mapped`. If an exception is thrown, nothing is constructed and
+    // elements are left intact.
+    void relocate(size_type first, size_type last, Key* new_keys, T* new_mapped)
+    {
+        Key* const keys = data_.keys();
+        T* const mapped = data_.mapped();
+
+        sfl::dtl::uninitialized_move_if_noexcept_a
+        (
+            data_.ref_to_alloc(),
+            keys + first,
+            keys + last,
+            new_keys
+        );
+
+        SFL_TRY
+        {
+            sfl::dtl::uninitialized_move_if_noexcept_a
+            (
+                data_.ref_to_alloc(),
+                mapped + first,
+                mapped + last,
+                new_mapped
+            );
+        }
+        SFL_CATCH (...)
+        {
+            sfl::dtl::destroy_a(data_.ref_to_alloc(), new_keys, new_keys + (last - first));
+            SFL_RETHROW;
+        }
+    }
+
+    // Moves all elements to storage of capacity `new_cap`, which is either
+    // internal storage (if `new_cap == N`) or newly allocated storage.
+    // Current storage must be different from the new one.
+    void reallocate(size_type new_cap)
+    {
+        const storage_pointer new_first = allocate_storage(new_cap);
+
+        SFL_TRY
+        {
+            relocate(0, size(), data::keys_of(new_first), data::mapped_of(new_first, new_cap));
+        }
+        SFL_CATCH (...)
+        {
+            deallocate_storage(new_first, new_cap);
+            SFL_RETHROW;
+        }
+
+        destroy_all();
+        deallocate_storage();
+
+        data_.first_    = new_first;
+        data_.capacity_ = new_cap;
+    }
+
+    void reset(size_type new_cap = N)
+    {
+        destroy_all();
+        deallocate_storage();
+
+        data_.first_    = data_.internal_storage();
+        data_.size_     = 0;
+        data_.capacity_ = N;
+
+        if (new_cap > N)
+        {
+            data_.first_    = sfl::dtl::allocate(data_.ref_to_alloc(), new_cap);
+            data_.capacity_ = new_cap;
+
+            // If allocation throws, first_ and capacity_ will be valid
+            // (first_ will be pointing to internal_storage).
+        }
+    }
+
+    // Copies or moves `n` keys and mapped values into this container that
+    // must be empty and must have sufficient capacity.
+    template <typename KeyIt, typename MappedIt>
+    void construct_all(KeyIt key_first, MappedIt mapped_first, size_type n)
+    {
+        SFL_ASSERT(empty() && n <= capacity());
+
+        Key* const keys = data_.keys();
+        T* const mapped = data_.mapped();
+
+        sfl::dtl::uninitialized_copy_a
+        (
+            data_.ref_to_alloc(),
+            key_first,
+            std::next(key_first, n),
+            keys
+        );
+
+        SFL_TRY
+        {
+            sfl::dtl::uninitialized_copy_a
+            (
+                data_.ref_to_alloc(),
+                mapped_first,
+                std::next(mapped_first, n),
+                mapped
+            );
+        }
+        SFL_CATCH (...)
+        {
+            sfl::dtl::destroy_a(data_.ref_to_alloc(), keys, keys + n);
+            SFL_RETHROW;
+        }
+
+        data_.size_ = n;
+    }
+
+    template <typename InputIt>
+    void initialize_range(InputIt first, InputIt last)
+    {
+        SFL_TRY
+        {
+            insert(first, last);
+        }
+        SFL_CATCH (...)
+        {
+            destroy_all();
+            deallocate_storage();
+            SFL_RETHROW;
+        }
+    }
+
+    template <typename InputIt>
+    void initialize_range(sfl::sorted_unique_t, InputIt first, InputIt last)
+    {
+        SFL_TRY
+        {
+            insert(sfl::sorted_unique_t(), first, last);
+        }
+        SFL_CATCH (...)
+        {
+            destroy_all();
+            deallocate_storage();
+            SFL_RETHROW;
+        }
+    }
+
+    void initialize_copy(const small_flat_split_map& other)
+    {
+        const size_type n = other.size();
+
+        check_size(n, "sfl::small_flat_split_map::initialize_copy");
+
+        if (n > N)
+        {
+            data_.first_    = sfl::dtl::allocate(data_.ref_to_alloc(), n);
+            data_.capacity_ = n;
+        }
+
+        SFL_TRY
+        {
+            construct_all(other.data_.keys(), other.data_.mapped(), n);
+        }
+        SFL_CATCH (...)
+        {
+            deallocate_storage();
+            SFL_RETHROW;
+        }
+    }
+
+    void initialize_move(small_flat_split_map& other)
+    {
+        if (other.data_.first_ == other.data_.internal_storage())
+        {
+            construct_all
+            (
+                std::make_move_iterator(other.data_.keys()),
+                std::make_move_iterator(other.data_.mapped()),
+                other.size()
+            );
+        }
+        else if (data_.ref_to_alloc() == other.data_.ref_to_alloc())
+        {
+            data_.first_    = other.data_.first_;
+            data_.size_     = other.data_.size_;
+            data_.capacity_ = other.data_.capacity_;
+
+            other.data_.first_    = other.data_.internal_storage();
+            other.data_.size_     = 0;
+            other.data_.capacity_ = N;
+        }
+        else
+        {
+            const size_type n = other.size();
+
+            check_size(n, "sfl::small_flat_split_map::initialize_move");
+
+            if (n > N)
+            {
+                data_.first_    = sfl::dtl::allocate(data_.ref_to_alloc(), n);
+                data_.capacity_ = n;
+            }
+
+            SFL_TRY
+            {
+                construct_all
+                (
+                    std::make_move_iterator(other.data_.keys()),
+                    std::make_move_iterator(other.data_.mapped()),
+                    n
+                );
+            }
+            SFL_CATCH (...)
+            {
+                deallocate_storage();
+                SFL_RETHROW;
+            }
+        }
+    }
+
+    template <typename KeyIt, typename MappedIt>
+    void assign_range(KeyIt key_first, MappedIt mapped_first, size_type n)
+    {
+        check_size(n, "sfl::small_flat_split_map::assign_range");
+
+        if (n <= capacity())
+        {
+            Key* const keys = data_.keys();
+            T* const mapped = data_.mapped();
+
+            const size_type s = size();
+
+            if (n <= s)
+            {
+                std::copy(key_first, std::next(key_first, n), keys);
+                std::copy(mapped_first, std::next(mapped_first, n), mapped);
+
+                sfl::dtl::destroy_a(data_.ref_to_alloc(), keys + n, keys + s);
+                sfl::dtl::destroy_a(data_.ref_to_alloc(), mapped + n, mapped + s);
+
+                data_.size_ = n;
+            }
+            else
+            {
+                const KeyIt key_mid = std::next(key_first, s);
+                const MappedIt mapped_mid = std::next(mapped_first, s);
+
+                std::copy(key_first, key_mid, keys);
+                std::copy(mapped_first, mapped_mid, mapped);
+
+                sfl::dtl::uninitialized_copy_a
+                (
+                    data_.ref_to_alloc(),
+                    key_mid,
+                    std::next(key_mid, n - s),
+                    keys + s
+                );
+
+                SFL_TRY
+                {
+                    sfl::dtl::uninitialized_copy_a
+                    (
+                        data_.ref_to_alloc(),
+                        mapped_mid,
+                        std::next(mapped_mid, n - s),
+                        mapped + s
+                    );
+                }
+                SFL_CATCH (...)
+                {
+                    sfl::dtl::destroy_a(data_.ref_to_alloc(), keys + s, keys + n);
+                    SFL_RETHROW;
+                }
+
+                data_.size_ = n;
+            }
+        }
+        else
+        {
+            reset(n);
+            construct_all(key_first, mapped_first, n);
+        }
+    }
+
+    void assign_copy(const small_flat_split_map& other)
+    {
+        if (this != &other)
+        {
+            if (allocator_traits::propagate_on_container_copy_assignment::value)
+            {
+                if (data_.ref_to_alloc() != other.data_.ref_to_alloc())
+                {
+                    reset();
+                }
+
+                data_.ref_to_alloc() = other.data_.ref_to_alloc();
+            }
+
+            data_.ref_to_comp() = other.data_.ref_to_comp();
+
+            assign_range(other.data_.keys(), other.data_.mapped(), other.size());
+        }
+    }
+
+    void assign_move(small_flat_split_map& other)
+    {
+        if (allocator_traits::propagate_on_container_move_assignment::value)
+        {
+            if (data_.ref_to_alloc() != other.data_.ref_to_alloc())
+            {
+                reset();
+            }
+
+            data_.ref_to_alloc() = std::move(other.data_.ref_to_alloc());
+        }
+
+        data_.ref_to_comp() = other.data_.ref_to_comp();
+
+        if
+        (
+            other.data_.first_ != other.data_.internal_storage() &&
+            data_.ref_to_alloc() == other.data_.ref_to_alloc()
+        )
+        {
+            reset();
+
+            data_.first_    = other.data_.first_;
+            data_.size_     = other.data_.size_;
+            data_.capacity_ = other.data_.capacity_;
+
+            other.data_.first_    = other.data_.internal_storage();
+            other.data_.size_     = 0;
+            other.data_.capacity_ = N;
+        }
+        else
+        {
+            assign_range
+            (
+                std::make_move_iterator(other.data_.keys()),
+                std::make_move_iterator(other.data_.mapped()),
+                other.size()
+            );
+        }
+    }
+
+    // Swaps elements of two containers that both use internal storage.
+    // This container must not have more elements than `other`.
+    void swap_internal(small_flat_split_map& other)
+    {
+        const size_type this_size  = this->size();
+        const size_type other_size = other.size();
+
+        SFL_ASSERT(this_size <= other_size);
+
+        Key* const this_keys  = this->data_.keys();
+        Key* const other_keys = other.data_.keys();
+
+        T* const this_mapped  = this->data_.mapped();
+        T* const other_mapped = other.data_.mapped();
+
+        std::swap_ranges(this_keys, this_keys + this_size, other_keys);
+        std::swap_ranges(this_mapped, this_mapped + this_size, other_mapped);
+
+        sfl::dtl::uninitialized_move_a
+        (
+            this->data_.ref_to_alloc(),
+            other_keys + this_size,
+            other_keys + other_size,
+            this_keys + this_size
+        );
+
+        sfl::dtl::uninitialized_move_a
+        (
+            this->data_.ref_to_alloc(),
+            other_mapped + this_size,
+            other_mapped + other_size,
+            this_mapped + this_size
+        );
+
+        sfl::dtl::destroy_a
+        (
+            other.data_.ref_to_alloc(),
+            other_keys + this_size,
+            other_keys + other_size
+        );
+
+        sfl::dtl::destroy_a
+        (
+            other.data_.ref_to_alloc(),
+            other_mapped + this_size,
+            other_mapped + other_size
+        );
+
+        this->data_.size_ = other_size;
+        other.data_.size_ = this_size;
+    }
+
+    // This container uses internal storage and `other` uses heap storage.
+    // Elements of this container are moved to internal storage of `other`
+    // and this container takes over heap storage of `other`.
+    void steal_heap_and_give_internal(small_flat_split_map& other)
+    {
+        const storage_pointer new_other_first = other.data_.internal_storage();
+
+        sfl::dtl::uninitialized_move_a
+        (
+            other.data_.ref_to_alloc(),
+            this->data_.keys(),
+            this->data_.keys() + this->size(),
+            data::keys_of(new_other_first)
+        );
+
+        sfl::dtl::uninitialized_move_a
+        (
+            other.data_.ref_to_alloc(),
+            this->data_.mapped(),
+            this->data_.mapped() + this->size(),
+            data::mapped_of(new_other_first, N)
+        );
+
+        const size_type new_other_size = this->size();
+
+        this->destroy_all();
+
+        this->data_.first_    = other.data_.first_;
+        this->data_.size_     = other.data_.size_;
+        this->data_.capacity_ = other.data_.capacity_;
+
+        other.data_.first_    = new_other_first;
+        other.data_.size_     = new_other_size;
+        other.data_.capacity_ = N;
+    }
+
+    // Key is taken from arguments and searched for before the element is
+    // constructed, so nothing is constructed if the key already exists.
+    // Keys and mapped values are stored separately, so new element is still
+    // constructed as a temporary pair first.
+    template <typename... Args,
+              sfl::dtl::enable_if_t<sfl::dtl::is_map_key_extractable<Key, Args...>::value>* = nullptr>
+    std::pair<iterator, bool> emplace_aux(Args&&... args)
+    {
+        const Key& key = sfl::dtl::extract_map_key(args...);
+
+        const size_type i = lower_bound_index(key);
+
+        if (i == size() || data_.ref_to_comp()(key, data_.keys()[i]))
+        {
+            return std::make_pair(insert_exactly_at(nth(i), value_type(std::forward<Args>(args)...)), true);
+        }
+
+        return std::make_pair(nth(i), false);
+    }
+
+    template <typename... Args,
+              sfl::dtl::enable_if_t<!sfl::dtl::is_map_key_extractable<Key, Args...>::value>* = nullptr>
+    std::pair<iterator, bool> emplace_aux(Args&&... args)
+    {
+        return insert_aux(value_type(std::forward<Args>(args)...));
+    }
+
+    template <typename... Args,
+              sfl::dtl::enable_if_t<sfl::dtl::is_map_key_extractable<Key, Args...>::value>* = nullptr>
+    iterator emplace_hint_aux(const_iterator hint, Args&&... args)
+    {
+        if (is_insert_hint_good(hint, sfl::dtl::extract_map_key(args...)))
+        {
+            return insert_exactly_at(hint, value_type(std::forward<Args>(args)...));
+        }
+
+        // Hint is not good. Use non-hinted function.
+        return emplace_aux(std::forward<Args>(args)...).first;
+    }
+
+    template <typename... Args,
+              sfl::dtl::enable_if_t<!sfl::dtl::is_map_key_extractable<Key, Args...>::value>* = nullptr>
+    iterator emplace_hint_aux(const_iterator hint, Args&&... args)
+    {
+        return insert_aux(hint, value_type(std::forward<Args>(args)...));
+    }
+
+    template <typename Value>
+    std::pair<iterator, bool> insert_aux(Value&& value)
+    {
+        const size_type i = lower_bound_index(value.first);
+
+        if (i == size() || data_.ref_to_comp()(value.first, data_.keys()[i]))
+        {
+            return std::make_pair(insert_exactly_at(nth(i), std::forward<Value>(value)), true);
+        }
+
+        return std::make_pair(nth(i), false);
+    }
+
+    template <typename Value>
+    iterator insert_aux(const_iterator hint, Value&& value)
+    {
+        if (is_insert_hint_good(hint, value.first))
+        {
+            return insert_exactly_at(hint, std::forward<Value>(value));
+        }
+
+        // Hint is not good. Use non-hinted function.
+        return insert_aux(std::forward<Value>(value)).first;
+    }
+
+    template <typename K, typename M>
+    std::pair<iterator, bool> insert_or_assign_aux(K&& key, M&& obj)
+    {
+        const size_type i = lower_bound_index(key);
+
+        if (i == size() || data_.ref_to_comp()(key, data_.keys()[i]))
+        {
+            return std::make_pair
+            (
+                insert_exactly_at
+                (
+                    nth(i),
+                    value_type
+                    (
+                        std::piecewise_construct,
+                        std::forward_as_tuple(std::forward<K>(key)),
+                        std::forward_as_tuple(std::forward<M>(obj))
+                    )
+                ),
+                true
+            );
+        }
+
+        data_.mapped()[i] = std::forward<M>(obj);
+        return std::make_pair(nth(i), false);
+    }
+
+    template <typename K, typename M>
+    iterator insert_or_assign_aux(const_iterator hint, K&& key, M&& obj)
+    {
+        if (is_insert_hint_good(hint, key))
+        {
+            return insert_exactly_at
+            (
+                hint,
+                value_type
+                (
+                    std::piecewise_construct,
+                    std::forward_as_tuple(std::forward<K>(key)),
+                    std::forward_as_tuple(std::forward<M>(obj))
+                )
+            );
+        }
+
+        // Hint is not good. Use non-hinted function.
+        return insert_or_assign_aux(std::forward<K>(key), std::forward<M>(obj)).first;
+    }
+
+    template <typename K, typename... Args>
+    std::pair<iterator, bool> try_emplace_aux(K&& key, Args&&... args)
+    {
+        const size_type i = lower_bound_index(key);
+
+        if (i == size() || data_.ref_to_comp()(key, data_.keys()[i]))
+        {
+            return std::make_pair
+            (
+                insert_exactly_at
+                (
+                    nth(i),
+                    value_type
+                    (
+                        std::piecewise_construct,
+                        std::forward_as_tuple(std::forward<K>(key)),
+                        std::forward_as_tuple(std::forward<Args>(args)...)
+                    )
+                ),
+                true
+            );
+        }
+
+        return std::make_pair(nth(i), false);
+    }
+
+    template <typename K, typename... Args>
+    iterator try_emplace_aux(const_iterator hint, K&& key, Args&&... args)
+    {
+        if (is_insert_hint_good(hint, key))
+        {
+            return insert_exactly_at
+            (
+                hint,
+                value_type
+                (
+                    std::piecewise_construct,
+                    std::forward_as_tuple(std::forward<K>(key)),
+                    std::forward_as_tuple(std::forward<Args>(args)...)
+                )
+            );
+        }
+
+        // Hint is not good. Use non-hinted function.
+        return try_emplace_aux(std::forward<K>(key), std::forward<Args>(args)...).first;
+    }
+
+    // Returns iterator that dereferences to modifiable key and mapped value
+    // at position `pos`.
+    zip_iterator zip(size_type pos) noexcept
+    {
+        return zip_iterator(data_.keys() + pos, data_.mapped() + pos);
+    }
+
+    void append(const value_type& value)
+    {
+        emplace_back(value.first, value.second);
+    }
+
+    void append(value_type&& value)
+    {
+        emplace_back(std::move(value.first), std::move(value.second));
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<!sfl::dtl::is_forward_iterator<InputIt>::value>* = nullptr>
+    void append_range(InputIt first, InputIt last)
+    {
+        while (first != last)
+        {
+            append(*first);
+            ++first;
+        }
+    }
+
+    template <typename ForwardIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_forward_iterator<ForwardIt>::value>* = nullptr>
+    void append_range(ForwardIt first, ForwardIt last)
+    {
+        const size_type n = std::distance(first, last);
+
+        if (n > available())
+        {
+            reserve(calculate_new_capacity(n, "sfl::small_flat_split_map::append_range"));
+        }
+
+        while (first != last)
+        {
+            append(*first);
+            ++first;
+        }
+    }
+
+    // Appends all elements and then sorts and merges them at once, which
+    // takes O(m * log(m)^2 + (n + m) * log(n + m)) element moves instead of
+    // O(n * m).
+    template <typename InputIt>
+    void insert_range_aux(InputIt first, InputIt last)
+    {
+        const size_type old_size = size();
+
+        SFL_TRY
+        {
+            append_range(first, last);
+        }
+        SFL_CATCH (...)
+        {
+            erase(nth(old_size), cend());
+            SFL_RETHROW;
+        }
+
+        merge_appended(old_size);
+    }
+
+    // Appends all elements and merges them with existing elements. Unlike
+    // `insert_range_aux`, appended elements are not sorted because they
+    // must already be in order.
+    template <typename InputIt>
+    void insert_sorted_range_aux(InputIt first, InputIt last)
+    {
+        const size_type old_size = size();
+
+        SFL_TRY
+        {
+            append_range(first, last);
+        }
+        SFL_CATCH (...)
+        {
+            erase(nth(old_size), cend());
+            SFL_RETHROW;
+        }
+
+        SFL_ASSERT(sfl::dtl::is_sorted_unique(data_.keys() + old_size, data_.keys() + size(), data_.ref_to_comp()));
+
+        merge_sorted_appended(old_size);
+    }
+
+    // Sorts elements at positions `pos` and above and merges them with
+    // preceding elements, keeping only the first of equivalent elements.
+    // Sorting and merging never allocate memory.
+    void merge_appended(size_type pos)
+    {
+        element_compare comp(data_.ref_to_comp());
+
+        SFL_TRY
+        {
+            sfl::dtl::stable_sort_in_place(zip(pos), zip(size()), comp);
+        }
+        SFL_CATCH (...)
+        {
+            erase(nth(pos), cend());
+            SFL_RETHROW;
+        }
+
+        merge_sorted_appended(pos);
+    }
+
+    // Merges sorted elements at positions `pos` and above with preceding
+    // elements, keeping only the first of equivalent elements.
+    // Merging does not allocate memory, so if an exception is thrown, the
+    // order of elements is unknown and all elements are removed.
+    void merge_sorted_appended(size_type pos)
+    {
+        element_compare comp(data_.ref_to_comp());
+
+        SFL_TRY
+        {
+            sfl::dtl::merge_in_place(zip(0), zip(pos), zip(size()), comp);
+
+            const zip_iterator new_last = sfl::dtl::unique_sorted(zip(0), zip(size()), comp);
+
+            erase(nth(new_last - zip(0)), cend());
+        }
+        SFL_CATCH (...)
+        {
+            // Order of elements is unknown, so they are all removed.
+            clear();
+            SFL_RETHROW;
+        }
+    }
+
+    // Constructs key from `key` at `k` and mapped value from `args` at `m`.
+    template <typename K, typename... Args>
+    void construct_element(Key* k, T* m, K&& key, Args&&... args)
+    {
+        sfl::dtl::construct_at_a(data_.ref_to_alloc(), k, std::forward<K>(key));
+
+        SFL_TRY
+        {
+            sfl::dtl::construct_at_a(data_.ref_to_alloc(), m, std::forward<Args>(args)...);
+        }
+        SFL_CATCH (...)
+        {
+            sfl::dtl::destroy_at_a(data_.ref_to_alloc(), k);
+            SFL_RETHROW;
+        }
+    }
+
+    // Appends new element. Key is constructed from `key` and mapped value
+    // is constructed from `args`.
+    template <typename K, typename... Args>
+    iterator emplace_back(K&& key, Args&&... args)
+    {
+        const size_type n = size();
+
+        if (n != capacity())
+        {
+            construct_element
+            (
+                data_.keys() + n,
+                data_.mapped() + n,
+                std::forward<K>(key),
+                std::forward<Args>(args)...
+            );
+
+            ++data_.size_;
+
+            return nth(n);
+        }
+
+        return insert_exactly_at
+        (
+            cend(),
+            value_type
+            (
+                std::piecewise_construct,
+                std::forward_as_tuple(std::forward<K>(key)),
+                std::forward_as_tuple(std::forward<Args>(args)...)
+            )
+        );
+    }
+
+    template <typename Value>
+    iterator insert_exactly_at(const_iterator pos, Value&& value)
+    {
+        const size_type i = index_of(pos);
+
+        const size_type n = size();
+
+        if (n != capacity())
+        {
+            Key* const keys = data_.keys();
+            T* const mapped = data_.mapped();
+
+            if (i == n)
+            {
+                construct_element
+                (
+                    keys + n,
+                    mapped + n,
+                    std::forward<Value>(value).first,
+                    std::forward<Value>(value).second
+                );
+
+                ++data_.size_;
+            }
+            else
+            {
+                construct_element
+                (
+                    keys + n,
+                    mapped + n,
+                    std::move(keys[n - 1]),
+                    std::move(mapped[n - 1])
+                );
+
+                ++data_.size_;
+
+                sfl::dtl::move_backward(keys + i, keys + n - 1, keys + n);
+                sfl::dtl::move_backward(mapped + i, mapped + n - 1, mapped + n);
+
+                keys[i]   = std::forward<Value>(value).first;
+                mapped[i] = std::forward<Value>(value).second;
+            }
+
+            return nth(i);
+        }
+
+        size_type new_cap =
+            calculate_new_capacity(1, "sfl::small_flat_split_map::insert_exactly_at");
+
+        if (new_cap <= N && data_.first_ != data_.internal_storage())
+        {
+            new_cap = N;
+        }
+
+        const storage_pointer new_first = allocate_storage(new_cap);
+
+        Key* const new_keys = data::keys_of(new_first);
+        T* const new_mapped = data::mapped_of(new_first, new_cap);
+
+        SFL_TRY
+        {
+            // New element is constructed first because `value` may refer to
+            // an existing element.
+            construct_element
+            (
+                new_keys + i,
+                new_mapped + i,
+                std::forward<Value>(value).first,
+                std::forward<Value>(value).second
+            );
+
+            SFL_TRY
+            {
+                relocate(0, i, new_keys, new_mapped);
+
+                SFL_TRY
+                {
+                    relocate(i, n, new_keys + i + 1, new_mapped + i + 1);
+                }
+                SFL_CATCH (...)
+                {
+                    sfl::dtl::destroy_a(data_.ref_to_alloc(), new_keys, new_keys + i);
+                    sfl::dtl::destroy_a(data_.ref_to_alloc(), new_mapped, new_mapped + i);
+                    SFL_RETHROW;
+                }
+            }
+            SFL_CATCH (...)
+            {
+                sfl::dtl::destroy_at_a(data_.ref_to_alloc(), new_keys + i);
+                sfl::dtl::destroy_at_a(data_.ref_to_alloc(), new_mapped + i);
+                SFL_RETHROW;
+            }
+        }
+        SFL_CATCH (...)
+        {
+            deallocate_storage(new_first, new_cap);
+            SFL_RETHROW;
+        }
+
+        destroy_all();
+        deallocate_storage();
+
+        data_.first_    = new_first;
+        data_.size_     = n + 1;
+        data_.capacity_ = new_cap;
+
+        return nth(i);
+    }
+
+    void pop_back()
+    {
+        SFL_ASSERT(!empty());
+
+        --data_.size_;
+
+        sfl::dtl::destroy_at_a(data_.ref_to_alloc(), data_.keys() + data_.size_);
+        sfl::dtl::destroy_at_a(data_.ref_to_alloc(), data_.mapped() + data_.size_);
+    }
+
+    template <typename K>
+    bool is_insert_hint_good(const_iterator hint, const K& key)
+    {
+        const size_type i = index_of(hint);
+
+        const Key* const keys = data_.keys();
+
+        return (i == 0      || data_.ref_to_comp()(keys[i - 1], key))
+            && (i == size() || data_.ref_to_comp()(key, keys[i]));
+    }
+};
+
+//
+// ---- NON-MEMBER FUNCTIONS --------------------------------------------------
+//
+
+template <typename K, typename T, std::size_t N, typename C, typename A>
+SFL_NODISCARD
+bool operator==
+(
+    const small_flat_split_map<K, T, N, C, A>& x,
+    const small_flat_split_map<K, T, N, C, A>& y
+)
+{
+    return x.size() == y.size() && std::equal(x.begin(), x.end(), y.begin());
+}
+
+template <typename K, typename T, std::size_t N, typename C, typename A>
+SFL_NODISCARD
+bool operator!=
+(
+    const small_flat_split_map<K, T, N, C, A>& x,
+    const small_flat_split_map<K, T, N, C, A>& y
+)
+{
+    return !(x == y);
+}
+
+template <typename K, typename T, std::size_t N, typename C, typename A>
+SFL_NODISCARD
+bool operator<
+(
+    const small_flat_split_map<K, T, N, C, A>& x,
+    const small_flat_split_map<K, T, N, C, A>& y
+)
+{
+    return std::lexicographical_compare(x.begin(), x.end(), y.begin(), y.end());
+}
+
+template <typename K, typename T, std::size_t N, typename C, typename A>
+SFL_NODISCARD
+bool operator>
+(
+    const small_flat_split_map<K, T, N, C, A>& x,
+    const small_flat_split_map<K, T, N, C, A>& y
+)
+{
+    return y < x;
+}
+
+template <typename K, typename T, std::size_t N, typename C, typename A>
+SFL_NODISCARD
+bool operator<=
+(
+    const small_flat_split_map<K, T, N, C, A>& x,
+    const small_flat_split_map<K, T, N, C, A>& y
+)
+{
+    return !(y < x);
+}
+
+template <typename K, typename T, std::size_t N, typename C, typename A>
+SFL_NODISCARD
+bool operator>=
+(
+    const small_flat_split_map<K, T, N, C, A>& x,
+    const small_flat_split_map<K, T, N, C, A>& y
+)
+{
+    return !(x < y);
+}
+
+template <typename K, typename T, std::size_t N, typename C, typename A>
+void swap
+(
+    small_flat_split_map<K, T, N, C, A>& x,
+    small_flat_split_map<K, T, N, C, A>& y
+)
+{
+    x.swap(y);
+}
+
+template <typename K, typename T, std::size_t N, typename C, typename A,
+          typename Predicate>
+typename small_flat_split_map<K, T, N, C, A>::size_type
+    erase_if(small_flat_split_map<K, T, N, C, A>& c, Predicate pred)
+{
+    using const_reference =
+        typename small_flat_split_map<K, T, N, C, A>::const_reference;
+
+    auto old_size = c.size();
+
+    for (auto it = c.begin(); it != c.end(); )
+    {
+        const_reference value = *it;
+
+        if (pred(value))
+        {
+            it = c.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    return old_size - c.size();
+}
+
+} // namespace sfl
+
+#endif // SFL_SMALL_FLAT_SPLIT_MAP_HPP_INCLUDED
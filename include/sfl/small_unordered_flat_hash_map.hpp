@@ -0,0 +1,2751 @@
+//
+// Copyright (c) 2022 Slaven Falandys
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+//
+
+#ifndef SFL_SMALL_UNORDERED_FLAT_HASH_MAP_HPP_INCLUDED
+#define SFL_SMALL_UNORDERED_FLAT_HASH_MAP_HPP_INCLUDED
+
+#include "private.hpp"
+#include "vector.hpp"
+
+#include <algorithm>        // copy, copy_n, fill_n, move, swap, swap_ranges
+#include <cstddef>          // size_t
+#include <cstring>          // memcpy, memmove
+#include <functional>       // equal_to, hash, less
+#include <initializer_list> // initializer_list
+#include <iterator>         // distance, next, reverse_iterator
+#include <limits>           // numeric_limits
+#include <memory>           // allocator, allocator_traits, pointer_traits
+#include <type_traits>      // is_same, is_nothrow_xxxxx
+#include <utility>          // forward, move, pair
+
+#ifdef SFL_TEST_SMALL_UNORDERED_FLAT_HASH_MAP
+template <int>
+void test_small_unordered_flat_hash_map();
+#endif
+
+namespace sfl
+{
+
+template < typename Key,
+           typename T,
+           std::size_t N,
+           typename Hash = std::hash<Key>,
+           typename KeyEqual = std::equal_to<Key>,
+           typename Allocator = std::allocator<std::pair<Key, T>>,
+           std::size_t IndexThreshold = 64 >
+class small_unordered_flat_hash_map
+{
+    #ifdef SFL_TEST_SMALL_UNORDERED_FLAT_HASH_MAP
+    template <int>
+    friend void ::test_small_unordered_flat_hash_map();
+    #endif
+
+public:
+
+    using allocator_type   = Allocator;
+    using allocator_traits = std::allocator_traits<allocator_type>;
+    using key_type         = Key;
+    using mapped_type      = T;
+    using value_type       = std::pair<Key, T>;
+    using size_type        = typename allocator_traits::size_type;
+    using difference_type  = typename allocator_traits::difference_type;
+    using hasher           = Hash;
+    using key_equal        = KeyEqual;
+    using reference        = value_type&;
+    using const_reference  = const value_type&;
+    using pointer          = typename allocator_traits::pointer;
+    using const_pointer    = typename allocator_traits::const_pointer;
+    using iterator         = sfl::dtl::normal_iterator<pointer, small_unordered_flat_hash_map>;
+    using const_iterator   = sfl::dtl::normal_iterator<const_pointer, small_unordered_flat_hash_map>;
+
+    class value_equal : protected key_equal
+    {
+        friend class small_unordered_flat_hash_map;
+
+    private:
+
+        value_equal(const key_equal& e) : key_equal(e)
+        {}
+
+    public:
+
+        bool operator()(const value_type& x, const value_type& y) const
+        {
+            return key_equal::operator()(x.first, y.first);
+        }
+    };
+
+    static_assert
+    (
+        std::is_same<typename Allocator::value_type, value_type>::value,
+        "Allocator::value_type must be same as sfl::small_unordered_flat_hash_map::value_type."
+    );
+
+public:
+
+    static constexpr size_type static_capacity = N;
+
+    static constexpr size_type index_threshold = IndexThreshold;
+
+private:
+
+    // Like `value_equal` but with additional operators.
+    // For internal use only.
+    class ultra_equal : public key_equal
+    {
+    public:
+
+        ultra_equal() noexcept(std::is_nothrow_default_constructible<key_equal>::value)
+        {}
+
+        ultra_equal(const key_equal& e) noexcept(std::is_nothrow_copy_constructible<key_equal>::value)
+            : key_equal(e)
+        {}
+
+        ultra_equal(key_equal&& e) noexcept(std::is_nothrow_move_constructible<key_equal>::value)
+            : key_equal(std::move(e))
+        {}
+
+        bool operator()(const value_type& x, const value_type& y) const
+        {
+            return key_equal::operator()(x.first, y.first);
+        }
+
+        template <typename K>
+        bool operator()(const value_type& x, const K& y) const
+        {
+            return key_equal::operator()(x.first, y);
+        }
+
+        template <typename K>
+        bool operator()(const K& x, const value_type& y) const
+        {
+            return key_equal::operator()(x, y.first);
+        }
+    };
+
+    // Wrapper around `hasher` that computes one-byte fingerprints.
+    // It also keeps `hasher` and `key_equal` apart as base classes of `data`.
+    // For internal use only.
+    class ultra_hash : public hasher
+    {
+    public:
+
+        ultra_hash() noexcept(std::is_nothrow_default_constructible<hasher>::value)
+        {}
+
+        ultra_hash(const hasher& h) noexcept(std::is_nothrow_copy_constructible<hasher>::value)
+            : hasher(h)
+        {}
+
+        ultra_hash(hasher&& h) noexcept(std::is_nothrow_move_constructible<hasher>::value)
+            : hasher(std::move(h))
+        {}
+
+        template <typename K>
+        unsigned long long mixed_hash(const K& key) const
+        {
+            return sfl::dtl::hash_mix(hasher::operator()(key));
+        }
+
+        template <typename K>
+        unsigned char fingerprint(const K& key) const
+        {
+            return sfl::dtl::hash_fingerprint(mixed_hash(key));
+        }
+    };
+
+    // Checks if heterogeneous lookup with key of type `K` is enabled.
+    // Both `Hash` and `KeyEqual` must have member `is_transparent`.
+    template <typename K>
+    using is_transparent_for = std::integral_constant
+    <
+        bool,
+        sfl::dtl::has_is_transparent<Hash, K>::value &&
+        sfl::dtl::has_is_transparent<KeyEqual, K>::value
+    >;
+
+    //
+    // Fingerprints are stored in an array of bytes parallel to the array of
+    // elements: `fingerprints()[i]` is fingerprint of the key of `first_[i]`.
+    //
+    // If elements are in internal storage then fingerprints are stored in
+    // `internal_fingerprints_`. Otherwise they are stored in the same memory
+    // block as elements, right after the last element slot (at `eos_`).
+    // Therefore it is enough to move `first_`, `last_` and `eos_` from one
+    // container to another to move fingerprints too.
+    //
+
+    template <bool WithInternalStorage = true, typename = void>
+    class data_base
+    {
+    private:
+
+        union
+        {
+            value_type internal_storage_[N];
+        };
+
+        unsigned char internal_fingerprints_[N];
+
+    public:
+
+        pointer first_;
+        pointer last_;
+        pointer eos_;
+
+        data_base() noexcept
+            : first_(std::pointer_traits<pointer>::pointer_to(*internal_storage_))
+            , last_(first_)
+            , eos_(first_ + N)
+        {}
+
+        #if defined(__clang__) && (__clang_major__ == 3) // For CentOS 7
+        ~data_base()
+        {}
+        #else
+        ~data_base() noexcept
+        {}
+        #endif
+
+        pointer internal_storage() noexcept
+        {
+            return std::pointer_traits<pointer>::pointer_to(*internal_storage_);
+        }
+
+        unsigned char* fingerprints_of(pointer first, pointer eos) noexcept
+        {
+            if (first == internal_storage())
+            {
+                return internal_fingerprints_;
+            }
+
+            return reinterpret_cast<unsigned char*>(sfl::dtl::to_address(eos));
+        }
+    };
+
+    template <typename Dummy>
+    class data_base<false, Dummy>
+    {
+    public:
+
+        pointer first_;
+        pointer last_;
+        pointer eos_;
+
+        data_base() noexcept
+            : first_(nullptr)
+            , last_(nullptr)
+            , eos_(nullptr)
+        {}
+
+        pointer internal_storage() noexcept
+        {
+            return nullptr;
+        }
+
+        unsigned char* fingerprints_of(pointer first, pointer eos) noexcept
+        {
+            sfl::dtl::ignore_unused(first);
+            return reinterpret_cast<unsigned char*>(sfl::dtl::to_address(eos));
+        }
+    };
+
+    //
+    // If the number of elements is greater than `IndexThreshold` then the
+    // container also maintains an open addressing (linear probing) index of
+    // element positions, so lookup does not have to scan all fingerprints.
+    //
+    // The index is an array of power-of-two number of slots. Empty slot holds
+    // zero and non-empty slot holds position of an element plus one. Home slot
+    // of an element is taken from the bits of mixed hash value just below the
+    // fingerprint byte, so fingerprints remain useful for filtering elements
+    // in the same probe sequence. Load factor is kept at most 1/2.
+    //
+    // The index is only an accelerator: if it cannot be allocated or updated
+    // (allocation or hash function throws) it is dropped and the container
+    // falls back to scanning fingerprints. The index is also dropped when the
+    // number of elements falls to `IndexThreshold / 2` or below.
+    //
+
+    using index_allocator = typename allocator_traits::template rebind_alloc<size_type>;
+    using index_pointer   = typename std::allocator_traits<index_allocator>::pointer;
+
+    class index_base
+    {
+    public:
+
+        index_pointer index_first_; // First slot or null if there is no index
+        size_type     index_mask_;  // Number of slots minus one
+        unsigned      index_shift_; // Shift of mixed hash value for home slot
+
+        index_base() noexcept
+            : index_first_(nullptr)
+            , index_mask_(0)
+            , index_shift_(0)
+        {}
+    };
+
+    class data : public data_base<(N > 0)>, public index_base, public allocator_type, public ultra_hash, public ultra_equal
+    {
+    public:
+
+        data() noexcept
+        (
+            std::is_nothrow_default_constructible<allocator_type>::value &&
+            std::is_nothrow_default_constructible<ultra_hash>::value &&
+            std::is_nothrow_default_constructible<ultra_equal>::value
+        )
+            : allocator_type()
+            , ultra_hash()
+            , ultra_equal()
+        {}
+
+        data(const allocator_type& alloc) noexcept
+        (
+            std::is_nothrow_copy_constructible<allocator_type>::value &&
+            std::is_nothrow_default_constructible<ultra_hash>::value &&
+            std::is_nothrow_default_constructible<ultra_equal>::value
+        )
+            : allocator_type(alloc)
+            , ultra_hash()
+            , ultra_equal()
+        {}
+
+        data(const ultra_hash& hash, const ultra_equal& equal, const allocator_type& alloc) noexcept
+        (
+            std::is_nothrow_copy_constructible<allocator_type>::value &&
+            std::is_nothrow_copy_constructible<ultra_hash>::value &&
+            std::is_nothrow_copy_constructible<ultra_equal>::value
+        )
+            : allocator_type(alloc)
+            , ultra_hash(hash)
+            , ultra_equal(equal)
+        {}
+
+        data(ultra_hash&& hash, ultra_equal&& equal, allocator_type&& alloc) noexcept
+        (
+            std::is_nothrow_move_constructible<allocator_type>::value &&
+            std::is_nothrow_move_constructible<ultra_hash>::value &&
+            std::is_nothrow_move_constructible<ultra_equal>::value
+        )
+            : allocator_type(std::move(alloc))
+            , ultra_hash(std::move(hash))
+            , ultra_equal(std::move(equal))
+        {}
+
+        data(ultra_hash&& hash, ultra_equal&& equal, const allocator_type& alloc) noexcept
+        (
+            std::is_nothrow_copy_constructible<allocator_type>::value &&
+            std::is_nothrow_move_constructible<ultra_hash>::value &&
+            std::is_nothrow_move_constructible<ultra_equal>::value
+        )
+            : allocator_type(alloc)
+            , ultra_hash(std::move(hash))
+            , ultra_equal(std::move(equal))
+        {}
+
+        allocator_type& ref_to_alloc() noexcept
+        {
+            return *this;
+        }
+
+        const allocator_type& ref_to_alloc() const noexcept
+        {
+            return *this;
+        }
+
+        ultra_hash& ref_to_hash() noexcept
+        {
+            return *this;
+        }
+
+        const ultra_hash& ref_to_hash() const noexcept
+        {
+            return *this;
+        }
+
+        ultra_equal& ref_to_equal() noexcept
+        {
+            return *this;
+        }
+
+        const ultra_equal& ref_to_equal() const noexcept
+        {
+            return *this;
+        }
+    };
+
+    data data_;
+
+public:
+
+    //
+    // ---- CONSTRUCTION AND DESTRUCTION --------------------------------------
+    //
+
+    small_unordered_flat_hash_map() noexcept
+    (
+        std::is_nothrow_default_constructible<Allocator>::value &&
+        std::is_nothrow_default_constructible<Hash>::value &&
+        std::is_nothrow_default_constructible<KeyEqual>::value
+    )
+        : data_()
+    {}
+
+    explicit small_unordered_flat_hash_map(const Hash& hash)
+        : data_(hash, KeyEqual(), Allocator())
+    {}
+
+    explicit small_unordered_flat_hash_map(const Hash& hash,
+                                           const KeyEqual& equal)
+        : data_(hash, equal, Allocator())
+    {}
+
+    explicit small_unordered_flat_hash_map(const Allocator& alloc) noexcept
+    (
+        std::is_nothrow_copy_constructible<Allocator>::value &&
+        std::is_nothrow_default_constructible<Hash>::value &&
+        std::is_nothrow_default_constructible<KeyEqual>::value
+    )
+        : data_(alloc)
+    {}
+
+    explicit small_unordered_flat_hash_map(const Hash& hash,
+                                           const Allocator& alloc)
+        : data_(hash, KeyEqual(), alloc)
+    {}
+
+    explicit small_unordered_flat_hash_map(const Hash& hash,
+                                           const KeyEqual& equal,
+                                           const Allocator& alloc) noexcept
+    (
+        std::is_nothrow_copy_constructible<Allocator>::value &&
+        std::is_nothrow_copy_constructible<Hash>::value &&
+        std::is_nothrow_copy_constructible<KeyEqual>::value
+    )
+        : data_(hash, equal, alloc)
+    {}
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    small_unordered_flat_hash_map(InputIt first, InputIt last)
+        : data_()
+    {
+        initialize_range(first, last);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    small_unordered_flat_hash_map(InputIt first, InputIt last,
+                                  const Hash& hash)
+        : data_(hash, KeyEqual(), Allocator())
+    {
+        initialize_range(first, last);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    small_unordered_flat_hash_map(InputIt first, InputIt last,
+                                  const Hash& hash,
+                                  const KeyEqual& equal)
+        : data_(hash, equal, Allocator())
+    {
+        initialize_range(first, last);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    small_unordered_flat_hash_map(InputIt first, InputIt last,
+                                  const Allocator& alloc)
+        : data_(alloc)
+    {
+        initialize_range(first, last);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    small_unordered_flat_hash_map(InputIt first, InputIt last,
+                                  const Hash& hash,
+                                  const Allocator& alloc)
+        : data_(hash, KeyEqual(), alloc)
+    {
+        initialize_range(first, last);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    small_unordered_flat_hash_map(InputIt first, InputIt last,
+                                  const Hash& hash,
+                                  const KeyEqual& equal,
+                                  const Allocator& alloc)
+        : data_(hash, equal, alloc)
+    {
+        initialize_range(first, last);
+    }
+
+    small_unordered_flat_hash_map(std::initializer_list<value_type> ilist)
+        : small_unordered_flat_hash_map(ilist.begin(), ilist.end())
+    {}
+
+    small_unordered_flat_hash_map(std::initializer_list<value_type> ilist,
+                                  const Hash& hash)
+        : small_unordered_flat_hash_map(ilist.begin(), ilist.end(), hash)
+    {}
+
+    small_unordered_flat_hash_map(std::initializer_list<value_type> ilist,
+                                  const Hash& hash,
+                                  const KeyEqual& equal)
+        : small_unordered_flat_hash_map(ilist.begin(), ilist.end(), hash, equal)
+    {}
+
+    small_unordered_flat_hash_map(std::initializer_list<value_type> ilist,
+                                  const Allocator& alloc)
+        : small_unordered_flat_hash_map(ilist.begin(), ilist.end(), alloc)
+    {}
+
+    small_unordered_flat_hash_map(std::initializer_list<value_type> ilist,
+                                  const Hash& hash,
+                                  const Allocator& alloc)
+        : small_unordered_flat_hash_map(ilist.begin(), ilist.end(), hash, alloc)
+    {}
+
+    small_unordered_flat_hash_map(std::initializer_list<value_type> ilist,
+                                  const Hash& hash,
+                                  const KeyEqual& equal,
+                                  const Allocator& alloc)
+        : small_unordered_flat_hash_map(ilist.begin(), ilist.end(), hash, equal, alloc)
+    {}
+
+    small_unordered_flat_hash_map(const small_unordered_flat_hash_map& other)
+        : data_
+        (
+            other.data_.ref_to_hash(),
+            other.data_.ref_to_equal(),
+            allocator_traits::select_on_container_copy_construction
+            (
+                other.data_.ref_to_alloc()
+            )
+        )
+    {
+        initialize_copy(other);
+    }
+
+    small_unordered_flat_hash_map(const small_unordered_flat_hash_map& other,
+                                  const Allocator& alloc)
+        : data_
+        (
+            other.data_.ref_to_hash(),
+            other.data_.ref_to_equal(),
+            alloc
+        )
+    {
+        initialize_copy(other);
+    }
+
+    small_unordered_flat_hash_map(small_unordered_flat_hash_map&& other)
+        : data_
+        (
+            std::move(other.data_.ref_to_hash()),
+            std::move(other.data_.ref_to_equal()),
+            std::move(other.data_.ref_to_alloc())
+        )
+    {
+        initialize_move(other);
+    }
+
+    small_unordered_flat_hash_map(small_unordered_flat_hash_map&& other,
+                                  const Allocator& alloc)
+        : data_
+        (
+            std::move(other.data_.ref_to_hash()),
+            std::move(other.data_.ref_to_equal()),
+            alloc
+        )
+    {
+        initialize_move(other);
+    }
+
+    ~small_unordered_flat_hash_map()
+    {
+        index_drop();
+
+        sfl::dtl::destroy_a
+        (
+            data_.ref_to_alloc(),
+            data_.first_,
+            data_.last_
+        );
+
+        if (data_.first_ != data_.internal_storage())
+        {
+            deallocate_storage(data_.first_, capacity());
+        }
+    }
+
+    //
+    // ---- ASSIGNMENT --------------------------------------------------------
+    //
+
+    small_unordered_flat_hash_map& operator=(const small_unordered_flat_hash_map& other)
+    {
+        assign_copy(other);
+        return *this;
+    }
+
+    small_unordered_flat_hash_map& operator=(small_unordered_flat_hash_map&& other)
+    {
+        assign_move(other);
+        return *this;
+    }
+
+    small_unordered_flat_hash_map& operator=(std::initializer_list<value_type> ilist)
+    {
+        clear();
+        insert(ilist.begin(), ilist.end());
+        return *this;
+    }
+
+    //
+    // ---- ALLOCATOR ---------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    allocator_type get_allocator() const noexcept
+    {
+        return data_.ref_to_alloc();
+    }
+
+    //
+    // ---- HASH FUNCTION -----------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    hasher hash_function() const
+    {
+        return data_.ref_to_hash();
+    }
+
+    //
+    // ---- KEY EQUAL ---------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    key_equal key_eq() const
+    {
+        return data_.ref_to_equal();
+    }
+
+    //
+    // ---- VALUE EQUAL -------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    value_equal value_eq() const
+    {
+        return value_equal(data_.ref_to_equal());
+    }
+
+    //
+    // ---- ITERATORS ---------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    iterator begin() noexcept
+    {
+        return iterator(data_.first_);
+    }
+
+    SFL_NODISCARD
+    const_iterator begin() const noexcept
+    {
+        return const_iterator(data_.first_);
+    }
+
+    SFL_NODISCARD
+    const_iterator cbegin() const noexcept
+    {
+        return const_iterator(data_.first_);
+    }
+
+    SFL_NODISCARD
+    iterator end() noexcept
+    {
+        return iterator(data_.last_);
+    }
+
+    SFL_NODISCARD
+    const_iterator end() const noexcept
+    {
+        return const_iterator(data_.last_);
+    }
+
+    SFL_NODISCARD
+    const_iterator cend() const noexcept
+    {
+        return const_iterator(data_.last_);
+    }
+
+    SFL_NODISCARD
+    iterator nth(size_type pos) noexcept
+    {
+        SFL_ASSERT(pos <= size());
+        return iterator(data_.first_ + pos);
+    }
+
+    SFL_NODISCARD
+    const_iterator nth(size_type pos) const noexcept
+    {
+        SFL_ASSERT(pos <= size());
+        return const_iterator(data_.first_ + pos);
+    }
+
+    SFL_NODISCARD
+    size_type index_of(const_iterator pos) const noexcept
+    {
+        SFL_ASSERT(cbegin() <= pos && pos <= cend());
+        return std::distance(cbegin(), pos);
+    }
+
+    //
+    // ---- SIZE AND CAPACITY -------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    bool empty() const noexcept
+    {
+        return data_.first_ == data_.last_;
+    }
+
+    SFL_NODISCARD
+    size_type size() const noexcept
+    {
+        return std::distance(data_.first_, data_.last_);
+    }
+
+    SFL_NODISCARD
+    size_type max_size() const noexcept
+    {
+        // Each element needs one more byte for fingerprint.
+        return std::min<size_type>
+        (
+            allocator_traits::max_size(data_.ref_to_alloc()),
+            std::numeric_limits<difference_type>::max() / sizeof(value_type)
+        ) / (sizeof(value_type) + 1) * sizeof(value_type);
+    }
+
+    SFL_NODISCARD
+    size_type capacity() const noexcept
+    {
+        return std::distance(data_.first_, data_.eos_);
+    }
+
+    SFL_NODISCARD
+    size_type available() const noexcept
+    {
+        return std::distance(data_.last_, data_.eos_);
+    }
+
+    void reserve(size_type new_cap)
+    {
+        check_size(new_cap, "sfl::small_unordered_flat_hash_map::reserve");
+
+        if (new_cap > capacity())
+        {
+            if (new_cap <= N)
+            {
+                if (data_.first_ == data_.internal_storage())
+                {
+                    // Do nothing. We are already using internal storage.
+                }
+                else
+                {
+                    // We are not using internal storage but new capacity
+                    // can fit in internal storage.
+
+                    pointer new_first = data_.internal_storage();
+                    pointer new_last  = new_first;
+                    pointer new_eos   = new_first + N;
+
+                    new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                    (
+                        data_.ref_to_alloc(),
+                        data_.first_,
+                        data_.last_,
+                        new_first
+                    );
+
+                    copy_fingerprints_to(data_.fingerprints_of(new_first, new_eos));
+
+                    sfl::dtl::destroy_a
+                    (
+                        data_.ref_to_alloc(),
+                        data_.first_,
+                        data_.last_
+                    );
+
+                    deallocate_storage(data_.first_, capacity());
+
+                    data_.first_ = new_first;
+                    data_.last_  = new_last;
+                    data_.eos_   = new_eos;
+                }
+            }
+            else
+            {
+                pointer new_first = allocate_storage(new_cap);
+                pointer new_last  = new_first;
+                pointer new_eos   = new_first + new_cap;
+
+                SFL_TRY
+                {
+                    new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                    (
+                        data_.ref_to_alloc(),
+                        data_.first_,
+                        data_.last_,
+                        new_first
+                    );
+                }
+                SFL_CATCH (...)
+                {
+                    deallocate_storage(new_first, new_cap);
+
+                    SFL_RETHROW;
+                }
+
+                copy_fingerprints_to(data_.fingerprints_of(new_first, new_eos));
+
+                sfl::dtl::destroy_a
+                (
+                    data_.ref_to_alloc(),
+                    data_.first_,
+                    data_.last_
+                );
+
+                if (data_.first_ != data_.internal_storage())
+                {
+                    deallocate_storage(data_.first_, capacity());
+                }
+
+                data_.first_ = new_first;
+                data_.last_  = new_last;
+                data_.eos_   = new_eos;
+            }
+        }
+    }
+
+    void shrink_to_fit()
+    {
+        const size_type new_cap = size();
+
+        if (new_cap < capacity())
+        {
+            if (new_cap <= N)
+            {
+                if (data_.first_ == data_.internal_storage())
+                {
+                    // Do nothing. We are already using internal storage.
+                }
+                else
+                {
+                    // We are not using internal storage but new capacity
+                    // can fit in internal storage.
+
+                    pointer new_first = data_.internal_storage();
+                    pointer new_last  = new_first;
+                    pointer new_eos   = new_first + N;
+
+                    new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                    (
+                        data_.ref_to_alloc(),
+                        data_.first_,
+                        data_.last_,
+                        new_first
+                    );
+
+                    copy_fingerprints_to(data_.fingerprints_of(new_first, new_eos));
+
+                    sfl::dtl::destroy_a
+                    (
+                        data_.ref_to_alloc(),
+                        data_.first_,
+                        data_.last_
+                    );
+
+                    deallocate_storage(data_.first_, capacity());
+
+                    data_.first_ = new_first;
+                    data_.last_  = new_last;
+                    data_.eos_   = new_eos;
+                }
+            }
+            else
+            {
+                pointer new_first = allocate_storage(new_cap);
+                pointer new_last  = new_first;
+                pointer new_eos   = new_first + new_cap;
+
+                SFL_TRY
+                {
+                    new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                    (
+                        data_.ref_to_alloc(),
+                        data_.first_,
+                        data_.last_,
+                        new_first
+                    );
+                }
+                SFL_CATCH (...)
+                {
+                    deallocate_storage(new_first, new_cap);
+
+                    SFL_RETHROW;
+                }
+
+                copy_fingerprints_to(data_.fingerprints_of(new_first, new_eos));
+
+                sfl::dtl::destroy_a
+                (
+                    data_.ref_to_alloc(),
+                    data_.first_,
+                    data_.last_
+                );
+
+                if (data_.first_ != data_.internal_storage())
+                {
+                    deallocate_storage(data_.first_, capacity());
+                }
+
+                data_.first_ = new_first;
+                data_.last_  = new_last;
+                data_.eos_   = new_eos;
+            }
+        }
+    }
+
+    //
+    // ---- MODIFIERS ---------------------------------------------------------
+    //
+
+    void clear() noexcept
+    {
+        index_drop();
+
+        sfl::dtl::destroy_a
+        (
+            data_.ref_to_alloc(),
+            data_.first_,
+            data_.last_
+        );
+
+        data_.last_ = data_.first_;
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args)
+    {
+        return emplace_aux(std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    iterator emplace_hint(const_iterator hint, Args&&... args)
+    {
+        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        return emplace_hint_aux(hint, std::forward<Args>(args)...);
+    }
+
+    std::pair<iterator, bool> insert(const value_type& value)
+    {
+        return insert_aux(value);
+    }
+
+    std::pair<iterator, bool> insert(value_type&& value)
+    {
+        return insert_aux(std::move(value));
+    }
+
+    template <typename P,
+              sfl::dtl::enable_if_t<std::is_constructible<value_type, P&&>::value>* = nullptr>
+    std::pair<iterator, bool> insert(P&& value)
+    {
+        return insert_aux(value_type(std::forward<P>(value)));
+    }
+
+    iterator insert(const_iterator hint, const value_type& value)
+    {
+        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        return insert_aux(hint, value);
+    }
+
+    iterator insert(const_iterator hint, value_type&& value)
+    {
+        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        return insert_aux(hint, std::move(value));
+    }
+
+    template <typename P,
+              sfl::dtl::enable_if_t<std::is_constructible<value_type, P&&>::value>* = nullptr>
+    iterator insert(const_iterator hint, P&& value)
+    {
+        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        return insert_aux(hint, value_type(std::forward<P>(value)));
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    void insert(InputIt first, InputIt last)
+    {
+        while (first != last)
+        {
+            insert(*first);
+            ++first;
+        }
+    }
+
+    void insert(std::initializer_list<value_type> ilist)
+    {
+        insert(ilist.begin(), ilist.end());
+    }
+
+    template <typename M,
+              sfl::dtl::enable_if_t<std::is_assignable<mapped_type&, M&&>::value>* = nullptr>
+    std::pair<iterator, bool> insert_or_assign(const Key& key, M&& obj)
+    {
+        return insert_or_assign_aux(key, std::forward<M>(obj));
+    }
+
+    template <typename M,
+              sfl::dtl::enable_if_t<std::is_assignable<mapped_type&, M&&>::value>* = nullptr>
+    std::pair<iterator, bool> insert_or_assign(Key&& key, M&& obj)
+    {
+        return insert_or_assign_aux(std::move(key), std::forward<M>(obj));
+    }
+
+    template <typename K, typename M,
+              sfl::dtl::enable_if_t< is_transparent_for<K>::value &&
+                                     std::is_assignable<mapped_type&, M&&>::value >* = nullptr>
+    std::pair<iterator, bool> insert_or_assign(K&& key, M&& obj)
+    {
+        return insert_or_assign_aux(std::forward<K>(key), std::forward<M>(obj));
+    }
+
+    template <typename M,
+              sfl::dtl::enable_if_t<std::is_assignable<mapped_type&, M&&>::value>* = nullptr>
+    iterator insert_or_assign(const_iterator hint, const Key& key, M&& obj)
+    {
+        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        return insert_or_assign_aux(hint, key, std::forward<M>(obj));
+    }
+
+    template <typename M,
+              sfl::dtl::enable_if_t<std::is_assignable<mapped_type&, M&&>::value>* = nullptr>
+    iterator insert_or_assign(const_iterator hint, Key&& key, M&& obj)
+    {
+        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        return insert_or_assign_aux(hint, std::move(key), std::forward<M>(obj));
+    }
+
+    template <typename K, typename M,
+              sfl::dtl::enable_if_t< is_transparent_for<K>::value &&
+                                     std::is_assignable<mapped_type&, M&&>::value >* = nullptr>
+    iterator insert_or_assign(const_iterator hint, K&& key, M&& obj)
+    {
+        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        return insert_or_assign_aux(hint, std::forward<K>(key), std::forward<M>(obj));
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args)
+    {
+        return try_emplace_aux(key, std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(Key&& key, Args&&... args)
+    {
+        return try_emplace_aux(std::move(key), std::forward<Args>(args)...);
+    }
+
+    template <typename K, typename... Args,
+              sfl::dtl::enable_if_t<
+                #if defined(__GNUC__) && !defined(__clang__) && (__GNUC__ < 7)
+                // This is workaround for GCC 4 bug on CentOS 7.
+                !std::is_same<sfl::dtl::remove_cvref_t<Key>, sfl::dtl::remove_cvref_t<K>>::value &&
+                #endif
+                is_transparent_for<K>::value &&
+                !std::is_convertible<K&&, const_iterator>::value &&
+                !std::is_convertible<K&&, iterator>::value
+              >* = nullptr>
+    std::pair<iterator, bool> try_emplace(K&& key, Args&&... args)
+    {
+        return try_emplace_aux(std::forward<K>(key), std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    iterator try_emplace(const_iterator hint, const Key& key, Args&&... args)
+    {
+        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        return try_emplace_aux(hint, key, std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    iterator try_emplace(const_iterator hint, Key&& key, Args&&... args)
+    {
+        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        return try_emplace_aux(hint, std::move(key), std::forward<Args>(args)...);
+    }
+
+    template <typename K, typename... Args,
+              sfl::dtl::enable_if_t<
+                #if defined(__GNUC__) && !defined(__clang__) && (__GNUC__ < 7)
+                // This is workaround for GCC 4 bug on CentOS 7.
+                !std::is_same<sfl::dtl::remove_cvref_t<Key>, sfl::dtl::remove_cvref_t<K>>::value &&
+                #endif
+                is_transparent_for<K>::value
+              >* = nullptr>
+    iterator try_emplace(const_iterator hint, K&& key, Args&&... args)
+    {
+        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        return try_emplace_aux(hint, std::forward<K>(key), std::forward<Args>(args)...);
+    }
+
+    iterator erase(iterator pos)
+    {
+        return erase(const_iterator(pos));
+    }
+
+    iterator erase(const_iterator pos)
+    {
+        SFL_ASSERT(cbegin() <= pos && pos < cend());
+
+        const difference_type offset = std::distance(cbegin(), pos);
+
+        const pointer p = data_.first_ + offset;
+
+        index_before_erase(size_type(offset));
+
+        if (p < data_.last_ - 1)
+        {
+            *p = std::move(*(data_.last_ - 1));
+
+            unsigned char* const fps = fingerprints();
+            fps[offset] = fps[size() - 1];
+        }
+
+        --data_.last_;
+
+        sfl::dtl::destroy_at_a(data_.ref_to_alloc(), data_.last_);
+
+        if (size() <= IndexThreshold / 2)
+        {
+            index_drop();
+        }
+
+        return iterator(p);
+    }
+
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        SFL_ASSERT(cbegin() <= first && first <= last && last <= cend());
+
+        if (first == last)
+        {
+            return begin() + std::distance(cbegin(), first);
+        }
+
+        const difference_type count1 = std::distance(first, last);
+        const difference_type count2 = std::distance(last, cend());
+
+        const difference_type offset = std::distance(cbegin(), first);
+
+        const pointer p1 = data_.first_ + offset;
+
+        unsigned char* const fps = fingerprints();
+
+        if (count1 >= count2)
+        {
+            const pointer p2 = p1 + count1;
+
+            std::memmove(fps + offset, fps + offset + count1, count2);
+
+            const pointer new_last = sfl::dtl::move(p2, data_.last_, p1);
+
+            sfl::dtl::destroy_a(data_.ref_to_alloc(), new_last, data_.last_);
+
+            data_.last_ = new_last;
+        }
+        else
+        {
+            const pointer p2 = p1 + count2;
+
+            std::memmove(fps + offset, fps + offset + count2, count1);
+
+            sfl::dtl::move(p2, data_.last_, p1);
+
+            const pointer new_last = p2;
+
+            sfl::dtl::destroy_a(data_.ref_to_alloc(), new_last, data_.last_);
+
+            data_.last_ = new_last;
+        }
+
+        if (index_exists() && size() > IndexThreshold / 2)
+        {
+            index_rebuild();
+        }
+        else
+        {
+            index_drop();
+        }
+
+        return iterator(p1);
+    }
+
+    size_type erase(const Key& key)
+    {
+        auto it = find(key);
+
+        if (it == cend())
+        {
+            return 0;
+        }
+
+        erase(it);
+        return 1;
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<is_transparent_for<K>::value>* = nullptr>
+    size_type erase(K&& x)
+    {
+        auto it = find(x);
+
+        if (it == cend())
+        {
+            return 0;
+        }
+
+        erase(it);
+        return 1;
+    }
+
+    void swap(small_unordered_flat_hash_map& other)
+    {
+        if (this == &other)
+        {
+            return;
+        }
+
+        using std::swap;
+
+        SFL_ASSERT
+        (
+            allocator_traits::propagate_on_container_swap::value ||
+            this->data_.ref_to_alloc() == other.data_.ref_to_alloc()
+        );
+
+        // If this and other allocator compares equal then one allocator
+        // can deallocate memory allocated by another allocator.
+        // One allocator can safely destroy_a elements constructed by other
+        // allocator regardless the two allocators compare equal or not.
+
+        if (allocator_traits::propagate_on_container_swap::value)
+        {
+            swap(this->data_.ref_to_alloc(), other.data_.ref_to_alloc());
+        }
+
+        swap(this->data_.ref_to_hash(), other.data_.ref_to_hash());
+        swap(this->data_.ref_to_equal(), other.data_.ref_to_equal());
+
+        swap(this->data_.index_first_, other.data_.index_first_);
+        swap(this->data_.index_mask_,  other.data_.index_mask_);
+        swap(this->data_.index_shift_, other.data_.index_shift_);
+
+        if
+        (
+            this->data_.first_ == this->data_.internal_storage() &&
+            other.data_.first_ == other.data_.internal_storage()
+        )
+        {
+            const size_type this_size  = this->size();
+            const size_type other_size = other.size();
+
+            unsigned char* const this_fps  = this->fingerprints();
+            unsigned char* const other_fps = other.fingerprints();
+
+            if (this_size <= other_size)
+            {
+                std::swap_ranges(this_fps, this_fps + this_size, other_fps);
+
+                copy_fingerprints
+                (
+                    this_fps + this_size,
+                    other_fps + this_size,
+                    other_size - this_size
+                );
+
+                std::swap_ranges
+                (
+                    this->data_.first_,
+                    this->data_.first_ + this_size,
+                    other.data_.first_
+                );
+
+                sfl::dtl::uninitialized_move_a
+                (
+                    this->data_.ref_to_alloc(),
+                    other.data_.first_ + this_size,
+                    other.data_.first_ + other_size,
+                    this->data_.first_ + this_size
+                );
+
+                sfl::dtl::destroy_a
+                (
+                    other.data_.ref_to_alloc(),
+                    other.data_.first_ + this_size,
+                    other.data_.first_ + other_size
+                );
+            }
+            else
+            {
+                std::swap_ranges(other_fps, other_fps + other_size, this_fps);
+
+                copy_fingerprints
+                (
+                    other_fps + other_size,
+                    this_fps + other_size,
+                    this_size - other_size
+                );
+
+                std::swap_ranges
+                (
+                    other.data_.first_,
+                    other.data_.first_ + other_size,
+                    this->data_.first_
+                );
+
+                sfl::dtl::uninitialized_move_a
+                (
+                    other.data_.ref_to_alloc(),
+                    this->data_.first_ + other_size,
+                    this->data_.first_ + this_size,
+                    other.data_.first_ + other_size
+                );
+
+                sfl::dtl::destroy_a
+                (
+                    this->data_.ref_to_alloc(),
+                    this->data_.first_ + other_size,
+                    this->data_.first_ + this_size
+                );
+            }
+
+            this->data_.last_ = this->data_.first_ + other_size;
+            other.data_.last_ = other.data_.first_ + this_size;
+        }
+        else if
+        (
+            this->data_.first_ == this->data_.internal_storage() &&
+            other.data_.first_ != other.data_.internal_storage()
+        )
+        {
+            pointer new_other_first = other.data_.internal_storage();
+            pointer new_other_last  = new_other_first;
+            pointer new_other_eos   = new_other_first + N;
+
+            new_other_last = sfl::dtl::uninitialized_move_a
+            (
+                other.data_.ref_to_alloc(),
+                this->data_.first_,
+                this->data_.last_,
+                new_other_first
+            );
+
+            copy_fingerprints
+            (
+                other.data_.fingerprints_of(new_other_first, new_other_eos),
+                this->fingerprints(),
+                this->size()
+            );
+
+            sfl::dtl::destroy_a
+            (
+                this->data_.ref_to_alloc(),
+                this->data_.first_,
+                this->data_.last_
+            );
+
+            this->data_.first_ = other.data_.first_;
+            this->data_.last_  = other.data_.last_;
+            this->data_.eos_   = other.data_.eos_;
+
+            other.data_.first_ = new_other_first;
+            other.data_.last_  = new_other_last;
+            other.data_.eos_   = new_other_eos;
+        }
+        else if
+        (
+            this->data_.first_ != this->data_.internal_storage() &&
+            other.data_.first_ == other.data_.internal_storage()
+        )
+        {
+            pointer new_this_first = this->data_.internal_storage();
+            pointer new_this_last  = new_this_first;
+            pointer new_this_eos   = new_this_first + N;
+
+            new_this_last = sfl::dtl::uninitialized_move_a
+            (
+                this->data_.ref_to_alloc(),
+                other.data_.first_,
+                other.data_.last_,
+                new_this_first
+            );
+
+            copy_fingerprints
+            (
+                this->data_.fingerprints_of(new_this_first, new_this_eos),
+                other.fingerprints(),
+                other.size()
+            );
+
+            sfl::dtl::destroy_a
+            (
+                other.data_.ref_to_alloc(),
+                other.data_.first_,
+                other.data_.last_
+            );
+
+            other.data_.first_ = this->data_.first_;
+            other.data_.last_  = this->data_.last_;
+            other.data_.eos_   = this->data_.eos_;
+
+            this->data_.first_ = new_this_first;
+            this->data_.last_  = new_this_last;
+            this->data_.eos_   = new_this_eos;
+        }
+        else
+        {
+            swap(this->data_.first_, other.data_.first_);
+            swap(this->data_.last_,  other.data_.last_);
+            swap(this->data_.eos_,   other.data_.eos_);
+        }
+    }
+
+    // Moves all elements into a vector and leaves the container empty.
+    // Elements and their fingerprints share one memory block that cannot be
+    // handed over, so elements are moved one by one.
+    sfl::vector<value_type, Allocator> extract()
+    {
+        sfl::vector<value_type, Allocator> result
+        (
+            std::make_move_iterator(data()),
+            std::make_move_iterator(data() + size()),
+            data_.ref_to_alloc()
+        );
+
+        index_drop();
+        reset();
+
+        return result;
+    }
+
+    // Replaces all elements with elements moved from `cont`. Fingerprints
+    // and the index are rebuilt as elements are appended.
+    void replace(sfl::vector<value_type, Allocator>&& cont)
+    {
+        SFL_ASSERT(sfl::dtl::is_unique(cont.begin(), cont.end(), data_.ref_to_equal()));
+
+        clear();
+
+        reserve(cont.size());
+
+        for (auto it = cont.begin(); it != cont.end(); ++it)
+        {
+            emplace_back(std::move(*it));
+        }
+
+        cont.clear();
+    }
+
+    //
+    // ---- LOOKUP ------------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    iterator find(const Key& key)
+    {
+        return iterator(find_aux(key, data_.ref_to_hash().mixed_hash(key)));
+    }
+
+    SFL_NODISCARD
+    const_iterator find(const Key& key) const
+    {
+        return const_iterator(find_aux(key, data_.ref_to_hash().mixed_hash(key)));
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<is_transparent_for<K>::value>* = nullptr>
+    SFL_NODISCARD
+    iterator find(const K& x)
+    {
+        return iterator(find_aux(x, data_.ref_to_hash().mixed_hash(x)));
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<is_transparent_for<K>::value>* = nullptr>
+    SFL_NODISCARD
+    const_iterator find(const K& x) const
+    {
+        return const_iterator(find_aux(x, data_.ref_to_hash().mixed_hash(x)));
+    }
+
+    SFL_NODISCARD
+    size_type count(const Key& key) const
+    {
+        return find(key) != end();
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<is_transparent_for<K>::value>* = nullptr>
+    SFL_NODISCARD
+    size_type count(const K& x) const
+    {
+        return find(x) != end();
+    }
+
+    SFL_NODISCARD
+    bool contains(const Key& key) const
+    {
+        return find(key) != end();
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<is_transparent_for<K>::value>* = nullptr>
+    SFL_NODISCARD
+    bool contains(const K& x) const
+    {
+        return find(x) != end();
+    }
+
+    //
+    // ---- ELEMENT ACCESS ----------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    T& at(const Key& key)
+    {
+        auto it = find(key);
+
+        if (it == end())
+        {
+            sfl::dtl::throw_out_of_range("sfl::small_unordered_flat_hash_map::at");
+        }
+
+        return it->second;
+    }
+
+    SFL_NODISCARD
+    const T& at(const Key& key) const
+    {
+        auto it = find(key);
+
+        if (it == end())
+        {
+            sfl::dtl::throw_out_of_range("sfl::small_unordered_flat_hash_map::at");
+        }
+
+        return it->second;
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<is_transparent_for<K>::value>* = nullptr>
+    SFL_NODISCARD
+    T& at(const K& x)
+    {
+        auto it = find(x);
+
+        if (it == end())
+        {
+            sfl::dtl::throw_out_of_range("sfl::small_unordered_flat_hash_map::at");
+        }
+
+        return it->second;
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<is_transparent_for<K>::value>* = nullptr>
+    SFL_NODISCARD
+    const T& at(const K& x) const
+    {
+        auto it = find(x);
+
+        if (it == end())
+        {
+            sfl::dtl::throw_out_of_range("sfl::small_unordered_flat_hash_map::at");
+        }
+
+        return it->second;
+    }
+
+    SFL_NODISCARD
+    T& operator[](const Key& key)
+    {
+        return try_emplace(key).first->second;
+    }
+
+    SFL_NODISCARD
+    T& operator[](Key&& key)
+    {
+        return try_emplace(std::move(key)).first->second;
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<is_transparent_for<K>::value>* = nullptr>
+    SFL_NODISCARD
+    T& operator[](K&& key)
+    {
+        return try_emplace(std::forward<K>(key)).first->second;
+    }
+
+    SFL_NODISCARD
+    value_type* data() noexcept
+    {
+        return sfl::dtl::to_address(data_.first_);
+    }
+
+    SFL_NODISCARD
+    const value_type* data() const noexcept
+    {
+        return sfl::dtl::to_address(data_.first_);
+    }
+
+private:
+
+    void check_size(size_type n, const char* msg)
+    {
+        if (n > max_size())
+        {
+            sfl::dtl::throw_length_error(msg);
+        }
+    }
+
+    size_type calculate_new_capacity(size_type num_additional_elements, const char* msg)
+    {
+        const size_type size = this->size();
+        const size_type capacity = this->capacity();
+        const size_type max_size = this->max_size();
+
+        if (max_size - size < num_additional_elements)
+        {
+            sfl::dtl::throw_length_error(msg);
+        }
+        else if (max_size - capacity < capacity / 2)
+        {
+            return max_size;
+        }
+        else if (size + num_additional_elements < capacity + capacity / 2)
+        {
+            return std::max(N, capacity + capacity / 2);
+        }
+        else
+        {
+            return std::max(N, size + num_additional_elements);
+        }
+    }
+
+    // Returns the number of `value_type` slots that must be allocated for
+    // `cap` elements and `cap` fingerprints.
+    static size_type storage_size(size_type cap) noexcept
+    {
+        return cap + (cap + sizeof(value_type) - 1) / sizeof(value_type);
+    }
+
+    pointer allocate_storage(size_type cap)
+    {
+        return sfl::dtl::allocate(data_.ref_to_alloc(), storage_size(cap));
+    }
+
+    void deallocate_storage(pointer p, size_type cap) noexcept
+    {
+        sfl::dtl::deallocate(data_.ref_to_alloc(), p, storage_size(cap));
+    }
+
+    unsigned char* fingerprints() noexcept
+    {
+        return data_.fingerprints_of(data_.first_, data_.eos_);
+    }
+
+    const unsigned char* fingerprints() const noexcept
+    {
+        return const_cast<small_unordered_flat_hash_map*>(this)->fingerprints();
+    }
+
+    // Copies `n` fingerprints from `src` to `dst`. Pointer `dst` is null
+    // only if it refers to internal storage of zero size (`N == 0`), and
+    // `n` is always zero in that case.
+    static void copy_fingerprints
+    (
+        unsigned char* dst,
+        const unsigned char* src,
+        size_type n
+    ) noexcept
+    {
+        if (n > 0 && dst != nullptr)
+        {
+            std::memcpy(dst, src, n);
+        }
+    }
+
+    // Copies fingerprints of all elements to array `fps`.
+    void copy_fingerprints_to(unsigned char* fps) const noexcept
+    {
+        copy_fingerprints(fps, fingerprints(), size());
+    }
+
+    // Returns pointer to element with key equivalent to `x` or `first_ + n`
+    // if there is no such element among the first `n` elements. Parameter
+    // `h` is mixed hash value of `x`. Full keys are compared only if
+    // fingerprints are equal.
+    //
+    // If the index exists, it is used instead of scanning fingerprints, and
+    // parameter `n` must not be greater than the number of indexed elements.
+    template <typename K>
+    pointer find_aux(const K& x, unsigned long long h, size_type n) const
+    {
+        const pointer first = data_.first_;
+
+        const unsigned char fp = sfl::dtl::hash_fingerprint(h);
+
+        const unsigned char* const fps = fingerprints();
+
+        if (index_exists())
+        {
+            const size_type* const slots = sfl::dtl::to_address(data_.index_first_);
+
+            for (size_type i = index_home(h); slots[i] != 0; i = (i + 1) & data_.index_mask_)
+            {
+                const size_type j = slots[i] - 1;
+
+                if (fps[j] == fp && data_.ref_to_equal()(*(first + j), x))
+                {
+                    return first + j;
+                }
+            }
+
+            return first + n;
+        }
+
+        const size_type i = sfl::dtl::find_byte_if
+        (
+            fps,
+            n,
+            fp,
+            [&](size_type j)
+            {
+                return data_.ref_to_equal()(*(first + j), x);
+            }
+        );
+
+        return first + i;
+    }
+
+    template <typename K>
+    pointer find_aux(const K& x, unsigned long long h) const
+    {
+        return find_aux(x, h, size());
+    }
+
+    //
+    // ---- INDEX -------------------------------------------------------------
+    //
+
+    bool index_exists() const noexcept
+    {
+        return data_.index_first_ != nullptr;
+    }
+
+    size_type index_size() const noexcept
+    {
+        return index_exists() ? data_.index_mask_ + 1 : 0;
+    }
+
+    // Returns home slot for mixed hash value `h`.
+    size_type index_home(unsigned long long h) const noexcept
+    {
+        return static_cast<size_type>(h >> data_.index_shift_) & data_.index_mask_;
+    }
+
+    // Returns home slot of the element at position `pos`.
+    // Hash function may throw.
+    size_type index_home_of(size_type pos) const
+    {
+        return index_home(data_.ref_to_hash().mixed_hash((data_.first_ + pos)->first));
+    }
+
+    // Returns slot that holds position `pos`. Element at that position must
+    // be indexed. Hash function may throw.
+    size_type index_slot_of(size_type pos) const
+    {
+        const size_type* const slots = sfl::dtl::to_address(data_.index_first_);
+
+        size_type i = index_home_of(pos);
+
+        while (slots[i] != pos + 1)
+        {
+            SFL_ASSERT(slots[i] != 0);
+            i = (i + 1) & data_.index_mask_;
+        }
+
+        return i;
+    }
+
+    void index_drop() noexcept
+    {
+        if (index_exists())
+        {
+            index_allocator alloc(data_.ref_to_alloc());
+            sfl::dtl::deallocate(alloc, data_.index_first_, index_size());
+
+            data_.index_first_ = nullptr;
+            data_.index_mask_  = 0;
+            data_.index_shift_ = 0;
+        }
+    }
+
+    // Builds new index of all elements. If that fails, the index is dropped.
+    void index_rebuild() noexcept
+    {
+        // Number of slots is power of two and at least twice the number
+        // of elements. Shift of mixed hash value is limited to 8 so bits of
+        // fingerprint are not used for home slot unless there are more than
+        // 2^56 slots (which is impossible in practice).
+
+        size_type new_size = 16;
+        unsigned new_shift = 56 - 4;
+
+        while (new_size / 2 < size())
+        {
+            if (new_size > std::numeric_limits<size_type>::max() / 2)
+            {
+                index_drop();
+                return;
+            }
+
+            new_size *= 2;
+
+            if (new_shift > 8)
+            {
+                --new_shift;
+            }
+        }
+
+        index_allocator alloc(data_.ref_to_alloc());
+
+        index_pointer new_first = nullptr;
+
+        SFL_TRY
+        {
+            new_first = sfl::dtl::allocate(alloc, new_size);
+
+            size_type* const slots = sfl::dtl::to_address(new_first);
+
+            std::fill_n(slots, new_size, size_type(0));
+
+            const size_type new_mask = new_size - 1;
+
+            const size_type n = size();
+
+            for (size_type pos = 0; pos < n; ++pos)
+            {
+                const unsigned long long h =
+                    data_.ref_to_hash().mixed_hash((data_.first_ + pos)->first);
+
+                size_type i = static_cast<size_type>(h >> new_shift) & new_mask;
+
+                while (slots[i] != 0)
+                {
+                    i = (i + 1) & new_mask;
+                }
+
+                slots[i] = pos + 1;
+            }
+
+            index_drop();
+
+            data_.index_first_ = new_first;
+            data_.index_mask_  = new_mask;
+            data_.index_shift_ = new_shift;
+        }
+        SFL_CATCH (...)
+        {
+            sfl::dtl::deallocate(alloc, new_first, new_size);
+            index_drop();
+        }
+    }
+
+    // Copies the index of `other` whose elements have just been copied or
+    // moved to this container (at the same positions).
+    void index_copy(const small_unordered_flat_hash_map& other) noexcept
+    {
+        index_drop();
+
+        if (other.index_exists())
+        {
+            const size_type new_size = other.index_size();
+
+            index_allocator alloc(data_.ref_to_alloc());
+
+            SFL_TRY
+            {
+                data_.index_first_ = sfl::dtl::allocate(alloc, new_size);
+            }
+            SFL_CATCH (...)
+            {
+                data_.index_first_ = nullptr;
+                return;
+            }
+
+            std::copy_n
+            (
+                sfl::dtl::to_address(other.data_.index_first_),
+                new_size,
+                sfl::dtl::to_address(data_.index_first_)
+            );
+
+            data_.index_mask_  = other.data_.index_mask_;
+            data_.index_shift_ = other.data_.index_shift_;
+        }
+    }
+
+    // Takes over the index of `other` whose elements have just been moved
+    // to this container (at the same positions). Allocators must be equal.
+    void index_steal(small_unordered_flat_hash_map& other) noexcept
+    {
+        index_drop();
+
+        data_.index_first_ = other.data_.index_first_;
+        data_.index_mask_  = other.data_.index_mask_;
+        data_.index_shift_ = other.data_.index_shift_;
+
+        other.data_.index_first_ = nullptr;
+        other.data_.index_mask_  = 0;
+        other.data_.index_shift_ = 0;
+    }
+
+    // Takes over or copies the index of `other`, depending on whether
+    // allocators are equal.
+    void index_take(small_unordered_flat_hash_map& other) noexcept
+    {
+        if (data_.ref_to_alloc() == other.data_.ref_to_alloc())
+        {
+            index_steal(other);
+        }
+        else
+        {
+            index_copy(other);
+        }
+    }
+
+    // Updates the index after the element with mixed hash value `h` has been
+    // appended at position `pos` (which is the last position).
+    void index_after_append(size_type pos, unsigned long long h) noexcept
+    {
+        if (index_exists())
+        {
+            if (size() > index_size() / 2)
+            {
+                index_rebuild();
+            }
+            else
+            {
+                size_type* const slots = sfl::dtl::to_address(data_.index_first_);
+
+                size_type i = index_home(h);
+
+                while (slots[i] != 0)
+                {
+                    i = (i + 1) & data_.index_mask_;
+                }
+
+                slots[i] = pos + 1;
+            }
+        }
+        else if (size() > IndexThreshold)
+        {
+            index_rebuild();
+        }
+    }
+
+    // Updates the index before the element at position `pos` is erased and
+    // the last element is moved to position `pos`. Elements are still in
+    // their original positions.
+    void index_before_erase(size_type pos) noexcept
+    {
+        if (!index_exists())
+        {
+            return;
+        }
+
+        SFL_TRY
+        {
+            size_type* const slots = sfl::dtl::to_address(data_.index_first_);
+
+            const size_type mask = data_.index_mask_;
+
+            const size_type last_pos = size() - 1;
+
+            // Backward shift deletion: move subsequent slots of the probe
+            // sequence one by one into the hole if their home slot allows.
+
+            size_type hole = index_slot_of(pos);
+
+            for (size_type i = (hole + 1) & mask; slots[i] != 0; i = (i + 1) & mask)
+            {
+                const size_type home = index_home_of(slots[i] - 1);
+
+                if (((i - home) & mask) >= ((i - hole) & mask))
+                {
+                    slots[hole] = slots[i];
+                    hole = i;
+                }
+            }
+
+            slots[hole] = 0;
+
+            // The last element will be moved to position `pos`.
+
+            if (pos != last_pos)
+            {
+                slots[index_slot_of(last_pos)] = pos + 1;
+            }
+        }
+        SFL_CATCH (...)
+        {
+            index_drop();
+        }
+    }
+
+    void reset(size_type new_cap = N)
+    {
+        sfl::dtl::destroy_a
+        (
+            data_.ref_to_alloc(),
+            data_.first_,
+            data_.last_
+        );
+
+        if (data_.first_ != data_.internal_storage())
+        {
+            deallocate_storage(data_.first_, capacity());
+        }
+
+        data_.first_ = data_.internal_storage();
+        data_.last_  = data_.first_;
+        data_.eos_   = data_.first_ + N;
+
+        if (new_cap > N)
+        {
+            data_.first_ = allocate_storage(new_cap);
+            data_.last_  = data_.first_;
+            data_.eos_   = data_.first_ + new_cap;
+
+            // If allocation throws, first_, last_ and eos_ will be valid
+            // (they will be pointing to internal_storage).
+        }
+    }
+
+    template <typename InputIt>
+    void initialize_range(InputIt first, InputIt last)
+    {
+        SFL_TRY
+        {
+            while (first != last)
+            {
+                insert(*first);
+                ++first;
+            }
+        }
+        SFL_CATCH (...)
+        {
+            sfl::dtl::destroy_a
+            (
+                data_.ref_to_alloc(),
+                data_.first_,
+                data_.last_
+            );
+
+            if (data_.first_ != data_.internal_storage())
+            {
+                deallocate_storage(data_.first_, capacity());
+            }
+
+            SFL_RETHROW;
+        }
+    }
+
+    void initialize_copy(const small_unordered_flat_hash_map& other)
+    {
+        const size_type n = other.size();
+
+        check_size(n, "sfl::small_unordered_flat_hash_map::initialize_copy");
+
+        if (n > N)
+        {
+            data_.first_ = allocate_storage(n);
+            data_.last_  = data_.first_;
+            data_.eos_   = data_.first_ + n;
+        }
+
+        SFL_TRY
+        {
+            data_.last_ = sfl::dtl::uninitialized_copy_a
+            (
+                data_.ref_to_alloc(),
+                other.data_.first_,
+                other.data_.last_,
+                data_.first_
+            );
+        }
+        SFL_CATCH (...)
+        {
+            if (n > N)
+            {
+                deallocate_storage(data_.first_, n);
+            }
+
+            SFL_RETHROW;
+        }
+
+        other.copy_fingerprints_to(fingerprints());
+
+        index_copy(other);
+    }
+
+    void initialize_move(small_unordered_flat_hash_map& other)
+    {
+        if (other.data_.first_ == other.data_.internal_storage())
+        {
+            data_.last_ = sfl::dtl::uninitialized_move_a
+            (
+                data_.ref_to_alloc(),
+                other.data_.first_,
+                other.data_.last_,
+                data_.first_
+            );
+
+            other.copy_fingerprints_to(fingerprints());
+
+            index_take(other);
+
+            // Keys of moved-from elements may not match their fingerprints.
+            other.clear();
+        }
+        else if (data_.ref_to_alloc() == other.data_.ref_to_alloc())
+        {
+            data_.first_ = other.data_.first_;
+            data_.last_  = other.data_.last_;
+            data_.eos_   = other.data_.eos_;
+
+            other.data_.first_ = nullptr;
+            other.data_.last_  = nullptr;
+            other.data_.eos_   = nullptr;
+
+            index_steal(other);
+        }
+        else
+        {
+            const size_type n = other.size();
+
+            check_size(n, "sfl::small_unordered_flat_hash_map::initialize_move");
+
+            if (n > N)
+            {
+                data_.first_ = allocate_storage(n);
+                data_.last_  = data_.first_;
+                data_.eos_   = data_.first_ + n;
+            }
+
+            SFL_TRY
+            {
+                data_.last_ = sfl::dtl::uninitialized_move_a
+                (
+                    data_.ref_to_alloc(),
+                    other.data_.first_,
+                    other.data_.last_,
+                    data_.first_
+                );
+            }
+            SFL_CATCH (...)
+            {
+                if (n > N)
+                {
+                    deallocate_storage(data_.first_, n);
+                }
+
+                SFL_RETHROW;
+            }
+
+            other.copy_fingerprints_to(fingerprints());
+
+            index_copy(other);
+
+            // Keys of moved-from elements may not match their fingerprints.
+            other.clear();
+        }
+    }
+
+    // Assigns elements from range [first, last) and their fingerprints
+    // from array `fps`. If an exception is thrown, the container is cleared
+    // because fingerprints would not match elements anymore.
+    template <typename ForwardIt>
+    void assign_range(ForwardIt first, ForwardIt last, const unsigned char* fps)
+    {
+        const size_type n = std::distance(first, last);
+
+        check_size(n, "sfl::small_unordered_flat_hash_map::assign_range");
+
+        SFL_TRY
+        {
+            if (n <= capacity())
+            {
+                const size_type s = size();
+
+                if (n <= s)
+                {
+                    pointer new_last = sfl::dtl::copy
+                    (
+                        first,
+                        last,
+                        data_.first_
+                    );
+
+                    sfl::dtl::destroy_a
+                    (
+                        data_.ref_to_alloc(),
+                        new_last,
+                        data_.last_
+                    );
+
+                    data_.last_ = new_last;
+                }
+                else
+                {
+                    ForwardIt mid = std::next(first, s);
+
+                    sfl::dtl::copy
+                    (
+                        first,
+                        mid,
+                        data_.first_
+                    );
+
+                    data_.last_ = sfl::dtl::uninitialized_copy_a
+                    (
+                        data_.ref_to_alloc(),
+                        mid,
+                        last,
+                        data_.last_
+                    );
+                }
+            }
+            else
+            {
+                reset(n);
+
+                data_.last_ = sfl::dtl::uninitialized_copy_a
+                (
+                    data_.ref_to_alloc(),
+                    first,
+                    last,
+                    data_.first_
+                );
+            }
+        }
+        SFL_CATCH (...)
+        {
+            clear();
+            SFL_RETHROW;
+        }
+
+        copy_fingerprints(fingerprints(), fps, n);
+    }
+
+    void assign_copy(const small_unordered_flat_hash_map& other)
+    {
+        if (this != &other)
+        {
+            index_drop();
+
+            if (allocator_traits::propagate_on_container_copy_assignment::value)
+            {
+                if (data_.ref_to_alloc() != other.data_.ref_to_alloc())
+                {
+                    reset();
+                }
+
+                data_.ref_to_alloc() = other.data_.ref_to_alloc();
+            }
+
+            data_.ref_to_hash() = other.data_.ref_to_hash();
+            data_.ref_to_equal() = other.data_.ref_to_equal();
+
+            assign_range(other.data_.first_, other.data_.last_, other.fingerprints());
+
+            index_copy(other);
+        }
+    }
+
+    void assign_move(small_unordered_flat_hash_map& other)
+    {
+        index_drop();
+
+        if (allocator_traits::propagate_on_container_move_assignment::value)
+        {
+            if (data_.ref_to_alloc() != other.data_.ref_to_alloc())
+            {
+                reset();
+            }
+
+            data_.ref_to_alloc() = std::move(other.data_.ref_to_alloc());
+        }
+
+        data_.ref_to_hash() = other.data_.ref_to_hash();
+        data_.ref_to_equal() = other.data_.ref_to_equal();
+
+        if (other.data_.first_ == other.data_.internal_storage())
+        {
+            assign_range
+            (
+                std::make_move_iterator(other.data_.first_),
+                std::make_move_iterator(other.data_.last_),
+                other.fingerprints()
+            );
+
+            index_take(other);
+
+            // Keys of moved-from elements may not match their fingerprints.
+            other.clear();
+        }
+        else if (data_.ref_to_alloc() == other.data_.ref_to_alloc())
+        {
+            reset();
+
+            data_.first_ = other.data_.first_;
+            data_.last_  = other.data_.last_;
+            data_.eos_   = other.data_.eos_;
+
+            other.data_.first_ = nullptr;
+            other.data_.last_  = nullptr;
+            other.data_.eos_   = nullptr;
+
+            index_steal(other);
+        }
+        else
+        {
+            assign_range
+            (
+                std::make_move_iterator(other.data_.first_),
+                std::make_move_iterator(other.data_.last_),
+                other.fingerprints()
+            );
+
+            index_take(other);
+
+            // Keys of moved-from elements may not match their fingerprints.
+            other.clear();
+        }
+    }
+
+    // Key is taken from arguments and searched for before the element is
+    // constructed, so nothing is constructed if the key already exists.
+    template <typename... Args,
+              sfl::dtl::enable_if_t<sfl::dtl::is_map_key_extractable<Key, Args...>::value>* = nullptr>
+    std::pair<iterator, bool> emplace_aux(Args&&... args)
+    {
+        const Key& key = sfl::dtl::extract_map_key(args...);
+
+        const unsigned long long h = data_.ref_to_hash().mixed_hash(key);
+
+        const pointer p = find_aux(key, h);
+
+        if (p == data_.last_)
+        {
+            return std::make_pair(emplace_back_hashed(h, std::forward<Args>(args)...), true);
+        }
+
+        return std::make_pair(iterator(p), false);
+    }
+
+    template <typename... Args,
+              sfl::dtl::enable_if_t<!sfl::dtl::is_map_key_extractable<Key, Args...>::value>* = nullptr>
+    std::pair<iterator, bool> emplace_aux(Args&&... args)
+    {
+        // Element is constructed first because its key is not known before.
+        // It is indexed only if it turns out to be unique.
+
+        const iterator it1 = emplace_back_aux(std::forward<Args>(args)...);
+
+        const size_type pos = index_of(it1);
+
+        iterator it2;
+
+        unsigned long long h = 0;
+
+        SFL_TRY
+        {
+            h = data_.ref_to_hash().mixed_hash(it1->first);
+
+            fingerprints()[pos] = sfl::dtl::hash_fingerprint(h);
+
+            it2 = iterator(find_aux(it1->first, h, pos));
+        }
+        SFL_CATCH (...)
+        {
+            pop_back();
+            SFL_RETHROW;
+        }
+
+        if (it1 != it2)
+        {
+            pop_back();
+            return std::make_pair(it2, false);
+        }
+
+        index_after_append(pos, h);
+
+        return std::make_pair(it1, true);
+    }
+
+    template <typename... Args>
+    iterator emplace_hint_aux(const_iterator hint, Args&&... args)
+    {
+        sfl::dtl::ignore_unused(hint);
+        return emplace_aux(std::forward<Args>(args)...).first;
+    }
+
+    template <typename Value>
+    std::pair<iterator, bool> insert_aux(Value&& value)
+    {
+        const unsigned long long h = data_.ref_to_hash().mixed_hash(value.first);
+
+        const pointer p = find_aux(value.first, h);
+
+        if (p == data_.last_)
+        {
+            return std::make_pair(emplace_back_hashed(h, std::forward<Value>(value)), true);
+        }
+
+        return std::make_pair(iterator(p), false);
+    }
+
+    template <typename Value>
+    iterator insert_aux(const_iterator hint, Value&& value)
+    {
+        sfl::dtl::ignore_unused(hint);
+        return insert_aux(std::forward<Value>(value)).first;
+    }
+
+    template <typename K, typename M>
+    std::pair<iterator, bool> insert_or_assign_aux(K&& key, M&& obj)
+    {
+        const unsigned long long h = data_.ref_to_hash().mixed_hash(key);
+
+        const pointer p = find_aux(key, h);
+
+        if (p == data_.last_)
+        {
+            return std::make_pair
+            (
+                emplace_back_hashed
+                (
+                    h,
+                    std::piecewise_construct,
+                    std::forward_as_tuple(std::forward<K>(key)),
+                    std::forward_as_tuple(std::forward<M>(obj))
+                ),
+                true
+            );
+        }
+
+        p->second = std::forward<M>(obj);
+        return std::make_pair(iterator(p), false);
+    }
+
+    template <typename K, typename M>
+    iterator insert_or_assign_aux(const_iterator hint, K&& key, M&& obj)
+    {
+        sfl::dtl::ignore_unused(hint);
+        return insert_or_assign_aux(std::forward<K>(key), std::forward<M>(obj)).first;
+    }
+
+    template <typename K, typename... Args>
+    std::pair<iterator, bool> try_emplace_aux(K&& key, Args&&... args)
+    {
+        const unsigned long long h = data_.ref_to_hash().mixed_hash(key);
+
+        const pointer p = find_aux(key, h);
+
+        if (p == data_.last_)
+        {
+            return std::make_pair
+            (
+                emplace_back_hashed
+                (
+                    h,
+                    std::piecewise_construct,
+                    std::forward_as_tuple(std::forward<K>(key)),
+                    std::forward_as_tuple(std::forward<Args>(args)...)
+                ),
+                true
+            );
+        }
+
+        return std::make_pair(iterator(p), false);
+    }
+
+    template <typename K, typename... Args>
+    iterator try_emplace_aux(const_iterator hint, K&& key, Args&&... args)
+    {
+        sfl::dtl::ignore_unused(hint);
+        return try_emplace_aux(std::forward<K>(key), std::forward<Args>(args)...).first;
+    }
+
+    template <typename... Args>
+    iterator emplace_back(Args&&... args)
+    {
+        const iterator it = emplace_back_aux(std::forward<Args>(args)...);
+
+        unsigned long long h = 0;
+
+        SFL_TRY
+        {
+            h = data_.ref_to_hash().mixed_hash(it->first);
+        }
+        SFL_CATCH (...)
+        {
+            pop_back();
+            SFL_RETHROW;
+        }
+
+        const size_type pos = index_of(it);
+
+        fingerprints()[pos] = sfl::dtl::hash_fingerprint(h);
+
+        index_after_append(pos, h);
+
+        return it;
+    }
+
+    // Appends new element whose key has mixed hash value `h`.
+    template <typename... Args>
+    iterator emplace_back_hashed(unsigned long long h, Args&&... args)
+    {
+        const iterator it = emplace_back_aux(std::forward<Args>(args)...);
+
+        const size_type pos = index_of(it);
+
+        fingerprints()[pos] = sfl::dtl::hash_fingerprint(h);
+
+        index_after_append(pos, h);
+
+        return it;
+    }
+
+    // Appends new element. Its fingerprint is NOT set and it is NOT indexed.
+    template <typename... Args>
+    iterator emplace_back_aux(Args&&... args)
+    {
+        if (data_.last_ != data_.eos_)
+        {
+            const pointer old_last = data_.last_;
+
+            sfl::dtl::construct_at_a
+            (
+                data_.ref_to_alloc(),
+                data_.last_,
+                std::forward<Args>(args)...
+            );
+
+            ++data_.last_;
+
+            return iterator(old_last);
+        }
+        else
+        {
+            const size_type new_cap =
+                calculate_new_capacity(1, "sfl::small_unordered_flat_hash_map::emplace_back");
+
+            pointer new_first;
+            pointer new_last;
+            pointer new_eos;
+
+            if (new_cap <= N && data_.first_ != data_.internal_storage())
+            {
+                new_first = data_.internal_storage();
+                new_last  = new_first;
+                new_eos   = new_first + N;
+            }
+            else
+            {
+                new_first = allocate_storage(new_cap);
+                new_last  = new_first;
+                new_eos   = new_first + new_cap;
+            }
+
+            const pointer p = new_first + size();
+
+            SFL_TRY
+            {
+                sfl::dtl::construct_at_a
+                (
+                    data_.ref_to_alloc(),
+                    p,
+                    std::forward<Args>(args)...
+                );
+
+                new_last = nullptr;
+
+                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                (
+                    data_.ref_to_alloc(),
+                    data_.first_,
+                    data_.last_,
+                    new_first
+                );
+
+                ++new_last;
+            }
+            SFL_CATCH (...)
+            {
+                if (new_last == nullptr)
+                {
+                    sfl::dtl::destroy_at_a
+                    (
+                        data_.ref_to_alloc(),
+                        p
+                    );
+                }
+                else
+                {
+                    // Nothing to do
+                }
+
+                if (new_first != data_.internal_storage())
+                {
+                    deallocate_storage(new_first, new_cap);
+                }
+
+                SFL_RETHROW;
+            }
+
+            copy_fingerprints_to(data_.fingerprints_of(new_first, new_eos));
+
+            sfl::dtl::destroy_a
+            (
+                data_.ref_to_alloc(),
+                data_.first_,
+                data_.last_
+            );
+
+            if (data_.first_ != data_.internal_storage())
+            {
+                deallocate_storage(data_.first_, capacity());
+            }
+
+            data_.first_ = new_first;
+            data_.last_  = new_last;
+            data_.eos_   = new_eos;
+
+            return iterator(p);
+        }
+    }
+
+    void pop_back()
+    {
+        SFL_ASSERT(!empty());
+
+        --data_.last_;
+
+        sfl::dtl::destroy_at_a(data_.ref_to_alloc(), data_.last_);
+    }
+};
+
+//
+// ---- NON-MEMBER FUNCTIONS --------------------------------------------------
+//
+
+template <typename K, typename T, std::size_t N, typename H, typename E, typename A, std::size_t I>
+SFL_NODISCARD
+bool operator==
+(
+    const small_unordered_flat_hash_map<K, T, N, H, E, A, I>& x,
+    const small_unordered_flat_hash_map<K, T, N, H, E, A, I>& y
+)
+{
+    return x.size() == y.size() && std::is_permutation(x.begin(), x.end(), y.begin());
+}
+
+template <typename K, typename T, std::size_t N, typename H, typename E, typename A, std::size_t I>
+SFL_NODISCARD
+bool operator!=
+(
+    const small_unordered_flat_hash_map<K, T, N, H, E, A, I>& x,
+    const small_unordered_flat_hash_map<K, T, N, H, E, A, I>& y
+)
+{
+    return !(x == y);
+}
+
+template <typename K, typename T, std::size_t N, typename H, typename E, typename A, std::size_t I>
+void swap
+(
+    small_unordered_flat_hash_map<K, T, N, H, E, A, I>& x,
+    small_unordered_flat_hash_map<K, T, N, H, E, A, I>& y
+)
+{
+    x.swap(y);
+}
+
+template <typename K, typename T, std::size_t N, typename H, typename E, typename A, std::size_t I,
+          typename Predicate>
+typename small_unordered_flat_hash_map<K, T, N, H, E, A, I>::size_type
+    erase_if(small_unordered_flat_hash_map<K, T, N, H, E, A, I>& c, Predicate pred)
+{
+    auto old_size = c.size();
+
+    for (auto it = c.begin(); it != c.end(); )
+    {
+        if (pred(*it))
+        {
+            it = c.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    return old_size - c.size();
+}
+
+} // namespace sfl
+
+#endif // SFL_SMALL_UNORDERED_FLAT_HASH_MAP_HPP_INCLUDED
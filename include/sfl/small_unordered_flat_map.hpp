@@ -22,8 +22,9 @@
 #define SFL_SMALL_UNORDERED_FLAT_MAP_HPP_INCLUDED
 
 #include "private.hpp"
+#include "vector.hpp"
 
-#include <algorithm>        // copy, move, lower_bound, swap, swap_ranges
+#include <algorithm>        // copy, move, lower_bound, rotate, swap, swap_ranges
 #include <cstddef>          // size_t
 #include <functional>       // equal_to, less
 #include <initializer_list> // initializer_list
@@ -854,11 +855,7 @@ public:
               sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
     void insert(InputIt first, InputIt last)
     {
-        while (first != last)
-        {
-            insert(*first);
-            ++first;
-        }
+        insert_range_aux(first, last, is_bulk_insertable<InputIt>());
     }
 
     void insert(std::initializer_list<value_type> ilist)
@@ -1225,36 +1222,103 @@ public:
         }
     }
 
-    //
-    // ---- LOOKUP ------------------------------------------------------------
-    //
-
-    SFL_NODISCARD
-    iterator find(const Key& key)
+    // Moves all elements into a vector and leaves the container empty.
+    // Dynamically allocated storage is handed over to the vector as is.
+    sfl::vector<value_type, Allocator> extract()
     {
-        for (auto it = begin(); it != end(); ++it)
+        sfl::vector<value_type, Allocator> result(data_.ref_to_alloc());
+
+        if (data_.first_ == data_.internal_storage())
         {
-            if (data_.ref_to_equal()(*it, key))
+            const size_type n = size();
+
+            if (n != 0)
             {
-                return it;
+                const pointer new_first = sfl::dtl::allocate(data_.ref_to_alloc(), n);
+
+                pointer new_last = new_first;
+
+                SFL_TRY
+                {
+                    new_last = sfl::dtl::uninitialized_move_a
+                    (
+                        data_.ref_to_alloc(),
+                        data_.first_,
+                        data_.last_,
+                        new_first
+                    );
+                }
+                SFL_CATCH (...)
+                {
+                    sfl::dtl::deallocate(data_.ref_to_alloc(), new_first, n);
+                    SFL_RETHROW;
+                }
+
+                sfl::dtl::vector_access::adopt(result, new_first, new_last, new_first + n);
+
+                clear();
             }
         }
+        else
+        {
+            sfl::dtl::vector_access::adopt(result, data_.first_, data_.last_, data_.eos_);
 
-        return end();
+            data_.first_ = data_.internal_storage();
+            data_.last_  = data_.first_;
+            data_.eos_   = data_.first_ + N;
+        }
+
+        return result;
     }
 
-    SFL_NODISCARD
-    const_iterator find(const Key& key) const
+    // Replaces all elements with elements of `cont`. Elements that fit into
+    // internal storage are moved there. Otherwise, if allocators compare
+    // equal, storage of `cont` is taken over as is.
+    void replace(sfl::vector<value_type, Allocator>&& cont)
     {
-        for (auto it = begin(); it != end(); ++it)
+        SFL_ASSERT(sfl::dtl::is_unique(cont.begin(), cont.end(), data_.ref_to_equal()));
+
+        if (cont.size() > N && cont.get_allocator() == data_.ref_to_alloc())
         {
-            if (data_.ref_to_equal()(*it, key))
+            reset();
+
+            sfl::dtl::vector_access::release(cont, data_.first_, data_.last_, data_.eos_);
+        }
+        else
+        {
+            if (cont.size() <= N)
             {
-                return it;
+                reset();
+            }
+            else
+            {
+                clear();
             }
+
+            assign_range
+            (
+                std::make_move_iterator(cont.begin()),
+                std::make_move_iterator(cont.end())
+            );
+
+            cont.clear();
         }
+    }
 
-        return end();
+    //
+    // ---- LOOKUP ------------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    iterator find(const Key& key)
+    {
+        return nth(find_index(key));
+    }
+
+    SFL_NODISCARD
+    const_iterator find(const Key& key) const
+    {
+        return nth(find_index(key));
     }
 
     template <typename K,
@@ -1317,6 +1381,63 @@ public:
         return find(x) != end();
     }
 
+    // Batched lookup. For each key in range [first, last), in order, writes
+    // `find(key)` into `out`. Integral, enumeration and pointer keys compared
+    // using `std::equal_to` are hashed, and elements are scanned once per
+    // batch of up to 64 keys.
+    template <typename ForwardIt, typename OutputIt>
+    OutputIt find_many(ForwardIt first, ForwardIt last, OutputIt out)
+    {
+        find_many_aux(first, last, [&](size_type i) { *out = nth(i); ++out; });
+        return out;
+    }
+
+    template <typename ForwardIt, typename OutputIt>
+    OutputIt find_many(ForwardIt first, ForwardIt last, OutputIt out) const
+    {
+        find_many_aux(first, last, [&](size_type i) { *out = nth(i); ++out; });
+        return out;
+    }
+
+    // Batched lookup. For each key in range [first, last), in order, writes
+    // `contains(key)` into `out`.
+    template <typename ForwardIt, typename OutputIt>
+    OutputIt contains_many(ForwardIt first, ForwardIt last, OutputIt out) const
+    {
+        const size_type n = size();
+        find_many_aux(first, last, [&](size_type i) { *out = i != n; ++out; });
+        return out;
+    }
+
+    // Self-organizing lookup. If the element is found, it is moved one
+    // position toward the beginning (transpose) or to the beginning
+    // (move-to-front), so frequently searched elements are found sooner.
+    // Returns iterator to the element at its new position, or `end()`.
+
+    iterator find_and_transpose(const Key& key)
+    {
+        return transpose_aux(find_index(key));
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<KeyEqual, K>::value>* = nullptr>
+    iterator find_and_transpose(const K& x)
+    {
+        return transpose_aux(index_of(find(x)));
+    }
+
+    iterator find_and_move_to_front(const Key& key)
+    {
+        return move_to_front_aux(find_index(key));
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<KeyEqual, K>::value>* = nullptr>
+    iterator find_and_move_to_front(const K& x)
+    {
+        return move_to_front_aux(index_of(find(x)));
+    }
+
     //
     // ---- ELEMENT ACCESS ----------------------------------------------------
     //
@@ -1411,6 +1532,103 @@ public:
 
 private:
 
+    // Keys can be searched for using SIMD instructions if they are integral,
+    // enumeration or pointer keys compared using `std::equal_to` and if
+    // mapped values have the same size as keys, so keys are evenly strided.
+    using is_simd_searchable = std::integral_constant
+    <
+        bool,
+        sfl::dtl::is_simd_searchable<Key, KeyEqual>::value &&
+        std::is_standard_layout<value_type>::value &&
+        sizeof(value_type) == 2 * sizeof(Key)
+    >;
+
+    // Calls `fn(find_index(key))` for each key in range [first, last).
+    template <typename ForwardIt, typename Function>
+    void find_many_aux(ForwardIt first, ForwardIt last, Function&& fn) const
+    {
+        const value_type* elements = sfl::dtl::to_address(data_.first_);
+
+        sfl::dtl::find_many<Key>
+        (
+            static_cast<const key_equal&>(data_.ref_to_equal()),
+            size(),
+            [elements](size_type i) -> const Key& { return elements[i].first; },
+            [this](const Key& key) { return find_index(key); },
+            first,
+            last,
+            std::forward<Function>(fn)
+        );
+    }
+
+    // Returns index of the element with key equivalent to `key`, or `size()`
+    // if there is no such element.
+    size_type find_index(const Key& key) const
+    {
+        return find_index(key, is_simd_searchable());
+    }
+
+    size_type find_index(const Key& key, std::true_type) const noexcept
+    {
+        return sfl::dtl::find_equal<2>
+        (
+            reinterpret_cast<const Key*>(sfl::dtl::to_address(data_.first_)),
+            size(),
+            key
+        );
+    }
+
+    size_type find_index(const Key& key, std::false_type) const
+    {
+        const value_type* first = sfl::dtl::to_address(data_.first_);
+
+        const size_type n = size();
+
+        for (size_type i = 0; i < n; ++i)
+        {
+            if (data_.ref_to_equal()(first[i], key))
+            {
+                return i;
+            }
+        }
+
+        return n;
+    }
+
+    // Swaps the element at position `i` with its predecessor.
+    // Returns iterator to the new position of the element, or `end()`.
+    iterator transpose_aux(size_type i)
+    {
+        if (i != 0 && i < size())
+        {
+            value_type* const p = sfl::dtl::to_address(data_.first_) + i;
+
+            using std::swap;
+            swap(*(p - 1), *p);
+
+            --i;
+        }
+
+        return nth(i);
+    }
+
+    // Moves the element at position `i` to the beginning, preserving the
+    // relative order of the other elements.
+    // Returns iterator to the new position of the element, or `end()`.
+    iterator move_to_front_aux(size_type i)
+    {
+        if (i != 0 && i < size())
+        {
+            value_type* const first = sfl::dtl::to_address(data_.first_);
+
+            std::rotate(first, first + i, first + i + 1);
+
+            i = 0;
+        }
+
+        return nth(i);
+    }
+
     void check_size(size_type n, const char* msg)
     {
         if (n > max_size())
@@ -1482,11 +1700,7 @@ private:
     {
         SFL_TRY
         {
-            while (first != last)
-            {
-                insert(*first);
-                ++first;
-            }
+            insert(first, last);
         }
         SFL_CATCH (...)
         {
@@ -1729,7 +1943,26 @@ private:
         }
     }
 
-    template <typename... Args>
+    // Key is taken from arguments and searched for before the element is
+    // constructed, so nothing is constructed if the key already exists.
+    template <typename... Args,
+              sfl::dtl::enable_if_t<sfl::dtl::is_map_key_extractable<Key, Args...>::value>* = nullptr>
+    std::pair<iterator, bool> emplace_aux(Args&&... args)
+    {
+        const auto it = find(sfl::dtl::extract_map_key(args...));
+
+        if (it == end())
+        {
+            return std::make_pair(emplace_back(std::forward<Args>(args)...), true);
+        }
+
+        return std::make_pair(it, false);
+    }
+
+    // Key cannot be taken from arguments, so the element is constructed at
+    // the end first and removed if its key already exists.
+    template <typename... Args,
+              sfl::dtl::enable_if_t<!sfl::dtl::is_map_key_extractable<Key, Args...>::value>* = nullptr>
     std::pair<iterator, bool> emplace_aux(Args&&... args)
     {
         const auto it1 = emplace_back(std::forward<Args>(args)...);
@@ -1752,6 +1985,85 @@ private:
         return emplace_aux(std::forward<Args>(args)...).first;
     }
 
+    using index_allocator = typename allocator_traits::template rebind_alloc<size_type>;
+
+    // Forward ranges are inserted in bulk if keys are integral, enumeration
+    // or pointer types compared using `std::equal_to`, or if they are
+    // compared using `std::equal_to` and `std::hash<Key>` is enabled.
+    template <typename InputIt>
+    using is_bulk_insertable = std::integral_constant
+    <
+        bool,
+        sfl::dtl::is_forward_iterator<InputIt>::value &&
+        sfl::dtl::is_hash_searchable<Key, KeyEqual>::value &&
+        (
+            std::is_same<typename std::iterator_traits<InputIt>::value_type, value_type>::value ||
+            std::is_same<typename std::iterator_traits<InputIt>::value_type, std::pair<const Key, T>>::value
+        )
+    >;
+
+    template <typename InputIt>
+    void insert_range_aux(InputIt first, InputIt last, std::false_type)
+    {
+        reserve_range(first, last, sfl::dtl::is_forward_iterator<InputIt>());
+
+        while (first != last)
+        {
+            insert(*first);
+            ++first;
+        }
+    }
+
+    template <typename InputIt>
+    void reserve_range(InputIt /*first*/, InputIt /*last*/, std::false_type)
+    {}
+
+    // Forward ranges whose keys cannot be hashed are still inserted one by
+    // one, but storage is reserved only once.
+    template <typename ForwardIt>
+    void reserve_range(ForwardIt first, ForwardIt last, std::true_type)
+    {
+        const size_type m = std::distance(first, last);
+
+        reserve(size() + std::min(m, max_size() - size()));
+    }
+
+    // Reserves storage once and finds duplicates of existing and preceding
+    // elements using temporary hash table, so inserting `m` elements costs
+    // O(size() + m) instead of O(size() * m).
+    template <typename ForwardIt>
+    void insert_range_aux(ForwardIt first, ForwardIt last, std::true_type)
+    {
+        using reference = typename std::iterator_traits<ForwardIt>::reference;
+
+        const size_type m = std::distance(first, last);
+
+        if (m <= sfl::dtl::find_many_hash_threshold)
+        {
+            insert_range_aux(first, last, std::false_type());
+            return;
+        }
+
+        reserve(size() + std::min(m, max_size() - size()));
+
+        const value_type* const elements = sfl::dtl::to_address(data_.first_);
+
+        index_allocator alloc(data_.ref_to_alloc());
+
+        sfl::dtl::insert_unique_hashed<Key>
+        (
+            static_cast<const key_equal&>(data_.ref_to_equal()),
+            alloc,
+            size(),
+            m,
+            [elements](size_type i) -> const Key& { return elements[i].first; },
+            [](reference x) -> const Key& { return x.first; },
+            [this](reference x) { emplace_back(std::forward<reference>(x)); },
+            first,
+            last
+        );
+    }
+
     template <typename Value>
     std::pair<iterator, bool> insert_aux(Value&& value)
     {
@@ -22,6 +22,7 @@
 #define SFL_SMALL_UNORDERED_FLAT_MULTISET_HPP_INCLUDED
 
 #include "private.hpp"
+#include "vector.hpp"
 
 #include <algorithm>        // copy, move, lower_bound, swap, swap_ranges
 #include <cstddef>          // size_t
@@ -1054,36 +1055,101 @@ public:
         }
     }
 
-    //
-    // ---- LOOKUP ------------------------------------------------------------
-    //
-
-    SFL_NODISCARD
-    iterator find(const Key& key)
+    // Moves all elements into a vector and leaves the container empty.
+    // Dynamically allocated storage is handed over to the vector as is.
+    sfl::vector<value_type, Allocator> extract()
     {
-        for (auto it = begin(); it != end(); ++it)
+        sfl::vector<value_type, Allocator> result(data_.ref_to_alloc());
+
+        if (data_.first_ == data_.internal_storage())
         {
-            if (data_.ref_to_equal()(*it, key))
+            const size_type n = size();
+
+            if (n != 0)
             {
-                return it;
+                const pointer new_first = sfl::dtl::allocate(data_.ref_to_alloc(), n);
+
+                pointer new_last = new_first;
+
+                SFL_TRY
+                {
+                    new_last = sfl::dtl::uninitialized_move_a
+                    (
+                        data_.ref_to_alloc(),
+                        data_.first_,
+                        data_.last_,
+                        new_first
+                    );
+                }
+                SFL_CATCH (...)
+                {
+                    sfl::dtl::deallocate(data_.ref_to_alloc(), new_first, n);
+                    SFL_RETHROW;
+                }
+
+                sfl::dtl::vector_access::adopt(result, new_first, new_last, new_first + n);
+
+                clear();
             }
         }
+        else
+        {
+            sfl::dtl::vector_access::adopt(result, data_.first_, data_.last_, data_.eos_);
 
-        return end();
+            data_.first_ = data_.internal_storage();
+            data_.last_  = data_.first_;
+            data_.eos_   = data_.first_ + N;
+        }
+
+        return result;
     }
 
-    SFL_NODISCARD
-    const_iterator find(const Key& key) const
+    // Replaces all elements with elements of `cont`. Elements that fit into
+    // internal storage are moved there. Otherwise, if allocators compare
+    // equal, storage of `cont` is taken over as is.
+    void replace(sfl::vector<value_type, Allocator>&& cont)
     {
-        for (auto it = begin(); it != end(); ++it)
+        if (cont.size() > N && cont.get_allocator() == data_.ref_to_alloc())
         {
-            if (data_.ref_to_equal()(*it, key))
+            reset();
+
+            sfl::dtl::vector_access::release(cont, data_.first_, data_.last_, data_.eos_);
+        }
+        else
+        {
+            if (cont.size() <= N)
             {
-                return it;
+                reset();
+            }
+            else
+            {
+                clear();
             }
+
+            assign_range
+            (
+                std::make_move_iterator(cont.begin()),
+                std::make_move_iterator(cont.end())
+            );
+
+            cont.clear();
         }
+    }
 
-        return end();
+    //
+    // ---- LOOKUP ------------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    iterator find(const Key& key)
+    {
+        return nth(find_index(key));
+    }
+
+    SFL_NODISCARD
+    const_iterator find(const Key& key) const
+    {
+        return nth(find_index(key));
     }
 
     template <typename K,
@@ -1166,6 +1232,34 @@ public:
         return find(x) != end();
     }
 
+    // Batched lookup. For each key in range [first, last), in order, writes
+    // `find(key)` into `out`. Integral, enumeration and pointer keys compared
+    // using `std::equal_to` are hashed, and elements are scanned once per
+    // batch of up to 64 keys.
+    template <typename ForwardIt, typename OutputIt>
+    OutputIt find_many(ForwardIt first, ForwardIt last, OutputIt out)
+    {
+        find_many_aux(first, last, [&](size_type i) { *out = nth(i); ++out; });
+        return out;
+    }
+
+    template <typename ForwardIt, typename OutputIt>
+    OutputIt find_many(ForwardIt first, ForwardIt last, OutputIt out) const
+    {
+        find_many_aux(first, last, [&](size_type i) { *out = nth(i); ++out; });
+        return out;
+    }
+
+    // Batched lookup. For each key in range [first, last), in order, writes
+    // `contains(key)` into `out`.
+    template <typename ForwardIt, typename OutputIt>
+    OutputIt contains_many(ForwardIt first, ForwardIt last, OutputIt out) const
+    {
+        const size_type n = size();
+        find_many_aux(first, last, [&](size_type i) { *out = i != n; ++out; });
+        return out;
+    }
+
     //
     // ---- ELEMENT ACCESS ----------------------------------------------------
     //
@@ -1184,6 +1278,54 @@ public:
 
 private:
 
+    // Calls `fn(find_index(key))` for each key in range [first, last).
+    template <typename ForwardIt, typename Function>
+    void find_many_aux(ForwardIt first, ForwardIt last, Function&& fn) const
+    {
+        const value_type* elements = sfl::dtl::to_address(data_.first_);
+
+        sfl::dtl::find_many<Key>
+        (
+            static_cast<const key_equal&>(data_.ref_to_equal()),
+            size(),
+            [elements](size_type i) -> const Key& { return elements[i]; },
+            [this](const Key& key) { return find_index(key); },
+            first,
+            last,
+            std::forward<Function>(fn)
+        );
+    }
+
+    // Returns index of the element equivalent to `key`, or `size()` if there
+    // is no such element. Integral, enumeration and pointer keys compared
+    // using `std::equal_to` are searched for using SIMD instructions.
+    size_type find_index(const Key& key) const
+    {
+        return find_index(key, sfl::dtl::is_simd_searchable<Key, KeyEqual>());
+    }
+
+    size_type find_index(const Key& key, std::true_type) const noexcept
+    {
+        return sfl::dtl::find_equal<1>(sfl::dtl::to_address(data_.first_), size(), key);
+    }
+
+    size_type find_index(const Key& key, std::false_type) const
+    {
+        const value_type* first = sfl::dtl::to_address(data_.first_);
+
+        const size_type n = size();
+
+        for (size_type i = 0; i < n; ++i)
+        {
+            if (data_.ref_to_equal()(first[i], key))
+            {
+                return i;
+            }
+        }
+
+        return n;
+    }
+
     void check_size(size_type n, const char* msg)
     {
         if (n > max_size())
@@ -0,0 +1,2080 @@
+//
+// Copyright (c) 2022 Slaven Falandys
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+//
+
+#ifndef SFL_SMALL_UNORDERED_FLAT_SPLIT_MAP_HPP_INCLUDED
+#define SFL_SMALL_UNORDERED_FLAT_SPLIT_MAP_HPP_INCLUDED
+
+#include "private.hpp"
+#include "vector.hpp"
+
+#include <algorithm>        // copy, is_permutation, max, min, move, swap, swap_ranges
+#include <cstddef>          // size_t
+#include <functional>       // equal_to
+#include <initializer_list> // initializer_list
+#include <iterator>         // distance, make_move_iterator, next
+#include <limits>           // numeric_limits
+#include <memory>           // allocator, allocator_traits, pointer_traits
+#include <type_traits>      // is_same, is_nothrow_xxxxx
+#include <utility>          // forward, move, pair
+
+#ifdef SFL_TEST_SMALL_UNORDERED_FLAT_SPLIT_MAP
+template <int>
+void test_small_unordered_flat_split_map();
+#endif
+
+namespace sfl
+{
+
+template < typename Key,
+           typename T,
+           std::size_t N,
+           typename KeyEqual = std::equal_to<Key>,
+           typename Allocator = std::allocator<std::pair<Key, T>> >
+class small_unordered_flat_split_map
+{
+    #ifdef SFL_TEST_SMALL_UNORDERED_FLAT_SPLIT_MAP
+    template <int>
+    friend void ::test_small_unordered_flat_split_map();
+    #endif
+
+public:
+
+    using allocator_type   = Allocator;
+    using allocator_traits = std::allocator_traits<allocator_type>;
+    using key_type         = Key;
+    using mapped_type      = T;
+    using value_type       = std::pair<Key, T>;
+    using size_type        = typename allocator_traits::size_type;
+    using difference_type  = typename allocator_traits::difference_type;
+    using key_equal        = KeyEqual;
+    using reference        = std::pair<const Key&, T&>;
+    using const_reference  = std::pair<const Key&, const T&>;
+    using iterator         = sfl::dtl::split_iterator<Key, T, small_unordered_flat_split_map>;
+    using const_iterator   = sfl::dtl::split_iterator<Key, const T, small_unordered_flat_split_map>;
+
+    class value_equal : protected key_equal
+    {
+        friend class small_unordered_flat_split_map;
+
+    private:
+
+        value_equal(const key_equal& e) : key_equal(e)
+        {}
+
+    public:
+
+        bool operator()(const_reference x, const_reference y) const
+        {
+            return key_equal::operator()(x.first, y.first);
+        }
+    };
+
+    static_assert
+    (
+        std::is_same<typename Allocator::value_type, value_type>::value,
+        "Allocator::value_type must be same as sfl::small_unordered_flat_split_map::value_type."
+    );
+
+public:
+
+    static constexpr size_type static_capacity = N;
+
+    using key_container_type    = sfl::vector<Key, typename allocator_traits::template rebind_alloc<Key>>;
+    using mapped_container_type = sfl::vector<T, typename allocator_traits::template rebind_alloc<T>>;
+
+    // Keys and mapped values moved out of the container by `extract`.
+    struct containers
+    {
+        key_container_type    keys;
+        mapped_container_type values;
+    };
+
+private:
+
+    //
+    // Keys and mapped values are stored in two separate arrays in the same
+    // memory block. The array of keys is at the beginning of the block and
+    // the array of mapped values follows it (suitably aligned).
+    //
+    // Memory block for `n` elements is allocated as storage for `n` objects
+    // of type `value_type`, which is always enough because
+    // sizeof(value_type) >= round_up(sizeof(Key), alignof(T)) + sizeof(T).
+    //
+
+    using storage_pointer = typename allocator_traits::pointer;
+
+    template <bool WithInternalStorage = true, typename = void>
+    class data_base
+    {
+    private:
+
+        union
+        {
+            value_type internal_storage_[N];
+        };
+
+    public:
+
+        storage_pointer first_;
+        size_type       size_;
+        size_type       capacity_;
+
+        data_base() noexcept
+            : first_(std::pointer_traits<storage_pointer>::pointer_to(*internal_storage_))
+            , size_(0)
+            , capacity_(N)
+        {}
+
+        #if defined(__clang__) && (__clang_major__ == 3) // For CentOS 7
+        ~data_base()
+        {}
+        #else
+        ~data_base() noexcept
+        {}
+        #endif
+
+        storage_pointer internal_storage() noexcept
+        {
+            return std::pointer_traits<storage_pointer>::pointer_to(*internal_storage_);
+        }
+    };
+
+    template <typename Dummy>
+    class data_base<false, Dummy>
+    {
+    public:
+
+        storage_pointer first_;
+        size_type       size_;
+        size_type       capacity_;
+
+        data_base() noexcept
+            : first_(nullptr)
+            , size_(0)
+            , capacity_(0)
+        {}
+
+        storage_pointer internal_storage() noexcept
+        {
+            return nullptr;
+        }
+    };
+
+    class data : public data_base<(N > 0)>, public allocator_type, public key_equal
+    {
+    public:
+
+        data() noexcept
+        (
+            std::is_nothrow_default_constructible<allocator_type>::value &&
+            std::is_nothrow_default_constructible<key_equal>::value
+        )
+            : allocator_type()
+            , key_equal()
+        {}
+
+        data(const key_equal& equal) noexcept
+        (
+            std::is_nothrow_default_constructible<allocator_type>::value &&
+            std::is_nothrow_copy_constructible<key_equal>::value
+        )
+            : allocator_type()
+            , key_equal(equal)
+        {}
+
+        data(const allocator_type& alloc) noexcept
+        (
+            std::is_nothrow_copy_constructible<allocator_type>::value &&
+            std::is_nothrow_default_constructible<key_equal>::value
+        )
+            : allocator_type(alloc)
+            , key_equal()
+        {}
+
+        data(const key_equal& equal, const allocator_type& alloc) noexcept
+        (
+            std::is_nothrow_copy_constructible<allocator_type>::value &&
+            std::is_nothrow_copy_constructible<key_equal>::value
+        )
+            : allocator_type(alloc)
+            , key_equal(equal)
+        {}
+
+        data(key_equal&& equal, allocator_type&& alloc) noexcept
+        (
+            std::is_nothrow_move_constructible<allocator_type>::value &&
+            std::is_nothrow_move_constructible<key_equal>::value
+        )
+            : allocator_type(std::move(alloc))
+            , key_equal(std::move(equal))
+        {}
+
+        data(key_equal&& equal, const allocator_type& alloc) noexcept
+        (
+            std::is_nothrow_copy_constructible<allocator_type>::value &&
+            std::is_nothrow_move_constructible<key_equal>::value
+        )
+            : allocator_type(alloc)
+            , key_equal(std::move(equal))
+        {}
+
+        allocator_type& ref_to_alloc() noexcept
+        {
+            return *this;
+        }
+
+        const allocator_type& ref_to_alloc() const noexcept
+        {
+            return *this;
+        }
+
+        key_equal& ref_to_equal() noexcept
+        {
+            return *this;
+        }
+
+        const key_equal& ref_to_equal() const noexcept
+        {
+            return *this;
+        }
+
+        // Returns pointer to the first key in the block that starts at `first`.
+        static Key* keys_of(storage_pointer first) noexcept
+        {
+            return reinterpret_cast<Key*>(sfl::dtl::to_address(first));
+        }
+
+        // Returns pointer to the first mapped value in the block that starts
+        // at `first` and has capacity for `cap` elements.
+        static T* mapped_of(storage_pointer first, size_type cap) noexcept
+        {
+            const size_type offset =
+                (cap * sizeof(Key) + alignof(T) - 1) / alignof(T) * alignof(T);
+
+            return reinterpret_cast<T*>
+            (
+                reinterpret_cast<unsigned char*>(sfl::dtl::to_address(first)) + offset
+            );
+        }
+
+        Key* keys() const noexcept
+        {
+            return keys_of(this->first_);
+        }
+
+        T* mapped() const noexcept
+        {
+            return mapped_of(this->first_, this->capacity_);
+        }
+    };
+
+    data data_;
+
+public:
+
+    //
+    // ---- CONSTRUCTION AND DESTRUCTION --------------------------------------
+    //
+
+    small_unordered_flat_split_map() noexcept
+    (
+        std::is_nothrow_default_constructible<Allocator>::value &&
+        std::is_nothrow_default_constructible<KeyEqual>::value
+    )
+        : data_()
+    {}
+
+    explicit small_unordered_flat_split_map(const KeyEqual& equal) noexcept
+    (
+        std::is_nothrow_default_constructible<Allocator>::value &&
+        std::is_nothrow_copy_constructible<KeyEqual>::value
+    )
+        : data_(equal)
+    {}
+
+    explicit small_unordered_flat_split_map(const Allocator& alloc) noexcept
+    (
+        std::is_nothrow_copy_constructible<Allocator>::value &&
+        std::is_nothrow_default_constructible<KeyEqual>::value
+    )
+        : data_(alloc)
+    {}
+
+    explicit small_unordered_flat_split_map(const KeyEqual& equal,
+                                            const Allocator& alloc) noexcept
+    (
+        std::is_nothrow_copy_constructible<Allocator>::value &&
+        std::is_nothrow_copy_constructible<KeyEqual>::value
+    )
+        : data_(equal, alloc)
+    {}
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    small_unordered_flat_split_map(InputIt first, InputIt last)
+        : data_()
+    {
+        initialize_range(first, last);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    small_unordered_flat_split_map(InputIt first, InputIt last,
+                                   const KeyEqual& equal)
+        : data_(equal)
+    {
+        initialize_range(first, last);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    small_unordered_flat_split_map(InputIt first, InputIt last,
+                                   const Allocator& alloc)
+        : data_(alloc)
+    {
+        initialize_range(first, last);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    small_unordered_flat_split_map(InputIt first, InputIt last,
+                                   const KeyEqual& equal,
+                                   const Allocator& alloc)
+        : data_(equal, alloc)
+    {
+        initialize_range(first, last);
+    }
+
+    small_unordered_flat_split_map(std::initializer_list<value_type> ilist)
+        : small_unordered_flat_split_map(ilist.begin(), ilist.end())
+    {}
+
+    small_unordered_flat_split_map(std::initializer_list<value_type> ilist,
+                                   const KeyEqual& equal)
+        : small_unordered_flat_split_map(ilist.begin(), ilist.end(), equal)
+    {}
+
+    small_unordered_flat_split_map(std::initializer_list<value_type> ilist,
+                                   const Allocator& alloc)
+        : small_unordered_flat_split_map(ilist.begin(), ilist.end(), alloc)
+    {}
+
+    small_unordered_flat_split_map(std::initializer_list<value_type> ilist,
+                                   const KeyEqual& equal,
+                                   const Allocator& alloc)
+        : small_unordered_flat_split_map(ilist.begin(), ilist.end(), equal, alloc)
+    {}
+
+    small_unordered_flat_split_map(const small_unordered_flat_split_map& other)
+        : data_
+        (
+            other.data_.ref_to_equal(),
+            allocator_traits::select_on_container_copy_construction
+            (
+                other.data_.ref_to_alloc()
+            )
+        )
+    {
+        initialize_copy(other);
+    }
+
+    small_unordered_flat_split_map(const small_unordered_flat_split_map& other,
+                                   const Allocator& alloc)
+        : data_
+        (
+            other.data_.ref_to_equal(),
+            alloc
+        )
+    {
+        initialize_copy(other);
+    }
+
+    small_unordered_flat_split_map(small_unordered_flat_split_map&& other)
+        : data_
+        (
+            std::move(other.data_.ref_to_equal()),
+            std::move(other.data_.ref_to_alloc())
+        )
+    {
+        initialize_move(other);
+    }
+
+    small_unordered_flat_split_map(small_unordered_flat_split_map&& other,
+                                   const Allocator& alloc)
+        : data_
+        (
+            std::move(other.data_.ref_to_equal()),
+            alloc
+        )
+    {
+        initialize_move(other);
+    }
+
+    ~small_unordered_flat_split_map()
+    {
+        destroy_all();
+        deallocate_storage();
+    }
+
+    //
+    // ---- ASSIGNMENT --------------------------------------------------------
+    //
+
+    small_unordered_flat_split_map& operator=(const small_unordered_flat_split_map& other)
+    {
+        assign_copy(other);
+        return *this;
+    }
+
+    small_unordered_flat_split_map& operator=(small_unordered_flat_split_map&& other)
+    {
+        assign_move(other);
+        return *this;
+    }
+
+    small_unordered_flat_split_map& operator=(std::initializer_list<value_type> ilist)
+    {
+        clear();
+        insert(ilist.begin(), ilist.end());
+        return *this;
+    }
+
+    //
+    // ---- ALLOCATOR ---------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    allocator_type get_allocator() const noexcept
+    {
+        return data_.ref_to_alloc();
+    }
+
+    //
+    // ---- KEY EQUAL ---------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    key_equal key_eq() const
+    {
+        return data_.ref_to_equal();
+    }
+
+    //
+    // ---- VALUE EQUAL -------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    value_equal value_eq() const
+    {
+        return value_equal(data_.ref_to_equal());
+    }
+
+    //
+    // ---- ITERATORS ---------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    iterator begin() noexcept
+    {
+        return nth(0);
+    }
+
+    SFL_NODISCARD
+    const_iterator begin() const noexcept
+    {
+        return nth(0);
+    }
+
+    SFL_NODISCARD
+    const_iterator cbegin() const noexcept
+    {
+        return nth(0);
+    }
+
+    SFL_NODISCARD
+    iterator end() noexcept
+    {
+        return nth(size());
+    }
+
+    SFL_NODISCARD
+    const_iterator end() const noexcept
+    {
+        return nth(size());
+    }
+
+    SFL_NODISCARD
+    const_iterator cend() const noexcept
+    {
+        return nth(size());
+    }
+
+    SFL_NODISCARD
+    iterator nth(size_type pos) noexcept
+    {
+        SFL_ASSERT(pos <= size());
+        return iterator(data_.keys() + pos, data_.mapped() + pos);
+    }
+
+    SFL_NODISCARD
+    const_iterator nth(size_type pos) const noexcept
+    {
+        SFL_ASSERT(pos <= size());
+        return const_iterator(data_.keys() + pos, data_.mapped() + pos);
+    }
+
+    SFL_NODISCARD
+    size_type index_of(const_iterator pos) const noexcept
+    {
+        SFL_ASSERT(cbegin() <= pos && pos <= cend());
+        return pos.key_ - data_.keys();
+    }
+
+    //
+    // ---- SIZE AND CAPACITY -------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    bool empty() const noexcept
+    {
+        return data_.size_ == 0;
+    }
+
+    SFL_NODISCARD
+    size_type size() const noexcept
+    {
+        return data_.size_;
+    }
+
+    SFL_NODISCARD
+    size_type max_size() const noexcept
+    {
+        return std::min<size_type>
+        (
+            allocator_traits::max_size(data_.ref_to_alloc()),
+            std::numeric_limits<difference_type>::max() / sizeof(value_type)
+        );
+    }
+
+    SFL_NODISCARD
+    size_type capacity() const noexcept
+    {
+        return data_.capacity_;
+    }
+
+    SFL_NODISCARD
+    size_type available() const noexcept
+    {
+        return data_.capacity_ - data_.size_;
+    }
+
+    void reserve(size_type new_cap)
+    {
+        check_size(new_cap, "sfl::small_unordered_flat_split_map::reserve");
+
+        if (new_cap > capacity())
+        {
+            if (new_cap <= N)
+            {
+                if (data_.first_ == data_.internal_storage())
+                {
+                    // Do nothing. We are already using internal storage.
+                }
+                else
+                {
+                    // We are not using internal storage but new capacity
+                    // can fit in internal storage.
+                    reallocate(N);
+                }
+            }
+            else
+            {
+                reallocate(new_cap);
+            }
+        }
+    }
+
+    void shrink_to_fit()
+    {
+        const size_type new_cap = size();
+
+        if (new_cap < capacity())
+        {
+            if (new_cap <= N)
+            {
+                if (data_.first_ == data_.internal_storage())
+                {
+                    // Do nothing. We are already using internal storage.
+                }
+                else
+                {
+                    // We are not using internal storage but new capacity
+                    // can fit in internal storage.
+                    reallocate(N);
+                }
+            }
+            else
+            {
+                reallocate(new_cap);
+            }
+        }
+    }
+
+    //
+    // ---- MODIFIERS ---------------------------------------------------------
+    //
+
+    void clear() noexcept
+    {
+        destroy_all();
+        data_.size_ = 0;
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args)
+    {
+        return emplace_aux(std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    iterator emplace_hint(const_iterator hint, Args&&... args)
+    {
+        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        sfl::dtl::ignore_unused(hint);
+        return emplace_aux(std::forward<Args>(args)...).first;
+    }
+
+    std::pair<iterator, bool> insert(const value_type& value)
+    {
+        return insert_aux(value);
+    }
+
+    std::pair<iterator, bool> insert(value_type&& value)
+    {
+        return insert_aux(std::move(value));
+    }
+
+    template <typename P,
+              sfl::dtl::enable_if_t<std::is_constructible<value_type, P&&>::value>* = nullptr>
+    std::pair<iterator, bool> insert(P&& value)
+    {
+        return insert_aux(value_type(std::forward<P>(value)));
+    }
+
+    iterator insert(const_iterator hint, const value_type& value)
+    {
+        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        sfl::dtl::ignore_unused(hint);
+        return insert_aux(value).first;
+    }
+
+    iterator insert(const_iterator hint, value_type&& value)
+    {
+        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        sfl::dtl::ignore_unused(hint);
+        return insert_aux(std::move(value)).first;
+    }
+
+    template <typename P,
+              sfl::dtl::enable_if_t<std::is_constructible<value_type, P&&>::value>* = nullptr>
+    iterator insert(const_iterator hint, P&& value)
+    {
+        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        sfl::dtl::ignore_unused(hint);
+        return insert_aux(value_type(std::forward<P>(value))).first;
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    void insert(InputIt first, InputIt last)
+    {
+        insert_range_aux(first, last, is_bulk_insertable<InputIt>());
+    }
+
+    void insert(std::initializer_list<value_type> ilist)
+    {
+        insert(ilist.begin(), ilist.end());
+    }
+
+    template <typename M,
+              sfl::dtl::enable_if_t<std::is_assignable<mapped_type&, M&&>::value>* = nullptr>
+    std::pair<iterator, bool> insert_or_assign(const Key& key, M&& obj)
+    {
+        return insert_or_assign_aux(key, std::forward<M>(obj));
+    }
+
+    template <typename M,
+              sfl::dtl::enable_if_t<std::is_assignable<mapped_type&, M&&>::value>* = nullptr>
+    std::pair<iterator, bool> insert_or_assign(Key&& key, M&& obj)
+    {
+        return insert_or_assign_aux(std::move(key), std::forward<M>(obj));
+    }
+
+    template <typename K, typename M,
+              sfl::dtl::enable_if_t< sfl::dtl::has_is_transparent<KeyEqual, K>::value &&
+                                     std::is_assignable<mapped_type&, M&&>::value >* = nullptr>
+    std::pair<iterator, bool> insert_or_assign(K&& key, M&& obj)
+    {
+        return insert_or_assign_aux(std::forward<K>(key), std::forward<M>(obj));
+    }
+
+    template <typename M,
+              sfl::dtl::enable_if_t<std::is_assignable<mapped_type&, M&&>::value>* = nullptr>
+    iterator insert_or_assign(const_iterator hint, const Key& key, M&& obj)
+    {
+        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        sfl::dtl::ignore_unused(hint);
+        return insert_or_assign_aux(key, std::forward<M>(obj)).first;
+    }
+
+    template <typename M,
+              sfl::dtl::enable_if_t<std::is_assignable<mapped_type&, M&&>::value>* = nullptr>
+    iterator insert_or_assign(const_iterator hint, Key&& key, M&& obj)
+    {
+        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        sfl::dtl::ignore_unused(hint);
+        return insert_or_assign_aux(std::move(key), std::forward<M>(obj)).first;
+    }
+
+    template <typename K, typename M,
+              sfl::dtl::enable_if_t< sfl::dtl::has_is_transparent<KeyEqual, K>::value &&
+                                     std::is_assignable<mapped_type&, M&&>::value >* = nullptr>
+    iterator insert_or_assign(const_iterator hint, K&& key, M&& obj)
+    {
+        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        sfl::dtl::ignore_unused(hint);
+        return insert_or_assign_aux(std::forward<K>(key), std::forward<M>(obj)).first;
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args)
+    {
+        return try_emplace_aux(key, std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(Key&& key, Args&&... args)
+    {
+        return try_emplace_aux(std::move(key), std::forward<Args>(args)...);
+    }
+
+    template <typename K, typename... Args,
+              sfl::dtl::enable_if_t<
+                #if defined(__GNUC__) && !defined(__clang__) && (__GNUC__ < 7)
+                // This is workaround for GCC 4 bug on CentOS 7.
+                !std::is_same<sfl::dtl::remove_cvref_t<Key>, sfl::dtl::remove_cvref_t<K>>::value &&
+                #endif
+                sfl::dtl::has_is_transparent<KeyEqual, K>::value &&
+                !std::is_convertible<K&&, const_iterator>::value &&
+                !std::is_convertible<K&&, iterator>::value
+              >* = nullptr>
+    std::pair<iterator, bool> try_emplace(K&& key, Args&&... args)
+    {
+        return try_emplace_aux(std::forward<K>(key), std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    iterator try_emplace(const_iterator hint, const Key& key, Args&&... args)
+    {
+        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        sfl::dtl::ignore_unused(hint);
+        return try_emplace_aux(key, std::forward<Args>(args)...).first;
+    }
+
+    template <typename... Args>
+    iterator try_emplace(const_iterator hint, Key&& key, Args&&... args)
+    {
+        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        sfl::dtl::ignore_unused(hint);
+        return try_emplace_aux(std::move(key), std::forward<Args>(args)...).first;
+    }
+
+    template <typename K, typename... Args,
+              sfl::dtl::enable_if_t<
+                #if defined(__GNUC__) && !defined(__clang__) && (__GNUC__ < 7)
+                // This is workaround for GCC 4 bug on CentOS 7.
+                !std::is_same<sfl::dtl::remove_cvref_t<Key>, sfl::dtl::remove_cvref_t<K>>::value &&
+                #endif
+                sfl::dtl::has_is_transparent<KeyEqual, K>::value
+              >* = nullptr>
+    iterator try_emplace(const_iterator hint, K&& key, Args&&... args)
+    {
+        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        sfl::dtl::ignore_unused(hint);
+        return try_emplace_aux(std::forward<K>(key), std::forward<Args>(args)...).first;
+    }
+
+    iterator erase(iterator pos)
+    {
+        return erase(const_iterator(pos));
+    }
+
+    iterator erase(const_iterator pos)
+    {
+        SFL_ASSERT(cbegin() <= pos && pos < cend());
+
+        const size_type i = index_of(pos);
+
+        const size_type last = size() - 1;
+
+        if (i < last)
+        {
+            Key* const keys = data_.keys();
+            T* const mapped = data_.mapped();
+
+            keys[i]   = std::move(keys[last]);
+            mapped[i] = std::move(mapped[last]);
+        }
+
+        pop_back();
+
+        return nth(i);
+    }
+
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        SFL_ASSERT(cbegin() <= first && first <= last && last <= cend());
+
+        const size_type i = index_of(first);
+
+        if (first == last)
+        {
+            return nth(i);
+        }
+
+        const size_type count1 = std::distance(first, last);
+        const size_type count2 = std::distance(last, cend());
+
+        // Elements after `last` fill the gap, so at most `count1` elements
+        // are moved.
+        const size_type num_moved = std::min(count1, count2);
+
+        const size_type src = size() - num_moved;
+
+        Key* const keys = data_.keys();
+        T* const mapped = data_.mapped();
+
+        std::move(keys + src, keys + size(), keys + i);
+        std::move(mapped + src, mapped + size(), mapped + i);
+
+        const size_type new_size = size() - count1;
+
+        sfl::dtl::destroy_a(data_.ref_to_alloc(), keys + new_size, keys + size());
+        sfl::dtl::destroy_a(data_.ref_to_alloc(), mapped + new_size, mapped + size());
+
+        data_.size_ = new_size;
+
+        return nth(i);
+    }
+
+    size_type erase(const Key& key)
+    {
+        auto it = find(key);
+
+        if (it == cend())
+        {
+            return 0;
+        }
+
+        erase(it);
+        return 1;
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<KeyEqual, K>::value>* = nullptr>
+    size_type erase(K&& x)
+    {
+        auto it = find(x);
+
+        if (it == cend())
+        {
+            return 0;
+        }
+
+        erase(it);
+        return 1;
+    }
+
+    void swap(small_unordered_flat_split_map& other)
+    {
+        if (this == &other)
+        {
+            return;
+        }
+
+        using std::swap;
+
+        SFL_ASSERT
+        (
+            allocator_traits::propagate_on_container_swap::value ||
+            this->data_.ref_to_alloc() == other.data_.ref_to_alloc()
+        );
+
+        // If this and other allocator compares equal then one allocator
+        // can deallocate memory allocated by another allocator.
+        // One allocator can safely destroy_a elements constructed by other
+        // allocator regardless the two allocators compare equal or not.
+
+        if (allocator_traits::propagate_on_container_swap::value)
+        {
+            swap(this->data_.ref_to_alloc(), other.data_.ref_to_alloc());
+        }
+
+        swap(this->data_.ref_to_equal(), other.data_.ref_to_equal());
+
+        if
+        (
+            this->data_.first_ == this->data_.internal_storage() &&
+            other.data_.first_ == other.data_.internal_storage()
+        )
+        {
+            if (this->size() <= other.size())
+            {
+                this->swap_internal(other);
+            }
+            else
+            {
+                other.swap_internal(*this);
+            }
+        }
+        else if
+        (
+            this->data_.first_ == this->data_.internal_storage() &&
+            other.data_.first_ != other.data_.internal_storage()
+        )
+        {
+            this->steal_heap_and_give_internal(other);
+        }
+        else if
+        (
+            this->data_.first_ != this->data_.internal_storage() &&
+            other.data_.first_ == other.data_.internal_storage()
+        )
+        {
+            other.steal_heap_and_give_internal(*this);
+        }
+        else
+        {
+            swap(this->data_.first_,    other.data_.first_);
+            swap(this->data_.size_,     other.data_.size_);
+            swap(this->data_.capacity_, other.data_.capacity_);
+        }
+    }
+
+    // Moves all keys and mapped values into two vectors and leaves the
+    // container empty. Keys and mapped values share one memory block that
+    // cannot be handed over, so they are moved one by one.
+    containers extract()
+    {
+        Key* const keys = data_.keys();
+        T* const mapped = data_.mapped();
+
+        containers result
+        {
+            key_container_type
+            (
+                std::make_move_iterator(keys),
+                std::make_move_iterator(keys + size()),
+                typename key_container_type::allocator_type(data_.ref_to_alloc())
+            ),
+            mapped_container_type
+            (
+                std::make_move_iterator(mapped),
+                std::make_move_iterator(mapped + size()),
+                typename mapped_container_type::allocator_type(data_.ref_to_alloc())
+            )
+        };
+
+        reset();
+
+        return result;
+    }
+
+    // Replaces all elements with keys and mapped values moved from `keys`
+    // and `values`.
+    void replace(key_container_type&& keys, mapped_container_type&& values)
+    {
+        SFL_ASSERT(keys.size() == values.size());
+        SFL_ASSERT(sfl::dtl::is_unique(keys.begin(), keys.end(), data_.ref_to_equal()));
+
+        assign_range
+        (
+            std::make_move_iterator(keys.begin()),
+            std::make_move_iterator(values.begin()),
+            keys.size()
+        );
+
+        keys.clear();
+        values.clear();
+    }
+
+    //
+    // ---- LOOKUP ------------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    iterator find(const Key& key)
+    {
+        return nth(find_index(key));
+    }
+
+    SFL_NODISCARD
+    const_iterator find(const Key& key) const
+    {
+        return nth(find_index(key));
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<KeyEqual, K>::value>* = nullptr>
+    SFL_NODISCARD
+    iterator find(const K& x)
+    {
+        return nth(find_index_transparent(x));
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<KeyEqual, K>::value>* = nullptr>
+    SFL_NODISCARD
+    const_iterator find(const K& x) const
+    {
+        return nth(find_index_transparent(x));
+    }
+
+    SFL_NODISCARD
+    size_type count(const Key& key) const
+    {
+        return find(key) != end();
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<KeyEqual, K>::value>* = nullptr>
+    SFL_NODISCARD
+    size_type count(const K& x) const
+    {
+        return find(x) != end();
+    }
+
+    SFL_NODISCARD
+    bool contains(const Key& key) const
+    {
+        return find(key) != end();
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<KeyEqual, K>::value>* = nullptr>
+    SFL_NODISCARD
+    bool contains(const K& x) const
+    {
+        return find(x) != end();
+    }
+
+    // Batched lookup. For each key in range [first, last), in order, writes
+    // `find(key)` into `out`. Integral, enumeration and pointer keys compared
+    // using `std::equal_to` are hashed, and elements are scanned once per
+    // batch of up to 64 keys.
+    template <typename ForwardIt, typename OutputIt>
+    OutputIt find_many(ForwardIt first, ForwardIt last, OutputIt out)
+    {
+        find_many_aux(first, last, [&](size_type i) { *out = nth(i); ++out; });
+        return out;
+    }
+
+    template <typename ForwardIt, typename OutputIt>
+    OutputIt find_many(ForwardIt first, ForwardIt last, OutputIt out) const
+    {
+        find_many_aux(first, last, [&](size_type i) { *out = nth(i); ++out; });
+        return out;
+    }
+
+    // Batched lookup. For each key in range [first, last), in order, writes
+    // `contains(key)` into `out`.
+    template <typename ForwardIt, typename OutputIt>
+    OutputIt contains_many(ForwardIt first, ForwardIt last, OutputIt out) const
+    {
+        const size_type n = size();
+        find_many_aux(first, last, [&](size_type i) { *out = i != n; ++out; });
+        return out;
+    }
+
+    //
+    // ---- ELEMENT ACCESS ----------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    T& at(const Key& key)
+    {
+        const size_type i = find_index(key);
+
+        if (i == size())
+        {
+            sfl::dtl::throw_out_of_range("sfl::small_unordered_flat_split_map::at");
+        }
+
+        return data_.mapped()[i];
+    }
+
+    SFL_NODISCARD
+    const T& at(const Key& key) const
+    {
+        const size_type i = find_index(key);
+
+        if (i == size())
+        {
+            sfl::dtl::throw_out_of_range("sfl::small_unordered_flat_split_map::at");
+        }
+
+        return data_.mapped()[i];
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<KeyEqual, K>::value>* = nullptr>
+    SFL_NODISCARD
+    T& at(const K& x)
+    {
+        const size_type i = find_index_transparent(x);
+
+        if (i == size())
+        {
+            sfl::dtl::throw_out_of_range("sfl::small_unordered_flat_split_map::at");
+        }
+
+        return data_.mapped()[i];
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<KeyEqual, K>::value>* = nullptr>
+    SFL_NODISCARD
+    const T& at(const K& x) const
+    {
+        const size_type i = find_index_transparent(x);
+
+        if (i == size())
+        {
+            sfl::dtl::throw_out_of_range("sfl::small_unordered_flat_split_map::at");
+        }
+
+        return data_.mapped()[i];
+    }
+
+    SFL_NODISCARD
+    T& operator[](const Key& key)
+    {
+        return try_emplace(key).first->second;
+    }
+
+    SFL_NODISCARD
+    T& operator[](Key&& key)
+    {
+        return try_emplace(std::move(key)).first->second;
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<KeyEqual, K>::value>* = nullptr>
+    SFL_NODISCARD
+    T& operator[](K&& key)
+    {
+        return try_emplace(std::forward<K>(key)).first->second;
+    }
+
+    SFL_NODISCARD
+    const key_type* key_data() const noexcept
+    {
+        return data_.keys();
+    }
+
+    SFL_NODISCARD
+    mapped_type* mapped_data() noexcept
+    {
+        return data_.mapped();
+    }
+
+    SFL_NODISCARD
+    const mapped_type* mapped_data() const noexcept
+    {
+        return data_.mapped();
+    }
+
+private:
+
+    // Calls `fn(find_index(key))` for each key in range [first, last).
+    template <typename ForwardIt, typename Function>
+    void find_many_aux(ForwardIt first, ForwardIt last, Function&& fn) const
+    {
+        const key_type* elements = data_.keys();
+
+        sfl::dtl::find_many<Key>
+        (
+            static_cast<const key_equal&>(data_.ref_to_equal()),
+            size(),
+            [elements](size_type i) -> const Key& { return elements[i]; },
+            [this](const Key& key) { return find_index(key); },
+            first,
+            last,
+            std::forward<Function>(fn)
+        );
+    }
+
+    // Returns index of the element with key equivalent to `key`, or `size()`
+    // if there is no such element. Keys are stored densely, so integral,
+    // enumeration and pointer keys compared using `std::equal_to` are searched
+    // for using SIMD instructions regardless of mapped type.
+    size_type find_index(const Key& key) const
+    {
+        return find_index(key, sfl::dtl::is_simd_searchable<Key, KeyEqual>());
+    }
+
+    size_type find_index(const Key& key, std::true_type) const noexcept
+    {
+        return sfl::dtl::find_equal<1>(data_.keys(), size(), key);
+    }
+
+    size_type find_index(const Key& key, std::false_type) const
+    {
+        return find_index_transparent(key);
+    }
+
+    template <typename K>
+    size_type find_index_transparent(const K& x) const
+    {
+        const Key* const keys = data_.keys();
+
+        const size_type n = size();
+
+        for (size_type i = 0; i < n; ++i)
+        {
+            if (data_.ref_to_equal()(keys[i], x))
+            {
+                return i;
+            }
+        }
+
+        return n;
+    }
+
+    void check_size(size_type n, const char* msg)
+    {
+        if (n > max_size())
+        {
+            sfl::dtl::throw_length_error(msg);
+        }
+    }
+
+    size_type calculate_new_capacity(size_type num_additional_elements, const char* msg)
+    {
+        const size_type size = this->size();
+        const size_type capacity = this->capacity();
+        const size_type max_size = this->max_size();
+
+        if (max_size - size < num_additional_elements)
+        {
+            sfl::dtl::throw_length_error(msg);
+        }
+        else if (max_size - capacity < capacity / 2)
+        {
+            return max_size;
+        }
+        else if (size + num_additional_elements < capacity + capacity / 2)
+        {
+            return std::max(N, capacity + capacity / 2);
+        }
+        else
+        {
+            return std::max(N, size + num_additional_elements);
+        }
+    }
+
+    void destroy_all() noexcept
+    {
+        Key* const keys = data_.keys();
+        T* const mapped = data_.mapped();
+
+        sfl::dtl::destroy_a(data_.ref_to_alloc(), keys, keys + size());
+        sfl::dtl::destroy_a(data_.ref_to_alloc(), mapped, mapped + size());
+    }
+
+    void deallocate_storage() noexcept
+    {
+        if (data_.first_ != data_.internal_storage())
+        {
+            sfl::dtl::deallocate(data_.ref_to_alloc(), data_.first_, data_.capacity_);
+        }
+    }
+
+    // Returns storage for `new_cap` elements: internal storage if `new_cap`
+    // is equal to `N`, otherwise newly allocated storage.
+    storage_pointer allocate_storage(size_type new_cap)
+    {
+        if (new_cap == N)
+        {
+            return data_.internal_storage();
+        }
+
+        return sfl::dtl::allocate(data_.ref_to_alloc(), new_cap);
+    }
+
+    void deallocate_storage(storage_pointer first, size_type cap) noexcept
+    {
+        if (first != data_.internal_storage())
+        {
+            sfl::dtl::deallocate(data_.ref_to_alloc(), first, cap);
+        }
+    }
+
+    // Moves (or copies, if move constructor is not noexcept) all elements
+    // into uninitialized arrays `new_keys` and `new_mapped`. If an exception
+    // is thrown, nothing is constructed and elements are left intact.
+    void relocate_to(Key* new_keys, T* new_mapped)
+    {
+        Key* const keys = data_.keys();
+        T* const mapped = data_.mapped();
+
+        const size_type n = size();
+
+        sfl::dtl::uninitialized_move_if_noexcept_a
+        (
+            data_.ref_to_alloc(),
+            keys,
+            keys + n,
+            new_keys
+        );
+
+        SFL_TRY
+        {
+            sfl::dtl::uninitialized_move_if_noexcept_a
+            (
+                data_.ref_to_alloc(),
+                mapped,
+                mapped + n,
+                new_mapped
+            );
+        }
+        SFL_CATCH (...)
+        {
+            sfl::dtl::destroy_a(data_.ref_to_alloc(), new_keys, new_keys + n);
+            SFL_RETHROW;
+        }
+    }
+
+    // Moves all elements to storage of capacity `new_cap`, which is either
+    // internal storage (if `new_cap == N`) or newly allocated storage.
+    // Current storage must be different from the new one.
+    void reallocate(size_type new_cap)
+    {
+        const storage_pointer new_first = allocate_storage(new_cap);
+
+        SFL_TRY
+        {
+            relocate_to(data::keys_of(new_first), data::mapped_of(new_first, new_cap));
+        }
+        SFL_CATCH (...)
+        {
+            deallocate_storage(new_first, new_cap);
+            SFL_RETHROW;
+        }
+
+        destroy_all();
+        deallocate_storage();
+
+        data_.first_    = new_first;
+        data_.capacity_ = new_cap;
+    }
+
+    void reset(size_type new_cap = N)
+    {
+        destroy_all();
+        deallocate_storage();
+
+        data_.first_    = data_.internal_storage();
+        data_.size_     = 0;
+        data_.capacity_ = N;
+
+        if (new_cap > N)
+        {
+            data_.first_    = sfl::dtl::allocate(data_.ref_to_alloc(), new_cap);
+            data_.capacity_ = new_cap;
+
+            // If allocation throws, first_ and capacity_ will be valid
+            // (first_ will be pointing to internal_storage).
+        }
+    }
+
+    // Copies or moves `n` keys and mapped values into this container that
+    // must be empty and must have sufficient capacity.
+    template <typename KeyIt, typename MappedIt>
+    void construct_all(KeyIt key_first, MappedIt mapped_first, size_type n)
+    {
+        SFL_ASSERT(empty() && n <= capacity());
+
+        Key* const keys = data_.keys();
+        T* const mapped = data_.mapped();
+
+        sfl::dtl::uninitialized_copy_a
+        (
+            data_.ref_to_alloc(),
+            key_first,
+            std::next(key_first, n),
+            keys
+        );
+
+        SFL_TRY
+        {
+            sfl::dtl::uninitialized_copy_a
+            (
+                data_.ref_to_alloc(),
+                mapped_first,
+                std::next(mapped_first, n),
+                mapped
+            );
+        }
+        SFL_CATCH (...)
+        {
+            sfl::dtl::destroy_a(data_.ref_to_alloc(), keys, keys + n);
+            SFL_RETHROW;
+        }
+
+        data_.size_ = n;
+    }
+
+    template <typename InputIt>
+    void initialize_range(InputIt first, InputIt last)
+    {
+        SFL_TRY
+        {
+            insert(first, last);
+        }
+        SFL_CATCH (...)
+        {
+            destroy_all();
+            deallocate_storage();
+            SFL_RETHROW;
+        }
+    }
+
+    void initialize_copy(const small_unordered_flat_split_map& other)
+    {
+        const size_type n = other.size();
+
+        check_size(n, "sfl::small_unordered_flat_split_map::initialize_copy");
+
+        if (n > N)
+        {
+            data_.first_    = sfl::dtl::allocate(data_.ref_to_alloc(), n);
+            data_.capacity_ = n;
+        }
+
+        SFL_TRY
+        {
+            construct_all(other.data_.keys(), other.data_.mapped(), n);
+        }
+        SFL_CATCH (...)
+        {
+            deallocate_storage();
+            SFL_RETHROW;
+        }
+    }
+
+    void initialize_move(small_unordered_flat_split_map& other)
+    {
+        if (other.data_.first_ == other.data_.internal_storage())
+        {
+            construct_all
+            (
+                std::make_move_iterator(other.data_.keys()),
+                std::make_move_iterator(other.data_.mapped()),
+                other.size()
+            );
+        }
+        else if (data_.ref_to_alloc() == other.data_.ref_to_alloc())
+        {
+            data_.first_    = other.data_.first_;
+            data_.size_     = other.data_.size_;
+            data_.capacity_ = other.data_.capacity_;
+
+            other.data_.first_    = other.data_.internal_storage();
+            other.data_.size_     = 0;
+            other.data_.capacity_ = N;
+        }
+        else
+        {
+            const size_type n = other.size();
+
+            check_size(n, "sfl::small_unordered_flat_split_map::initialize_move");
+
+            if (n > N)
+            {
+                data_.first_    = sfl::dtl::allocate(data_.ref_to_alloc(), n);
+                data_.capacity_ = n;
+            }
+
+            SFL_TRY
+            {
+                construct_all
+                (
+                    std::make_move_iterator(other.data_.keys()),
+                    std::make_move_iterator(other.data_.mapped()),
+                    n
+                );
+            }
+            SFL_CATCH (...)
+            {
+                deallocate_storage();
+                SFL_RETHROW;
+            }
+        }
+    }
+
+    template <typename KeyIt, typename MappedIt>
+    void assign_range(KeyIt key_first, MappedIt mapped_first, size_type n)
+    {
+        check_size(n, "sfl::small_unordered_flat_split_map::assign_range");
+
+        if (n <= capacity())
+        {
+            Key* const keys = data_.keys();
+            T* const mapped = data_.mapped();
+
+            const size_type s = size();
+
+            if (n <= s)
+            {
+                std::copy(key_first, std::next(key_first, n), keys);
+                std::copy(mapped_first, std::next(mapped_first, n), mapped);
+
+                sfl::dtl::destroy_a(data_.ref_to_alloc(), keys + n, keys + s);
+                sfl::dtl::destroy_a(data_.ref_to_alloc(), mapped + n, mapped + s);
+
+                data_.size_ = n;
+            }
+            else
+            {
+                const KeyIt key_mid = std::next(key_first, s);
+                const MappedIt mapped_mid = std::next(mapped_first, s);
+
+                std::copy(key_first, key_mid, keys);
+                std::copy(mapped_first, mapped_mid, mapped);
+
+                sfl::dtl::uninitialized_copy_a
+                (
+                    data_.ref_to_alloc(),
+                    key_mid,
+                    std::next(key_mid, n - s),
+                    keys + s
+                );
+
+                SFL_TRY
+                {
+                    sfl::dtl::uninitialized_copy_a
+                    (
+                        data_.ref_to_alloc(),
+                        mapped_mid,
+                        std::next(mapped_mid, n - s),
+                        mapped + s
+                    );
+                }
+                SFL_CATCH (...)
+                {
+                    sfl::dtl::destroy_a(data_.ref_to_alloc(), keys + s, keys + n);
+                    SFL_RETHROW;
+                }
+
+                data_.size_ = n;
+            }
+        }
+        else
+        {
+            reset(n);
+            construct_all(key_first, mapped_first, n);
+        }
+    }
+
+    void assign_copy(const small_unordered_flat_split_map& other)
+    {
+        if (this != &other)
+        {
+            if (allocator_traits::propagate_on_container_copy_assignment::value)
+            {
+                if (data_.ref_to_alloc() != other.data_.ref_to_alloc())
+                {
+                    reset();
+                }
+
+                data_.ref_to_alloc() = other.data_.ref_to_alloc();
+            }
+
+            data_.ref_to_equal() = other.data_.ref_to_equal();
+
+            assign_range(other.data_.keys(), other.data_.mapped(), other.size());
+        }
+    }
+
+    void assign_move(small_unordered_flat_split_map& other)
+    {
+        if (allocator_traits::propagate_on_container_move_assignment::value)
+        {
+            if (data_.ref_to_alloc() != other.data_.ref_to_alloc())
+            {
+                reset();
+            }
+
+            data_.ref_to_alloc() = std::move(other.data_.ref_to_alloc());
+        }
+
+        data_.ref_to_equal() = other.data_.ref_to_equal();
+
+        if
+        (
+            other.data_.first_ != other.data_.internal_storage() &&
+            data_.ref_to_alloc() == other.data_.ref_to_alloc()
+        )
+        {
+            reset();
+
+            data_.first_    = other.data_.first_;
+            data_.size_     = other.data_.size_;
+            data_.capacity_ = other.data_.capacity_;
+
+            other.data_.first_    = other.data_.internal_storage();
+            other.data_.size_     = 0;
+            other.data_.capacity_ = N;
+        }
+        else
+        {
+            assign_range
+            (
+                std::make_move_iterator(other.data_.keys()),
+                std::make_move_iterator(other.data_.mapped()),
+                other.size()
+            );
+        }
+    }
+
+    // Swaps elements of two containers that both use internal storage.
+    // This container must not have more elements than `other`.
+    void swap_internal(small_unordered_flat_split_map& other)
+    {
+        const size_type this_size  = this->size();
+        const size_type other_size = other.size();
+
+        SFL_ASSERT(this_size <= other_size);
+
+        Key* const this_keys  = this->data_.keys();
+        Key* const other_keys = other.data_.keys();
+
+        T* const this_mapped  = this->data_.mapped();
+        T* const other_mapped = other.data_.mapped();
+
+        std::swap_ranges(this_keys, this_keys + this_size, other_keys);
+        std::swap_ranges(this_mapped, this_mapped + this_size, other_mapped);
+
+        sfl::dtl::uninitialized_move_a
+        (
+            this->data_.ref_to_alloc(),
+            other_keys + this_size,
+            other_keys + other_size,
+            this_keys + this_size
+        );
+
+        sfl::dtl::uninitialized_move_a
+        (
+            this->data_.ref_to_alloc(),
+            other_mapped + this_size,
+            other_mapped + other_size,
+            this_mapped + this_size
+        );
+
+        sfl::dtl::destroy_a
+        (
+            other.data_.ref_to_alloc(),
+            other_keys + this_size,
+            other_keys + other_size
+        );
+
+        sfl::dtl::destroy_a
+        (
+            other.data_.ref_to_alloc(),
+            other_mapped + this_size,
+            other_mapped + other_size
+        );
+
+        this->data_.size_ = other_size;
+        other.data_.size_ = this_size;
+    }
+
+    // This container uses internal storage and `other` uses heap storage.
+    // Elements of this container are moved to internal storage of `other`
+    // and this container takes over heap storage of `other`.
+    void steal_heap_and_give_internal(small_unordered_flat_split_map& other)
+    {
+        const storage_pointer new_other_first = other.data_.internal_storage();
+
+        sfl::dtl::uninitialized_move_a
+        (
+            other.data_.ref_to_alloc(),
+            this->data_.keys(),
+            this->data_.keys() + this->size(),
+            data::keys_of(new_other_first)
+        );
+
+        sfl::dtl::uninitialized_move_a
+        (
+            other.data_.ref_to_alloc(),
+            this->data_.mapped(),
+            this->data_.mapped() + this->size(),
+            data::mapped_of(new_other_first, N)
+        );
+
+        const size_type new_other_size = this->size();
+
+        this->destroy_all();
+
+        this->data_.first_    = other.data_.first_;
+        this->data_.size_     = other.data_.size_;
+        this->data_.capacity_ = other.data_.capacity_;
+
+        other.data_.first_    = new_other_first;
+        other.data_.size_     = new_other_size;
+        other.data_.capacity_ = N;
+    }
+
+    // Key is taken from arguments and searched for before the element is
+    // constructed, so nothing is constructed if the key already exists.
+    template <typename... Args,
+              sfl::dtl::enable_if_t<sfl::dtl::is_map_key_extractable<Key, Args...>::value>* = nullptr>
+    std::pair<iterator, bool> emplace_aux(Args&&... args)
+    {
+        const auto it = find(sfl::dtl::extract_map_key(args...));
+
+        if (it == end())
+        {
+            // Keys and mapped values are constructed separately, so element
+            // is constructed as a temporary pair first.
+            return insert_aux(value_type(std::forward<Args>(args)...));
+        }
+
+        return std::make_pair(it, false);
+    }
+
+    template <typename... Args,
+              sfl::dtl::enable_if_t<!sfl::dtl::is_map_key_extractable<Key, Args...>::value>* = nullptr>
+    std::pair<iterator, bool> emplace_aux(Args&&... args)
+    {
+        // Keys and mapped values are constructed separately, so element is
+        // constructed as a temporary pair first.
+        return insert_aux(value_type(std::forward<Args>(args)...));
+    }
+
+    using index_allocator = typename allocator_traits::template rebind_alloc<size_type>;
+
+    // Forward ranges are inserted in bulk if keys are integral, enumeration
+    // or pointer types compared using `std::equal_to`, or if they are
+    // compared using `std::equal_to` and `std::hash<Key>` is enabled.
+    template <typename InputIt>
+    using is_bulk_insertable = std::integral_constant
+    <
+        bool,
+        sfl::dtl::is_forward_iterator<InputIt>::value &&
+        sfl::dtl::is_hash_searchable<Key, KeyEqual>::value &&
+        (
+            std::is_same<typename std::iterator_traits<InputIt>::value_type, value_type>::value ||
+            std::is_same<typename std::iterator_traits<InputIt>::value_type, std::pair<const Key, T>>::value
+        )
+    >;
+
+    template <typename InputIt>
+    void insert_range_aux(InputIt first, InputIt last, std::false_type)
+    {
+        reserve_range(first, last, sfl::dtl::is_forward_iterator<InputIt>());
+
+        while (first != last)
+        {
+            insert(*first);
+            ++first;
+        }
+    }
+
+    template <typename InputIt>
+    void reserve_range(InputIt /*first*/, InputIt /*last*/, std::false_type)
+    {}
+
+    // Forward ranges whose keys cannot be hashed are still inserted one by
+    // one, but storage is reserved only once.
+    template <typename ForwardIt>
+    void reserve_range(ForwardIt first, ForwardIt last, std::true_type)
+    {
+        const size_type m = std::distance(first, last);
+
+        reserve(size() + std::min(m, max_size() - size()));
+    }
+
+    // Reserves storage once and finds duplicates of existing and preceding
+    // elements using temporary hash table, so inserting `m` elements costs
+    // O(size() + m) instead of O(size() * m).
+    template <typename ForwardIt>
+    void insert_range_aux(ForwardIt first, ForwardIt last, std::true_type)
+    {
+        using reference = typename std::iterator_traits<ForwardIt>::reference;
+
+        const size_type m = std::distance(first, last);
+
+        if (m <= sfl::dtl::find_many_hash_threshold)
+        {
+            insert_range_aux(first, last, std::false_type());
+            return;
+        }
+
+        reserve(size() + std::min(m, max_size() - size()));
+
+        const Key* const keys = data_.keys();
+
+        index_allocator alloc(data_.ref_to_alloc());
+
+        sfl::dtl::insert_unique_hashed<Key>
+        (
+            data_.ref_to_equal(),
+            alloc,
+            size(),
+            m,
+            [keys](size_type i) -> const Key& { return keys[i]; },
+            [](reference x) -> const Key& { return x.first; },
+            [this](reference x) { emplace_back(std::forward<reference>(x).first, std::forward<reference>(x).second); },
+            first,
+            last
+        );
+    }
+
+    std::pair<iterator, bool> insert_aux(const value_type& value)
+    {
+        const size_type i = find_index(value.first);
+
+        if (i == size())
+        {
+            return std::make_pair(emplace_back(value.first, value.second), true);
+        }
+
+        return std::make_pair(nth(i), false);
+    }
+
+    std::pair<iterator, bool> insert_aux(value_type&& value)
+    {
+        const size_type i = find_index(value.first);
+
+        if (i == size())
+        {
+            return std::make_pair(emplace_back(std::move(value.first), std::move(value.second)), true);
+        }
+
+        return std::make_pair(nth(i), false);
+    }
+
+    template <typename K, typename M>
+    std::pair<iterator, bool> insert_or_assign_aux(K&& key, M&& obj)
+    {
+        auto it = find(key);
+
+        if (it == end())
+        {
+            return std::make_pair(emplace_back(std::forward<K>(key), std::forward<M>(obj)), true);
+        }
+
+        it->second = std::forward<M>(obj);
+        return std::make_pair(it, false);
+    }
+
+    template <typename K, typename... Args>
+    std::pair<iterator, bool> try_emplace_aux(K&& key, Args&&... args)
+    {
+        auto it = find(key);
+
+        if (it == end())
+        {
+            return std::make_pair(emplace_back(std::forward<K>(key), std::forward<Args>(args)...), true);
+        }
+
+        return std::make_pair(it, false);
+    }
+
+    // Constructs key from `key` at `k` and mapped value from `args` at `m`.
+    template <typename K, typename... Args>
+    void construct_element(Key* k, T* m, K&& key, Args&&... args)
+    {
+        sfl::dtl::construct_at_a(data_.ref_to_alloc(), k, std::forward<K>(key));
+
+        SFL_TRY
+        {
+            sfl::dtl::construct_at_a(data_.ref_to_alloc(), m, std::forward<Args>(args)...);
+        }
+        SFL_CATCH (...)
+        {
+            sfl::dtl::destroy_at_a(data_.ref_to_alloc(), k);
+            SFL_RETHROW;
+        }
+    }
+
+    // Appends new element. Key is constructed from `key` and mapped value
+    // is constructed from `args`.
+    template <typename K, typename... Args>
+    iterator emplace_back(K&& key, Args&&... args)
+    {
+        const size_type n = size();
+
+        if (n != capacity())
+        {
+            construct_element
+            (
+                data_.keys() + n,
+                data_.mapped() + n,
+                std::forward<K>(key),
+                std::forward<Args>(args)...
+            );
+
+            ++data_.size_;
+
+            return nth(n);
+        }
+
+        size_type new_cap =
+            calculate_new_capacity(1, "sfl::small_unordered_flat_split_map::emplace_back");
+
+        if (new_cap <= N && data_.first_ != data_.internal_storage())
+        {
+            new_cap = N;
+        }
+
+        const storage_pointer new_first = allocate_storage(new_cap);
+
+        Key* const new_keys = data::keys_of(new_first);
+        T* const new_mapped = data::mapped_of(new_first, new_cap);
+
+        SFL_TRY
+        {
+            // New element is constructed first because `args` may refer to
+            // an existing element.
+            construct_element
+            (
+                new_keys + n,
+                new_mapped + n,
+                std::forward<K>(key),
+                std::forward<Args>(args)...
+            );
+
+            SFL_TRY
+            {
+                relocate_to(new_keys, new_mapped);
+            }
+            SFL_CATCH (...)
+            {
+                sfl::dtl::destroy_at_a(data_.ref_to_alloc(), new_keys + n);
+                sfl::dtl::destroy_at_a(data_.ref_to_alloc(), new_mapped + n);
+                SFL_RETHROW;
+            }
+        }
+        SFL_CATCH (...)
+        {
+            deallocate_storage(new_first, new_cap);
+            SFL_RETHROW;
+        }
+
+        destroy_all();
+        deallocate_storage();
+
+        data_.first_    = new_first;
+        data_.size_     = n + 1;
+        data_.capacity_ = new_cap;
+
+        return nth(n);
+    }
+
+    void pop_back()
+    {
+        SFL_ASSERT(!empty());
+
+        --data_.size_;
+
+        sfl::dtl::destroy_at_a(data_.ref_to_alloc(), data_.keys() + data_.size_);
+        sfl::dtl::destroy_at_a(data_.ref_to_alloc(), data_.mapped() + data_.size_);
+    }
+};
+
+//
+// ---- NON-MEMBER FUNCTIONS --------------------------------------------------
+//
+
+template <typename K, typename T, std::size_t N, typename E, typename A>
+SFL_NODISCARD
+bool operator==
+(
+    const small_unordered_flat_split_map<K, T, N, E, A>& x,
+    const small_unordered_flat_split_map<K, T, N, E, A>& y
+)
+{
+    return x.size() == y.size() && std::is_permutation(x.begin(), x.end(), y.begin());
+}
+
+template <typename K, typename T, std::size_t N, typename E, typename A>
+SFL_NODISCARD
+bool operator!=
+(
+    const small_unordered_flat_split_map<K, T, N, E, A>& x,
+    const small_unordered_flat_split_map<K, T, N, E, A>& y
+)
+{
+    return !(x == y);
+}
+
+template <typename K, typename T, std::size_t N, typename E, typename A>
+void swap
+(
+    small_unordered_flat_split_map<K, T, N, E, A>& x,
+    small_unordered_flat_split_map<K, T, N, E, A>& y
+)
+{
+    x.swap(y);
+}
+
+template <typename K, typename T, std::size_t N, typename E, typename A,
+          typename Predicate>
+typename small_unordered_flat_split_map<K, T, N, E, A>::size_type
+    erase_if(small_unordered_flat_split_map<K, T, N, E, A>& c, Predicate pred)
+{
+    using const_reference =
+        typename small_unordered_flat_split_map<K, T, N, E, A>::const_reference;
+
+    auto old_size = c.size();
+
+    for (auto it = c.begin(); it != c.end(); )
+    {
+        const_reference value = *it;
+
+        if (pred(value))
+        {
+            it = c.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    return old_size - c.size();
+}
+
+} // namespace sfl
+
+#endif // SFL_SMALL_UNORDERED_FLAT_SPLIT_MAP_HPP_INCLUDED
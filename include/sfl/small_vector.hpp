@@ -37,13 +37,15 @@ namespace sfl
 
 template < typename T,
            std::size_t N,
-           typename Allocator = std::allocator<T> >
+           typename Allocator = std::allocator<T>,
+           typename GrowthPolicy = sfl::geometric_growth<> >
 class small_vector
 {
 public:
 
     using allocator_type         = Allocator;
     using allocator_traits       = std::allocator_traits<Allocator>;
+    using growth_policy          = GrowthPolicy;
     using value_type             = T;
     using size_type              = typename allocator_traits::size_type;
     using difference_type        = typename allocator_traits::difference_type;
@@ -472,7 +474,7 @@ public:
                     pointer new_last  = new_first;
                     pointer new_eos   = new_first + N;
 
-                    new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                    new_last = sfl::dtl::uninitialized_relocate_a
                     (
                         data_.ref_to_alloc(),
                         data_.first_,
@@ -480,7 +482,7 @@ public:
                         new_first
                     );
 
-                    sfl::dtl::destroy_a
+                    sfl::dtl::destroy_relocated_a
                     (
                         data_.ref_to_alloc(),
                         data_.first_,
@@ -501,13 +503,15 @@ public:
             }
             else
             {
-                pointer new_first = sfl::dtl::allocate(data_.ref_to_alloc(), new_cap);
+                new_cap = GrowthPolicy::round(new_cap, max_size(), sizeof(value_type));
+
+                pointer new_first = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), new_cap);
                 pointer new_last  = new_first;
                 pointer new_eos   = new_first + new_cap;
 
                 SFL_TRY
                 {
-                    new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                    new_last = sfl::dtl::uninitialized_relocate_a
                     (
                         data_.ref_to_alloc(),
                         data_.first_,
@@ -527,7 +531,7 @@ public:
                     SFL_RETHROW;
                 }
 
-                sfl::dtl::destroy_a
+                sfl::dtl::destroy_relocated_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -572,7 +576,7 @@ public:
                     pointer new_last  = new_first;
                     pointer new_eos   = new_first + N;
 
-                    new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                    new_last = sfl::dtl::uninitialized_relocate_a
                     (
                         data_.ref_to_alloc(),
                         data_.first_,
@@ -580,7 +584,7 @@ public:
                         new_first
                     );
 
-                    sfl::dtl::destroy_a
+                    sfl::dtl::destroy_relocated_a
                     (
                         data_.ref_to_alloc(),
                         data_.first_,
@@ -607,7 +611,7 @@ public:
 
                 SFL_TRY
                 {
-                    new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                    new_last = sfl::dtl::uninitialized_relocate_a
                     (
                         data_.ref_to_alloc(),
                         data_.first_,
@@ -627,7 +631,7 @@ public:
                     SFL_RETHROW;
                 }
 
-                sfl::dtl::destroy_a
+                sfl::dtl::destroy_relocated_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -773,27 +777,13 @@ public:
                 // create new element now as a temporary value.
                 value_type tmp(std::forward<Args>(args)...);
 
-                const pointer p2 = data_.last_ - 1;
-
-                const pointer old_last = data_.last_;
-
-                sfl::dtl::construct_at_a
+                sfl::dtl::insert_shift_right_a
                 (
                     data_.ref_to_alloc(),
-                    data_.last_,
-                    std::move(*p2)
-                );
-
-                ++data_.last_;
-
-                sfl::dtl::move_backward
-                (
                     p1,
-                    p2,
-                    old_last
+                    data_.last_,
+                    std::move(tmp)
                 );
-
-                *p1 = std::move(tmp);
             }
 
             return iterator(p1);
@@ -802,7 +792,7 @@ public:
         {
             const difference_type offset = std::distance(cbegin(), pos);
 
-            const size_type new_cap =
+            size_type new_cap =
                 calculate_new_capacity(1, "sfl::small_vector::emplace");
 
             pointer new_first;
@@ -817,7 +807,7 @@ public:
             }
             else
             {
-                new_first = sfl::dtl::allocate(data_.ref_to_alloc(), new_cap);
+                new_first = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), new_cap);
                 new_last  = new_first;
                 new_eos   = new_first + new_cap;
             }
@@ -837,7 +827,7 @@ public:
 
                 const pointer mid = data_.first_ + offset;
 
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -847,7 +837,7 @@ public:
 
                 ++new_last;
 
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     mid,
@@ -888,7 +878,7 @@ public:
                 SFL_RETHROW;
             }
 
-            sfl::dtl::destroy_a
+            sfl::dtl::destroy_relocated_a
             (
                 data_.ref_to_alloc(),
                 data_.first_,
@@ -965,7 +955,7 @@ public:
         }
         else
         {
-            const size_type new_cap =
+            size_type new_cap =
                 calculate_new_capacity(1, "sfl::small_vector::emplace_back");
 
             pointer new_first;
@@ -980,7 +970,7 @@ public:
             }
             else
             {
-                new_first = sfl::dtl::allocate(data_.ref_to_alloc(), new_cap);
+                new_first = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), new_cap);
                 new_last  = new_first;
                 new_eos   = new_first + new_cap;
             }
@@ -998,7 +988,7 @@ public:
 
                 new_last = nullptr;
 
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -1036,7 +1026,7 @@ public:
                 SFL_RETHROW;
             }
 
-            sfl::dtl::destroy_a
+            sfl::dtl::destroy_relocated_a
             (
                 data_.ref_to_alloc(),
                 data_.first_,
@@ -1086,9 +1076,7 @@ public:
 
         const pointer p = data_.first_ + std::distance(cbegin(), pos);
 
-        data_.last_ = sfl::dtl::move(p + 1, data_.last_, p);
-
-        sfl::dtl::destroy_at_a(data_.ref_to_alloc(), data_.last_);
+        data_.last_ = sfl::dtl::erase_shift_left_a(data_.ref_to_alloc(), p, p + 1, data_.last_);
 
         return iterator(p);
     }
@@ -1105,11 +1093,7 @@ public:
         const pointer p1 = data_.first_ + std::distance(cbegin(), first);
         const pointer p2 = data_.first_ + std::distance(cbegin(), last);
 
-        const pointer new_last = sfl::dtl::move(p2, data_.last_, p1);
-
-        sfl::dtl::destroy_a(data_.ref_to_alloc(), new_last, data_.last_);
-
-        data_.last_ = new_last;
+        data_.last_ = sfl::dtl::erase_shift_left_a(data_.ref_to_alloc(), p1, p2, data_.last_);
 
         return iterator(p1);
     }
@@ -1167,7 +1151,7 @@ public:
 
                     new_last = nullptr;
 
-                    new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                    new_last = sfl::dtl::uninitialized_relocate_a
                     (
                         data_.ref_to_alloc(),
                         data_.first_,
@@ -1211,7 +1195,7 @@ public:
                     SFL_RETHROW;
                 }
 
-                sfl::dtl::destroy_a
+                sfl::dtl::destroy_relocated_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -1298,7 +1282,7 @@ public:
 
                     new_last = nullptr;
 
-                    new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                    new_last = sfl::dtl::uninitialized_relocate_a
                     (
                         data_.ref_to_alloc(),
                         data_.first_,
@@ -1342,7 +1326,7 @@ public:
                     SFL_RETHROW;
                 }
 
-                sfl::dtl::destroy_a
+                sfl::dtl::destroy_relocated_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -1549,25 +1533,26 @@ private:
     size_type calculate_new_capacity(size_type num_additional_elements, const char* msg)
     {
         const size_type size = this->size();
-        const size_type capacity = this->capacity();
         const size_type max_size = this->max_size();
 
         if (max_size - size < num_additional_elements)
         {
             sfl::dtl::throw_length_error(msg);
         }
-        else if (max_size - capacity < capacity / 2)
-        {
-            return max_size;
-        }
-        else if (size + num_additional_elements < capacity + capacity / 2)
-        {
-            return std::max(N, capacity + capacity / 2);
-        }
-        else
-        {
-            return std::max(N, size + num_additional_elements);
-        }
+
+        const size_type min_cap = size + num_additional_elements;
+
+        const size_type new_cap = GrowthPolicy::grow
+        (
+            capacity(),
+            min_cap,
+            max_size,
+            sizeof(value_type)
+        );
+
+        SFL_ASSERT(min_cap <= new_cap && new_cap <= max_size);
+
+        return std::max(N, new_cap);
     }
 
     void reset(size_type new_cap = N)
@@ -2124,7 +2109,7 @@ private:
         {
             const difference_type offset = std::distance(cbegin(), pos);
 
-            const size_type new_cap =
+            size_type new_cap =
                 calculate_new_capacity(n, "sfl::small_vector::insert_fill_n");
 
             pointer new_first;
@@ -2139,7 +2124,7 @@ private:
             }
             else
             {
-                new_first = sfl::dtl::allocate(data_.ref_to_alloc(), new_cap);
+                new_first = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), new_cap);
                 new_last  = new_first;
                 new_eos   = new_first + new_cap;
             }
@@ -2164,7 +2149,7 @@ private:
 
                 const pointer mid = data_.first_ + offset;
 
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -2174,7 +2159,7 @@ private:
 
                 new_last += n;
 
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     mid,
@@ -2216,7 +2201,7 @@ private:
                 SFL_RETHROW;
             }
 
-            sfl::dtl::destroy_a
+            sfl::dtl::destroy_relocated_a
             (
                 data_.ref_to_alloc(),
                 data_.first_,
@@ -2337,7 +2322,7 @@ private:
         {
             const difference_type offset = std::distance(cbegin(), pos);
 
-            const size_type new_cap =
+            size_type new_cap =
                 calculate_new_capacity(n, "sfl::small_vector::insert_range");
 
             pointer new_first;
@@ -2352,7 +2337,7 @@ private:
             }
             else
             {
-                new_first = sfl::dtl::allocate(data_.ref_to_alloc(), new_cap);
+                new_first = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), new_cap);
                 new_last  = new_first;
                 new_eos   = new_first + new_cap;
             }
@@ -2361,25 +2346,32 @@ private:
 
             SFL_TRY
             {
+                // New elements are created first so that existing elements
+                // can be relocated after that without further exceptions.
+
                 const pointer mid = data_.first_ + offset;
 
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                sfl::dtl::uninitialized_copy_a
                 (
                     data_.ref_to_alloc(),
-                    data_.first_,
-                    mid,
-                    new_first
+                    first,
+                    last,
+                    p
                 );
 
-                new_last = sfl::dtl::uninitialized_copy_a
+                new_last = nullptr;
+
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
-                    first,
-                    last,
-                    new_last
+                    data_.first_,
+                    mid,
+                    new_first
                 );
 
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last += n;
+
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     mid,
@@ -2389,12 +2381,24 @@ private:
             }
             SFL_CATCH (...)
             {
-                sfl::dtl::destroy_a
-                (
-                    data_.ref_to_alloc(),
-                    new_first,
-                    new_last
-                );
+                if (new_last == nullptr)
+                {
+                    sfl::dtl::destroy_n_a
+                    (
+                        data_.ref_to_alloc(),
+                        p,
+                        n
+                    );
+                }
+                else
+                {
+                    sfl::dtl::destroy_a
+                    (
+                        data_.ref_to_alloc(),
+                        new_first,
+                        new_last
+                    );
+                }
 
                 if (new_first != data_.internal_storage())
                 {
@@ -2409,7 +2413,7 @@ private:
                 SFL_RETHROW;
             }
 
-            sfl::dtl::destroy_a
+            sfl::dtl::destroy_relocated_a
             (
                 data_.ref_to_alloc(),
                 data_.first_,
@@ -2439,85 +2443,85 @@ private:
 // ---- NON-MEMBER FUNCTIONS --------------------------------------------------
 //
 
-template <typename T, std::size_t N, typename A>
+template <typename T, std::size_t N, typename A, typename G>
 SFL_NODISCARD
 bool operator==
 (
-    const small_vector<T, N, A>& x,
-    const small_vector<T, N, A>& y
+    const small_vector<T, N, A, G>& x,
+    const small_vector<T, N, A, G>& y
 )
 {
     return x.size() == y.size() && std::equal(x.begin(), x.end(), y.begin());
 }
 
-template <typename T, std::size_t N, typename A>
+template <typename T, std::size_t N, typename A, typename G>
 SFL_NODISCARD
 bool operator!=
 (
-    const small_vector<T, N, A>& x,
-    const small_vector<T, N, A>& y
+    const small_vector<T, N, A, G>& x,
+    const small_vector<T, N, A, G>& y
 )
 {
     return !(x == y);
 }
 
-template <typename T, std::size_t N, typename A>
+template <typename T, std::size_t N, typename A, typename G>
 SFL_NODISCARD
 bool operator<
 (
-    const small_vector<T, N, A>& x,
-    const small_vector<T, N, A>& y
+    const small_vector<T, N, A, G>& x,
+    const small_vector<T, N, A, G>& y
 )
 {
     return std::lexicographical_compare(x.begin(), x.end(), y.begin(), y.end());
 }
 
-template <typename T, std::size_t N, typename A>
+template <typename T, std::size_t N, typename A, typename G>
 SFL_NODISCARD
 bool operator>
 (
-    const small_vector<T, N, A>& x,
-    const small_vector<T, N, A>& y
+    const small_vector<T, N, A, G>& x,
+    const small_vector<T, N, A, G>& y
 )
 {
     return y < x;
 }
 
-template <typename T, std::size_t N, typename A>
+template <typename T, std::size_t N, typename A, typename G>
 SFL_NODISCARD
 bool operator<=
 (
-    const small_vector<T, N, A>& x,
-    const small_vector<T, N, A>& y
+    const small_vector<T, N, A, G>& x,
+    const small_vector<T, N, A, G>& y
 )
 {
     return !(y < x);
 }
 
-template <typename T, std::size_t N, typename A>
+template <typename T, std::size_t N, typename A, typename G>
 SFL_NODISCARD
 bool operator>=
 (
-    const small_vector<T, N, A>& x,
-    const small_vector<T, N, A>& y
+    const small_vector<T, N, A, G>& x,
+    const small_vector<T, N, A, G>& y
 )
 {
     return !(x < y);
 }
 
-template <typename T, std::size_t N, typename A>
+template <typename T, std::size_t N, typename A, typename G>
 void swap
 (
-    small_vector<T, N, A>& x,
-    small_vector<T, N, A>& y
+    small_vector<T, N, A, G>& x,
+    small_vector<T, N, A, G>& y
 )
 {
     x.swap(y);
 }
 
-template <typename T, std::size_t N, typename A, typename U>
-typename small_vector<T, N, A>::size_type
-    erase(small_vector<T, N, A>& c, const U& value)
+template <typename T, std::size_t N, typename A, typename G, typename U>
+typename small_vector<T, N, A, G>::size_type
+    erase(small_vector<T, N, A, G>& c, const U& value)
 {
     auto it = std::remove(c.begin(), c.end(), value);
     auto r = std::distance(it, c.end());
@@ -2525,9 +2529,9 @@ typename small_vector<T, N, A>::size_type
     return r;
 }
 
-template <typename T, std::size_t N, typename A, typename Predicate>
-typename small_vector<T, N, A>::size_type
-    erase_if(small_vector<T, N, A>& c, Predicate pred)
+template <typename T, std::size_t N, typename A, typename G, typename Predicate>
+typename small_vector<T, N, A, G>::size_type
+    erase_if(small_vector<T, N, A, G>& c, Predicate pred)
 {
     auto it = std::remove_if(c.begin(), c.end(), pred);
     auto r = std::distance(it, c.end());
@@ -22,12 +22,13 @@
 #define SFL_STATIC_FLAT_MAP_HPP_INCLUDED
 
 #include "private.hpp"
+#include "static_vector.hpp"
 
-#include <algorithm>        // copy, move, lower_bound, swap, swap_ranges
+#include <algorithm>        // copy, move, swap, swap_ranges
 #include <cstddef>          // size_t
 #include <functional>       // equal_to, less
 #include <initializer_list> // initializer_list
-#include <iterator>         // distance, next, reverse_iterator
+#include <iterator>         // distance, make_move_iterator, next, reverse_iterator
 #include <limits>           // numeric_limits
 #include <memory>           // allocator, allocator_traits, pointer_traits
 #include <type_traits>      // is_same, is_nothrow_xxxxx
@@ -43,7 +44,9 @@ namespace sfl
 template < typename Key,
            typename T,
            std::size_t N,
-           typename Compare = std::less<Key> >
+           typename Compare = std::less<Key>,
+           bool Freezable = false,
+           bool Learned = false >
 class static_flat_map
 {
     #ifdef SFL_TEST_STATIC_FLAT_MAP
@@ -52,6 +55,12 @@ class static_flat_map
 
     static_assert(N > 0, "N must be greater than zero.");
 
+    static_assert
+    (
+        !Learned || sfl::dtl::is_builtin_less<Key, Key, Compare>::value,
+        "Learned index requires arithmetic Key and std::less."
+    );
+
 public:
 
     using key_type               = Key;
@@ -75,12 +84,14 @@ public:
 
     private:
 
+        SFL_CONSTEXPR_20
         value_compare(const key_compare& c)
             : key_compare(c)
         {}
 
     public:
 
+        SFL_CONSTEXPR_20
         bool operator()(const value_type& x, const value_type& y) const
         {
             return key_compare::operator()(x.first, y.first);
@@ -91,6 +102,10 @@ public:
 
     static constexpr size_type static_capacity = N;
 
+    static constexpr bool freezable = Freezable;
+
+    static constexpr bool learned = Learned;
+
 private:
 
     // Like `value_compare` but with additional operators.
@@ -99,36 +114,43 @@ private:
     {
     public:
 
+        SFL_CONSTEXPR_20
         ultra_compare() noexcept(std::is_nothrow_default_constructible<key_compare>::value)
         {}
 
+        SFL_CONSTEXPR_20
         ultra_compare(const key_compare& c) noexcept(std::is_nothrow_copy_constructible<key_compare>::value)
             : key_compare(c)
         {}
 
+        SFL_CONSTEXPR_20
         ultra_compare(key_compare&& c) noexcept(std::is_nothrow_move_constructible<key_compare>::value)
             : key_compare(std::move(c))
         {}
 
+        SFL_CONSTEXPR_20
         bool operator()(const value_type& x, const value_type& y) const
         {
             return key_compare::operator()(x.first, y.first);
         }
 
         template <typename K>
+        SFL_CONSTEXPR_20
         bool operator()(const value_type& x, const K& y) const
         {
             return key_compare::operator()(x.first, y);
         }
 
         template <typename K>
+        SFL_CONSTEXPR_20
         bool operator()(const K& x, const value_type& y) const
         {
             return key_compare::operator()(x, y.first);
         }
     };
 
-    class data_base
+    class data_base : public sfl::dtl::eytzinger_index<Key, N, Freezable>
+                    , public sfl::dtl::learned_index<Key, N, Learned>
     {
     public:
 
@@ -139,40 +161,58 @@ private:
 
         pointer last_;
 
+        SFL_CONSTEXPR_20
         data_base() noexcept
             : last_(first_)
-        {}
+        {
+            sfl::dtl::initialize_static_storage(first_, N);
+        }
 
         #if defined(__clang__) && (__clang_major__ == 3) // For CentOS 7
+        SFL_CONSTEXPR_20
         ~data_base()
         {}
         #else
+        SFL_CONSTEXPR_20
         ~data_base() noexcept
         {}
         #endif
+
+        // Discards both search index and learned model.
+        SFL_CONSTEXPR_20
+        void clear_index() noexcept
+        {
+            sfl::dtl::eytzinger_index<Key, N, Freezable>::clear_index();
+            this->clear_model();
+        }
     };
 
     class data : public data_base, public ultra_compare
     {
     public:
 
+        SFL_CONSTEXPR_20
         data() noexcept(std::is_nothrow_default_constructible<ultra_compare>::value)
             : ultra_compare()
         {}
 
+        SFL_CONSTEXPR_20
         data(const ultra_compare& comp) noexcept(std::is_nothrow_copy_constructible<ultra_compare>::value)
             : ultra_compare(comp)
         {}
 
+        SFL_CONSTEXPR_20
         data(ultra_compare&& comp) noexcept(std::is_nothrow_move_constructible<ultra_compare>::value)
             : ultra_compare(std::move(comp))
         {}
 
+        SFL_CONSTEXPR_20
         ultra_compare& ref_to_comp() noexcept
         {
             return *this;
         }
 
+        SFL_CONSTEXPR_20
         const ultra_compare& ref_to_comp() const noexcept
         {
             return *this;
@@ -187,26 +227,25 @@ public:
     // ---- CONSTRUCTION AND DESTRUCTION --------------------------------------
     //
 
+    SFL_CONSTEXPR_20
     static_flat_map() noexcept(std::is_nothrow_default_constructible<Compare>::value)
         : data_()
     {}
 
+    SFL_CONSTEXPR_20
     explicit static_flat_map(const Compare& comp) noexcept(std::is_nothrow_copy_constructible<Compare>::value)
         : data_(comp)
     {}
 
     template <typename InputIt,
               sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    SFL_CONSTEXPR_20
     static_flat_map(InputIt first, InputIt last)
         : data_()
     {
         SFL_TRY
         {
-            while (first != last)
-            {
-                emplace(*first);
-                ++first;
-            }
+            insert(first, last);
         }
         SFL_CATCH (...)
         {
@@ -217,16 +256,13 @@ public:
 
     template <typename InputIt,
               sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    SFL_CONSTEXPR_20
     static_flat_map(InputIt first, InputIt last, const Compare& comp)
         : data_(comp)
     {
         SFL_TRY
         {
-            while (first != last)
-            {
-                emplace(*first);
-                ++first;
-            }
+            insert(first, last);
         }
         SFL_CATCH (...)
         {
@@ -235,14 +271,61 @@ public:
         }
     }
 
+    SFL_CONSTEXPR_20
     static_flat_map(std::initializer_list<value_type> ilist)
         : static_flat_map(ilist.begin(), ilist.end())
     {}
 
+    SFL_CONSTEXPR_20
     static_flat_map(std::initializer_list<value_type> ilist, const Compare& comp)
         : static_flat_map(ilist.begin(), ilist.end(), comp)
     {}
 
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    SFL_CONSTEXPR_20
+    static_flat_map(sfl::sorted_unique_t, InputIt first, InputIt last)
+        : data_()
+    {
+        SFL_TRY
+        {
+            insert(sfl::sorted_unique_t(), first, last);
+        }
+        SFL_CATCH (...)
+        {
+            sfl::dtl::destroy(data_.first_, data_.last_);
+            SFL_RETHROW;
+        }
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    SFL_CONSTEXPR_20
+    static_flat_map(sfl::sorted_unique_t, InputIt first, InputIt last, const Compare& comp)
+        : data_(comp)
+    {
+        SFL_TRY
+        {
+            insert(sfl::sorted_unique_t(), first, last);
+        }
+        SFL_CATCH (...)
+        {
+            sfl::dtl::destroy(data_.first_, data_.last_);
+            SFL_RETHROW;
+        }
+    }
+
+    SFL_CONSTEXPR_20
+    static_flat_map(sfl::sorted_unique_t, std::initializer_list<value_type> ilist)
+        : static_flat_map(sfl::sorted_unique_t(), ilist.begin(), ilist.end())
+    {}
+
+    SFL_CONSTEXPR_20
+    static_flat_map(sfl::sorted_unique_t, std::initializer_list<value_type> ilist, const Compare& comp)
+        : static_flat_map(sfl::sorted_unique_t(), ilist.begin(), ilist.end(), comp)
+    {}
+
+    SFL_CONSTEXPR_20
     static_flat_map(const static_flat_map& other)
         : data_(other.data_.ref_to_comp())
     {
@@ -252,8 +335,19 @@ public:
             pointer(other.data_.last_),
             data_.first_
         );
+
+        if (other.frozen())
+        {
+            build_index();
+        }
+
+        if (other.fitted())
+        {
+            build_model();
+        }
     }
 
+    SFL_CONSTEXPR_20
     static_flat_map(static_flat_map&& other)
         : data_(std::move(other.data_.ref_to_comp()))
     {
@@ -263,8 +357,19 @@ public:
             std::make_move_iterator(pointer(other.data_.last_)),
             data_.first_
         );
+
+        if (other.frozen())
+        {
+            build_index();
+        }
+
+        if (other.fitted())
+        {
+            build_model();
+        }
     }
 
+    SFL_CONSTEXPR_20
     ~static_flat_map()
     {
         sfl::dtl::destroy(data_.first_, data_.last_);
@@ -274,6 +379,7 @@ public:
     // ---- ASSIGNMENT --------------------------------------------------------
     //
 
+    SFL_CONSTEXPR_20
     static_flat_map& operator=(const static_flat_map& other)
     {
         if (this != &other)
@@ -285,11 +391,22 @@ public:
                 pointer(other.data_.first_),
                 pointer(other.data_.last_)
             );
+
+            if (other.frozen())
+            {
+                build_index();
+            }
+
+            if (other.fitted())
+            {
+                build_model();
+            }
         }
 
         return *this;
     }
 
+    SFL_CONSTEXPR_20
     static_flat_map& operator=(static_flat_map&& other)
     {
         data_.ref_to_comp() = other.data_.ref_to_comp();
@@ -300,9 +417,20 @@ public:
             std::make_move_iterator(pointer(other.data_.last_))
         );
 
+        if (other.frozen())
+        {
+            build_index();
+        }
+
+        if (other.fitted())
+        {
+            build_model();
+        }
+
         return *this;
     }
 
+    SFL_CONSTEXPR_20
     static_flat_map& operator=(std::initializer_list<value_type> ilist)
     {
         assign_range(ilist.begin(), ilist.end());
@@ -314,6 +442,7 @@ public:
     //
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     key_compare key_comp() const
     {
         return data_.ref_to_comp();
@@ -324,6 +453,7 @@ public:
     //
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     value_compare value_comp() const
     {
         return value_compare(data_.ref_to_comp());
@@ -334,78 +464,91 @@ public:
     //
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     iterator begin() noexcept
     {
         return iterator(data_.first_);
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     const_iterator begin() const noexcept
     {
         return const_iterator(data_.first_);
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     const_iterator cbegin() const noexcept
     {
         return const_iterator(data_.first_);
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     iterator end() noexcept
     {
         return iterator(data_.last_);
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     const_iterator end() const noexcept
     {
         return const_iterator(data_.last_);
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     const_iterator cend() const noexcept
     {
         return const_iterator(data_.last_);
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     reverse_iterator rbegin() noexcept
     {
         return reverse_iterator(end());
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     const_reverse_iterator rbegin() const noexcept
     {
         return const_reverse_iterator(end());
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     const_reverse_iterator crbegin() const noexcept
     {
         return const_reverse_iterator(end());
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     reverse_iterator rend() noexcept
     {
         return reverse_iterator(begin());
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     const_reverse_iterator rend() const noexcept
     {
         return const_reverse_iterator(begin());
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     const_reverse_iterator crend() const noexcept
     {
         return const_reverse_iterator(begin());
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     iterator nth(size_type pos) noexcept
     {
         SFL_ASSERT(pos <= size());
@@ -413,6 +556,7 @@ public:
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     const_iterator nth(size_type pos) const noexcept
     {
         SFL_ASSERT(pos <= size());
@@ -420,6 +564,7 @@ public:
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     size_type index_of(const_iterator pos) const noexcept
     {
         SFL_ASSERT(cbegin() <= pos && pos <= cend());
@@ -431,18 +576,21 @@ public:
     //
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     bool empty() const noexcept
     {
         return data_.first_ == data_.last_;
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     bool full() const noexcept
     {
         return std::distance(begin(), end()) == N;
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     size_type size() const noexcept
     {
         return std::distance(begin(), end());
@@ -461,6 +609,7 @@ public:
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     size_type available() const noexcept
     {
         return capacity() - size();
@@ -470,33 +619,39 @@ public:
     // ---- MODIFIERS ---------------------------------------------------------
     //
 
+    SFL_CONSTEXPR_20
     void clear() noexcept
     {
+        data_.clear_index();
         sfl::dtl::destroy(data_.first_, data_.last_);
         data_.last_ = data_.first_;
     }
 
     template <typename... Args>
+    SFL_CONSTEXPR_20
     std::pair<iterator, bool> emplace(Args&&... args)
     {
         SFL_ASSERT(!full());
-        return insert_aux(value_type(std::forward<Args>(args)...));
+        return emplace_aux(std::forward<Args>(args)...);
     }
 
     template <typename... Args>
+    SFL_CONSTEXPR_20
     iterator emplace_hint(const_iterator hint, Args&&... args)
     {
         SFL_ASSERT(!full());
         SFL_ASSERT(cbegin() <= hint && hint <= cend());
-        return insert_aux(hint, value_type(std::forward<Args>(args)...));
+        return emplace_hint_aux(hint, std::forward<Args>(args)...);
     }
 
+    SFL_CONSTEXPR_20
     std::pair<iterator, bool> insert(const value_type& value)
     {
         SFL_ASSERT(!full());
         return insert_aux(value);
     }
 
+    SFL_CONSTEXPR_20
     std::pair<iterator, bool> insert(value_type&& value)
     {
         SFL_ASSERT(!full());
@@ -505,12 +660,14 @@ public:
 
     template <typename P,
               sfl::dtl::enable_if_t<std::is_constructible<value_type, P&&>::value>* = nullptr>
+    SFL_CONSTEXPR_20
     std::pair<iterator, bool> insert(P&& value)
     {
         SFL_ASSERT(!full());
         return insert_aux(value_type(std::forward<P>(value)));
     }
 
+    SFL_CONSTEXPR_20
     iterator insert(const_iterator hint, const value_type& value)
     {
         SFL_ASSERT(!full());
@@ -518,6 +675,7 @@ public:
         return insert_aux(hint, value);
     }
 
+    SFL_CONSTEXPR_20
     iterator insert(const_iterator hint, value_type&& value)
     {
         SFL_ASSERT(!full());
@@ -527,6 +685,7 @@ public:
 
     template <typename P,
               sfl::dtl::enable_if_t<std::is_constructible<value_type, P>::value>* = nullptr>
+    SFL_CONSTEXPR_20
     iterator insert(const_iterator hint, P&& value)
     {
         SFL_ASSERT(!full());
@@ -536,22 +695,35 @@ public:
 
     template <typename InputIt,
               sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    SFL_CONSTEXPR_20
     void insert(InputIt first, InputIt last)
     {
-        while (first != last)
-        {
-            insert(*first);
-            ++first;
-        }
+        insert_range_aux(first, last);
     }
 
+    SFL_CONSTEXPR_20
     void insert(std::initializer_list<value_type> ilist)
     {
         insert(ilist.begin(), ilist.end());
     }
 
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    SFL_CONSTEXPR_20
+    void insert(sfl::sorted_unique_t, InputIt first, InputIt last)
+    {
+        insert_sorted_range_aux(first, last);
+    }
+
+    SFL_CONSTEXPR_20
+    void insert(sfl::sorted_unique_t, std::initializer_list<value_type> ilist)
+    {
+        insert(sfl::sorted_unique_t(), ilist.begin(), ilist.end());
+    }
+
     template <typename M,
               sfl::dtl::enable_if_t<std::is_assignable<mapped_type&, M&&>::value>* = nullptr>
+    SFL_CONSTEXPR_20
     std::pair<iterator, bool> insert_or_assign(const Key& key, M&& obj)
     {
         SFL_ASSERT(!full());
@@ -560,6 +732,7 @@ public:
 
     template <typename M,
               sfl::dtl::enable_if_t<std::is_assignable<mapped_type&, M&&>::value>* = nullptr>
+    SFL_CONSTEXPR_20
     std::pair<iterator, bool> insert_or_assign(Key&& key, M&& obj)
     {
         SFL_ASSERT(!full());
@@ -569,6 +742,7 @@ public:
     template <typename K, typename M,
               sfl::dtl::enable_if_t< sfl::dtl::has_is_transparent<Compare, K>::value &&
                                      std::is_assignable<mapped_type&, M&&>::value >* = nullptr>
+    SFL_CONSTEXPR_20
     std::pair<iterator, bool> insert_or_assign(K&& key, M&& obj)
     {
         SFL_ASSERT(!full());
@@ -577,6 +751,7 @@ public:
 
     template <typename M,
               sfl::dtl::enable_if_t<std::is_assignable<mapped_type&, M&&>::value>* = nullptr>
+    SFL_CONSTEXPR_20
     iterator insert_or_assign(const_iterator hint, const Key& key, M&& obj)
     {
         SFL_ASSERT(!full());
@@ -586,6 +761,7 @@ public:
 
     template <typename M,
               sfl::dtl::enable_if_t<std::is_assignable<mapped_type&, M&&>::value>* = nullptr>
+    SFL_CONSTEXPR_20
     iterator insert_or_assign(const_iterator hint, Key&& key, M&& obj)
     {
         SFL_ASSERT(!full());
@@ -596,6 +772,7 @@ public:
     template <typename K, typename M,
               sfl::dtl::enable_if_t< sfl::dtl::has_is_transparent<Compare, K>::value &&
                                      std::is_assignable<mapped_type&, M&&>::value >* = nullptr>
+    SFL_CONSTEXPR_20
     iterator insert_or_assign(const_iterator hint, K&& key, M&& obj)
     {
         SFL_ASSERT(!full());
@@ -604,6 +781,7 @@ public:
     }
 
     template <typename... Args>
+    SFL_CONSTEXPR_20
     std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args)
     {
         SFL_ASSERT(!full());
@@ -611,6 +789,7 @@ public:
     }
 
     template <typename... Args>
+    SFL_CONSTEXPR_20
     std::pair<iterator, bool> try_emplace(Key&& key, Args&&... args)
     {
         SFL_ASSERT(!full());
@@ -627,6 +806,7 @@ public:
                 !std::is_convertible<K&&, const_iterator>::value &&
                 !std::is_convertible<K&&, iterator>::value
               >* = nullptr>
+    SFL_CONSTEXPR_20
     std::pair<iterator, bool> try_emplace(K&& key, Args&&... args)
     {
         SFL_ASSERT(!full());
@@ -634,6 +814,7 @@ public:
     }
 
     template <typename... Args>
+    SFL_CONSTEXPR_20
     iterator try_emplace(const_iterator hint, const Key& key, Args&&... args)
     {
         SFL_ASSERT(!full());
@@ -642,6 +823,7 @@ public:
     }
 
     template <typename... Args>
+    SFL_CONSTEXPR_20
     iterator try_emplace(const_iterator hint, Key&& key, Args&&... args)
     {
         SFL_ASSERT(!full());
@@ -657,6 +839,7 @@ public:
                 #endif
                 sfl::dtl::has_is_transparent<Compare, K>::value
               >* = nullptr>
+    SFL_CONSTEXPR_20
     iterator try_emplace(const_iterator hint, K&& key, Args&&... args)
     {
         SFL_ASSERT(!full());
@@ -664,15 +847,19 @@ public:
         return try_emplace_aux(hint, std::forward<K>(key), std::forward<Args>(args)...);
     }
 
+    SFL_CONSTEXPR_20
     iterator erase(iterator pos)
     {
         return erase(const_iterator(pos));
     }
 
+    SFL_CONSTEXPR_20
     iterator erase(const_iterator pos)
     {
         SFL_ASSERT(cbegin() <= pos && pos < cend());
 
+        data_.clear_index();
+
         const pointer p = data_.first_ + std::distance(cbegin(), pos);
 
         data_.last_ = sfl::dtl::move(p + 1, data_.last_, p);
@@ -682,6 +869,7 @@ public:
         return iterator(p);
     }
 
+    SFL_CONSTEXPR_20
     iterator erase(const_iterator first, const_iterator last)
     {
         SFL_ASSERT(cbegin() <= first && first <= last && last <= cend());
@@ -691,6 +879,8 @@ public:
             return begin() + std::distance(cbegin(), first);
         }
 
+        data_.clear_index();
+
         const pointer p1 = data_.first_ + std::distance(cbegin(), first);
         const pointer p2 = data_.first_ + std::distance(cbegin(), last);
 
@@ -703,6 +893,7 @@ public:
         return iterator(p1);
     }
 
+    SFL_CONSTEXPR_20
     size_type erase(const Key& key)
     {
         auto it = find(key);
@@ -716,6 +907,7 @@ public:
 
     template <typename K,
               sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    SFL_CONSTEXPR_20
     size_type erase(K&& x)
     {
         auto it = find(x);
@@ -727,6 +919,7 @@ public:
         return 1;
     }
 
+    SFL_CONSTEXPR_20
     void swap(static_flat_map& other)
     {
         if (this == &other)
@@ -734,6 +927,15 @@ public:
             return;
         }
 
+        const bool this_frozen  = this->frozen();
+        const bool other_frozen = other.frozen();
+
+        const bool this_fitted  = this->fitted();
+        const bool other_fitted = other.fitted();
+
+        this->data_.clear_index();
+        other.data_.clear_index();
+
         using std::swap;
 
         swap(this->data_.ref_to_comp(), other.data_.ref_to_comp());
@@ -788,6 +990,56 @@ public:
 
         this->data_.last_ = this->data_.first_ + other_size;
         other.data_.last_ = other.data_.first_ + this_size;
+
+        if (other_frozen)
+        {
+            this->build_index();
+        }
+
+        if (this_frozen)
+        {
+            other.build_index();
+        }
+
+        if (other_fitted)
+        {
+            this->build_model();
+        }
+
+        if (this_fitted)
+        {
+            other.build_model();
+        }
+    }
+
+    // Moves all elements into a static vector and leaves the container empty.
+    SFL_CONSTEXPR_20
+    sfl::static_vector<value_type, N> extract()
+    {
+        sfl::static_vector<value_type, N> result
+        (
+            std::make_move_iterator(data_.first_),
+            std::make_move_iterator(data_.last_)
+        );
+
+        clear();
+
+        return result;
+    }
+
+    // Replaces all elements with elements moved from `cont`.
+    SFL_CONSTEXPR_20
+    void replace(sfl::static_vector<value_type, N>&& cont)
+    {
+        SFL_ASSERT(sfl::dtl::is_sorted_unique(cont.begin(), cont.end(), data_.ref_to_comp()));
+
+        assign_range
+        (
+            std::make_move_iterator(cont.begin()),
+            std::make_move_iterator(cont.end())
+        );
+
+        cont.clear();
     }
 
     //
@@ -795,90 +1047,107 @@ public:
     //
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     iterator lower_bound(const Key& key)
     {
-        return std::lower_bound(begin(), end(), key, data_.ref_to_comp());
+        return begin() + lower_bound_index(key);
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     const_iterator lower_bound(const Key& key) const
     {
-        return std::lower_bound(begin(), end(), key, data_.ref_to_comp());
+        return begin() + lower_bound_index(key);
     }
 
     template <typename K,
               sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     iterator lower_bound(const K& x)
     {
-        return std::lower_bound(begin(), end(), x, data_.ref_to_comp());
+        return begin() + lower_bound_index(x);
     }
 
     template <typename K,
               sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     const_iterator lower_bound(const K& x) const
     {
-        return std::lower_bound(begin(), end(), x, data_.ref_to_comp());
+        return begin() + lower_bound_index(x);
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     iterator upper_bound(const Key& key)
     {
-        return std::upper_bound(begin(), end(), key, data_.ref_to_comp());
+        return begin() + upper_bound_index(key);
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     const_iterator upper_bound(const Key& key) const
     {
-        return std::upper_bound(begin(), end(), key, data_.ref_to_comp());
+        return begin() + upper_bound_index(key);
     }
 
     template <typename K,
               sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     iterator upper_bound(const K& x)
     {
-        return std::upper_bound(begin(), end(), x, data_.ref_to_comp());
+        return begin() + upper_bound_index(x);
     }
 
     template <typename K,
               sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     const_iterator upper_bound(const K& x) const
     {
-        return std::upper_bound(begin(), end(), x, data_.ref_to_comp());
+        return begin() + upper_bound_index(x);
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     std::pair<iterator, iterator> equal_range(const Key& key)
     {
-        return std::equal_range(begin(), end(), key, data_.ref_to_comp());
+        const auto r = equal_range_index(key);
+        return std::make_pair(begin() + r.first, begin() + r.second);
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     std::pair<const_iterator, const_iterator> equal_range(const Key& key) const
     {
-        return std::equal_range(begin(), end(), key, data_.ref_to_comp());
+        const auto r = equal_range_index(key);
+        return std::make_pair(begin() + r.first, begin() + r.second);
     }
 
     template <typename K,
               sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     std::pair<iterator, iterator> equal_range(const K& x)
     {
-        return std::equal_range(begin(), end(), x, data_.ref_to_comp());
+        const auto r = equal_range_index(x);
+        return std::make_pair(begin() + r.first, begin() + r.second);
     }
 
     template <typename K,
               sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     std::pair<const_iterator, const_iterator> equal_range(const K& x) const
     {
-        return std::equal_range(begin(), end(), x, data_.ref_to_comp());
+        const auto r = equal_range_index(x);
+        return std::make_pair(begin() + r.first, begin() + r.second);
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     iterator find(const Key& key)
     {
         auto it = lower_bound(key);
@@ -892,6 +1161,7 @@ public:
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     const_iterator find(const Key& key) const
     {
         auto it = lower_bound(key);
@@ -907,6 +1177,7 @@ public:
     template <typename K,
               sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     iterator find(const K& x)
     {
         auto it = lower_bound(x);
@@ -922,6 +1193,7 @@ public:
     template <typename K,
               sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     const_iterator find(const K& x) const
     {
         auto it = lower_bound(x);
@@ -935,6 +1207,7 @@ public:
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     size_type count(const Key& key) const
     {
         return find(key) != end();
@@ -943,12 +1216,14 @@ public:
     template <typename K,
               sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     size_type count(const K& x) const
     {
         return find(x) != end();
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     bool contains(const Key& key) const
     {
         return find(key) != end();
@@ -957,16 +1232,61 @@ public:
     template <typename K,
               sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     bool contains(const K& x) const
     {
         return find(x) != end();
     }
 
+    //
+    // ---- FROZEN INDEX ------------------------------------------------------
+    //
+
+    // Available only if `Freezable` is true. Builds a read-only search index
+    // that is used by lookup functions until the next modification.
+    template <bool F = Freezable,
+              sfl::dtl::enable_if_t<F>* = nullptr>
+    SFL_CONSTEXPR_20
+    void freeze()
+    {
+        build_index();
+    }
+
+    SFL_NODISCARD
+    SFL_CONSTEXPR_20
+    bool frozen() const noexcept
+    {
+        return data_.indexed();
+    }
+
+    //
+    // ---- LEARNED INDEX -----------------------------------------------------
+    //
+
+    // Available only if `Learned` is true. Fits a piecewise linear model of
+    // positions of keys that is used by lookup functions until the next
+    // modification.
+    template <bool L = Learned,
+              sfl::dtl::enable_if_t<L>* = nullptr>
+    SFL_CONSTEXPR_20
+    void fit()
+    {
+        build_model();
+    }
+
+    SFL_NODISCARD
+    SFL_CONSTEXPR_20
+    bool fitted() const noexcept
+    {
+        return data_.fitted();
+    }
+
     //
     // ---- ELEMENT ACCESS ----------------------------------------------------
     //
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     T& at(const Key& key)
     {
         auto it = find(key);
@@ -980,6 +1300,7 @@ public:
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     const T& at(const Key& key) const
     {
         auto it = find(key);
@@ -995,6 +1316,7 @@ public:
     template <typename K,
               sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     T& at(const K& x)
     {
         auto it = find(x);
@@ -1010,6 +1332,7 @@ public:
     template <typename K,
               sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     const T& at(const K& x) const
     {
         auto it = find(x);
@@ -1023,12 +1346,14 @@ public:
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     T& operator[](const Key& key)
     {
         return try_emplace(key).first->second;
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     T& operator[](Key&& key)
     {
         return try_emplace(std::move(key)).first->second;
@@ -1037,18 +1362,21 @@ public:
     template <typename K,
               sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     T& operator[](K&& key)
     {
         return try_emplace(std::forward<K>(key)).first->second;
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     value_type* data() noexcept
     {
         return data_.first_;
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     const value_type* data() const noexcept
     {
         return data_.first_;
@@ -1056,10 +1384,152 @@ public:
 
 private:
 
+    SFL_CONSTEXPR_20
+    void build_index()
+    {
+        data_.build_index
+        (
+            data_.first_,
+            size(),
+            [](const value_type& x) -> const Key& { return x.first; }
+        );
+    }
+
+    SFL_CONSTEXPR_20
+    void build_model()
+    {
+        data_.fit_model
+        (
+            data_.first_,
+            size(),
+            [](const value_type& x) -> const Key& { return x.first; }
+        );
+    }
+
+    // Model predicts range of positions that contains the result, which is
+    // then found by binary search within that range.
+    template <typename K>
+    SFL_CONSTEXPR_20
+    size_type model_lower_bound_index(const K& x) const
+    {
+        const auto w = data_.model_window(x);
+
+        return std::distance
+        (
+            begin(),
+            sfl::dtl::lower_bound(nth(w.first), nth(w.second), x, data_.ref_to_comp())
+        );
+    }
+
+    template <typename K>
+    SFL_CONSTEXPR_20
+    size_type model_upper_bound_index(const K& x) const
+    {
+        const auto w = data_.model_window(x);
+
+        return std::distance
+        (
+            begin(),
+            sfl::dtl::upper_bound(nth(w.first), nth(w.second), x, data_.ref_to_comp())
+        );
+    }
+
+    template <typename K>
+    SFL_CONSTEXPR_20
+    size_type lower_bound_index(const K& x) const
+    {
+        if (data_.fitted())
+        {
+            return model_lower_bound_index(x);
+        }
+
+        if (data_.indexed())
+        {
+            return data_.index_lower_bound(x, static_cast<const key_compare&>(data_.ref_to_comp()));
+        }
+
+        return std::distance
+        (
+            begin(),
+            sfl::dtl::lower_bound(begin(), end(), x, data_.ref_to_comp())
+        );
+    }
+
+    template <typename K>
+    SFL_CONSTEXPR_20
+    size_type upper_bound_index(const K& x) const
+    {
+        if (data_.fitted())
+        {
+            return model_upper_bound_index(x);
+        }
+
+        if (data_.indexed())
+        {
+            return data_.index_upper_bound(x, static_cast<const key_compare&>(data_.ref_to_comp()));
+        }
+
+        return std::distance
+        (
+            begin(),
+            sfl::dtl::upper_bound(begin(), end(), x, data_.ref_to_comp())
+        );
+    }
+
+    SFL_CONSTEXPR_20
+    std::pair<size_type, size_type> equal_range_index(const Key& x) const
+    {
+        if (data_.fitted() || data_.indexed())
+        {
+            // Keys are unique, so the range contains at most one element.
+            const size_type i = data_.fitted()
+                ? model_lower_bound_index(x)
+                : data_.index_lower_bound(x, static_cast<const key_compare&>(data_.ref_to_comp()));
+
+            if (i != size() && !data_.ref_to_comp()(x, data_.first_[i]))
+            {
+                return std::make_pair(i, i + 1);
+            }
+
+            return std::make_pair(i, i);
+        }
+
+        const auto r = sfl::dtl::equal_range(begin(), end(), x, data_.ref_to_comp());
+
+        return std::make_pair
+        (
+            size_type(std::distance(begin(), r.first)),
+            size_type(std::distance(begin(), r.second))
+        );
+    }
+
+    // Several unique keys can be equivalent to `x` under transparent
+    // comparator, so the upper end is searched for too.
+    template <typename K>
+    SFL_CONSTEXPR_20
+    std::pair<size_type, size_type> equal_range_index(const K& x) const
+    {
+        if (data_.fitted() || data_.indexed())
+        {
+            return std::make_pair(lower_bound_index(x), upper_bound_index(x));
+        }
+
+        const auto r = sfl::dtl::equal_range(begin(), end(), x, data_.ref_to_comp());
+
+        return std::make_pair
+        (
+            size_type(std::distance(begin(), r.first)),
+            size_type(std::distance(begin(), r.second))
+        );
+    }
+
     template <typename ForwardIt,
               sfl::dtl::enable_if_t<sfl::dtl::is_forward_iterator<ForwardIt>::value>* = nullptr>
+    SFL_CONSTEXPR_20
     void assign_range(ForwardIt first, ForwardIt last)
     {
+        data_.clear_index();
+
         SFL_ASSERT(size_type(std::distance(first, last)) <= capacity());
 
         const size_type n = std::distance(first, last);
@@ -1103,7 +1573,59 @@ private:
         }
     }
 
+    // Key is taken from arguments and searched for before the element is
+    // constructed, so nothing is constructed if the key already exists.
+    template <typename... Args,
+              sfl::dtl::enable_if_t<sfl::dtl::is_map_key_extractable<Key, Args...>::value>* = nullptr>
+    SFL_CONSTEXPR_20
+    std::pair<iterator, bool> emplace_aux(Args&&... args)
+    {
+        const Key& key = sfl::dtl::extract_map_key(args...);
+
+        auto it = lower_bound(key);
+
+        if (it == end() || data_.ref_to_comp()(key, *it))
+        {
+            return std::make_pair(emplace_exactly_at(it, std::forward<Args>(args)...), true);
+        }
+
+        return std::make_pair(it, false);
+    }
+
+    // Key cannot be taken from arguments, so the element is constructed
+    // first and then inserted.
+    template <typename... Args,
+              sfl::dtl::enable_if_t<!sfl::dtl::is_map_key_extractable<Key, Args...>::value>* = nullptr>
+    SFL_CONSTEXPR_20
+    std::pair<iterator, bool> emplace_aux(Args&&... args)
+    {
+        return insert_aux(value_type(std::forward<Args>(args)...));
+    }
+
+    template <typename... Args,
+              sfl::dtl::enable_if_t<sfl::dtl::is_map_key_extractable<Key, Args...>::value>* = nullptr>
+    SFL_CONSTEXPR_20
+    iterator emplace_hint_aux(const_iterator hint, Args&&... args)
+    {
+        if (is_insert_hint_good(hint, sfl::dtl::extract_map_key(args...)))
+        {
+            return emplace_exactly_at(hint, std::forward<Args>(args)...);
+        }
+
+        // Hint is not good. Use non-hinted function.
+        return emplace_aux(std::forward<Args>(args)...).first;
+    }
+
+    template <typename... Args,
+              sfl::dtl::enable_if_t<!sfl::dtl::is_map_key_extractable<Key, Args...>::value>* = nullptr>
+    SFL_CONSTEXPR_20
+    iterator emplace_hint_aux(const_iterator hint, Args&&... args)
+    {
+        return insert_aux(hint, value_type(std::forward<Args>(args)...));
+    }
+
     template <typename Value>
+    SFL_CONSTEXPR_20
     std::pair<iterator, bool> insert_aux(Value&& value)
     {
         auto it = lower_bound(value.first);
@@ -1117,6 +1639,7 @@ private:
     }
 
     template <typename Value>
+    SFL_CONSTEXPR_20
     iterator insert_aux(const_iterator hint, Value&& value)
     {
         if (is_insert_hint_good(hint, value))
@@ -1129,6 +1652,7 @@ private:
     }
 
     template <typename K, typename M>
+    SFL_CONSTEXPR_20
     std::pair<iterator, bool> insert_or_assign_aux(K&& key, M&& obj)
     {
         auto it = lower_bound(key);
@@ -1137,15 +1661,12 @@ private:
         {
             return std::make_pair
             (
-                insert_exactly_at
+                emplace_exactly_at
                 (
                     it,
-                    value_type
-                    (
-                        std::piecewise_construct,
-                        std::forward_as_tuple(std::forward<K>(key)),
-                        std::forward_as_tuple(std::forward<M>(obj))
-                    )
+                    std::piecewise_construct,
+                    std::forward_as_tuple(std::forward<K>(key)),
+                    std::forward_as_tuple(std::forward<M>(obj))
                 ),
                 true
             );
@@ -1156,19 +1677,17 @@ private:
     }
 
     template <typename K, typename M>
+    SFL_CONSTEXPR_20
     iterator insert_or_assign_aux(const_iterator hint, K&& key, M&& obj)
     {
         if (is_insert_hint_good(hint, key))
         {
-            return insert_exactly_at
+            return emplace_exactly_at
             (
                 hint,
-                value_type
-                (
-                    std::piecewise_construct,
-                    std::forward_as_tuple(std::forward<K>(key)),
-                    std::forward_as_tuple(std::forward<M>(obj))
-                )
+                std::piecewise_construct,
+                std::forward_as_tuple(std::forward<K>(key)),
+                std::forward_as_tuple(std::forward<M>(obj))
             );
         }
 
@@ -1177,6 +1696,7 @@ private:
     }
 
     template <typename K, typename... Args>
+    SFL_CONSTEXPR_20
     std::pair<iterator, bool> try_emplace_aux(K&& key, Args&&... args)
     {
         auto it = lower_bound(key);
@@ -1185,15 +1705,12 @@ private:
         {
             return std::make_pair
             (
-                insert_exactly_at
+                emplace_exactly_at
                 (
                     it,
-                    value_type
-                    (
-                        std::piecewise_construct,
-                        std::forward_as_tuple(std::forward<K>(key)),
-                        std::forward_as_tuple(std::forward<Args>(args)...)
-                    )
+                    std::piecewise_construct,
+                    std::forward_as_tuple(std::forward<K>(key)),
+                    std::forward_as_tuple(std::forward<Args>(args)...)
                 ),
                 true
             );
@@ -1203,19 +1720,17 @@ private:
     }
 
     template <typename K, typename... Args>
+    SFL_CONSTEXPR_20
     iterator try_emplace_aux(const_iterator hint, K&& key, Args&&... args)
     {
         if (is_insert_hint_good(hint, key))
         {
-            return insert_exactly_at
+            return emplace_exactly_at
             (
                 hint,
-                value_type
-                (
-                    std::piecewise_construct,
-                    std::forward_as_tuple(std::forward<K>(key)),
-                    std::forward_as_tuple(std::forward<Args>(args)...)
-                )
+                std::piecewise_construct,
+                std::forward_as_tuple(std::forward<K>(key)),
+                std::forward_as_tuple(std::forward<Args>(args)...)
             );
         }
 
@@ -1223,9 +1738,156 @@ private:
         return try_emplace_aux(std::forward<K>(key), std::forward<Args>(args)...).first;
     }
 
+    // Appends as many elements as fit into internal storage and then sorts
+    // and merges them at once, which takes O(m * log(m)^2 + (n + m) *
+    // log(n + m)) element moves instead of O(n * m). Repeats until all
+    // elements are inserted.
+    template <typename InputIt>
+    SFL_CONSTEXPR_20
+    void insert_range_aux(InputIt first, InputIt last)
+    {
+        while (first != last)
+        {
+            if (full())
+            {
+                insert(*first);
+                ++first;
+                continue;
+            }
+
+            const size_type old_size = size();
+
+            SFL_TRY
+            {
+                while (first != last && !full())
+                {
+                    insert_exactly_at(cend(), *first);
+                    ++first;
+                }
+            }
+            SFL_CATCH (...)
+            {
+                erase(nth(old_size), cend());
+                SFL_RETHROW;
+            }
+
+            merge_appended(old_size);
+        }
+    }
+
+    // Appends as many elements as fit into internal storage and merges them
+    // with existing elements. Unlike `insert_range_aux`, appended elements
+    // are not sorted because they must already be in order. Remaining
+    // elements (if any) are inserted using `insert_range_aux`.
+    template <typename InputIt>
+    SFL_CONSTEXPR_20
+    void insert_sorted_range_aux(InputIt first, InputIt last)
+    {
+        const size_type old_size = size();
+
+        SFL_TRY
+        {
+            while (first != last && !full())
+            {
+                insert_exactly_at(cend(), *first);
+                ++first;
+            }
+        }
+        SFL_CATCH (...)
+        {
+            erase(nth(old_size), cend());
+            SFL_RETHROW;
+        }
+
+        SFL_ASSERT(sfl::dtl::is_sorted_unique(data_.first_ + old_size, data_.last_, data_.ref_to_comp()));
+
+        merge_sorted_appended(old_size);
+
+        insert_range_aux(first, last);
+    }
+
+    // Sorts elements at positions `pos` and above and merges them with
+    // preceding elements, keeping only the first of equivalent elements.
+    // Sorting and merging never allocate memory.
+    SFL_CONSTEXPR_20
+    void merge_appended(size_type pos)
+    {
+        const pointer mid = data_.first_ + pos;
+
+        SFL_TRY
+        {
+            sfl::dtl::stable_sort_in_place(mid, data_.last_, data_.ref_to_comp());
+        }
+        SFL_CATCH (...)
+        {
+            erase(nth(pos), cend());
+            SFL_RETHROW;
+        }
+
+        merge_sorted_appended(pos);
+    }
+
+    // Merges sorted elements at positions `pos` and above with preceding
+    // elements, keeping only the first of equivalent elements.
+    // Merging does not allocate memory, so if an exception is thrown, the
+    // order of elements is unknown and all elements are removed.
+    SFL_CONSTEXPR_20
+    void merge_sorted_appended(size_type pos)
+    {
+        SFL_TRY
+        {
+            sfl::dtl::merge_in_place(data_.first_, data_.first_ + pos, data_.last_, data_.ref_to_comp());
+
+            const pointer new_last = sfl::dtl::unique_sorted
+            (
+                data_.first_,
+                data_.last_,
+                data_.ref_to_comp()
+            );
+
+            erase(nth(std::distance(data_.first_, new_last)), cend());
+        }
+        SFL_CATCH (...)
+        {
+            // Order of elements is unknown, so they are all removed.
+            clear();
+            SFL_RETHROW;
+        }
+    }
+
+    // Constructs new element from `args` directly in place if it goes to
+    // the end. Otherwise, element is constructed as a temporary before
+    // existing elements are moved.
+    template <typename... Args>
+    SFL_CONSTEXPR_20
+    iterator emplace_exactly_at(const_iterator pos, Args&&... args)
+    {
+        SFL_ASSERT(!full());
+
+        if (pos == cend())
+        {
+            data_.clear_index();
+
+            sfl::dtl::construct_at
+            (
+                data_.last_,
+                std::forward<Args>(args)...
+            );
+
+            ++data_.last_;
+
+            return iterator(data_.last_ - 1);
+        }
+
+        return insert_exactly_at(pos, value_type(std::forward<Args>(args)...));
+    }
+
     template <typename Value>
+    SFL_CONSTEXPR_20
     iterator insert_exactly_at(const_iterator pos, Value&& value)
     {
+        data_.clear_index();
+
         SFL_ASSERT(!full());
         SFL_ASSERT(cbegin() <= pos && pos <= cend());
 
@@ -1269,6 +1931,7 @@ private:
     }
 
     template <typename Value>
+    SFL_CONSTEXPR_20
     bool is_insert_hint_good(const_iterator hint, const Value& value)
     {
         return (hint == begin() || data_.ref_to_comp()(*(hint - 1), value))
@@ -1280,85 +1943,93 @@ private:
 // ---- NON-MEMBER FUNCTIONS --------------------------------------------------
 //
 
-template <typename K, typename T, std::size_t N, typename C>
+template <typename K, typename T, std::size_t N, typename C, bool F, bool L>
 SFL_NODISCARD
+SFL_CONSTEXPR_20
 bool operator==
 (
-    const static_flat_map<K, T, N, C>& x,
-    const static_flat_map<K, T, N, C>& y
+    const static_flat_map<K, T, N, C, F, L>& x,
+    const static_flat_map<K, T, N, C, F, L>& y
 )
 {
     return x.size() == y.size() && std::equal(x.begin(), x.end(), y.begin());
 }
 
-template <typename K, typename T, std::size_t N, typename C>
+template <typename K, typename T, std::size_t N, typename C, bool F, bool L>
 SFL_NODISCARD
+SFL_CONSTEXPR_20
 bool operator!=
 (
-    const static_flat_map<K, T, N, C>& x,
-    const static_flat_map<K, T, N, C>& y
+    const static_flat_map<K, T, N, C, F, L>& x,
+    const static_flat_map<K, T, N, C, F, L>& y
 )
 {
     return !(x == y);
 }
 
-template <typename K, typename T, std::size_t N, typename C>
+template <typename K, typename T, std::size_t N, typename C, bool F, bool L>
 SFL_NODISCARD
+SFL_CONSTEXPR_20
 bool operator<
 (
-    const static_flat_map<K, T, N, C>& x,
-    const static_flat_map<K, T, N, C>& y
+    const static_flat_map<K, T, N, C, F, L>& x,
+    const static_flat_map<K, T, N, C, F, L>& y
 )
 {
     return std::lexicographical_compare(x.begin(), x.end(), y.begin(), y.end());
 }
 
-template <typename K, typename T, std::size_t N, typename C>
+template <typename K, typename T, std::size_t N, typename C, bool F, bool L>
 SFL_NODISCARD
+SFL_CONSTEXPR_20
 bool operator>
 (
-    const static_flat_map<K, T, N, C>& x,
-    const static_flat_map<K, T, N, C>& y
+    const static_flat_map<K, T, N, C, F, L>& x,
+    const static_flat_map<K, T, N, C, F, L>& y
 )
 {
     return y < x;
 }
 
-template <typename K, typename T, std::size_t N, typename C>
+template <typename K, typename T, std::size_t N, typename C, bool F, bool L>
 SFL_NODISCARD
+SFL_CONSTEXPR_20
 bool operator<=
 (
-    const static_flat_map<K, T, N, C>& x,
-    const static_flat_map<K, T, N, C>& y
+    const static_flat_map<K, T, N, C, F, L>& x,
+    const static_flat_map<K, T, N, C, F, L>& y
 )
 {
     return !(y < x);
 }
 
-template <typename K, typename T, std::size_t N, typename C>
+template <typename K, typename T, std::size_t N, typename C, bool F, bool L>
 SFL_NODISCARD
+SFL_CONSTEXPR_20
 bool operator>=
 (
-    const static_flat_map<K, T, N, C>& x,
-    const static_flat_map<K, T, N, C>& y
+    const static_flat_map<K, T, N, C, F, L>& x,
+    const static_flat_map<K, T, N, C, F, L>& y
 )
 {
     return !(x < y);
 }
 
-template <typename K, typename T, std::size_t N, typename C>
+template <typename K, typename T, std::size_t N, typename C, bool F, bool L>
+SFL_CONSTEXPR_20
 void swap
 (
-    static_flat_map<K, T, N, C>& x,
-    static_flat_map<K, T, N, C>& y
+    static_flat_map<K, T, N, C, F, L>& x,
+    static_flat_map<K, T, N, C, F, L>& y
 )
 {
     x.swap(y);
 }
 
-template <typename K, typename T, std::size_t N, typename C, typename Predicate>
-typename static_flat_map<K, T, N, C>::size_type
-    erase_if(static_flat_map<K, T, N, C>& c, Predicate pred)
+template <typename K, typename T, std::size_t N, typename C, bool F, bool L, typename Predicate>
+SFL_CONSTEXPR_20
+typename static_flat_map<K, T, N, C, F, L>::size_type
+    erase_if(static_flat_map<K, T, N, C, F, L>& c, Predicate pred)
 {
     auto old_size = c.size();
 
@@ -1377,6 +2048,33 @@ typename static_flat_map<K, T, N, C>::size_type
     return old_size - c.size();
 }
 
+//
+// Creates static_flat_map whose capacity N is deduced from the number of
+// elements, e.g. `sfl::make_static_flat_map<int, char>({{1, 'a'}, {2, 'b'}})`.
+// Elements need not be sorted. Duplicate keys are discarded.
+//
+template <typename Key, typename T, typename Compare = std::less<Key>, std::size_t N>
+SFL_NODISCARD
+SFL_CONSTEXPR_20
+static_flat_map<Key, T, N, Compare>
+    make_static_flat_map(const std::pair<Key, T> (&arr)[N])
+{
+    return static_flat_map<Key, T, N, Compare>(arr, arr + N);
+}
+
+template <typename Key, typename T, typename Compare = std::less<Key>, std::size_t N>
+SFL_NODISCARD
+SFL_CONSTEXPR_20
+static_flat_map<Key, T, N, Compare>
+    make_static_flat_map(std::pair<Key, T> (&&arr)[N])
+{
+    return static_flat_map<Key, T, N, Compare>
+    (
+        std::make_move_iterator(arr),
+        std::make_move_iterator(arr + N)
+    );
+}
+
 } // namespace sfl
 
 #endif // SFL_STATIC_FLAT_MAP_HPP_INCLUDED
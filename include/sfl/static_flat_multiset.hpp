@@ -22,8 +22,9 @@
 #define SFL_STATIC_FLAT_MULTISET_HPP_INCLUDED
 
 #include "private.hpp"
+#include "static_vector.hpp"
 
-#include <algorithm>        // copy, move, lower_bound, swap, swap_ranges
+#include <algorithm>        // copy, move, reverse, rotate, swap, swap_ranges
 #include <cstddef>          // size_t
 #include <functional>       // equal_to, less
 #include <initializer_list> // initializer_list
@@ -148,11 +149,7 @@ public:
     {
         SFL_TRY
         {
-            while (first != last)
-            {
-                emplace(*first);
-                ++first;
-            }
+            insert(first, last);
         }
         SFL_CATCH (...)
         {
@@ -168,11 +165,7 @@ public:
     {
         SFL_TRY
         {
-            while (first != last)
-            {
-                emplace(*first);
-                ++first;
-            }
+            insert(first, last);
         }
         SFL_CATCH (...)
         {
@@ -189,6 +182,46 @@ public:
         : static_flat_multiset(ilist.begin(), ilist.end(), comp)
     {}
 
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    static_flat_multiset(sfl::sorted_equivalent_t, InputIt first, InputIt last)
+        : data_()
+    {
+        SFL_TRY
+        {
+            insert(sfl::sorted_equivalent_t(), first, last);
+        }
+        SFL_CATCH (...)
+        {
+            sfl::dtl::destroy(data_.first_, data_.last_);
+            SFL_RETHROW;
+        }
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    static_flat_multiset(sfl::sorted_equivalent_t, InputIt first, InputIt last, const Compare& comp)
+        : data_(comp)
+    {
+        SFL_TRY
+        {
+            insert(sfl::sorted_equivalent_t(), first, last);
+        }
+        SFL_CATCH (...)
+        {
+            sfl::dtl::destroy(data_.first_, data_.last_);
+            SFL_RETHROW;
+        }
+    }
+
+    static_flat_multiset(sfl::sorted_equivalent_t, std::initializer_list<value_type> ilist)
+        : static_flat_multiset(sfl::sorted_equivalent_t(), ilist.begin(), ilist.end())
+    {}
+
+    static_flat_multiset(sfl::sorted_equivalent_t, std::initializer_list<value_type> ilist, const Compare& comp)
+        : static_flat_multiset(sfl::sorted_equivalent_t(), ilist.begin(), ilist.end(), comp)
+    {}
+
     static_flat_multiset(const static_flat_multiset& other)
         : data_(other.data_.ref_to_comp())
     {
@@ -467,11 +500,7 @@ public:
               sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
     void insert(InputIt first, InputIt last)
     {
-        while (first != last)
-        {
-            insert(*first);
-            ++first;
-        }
+        insert_range_aux(first, last);
     }
 
     void insert(std::initializer_list<value_type> ilist)
@@ -479,6 +508,18 @@ public:
         insert(ilist.begin(), ilist.end());
     }
 
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    void insert(sfl::sorted_equivalent_t, InputIt first, InputIt last)
+    {
+        insert_sorted_range_aux(first, last);
+    }
+
+    void insert(sfl::sorted_equivalent_t, std::initializer_list<value_type> ilist)
+    {
+        insert(sfl::sorted_equivalent_t(), ilist.begin(), ilist.end());
+    }
+
     iterator erase(const_iterator pos)
     {
         SFL_ASSERT(cbegin() <= pos && pos < cend());
@@ -594,6 +635,34 @@ public:
         other.data_.last_ = other.data_.first_ + this_size;
     }
 
+    // Moves all elements into a static vector and leaves the container empty.
+    sfl::static_vector<value_type, N> extract()
+    {
+        sfl::static_vector<value_type, N> result
+        (
+            std::make_move_iterator(data_.first_),
+            std::make_move_iterator(data_.last_)
+        );
+
+        clear();
+
+        return result;
+    }
+
+    // Replaces all elements with elements moved from `cont`.
+    void replace(sfl::static_vector<value_type, N>&& cont)
+    {
+        SFL_ASSERT(std::is_sorted(cont.begin(), cont.end(), data_.ref_to_comp()));
+
+        assign_range
+        (
+            std::make_move_iterator(cont.begin()),
+            std::make_move_iterator(cont.end())
+        );
+
+        cont.clear();
+    }
+
     //
     // ---- LOOKUP ------------------------------------------------------------
     //
@@ -601,13 +670,13 @@ public:
     SFL_NODISCARD
     iterator lower_bound(const Key& key)
     {
-        return std::lower_bound(begin(), end(), key, data_.ref_to_comp());
+        return sfl::dtl::lower_bound(begin(), end(), key, data_.ref_to_comp());
     }
 
     SFL_NODISCARD
     const_iterator lower_bound(const Key& key) const
     {
-        return std::lower_bound(begin(), end(), key, data_.ref_to_comp());
+        return sfl::dtl::lower_bound(begin(), end(), key, data_.ref_to_comp());
     }
 
     template <typename K,
@@ -615,7 +684,7 @@ public:
     SFL_NODISCARD
     iterator lower_bound(const K& x)
     {
-        return std::lower_bound(begin(), end(), x, data_.ref_to_comp());
+        return sfl::dtl::lower_bound(begin(), end(), x, data_.ref_to_comp());
     }
 
     template <typename K,
@@ -623,19 +692,19 @@ public:
     SFL_NODISCARD
     const_iterator lower_bound(const K& x) const
     {
-        return std::lower_bound(begin(), end(), x, data_.ref_to_comp());
+        return sfl::dtl::lower_bound(begin(), end(), x, data_.ref_to_comp());
     }
 
     SFL_NODISCARD
     iterator upper_bound(const Key& key)
     {
-        return std::upper_bound(begin(), end(), key, data_.ref_to_comp());
+        return sfl::dtl::upper_bound(begin(), end(), key, data_.ref_to_comp());
     }
 
     SFL_NODISCARD
     const_iterator upper_bound(const Key& key) const
     {
-        return std::upper_bound(begin(), end(), key, data_.ref_to_comp());
+        return sfl::dtl::upper_bound(begin(), end(), key, data_.ref_to_comp());
     }
 
     template <typename K,
@@ -643,7 +712,7 @@ public:
     SFL_NODISCARD
     iterator upper_bound(const K& x)
     {
-        return std::upper_bound(begin(), end(), x, data_.ref_to_comp());
+        return sfl::dtl::upper_bound(begin(), end(), x, data_.ref_to_comp());
     }
 
     template <typename K,
@@ -651,19 +720,19 @@ public:
     SFL_NODISCARD
     const_iterator upper_bound(const K& x) const
     {
-        return std::upper_bound(begin(), end(), x, data_.ref_to_comp());
+        return sfl::dtl::upper_bound(begin(), end(), x, data_.ref_to_comp());
     }
 
     SFL_NODISCARD
     std::pair<iterator, iterator> equal_range(const Key& key)
     {
-        return std::equal_range(begin(), end(), key, data_.ref_to_comp());
+        return sfl::dtl::equal_range(begin(), end(), key, data_.ref_to_comp());
     }
 
     SFL_NODISCARD
     std::pair<const_iterator, const_iterator> equal_range(const Key& key) const
     {
-        return std::equal_range(begin(), end(), key, data_.ref_to_comp());
+        return sfl::dtl::equal_range(begin(), end(), key, data_.ref_to_comp());
     }
 
     template <typename K,
@@ -671,7 +740,7 @@ public:
     SFL_NODISCARD
     std::pair<iterator, iterator> equal_range(const K& x)
     {
-        return std::equal_range(begin(), end(), x, data_.ref_to_comp());
+        return sfl::dtl::equal_range(begin(), end(), x, data_.ref_to_comp());
     }
 
     template <typename K,
@@ -679,7 +748,7 @@ public:
     SFL_NODISCARD
     std::pair<const_iterator, const_iterator> equal_range(const K& x) const
     {
-        return std::equal_range(begin(), end(), x, data_.ref_to_comp());
+        return sfl::dtl::equal_range(begin(), end(), x, data_.ref_to_comp());
     }
 
     SFL_NODISCARD
@@ -851,6 +920,114 @@ private:
         return insert_aux(std::forward<Value>(value));
     }
 
+    // Appends as many elements as fit into internal storage and then sorts
+    // and merges them at once, which takes O(m * log(m)^2 + (n + m) *
+    // log(n + m)) element moves instead of O(n * m). Repeats until all
+    // elements are inserted.
+    template <typename InputIt>
+    void insert_range_aux(InputIt first, InputIt last)
+    {
+        while (first != last)
+        {
+            if (full())
+            {
+                insert(*first);
+                ++first;
+                continue;
+            }
+
+            const size_type old_size = size();
+
+            SFL_TRY
+            {
+                while (first != last && !full())
+                {
+                    insert_exactly_at(cend(), *first);
+                    ++first;
+                }
+            }
+            SFL_CATCH (...)
+            {
+                erase(nth(old_size), cend());
+                SFL_RETHROW;
+            }
+
+            merge_appended(old_size);
+        }
+    }
+
+    // Appends as many elements as fit into internal storage and merges them
+    // with existing elements. Unlike `insert_range_aux`, appended elements
+    // are not sorted because they must already be in order. Remaining
+    // elements (if any) are inserted using `insert_range_aux`.
+    template <typename InputIt>
+    void insert_sorted_range_aux(InputIt first, InputIt last)
+    {
+        const size_type old_size = size();
+
+        SFL_TRY
+        {
+            while (first != last && !full())
+            {
+                insert_exactly_at(cend(), *first);
+                ++first;
+            }
+        }
+        SFL_CATCH (...)
+        {
+            erase(nth(old_size), cend());
+            SFL_RETHROW;
+        }
+
+        SFL_ASSERT(std::is_sorted(data_.first_ + old_size, data_.last_, data_.ref_to_comp()));
+
+        merge_sorted_appended(old_size);
+
+        insert_range_aux(first, last);
+    }
+
+    // Sorts elements at positions `pos` and above and merges them with
+    // preceding elements. Sorting and merging never allocate memory.
+    // Like single element insertion (which inserts at lower bound), new
+    // elements precede existing equivalent elements and later new elements
+    // precede earlier ones.
+    void merge_appended(size_type pos)
+    {
+        const pointer mid = data_.first_ + pos;
+
+        SFL_TRY
+        {
+            std::reverse(mid, data_.last_);
+            sfl::dtl::stable_sort_in_place(mid, data_.last_, data_.ref_to_comp());
+        }
+        SFL_CATCH (...)
+        {
+            erase(nth(pos), cend());
+            SFL_RETHROW;
+        }
+
+        merge_sorted_appended(pos);
+    }
+
+    // Merges sorted elements at positions `pos` and above with preceding
+    // elements. New elements precede existing equivalent elements.
+    // Merging does not allocate memory, so if an exception is thrown, the
+    // order of elements is unknown and all elements are removed.
+    void merge_sorted_appended(size_type pos)
+    {
+        SFL_TRY
+        {
+            const pointer new_mid = std::rotate(data_.first_, data_.first_ + pos, data_.last_);
+            sfl::dtl::merge_in_place(data_.first_, new_mid, data_.last_, data_.ref_to_comp());
+        }
+        SFL_CATCH (...)
+        {
+            // Order of elements is unknown, so they are all removed.
+            clear();
+            SFL_RETHROW;
+        }
+    }
+
     template <typename Value>
     iterator insert_exactly_at(const_iterator pos, Value&& value)
     {
@@ -22,12 +22,13 @@
 #define SFL_STATIC_FLAT_SET_HPP_INCLUDED
 
 #include "private.hpp"
+#include "static_vector.hpp"
 
-#include <algorithm>        // copy, move, lower_bound, swap, swap_ranges
+#include <algorithm>        // copy, move, swap, swap_ranges
 #include <cstddef>          // size_t
 #include <functional>       // equal_to, less
 #include <initializer_list> // initializer_list
-#include <iterator>         // distance, next, reverse_iterator
+#include <iterator>         // distance, make_move_iterator, next, reverse_iterator
 #include <limits>           // numeric_limits
 #include <memory>           // allocator, allocator_traits, pointer_traits
 #include <type_traits>      // is_same, is_nothrow_xxxxx
@@ -42,7 +43,9 @@ namespace sfl
 
 template < typename Key,
            std::size_t N,
-           typename Compare = std::less<Key> >
+           typename Compare = std::less<Key>,
+           bool Freezable = false,
+           bool Learned = false >
 class static_flat_set
 {
     #ifdef SFL_TEST_STATIC_FLAT_SET
@@ -51,6 +54,12 @@ class static_flat_set
 
     static_assert(N > 0, "N must be greater than zero.");
 
+    static_assert
+    (
+        !Learned || sfl::dtl::is_builtin_less<Key, Key, Compare>::value,
+        "Learned index requires arithmetic Key and std::less."
+    );
+
 public:
 
     using key_type               = Key;
@@ -72,9 +81,14 @@ public:
 
     static constexpr size_type static_capacity = N;
 
+    static constexpr bool freezable = Freezable;
+
+    static constexpr bool learned = Learned;
+
 private:
 
-    class data_base
+    class data_base : public sfl::dtl::eytzinger_index<Key, N, Freezable>
+                    , public sfl::dtl::learned_index<Key, N, Learned>
     {
     public:
 
@@ -85,40 +99,58 @@ private:
 
         pointer last_;
 
+        SFL_CONSTEXPR_20
         data_base() noexcept
             : last_(first_)
-        {}
+        {
+            sfl::dtl::initialize_static_storage(first_, N);
+        }
 
         #if defined(__clang__) && (__clang_major__ == 3) // For CentOS 7
+        SFL_CONSTEXPR_20
         ~data_base()
         {}
         #else
+        SFL_CONSTEXPR_20
         ~data_base() noexcept
         {}
         #endif
+
+        // Discards both search index and learned model.
+        SFL_CONSTEXPR_20
+        void clear_index() noexcept
+        {
+            sfl::dtl::eytzinger_index<Key, N, Freezable>::clear_index();
+            this->clear_model();
+        }
     };
 
     class data : public data_base, public value_compare
     {
     public:
 
+        SFL_CONSTEXPR_20
         data() noexcept(std::is_nothrow_default_constructible<value_compare>::value)
             : value_compare()
         {}
 
+        SFL_CONSTEXPR_20
         data(const value_compare& comp) noexcept(std::is_nothrow_copy_constructible<value_compare>::value)
             : value_compare(comp)
         {}
 
+        SFL_CONSTEXPR_20
         data(value_compare&& comp) noexcept(std::is_nothrow_move_constructible<value_compare>::value)
             : value_compare(std::move(comp))
         {}
 
+        SFL_CONSTEXPR_20
         value_compare& ref_to_comp() noexcept
         {
             return *this;
         }
 
+        SFL_CONSTEXPR_20
         const value_compare& ref_to_comp() const noexcept
         {
             return *this;
@@ -133,26 +165,25 @@ public:
     // ---- CONSTRUCTION AND DESTRUCTION --------------------------------------
     //
 
+    SFL_CONSTEXPR_20
     static_flat_set() noexcept(std::is_nothrow_default_constructible<Compare>::value)
         : data_()
     {}
 
+    SFL_CONSTEXPR_20
     explicit static_flat_set(const Compare& comp) noexcept(std::is_nothrow_copy_constructible<Compare>::value)
         : data_(comp)
     {}
 
     template <typename InputIt,
               sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    SFL_CONSTEXPR_20
     static_flat_set(InputIt first, InputIt last)
         : data_()
     {
         SFL_TRY
         {
-            while (first != last)
-            {
-                emplace(*first);
-                ++first;
-            }
+            insert(first, last);
         }
         SFL_CATCH (...)
         {
@@ -163,16 +194,13 @@ public:
 
     template <typename InputIt,
               sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    SFL_CONSTEXPR_20
     static_flat_set(InputIt first, InputIt last, const Compare& comp)
         : data_(comp)
     {
         SFL_TRY
         {
-            while (first != last)
-            {
-                emplace(*first);
-                ++first;
-            }
+            insert(first, last);
         }
         SFL_CATCH (...)
         {
@@ -181,14 +209,61 @@ public:
         }
     }
 
+    SFL_CONSTEXPR_20
     static_flat_set(std::initializer_list<value_type> ilist)
         : static_flat_set(ilist.begin(), ilist.end())
     {}
 
+    SFL_CONSTEXPR_20
     static_flat_set(std::initializer_list<value_type> ilist, const Compare& comp)
         : static_flat_set(ilist.begin(), ilist.end(), comp)
     {}
 
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    SFL_CONSTEXPR_20
+    static_flat_set(sfl::sorted_unique_t, InputIt first, InputIt last)
+        : data_()
+    {
+        SFL_TRY
+        {
+            insert(sfl::sorted_unique_t(), first, last);
+        }
+        SFL_CATCH (...)
+        {
+            sfl::dtl::destroy(data_.first_, data_.last_);
+            SFL_RETHROW;
+        }
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    SFL_CONSTEXPR_20
+    static_flat_set(sfl::sorted_unique_t, InputIt first, InputIt last, const Compare& comp)
+        : data_(comp)
+    {
+        SFL_TRY
+        {
+            insert(sfl::sorted_unique_t(), first, last);
+        }
+        SFL_CATCH (...)
+        {
+            sfl::dtl::destroy(data_.first_, data_.last_);
+            SFL_RETHROW;
+        }
+    }
+
+    SFL_CONSTEXPR_20
+    static_flat_set(sfl::sorted_unique_t, std::initializer_list<value_type> ilist)
+        : static_flat_set(sfl::sorted_unique_t(), ilist.begin(), ilist.end())
+    {}
+
+    SFL_CONSTEXPR_20
+    static_flat_set(sfl::sorted_unique_t, std::initializer_list<value_type> ilist, const Compare& comp)
+        : static_flat_set(sfl::sorted_unique_t(), ilist.begin(), ilist.end(), comp)
+    {}
+
+    SFL_CONSTEXPR_20
     static_flat_set(const static_flat_set& other)
         : data_(other.data_.ref_to_comp())
     {
@@ -198,8 +273,19 @@ public:
             pointer(other.data_.last_),
             data_.first_
         );
+
+        if (other.frozen())
+        {
+            build_index();
+        }
+
+        if (other.fitted())
+        {
+            build_model();
+        }
     }
 
+    SFL_CONSTEXPR_20
     static_flat_set(static_flat_set&& other)
         : data_(std::move(other.data_.ref_to_comp()))
     {
@@ -209,8 +295,19 @@ public:
             std::make_move_iterator(pointer(other.data_.last_)),
             data_.first_
         );
+
+        if (other.frozen())
+        {
+            build_index();
+        }
+
+        if (other.fitted())
+        {
+            build_model();
+        }
     }
 
+    SFL_CONSTEXPR_20
     ~static_flat_set()
     {
         sfl::dtl::destroy(data_.first_, data_.last_);
@@ -220,6 +317,7 @@ public:
     // ---- ASSIGNMENT --------------------------------------------------------
     //
 
+    SFL_CONSTEXPR_20
     static_flat_set& operator=(const static_flat_set& other)
     {
         if (this != &other)
@@ -231,11 +329,22 @@ public:
                 pointer(other.data_.first_),
                 pointer(other.data_.last_)
             );
+
+            if (other.frozen())
+            {
+                build_index();
+            }
+
+            if (other.fitted())
+            {
+                build_model();
+            }
         }
 
         return *this;
     }
 
+    SFL_CONSTEXPR_20
     static_flat_set& operator=(static_flat_set&& other)
     {
         data_.ref_to_comp() = other.data_.ref_to_comp();
@@ -246,9 +355,20 @@ public:
             std::make_move_iterator(pointer(other.data_.last_))
         );
 
+        if (other.frozen())
+        {
+            build_index();
+        }
+
+        if (other.fitted())
+        {
+            build_model();
+        }
+
         return *this;
     }
 
+    SFL_CONSTEXPR_20
     static_flat_set& operator=(std::initializer_list<value_type> ilist)
     {
         assign_range(ilist.begin(), ilist.end());
@@ -260,6 +380,7 @@ public:
     //
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     key_compare key_comp() const
     {
         return data_.ref_to_comp();
@@ -270,6 +391,7 @@ public:
     //
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     value_compare value_comp() const
     {
         return data_.ref_to_comp();
@@ -280,78 +402,91 @@ public:
     //
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     iterator begin() noexcept
     {
         return iterator(data_.first_);
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     const_iterator begin() const noexcept
     {
         return const_iterator(data_.first_);
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     const_iterator cbegin() const noexcept
     {
         return const_iterator(data_.first_);
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     iterator end() noexcept
     {
         return iterator(data_.last_);
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     const_iterator end() const noexcept
     {
         return const_iterator(data_.last_);
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     const_iterator cend() const noexcept
     {
         return const_iterator(data_.last_);
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     reverse_iterator rbegin() noexcept
     {
         return reverse_iterator(end());
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     const_reverse_iterator rbegin() const noexcept
     {
         return const_reverse_iterator(end());
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     const_reverse_iterator crbegin() const noexcept
     {
         return const_reverse_iterator(end());
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     reverse_iterator rend() noexcept
     {
         return reverse_iterator(begin());
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     const_reverse_iterator rend() const noexcept
     {
         return const_reverse_iterator(begin());
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     const_reverse_iterator crend() const noexcept
     {
         return const_reverse_iterator(begin());
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     iterator nth(size_type pos) noexcept
     {
         SFL_ASSERT(pos <= size());
@@ -359,6 +494,7 @@ public:
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     const_iterator nth(size_type pos) const noexcept
     {
         SFL_ASSERT(pos <= size());
@@ -366,6 +502,7 @@ public:
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     size_type index_of(const_iterator pos) const noexcept
     {
         SFL_ASSERT(cbegin() <= pos && pos <= cend());
@@ -377,18 +514,21 @@ public:
     //
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     bool empty() const noexcept
     {
         return data_.first_ == data_.last_;
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     bool full() const noexcept
     {
         return std::distance(begin(), end()) == N;
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     size_type size() const noexcept
     {
         return std::distance(begin(), end());
@@ -407,6 +547,7 @@ public:
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     size_type available() const noexcept
     {
         return capacity() - size();
@@ -416,33 +557,39 @@ public:
     // ---- MODIFIERS ---------------------------------------------------------
     //
 
+    SFL_CONSTEXPR_20
     void clear() noexcept
     {
+        data_.clear_index();
         sfl::dtl::destroy(data_.first_, data_.last_);
         data_.last_ = data_.first_;
     }
 
     template <typename... Args>
+    SFL_CONSTEXPR_20
     std::pair<iterator, bool> emplace(Args&&... args)
     {
         SFL_ASSERT(!full());
-        return insert_aux(value_type(std::forward<Args>(args)...));
+        return emplace_aux(std::forward<Args>(args)...);
     }
 
     template <typename... Args>
+    SFL_CONSTEXPR_20
     iterator emplace_hint(const_iterator hint, Args&&... args)
     {
         SFL_ASSERT(!full());
         SFL_ASSERT(cbegin() <= hint && hint <= cend());
-        return insert_aux(hint, value_type(std::forward<Args>(args)...));
+        return emplace_hint_aux(hint, std::forward<Args>(args)...);
     }
 
+    SFL_CONSTEXPR_20
     std::pair<iterator, bool> insert(const value_type& value)
     {
         SFL_ASSERT(!full());
         return insert_aux(value);
     }
 
+    SFL_CONSTEXPR_20
     std::pair<iterator, bool> insert(value_type&& value)
     {
         SFL_ASSERT(!full());
@@ -451,12 +598,14 @@ public:
 
     template <typename K,
               sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    SFL_CONSTEXPR_20
     std::pair<iterator, bool> insert(K&& x)
     {
         SFL_ASSERT(!full());
         return insert_aux_heterogeneous(std::forward<K>(x));
     }
 
+    SFL_CONSTEXPR_20
     iterator insert(const_iterator hint, const value_type& value)
     {
         SFL_ASSERT(!full());
@@ -464,6 +613,7 @@ public:
         return insert_aux(hint, value);
     }
 
+    SFL_CONSTEXPR_20
     iterator insert(const_iterator hint, value_type&& value)
     {
         SFL_ASSERT(!full());
@@ -475,6 +625,7 @@ public:
               sfl::dtl::enable_if_t< sfl::dtl::has_is_transparent<Compare, K>::value &&
                                     !std::is_convertible<K&&, const_iterator>::value &&
                                     !std::is_convertible<K&&, iterator>::value >* = nullptr>
+    SFL_CONSTEXPR_20
     iterator insert(const_iterator hint, K&& x)
     {
         SFL_ASSERT(!full());
@@ -484,24 +635,39 @@ public:
 
     template <typename InputIt,
               sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    SFL_CONSTEXPR_20
     void insert(InputIt first, InputIt last)
     {
-        while (first != last)
-        {
-            insert(*first);
-            ++first;
-        }
+        insert_range_aux(first, last);
     }
 
+    SFL_CONSTEXPR_20
     void insert(std::initializer_list<value_type> ilist)
     {
         insert(ilist.begin(), ilist.end());
     }
 
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    SFL_CONSTEXPR_20
+    void insert(sfl::sorted_unique_t, InputIt first, InputIt last)
+    {
+        insert_sorted_range_aux(first, last);
+    }
+
+    SFL_CONSTEXPR_20
+    void insert(sfl::sorted_unique_t, std::initializer_list<value_type> ilist)
+    {
+        insert(sfl::sorted_unique_t(), ilist.begin(), ilist.end());
+    }
+
+    SFL_CONSTEXPR_20
     iterator erase(const_iterator pos)
     {
         SFL_ASSERT(cbegin() <= pos && pos < cend());
 
+        data_.clear_index();
+
         const pointer p = data_.first_ + std::distance(cbegin(), pos);
 
         data_.last_ = sfl::dtl::move(p + 1, data_.last_, p);
@@ -511,6 +677,7 @@ public:
         return iterator(p);
     }
 
+    SFL_CONSTEXPR_20
     iterator erase(const_iterator first, const_iterator last)
     {
         SFL_ASSERT(cbegin() <= first && first <= last && last <= cend());
@@ -520,6 +687,8 @@ public:
             return begin() + std::distance(cbegin(), first);
         }
 
+        data_.clear_index();
+
         const pointer p1 = data_.first_ + std::distance(cbegin(), first);
         const pointer p2 = data_.first_ + std::distance(cbegin(), last);
 
@@ -532,6 +701,7 @@ public:
         return iterator(p1);
     }
 
+    SFL_CONSTEXPR_20
     size_type erase(const Key& key)
     {
         auto it = find(key);
@@ -545,6 +715,7 @@ public:
 
     template <typename K,
               sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    SFL_CONSTEXPR_20
     size_type erase(K&& x)
     {
         auto it = find(x);
@@ -556,6 +727,7 @@ public:
         return 1;
     }
 
+    SFL_CONSTEXPR_20
     void swap(static_flat_set& other)
     {
         if (this == &other)
@@ -563,6 +735,15 @@ public:
             return;
         }
 
+        const bool this_frozen  = this->frozen();
+        const bool other_frozen = other.frozen();
+
+        const bool this_fitted  = this->fitted();
+        const bool other_fitted = other.fitted();
+
+        this->data_.clear_index();
+        other.data_.clear_index();
+
         using std::swap;
 
         swap(this->data_.ref_to_comp(), other.data_.ref_to_comp());
@@ -617,6 +798,56 @@ public:
 
         this->data_.last_ = this->data_.first_ + other_size;
         other.data_.last_ = other.data_.first_ + this_size;
+
+        if (other_frozen)
+        {
+            this->build_index();
+        }
+
+        if (this_frozen)
+        {
+            other.build_index();
+        }
+
+        if (other_fitted)
+        {
+            this->build_model();
+        }
+
+        if (this_fitted)
+        {
+            other.build_model();
+        }
+    }
+
+    // Moves all elements into a static vector and leaves the container empty.
+    SFL_CONSTEXPR_20
+    sfl::static_vector<value_type, N> extract()
+    {
+        sfl::static_vector<value_type, N> result
+        (
+            std::make_move_iterator(data_.first_),
+            std::make_move_iterator(data_.last_)
+        );
+
+        clear();
+
+        return result;
+    }
+
+    // Replaces all elements with elements moved from `cont`.
+    SFL_CONSTEXPR_20
+    void replace(sfl::static_vector<value_type, N>&& cont)
+    {
+        SFL_ASSERT(sfl::dtl::is_sorted_unique(cont.begin(), cont.end(), data_.ref_to_comp()));
+
+        assign_range
+        (
+            std::make_move_iterator(cont.begin()),
+            std::make_move_iterator(cont.end())
+        );
+
+        cont.clear();
     }
 
     //
@@ -624,90 +855,107 @@ public:
     //
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     iterator lower_bound(const Key& key)
     {
-        return std::lower_bound(begin(), end(), key, data_.ref_to_comp());
+        return begin() + lower_bound_index(key);
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     const_iterator lower_bound(const Key& key) const
     {
-        return std::lower_bound(begin(), end(), key, data_.ref_to_comp());
+        return begin() + lower_bound_index(key);
     }
 
     template <typename K,
               sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     iterator lower_bound(const K& x)
     {
-        return std::lower_bound(begin(), end(), x, data_.ref_to_comp());
+        return begin() + lower_bound_index(x);
     }
 
     template <typename K,
               sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     const_iterator lower_bound(const K& x) const
     {
-        return std::lower_bound(begin(), end(), x, data_.ref_to_comp());
+        return begin() + lower_bound_index(x);
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     iterator upper_bound(const Key& key)
     {
-        return std::upper_bound(begin(), end(), key, data_.ref_to_comp());
+        return begin() + upper_bound_index(key);
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     const_iterator upper_bound(const Key& key) const
     {
-        return std::upper_bound(begin(), end(), key, data_.ref_to_comp());
+        return begin() + upper_bound_index(key);
     }
 
     template <typename K,
               sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     iterator upper_bound(const K& x)
     {
-        return std::upper_bound(begin(), end(), x, data_.ref_to_comp());
+        return begin() + upper_bound_index(x);
     }
 
     template <typename K,
               sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     const_iterator upper_bound(const K& x) const
     {
-        return std::upper_bound(begin(), end(), x, data_.ref_to_comp());
+        return begin() + upper_bound_index(x);
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     std::pair<iterator, iterator> equal_range(const Key& key)
     {
-        return std::equal_range(begin(), end(), key, data_.ref_to_comp());
+        const auto r = equal_range_index(key);
+        return std::make_pair(begin() + r.first, begin() + r.second);
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     std::pair<const_iterator, const_iterator> equal_range(const Key& key) const
     {
-        return std::equal_range(begin(), end(), key, data_.ref_to_comp());
+        const auto r = equal_range_index(key);
+        return std::make_pair(begin() + r.first, begin() + r.second);
     }
 
     template <typename K,
               sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     std::pair<iterator, iterator> equal_range(const K& x)
     {
-        return std::equal_range(begin(), end(), x, data_.ref_to_comp());
+        const auto r = equal_range_index(x);
+        return std::make_pair(begin() + r.first, begin() + r.second);
     }
 
     template <typename K,
               sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     std::pair<const_iterator, const_iterator> equal_range(const K& x) const
     {
-        return std::equal_range(begin(), end(), x, data_.ref_to_comp());
+        const auto r = equal_range_index(x);
+        return std::make_pair(begin() + r.first, begin() + r.second);
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     iterator find(const Key& key)
     {
         auto it = lower_bound(key);
@@ -721,6 +969,7 @@ public:
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     const_iterator find(const Key& key) const
     {
         auto it = lower_bound(key);
@@ -736,6 +985,7 @@ public:
     template <typename K,
               sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     iterator find(const K& x)
     {
         auto it = lower_bound(x);
@@ -751,6 +1001,7 @@ public:
     template <typename K,
               sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     const_iterator find(const K& x) const
     {
         auto it = lower_bound(x);
@@ -764,6 +1015,7 @@ public:
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     size_type count(const Key& key) const
     {
         return find(key) != end();
@@ -772,12 +1024,14 @@ public:
     template <typename K,
               sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     size_type count(const K& x) const
     {
         return find(x) != end();
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     bool contains(const Key& key) const
     {
         return find(key) != end();
@@ -786,22 +1040,255 @@ public:
     template <typename K,
               sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     bool contains(const K& x) const
     {
         return find(x) != end();
     }
 
+    //
+    // ---- FROZEN INDEX ------------------------------------------------------
+    //
+
+    // Available only if `Freezable` is true. Builds a read-only search index
+    // that is used by lookup functions until the next modification.
+    template <bool F = Freezable,
+              sfl::dtl::enable_if_t<F>* = nullptr>
+    SFL_CONSTEXPR_20
+    void freeze()
+    {
+        build_index();
+    }
+
+    SFL_NODISCARD
+    SFL_CONSTEXPR_20
+    bool frozen() const noexcept
+    {
+        return data_.indexed();
+    }
+
+    //
+    // ---- LEARNED INDEX -----------------------------------------------------
+    //
+
+    // Available only if `Learned` is true. Fits a piecewise linear model of
+    // positions of keys that is used by lookup functions until the next
+    // modification.
+    template <bool L = Learned,
+              sfl::dtl::enable_if_t<L>* = nullptr>
+    SFL_CONSTEXPR_20
+    void fit()
+    {
+        build_model();
+    }
+
+    SFL_NODISCARD
+    SFL_CONSTEXPR_20
+    bool fitted() const noexcept
+    {
+        return data_.fitted();
+    }
+
+    //
+    // ---- SET OPERATIONS ----------------------------------------------------
+    //
+
+    // Returns container with elements that are in `*this`, in `other` or in
+    // both. The result is built by a single linear merge.
+    SFL_NODISCARD
+    SFL_CONSTEXPR_20
+    static_flat_set set_union(const static_flat_set& other) const
+    {
+        static_flat_set result(data_.ref_to_comp());
+
+        sfl::dtl::for_each_union
+        (
+            begin(),
+            end(),
+            other.begin(),
+            other.end(),
+            data_.ref_to_comp(),
+            [&result](const value_type& x) { result.append_unchecked(x); },
+            [&result](const value_type& x) { result.append_unchecked(x); }
+        );
+
+        return result;
+    }
+
+    // Returns container with elements that are both in `*this` and in `other`.
+    SFL_NODISCARD
+    SFL_CONSTEXPR_20
+    static_flat_set set_intersection(const static_flat_set& other) const
+    {
+        static_flat_set result(data_.ref_to_comp());
+
+        sfl::dtl::for_each_intersection
+        (
+            begin(),
+            end(),
+            other.begin(),
+            other.end(),
+            data_.ref_to_comp(),
+            [&result](const value_type& x) { result.append_unchecked(x); }
+        );
+
+        return result;
+    }
+
+    // Returns container with elements that are in `*this` but not in `other`.
+    SFL_NODISCARD
+    SFL_CONSTEXPR_20
+    static_flat_set set_difference(const static_flat_set& other) const
+    {
+        static_flat_set result(data_.ref_to_comp());
+
+        sfl::dtl::for_each_difference
+        (
+            begin(),
+            end(),
+            other.begin(),
+            other.end(),
+            data_.ref_to_comp(),
+            [&result](const value_type& x) { result.append_unchecked(x); }
+        );
+
+        return result;
+    }
+
+    // Inserts elements of `other` that are not in `*this`, i.e. replaces
+    // `*this` with `set_union(other)` without creating a temporary.
+    // New elements are merged from back to front, so each element is moved
+    // at most once.
+    SFL_CONSTEXPR_20
+    void merge_from(const static_flat_set& other)
+    {
+        if (this == &other)
+        {
+            return;
+        }
+
+        size_type n = 0;
+
+        sfl::dtl::for_each_difference
+        (
+            other.begin(),
+            other.end(),
+            begin(),
+            end(),
+            data_.ref_to_comp(),
+            [&n](const value_type&) { ++n; }
+        );
+
+        if (n == 0)
+        {
+            return;
+        }
+
+        SFL_ASSERT(n <= available());
+
+        data_.clear_index();
+
+        merge_backward(other, n);
+    }
+
+    // Removes elements that are not in `other`.
+    SFL_CONSTEXPR_20
+    void intersect_with(const static_flat_set& other)
+    {
+        if (this == &other)
+        {
+            return;
+        }
+
+        data_.clear_index();
+
+        pointer d = data_.first_;
+
+        SFL_TRY
+        {
+            sfl::dtl::for_each_intersection
+            (
+                data_.first_,
+                data_.last_,
+                other.begin(),
+                other.end(),
+                data_.ref_to_comp(),
+                [&d](value_type& x)
+                {
+                    if (std::addressof(*d) != std::addressof(x))
+                    {
+                        *d = std::move(x);
+                    }
+                    ++d;
+                }
+            );
+        }
+        SFL_CATCH (...)
+        {
+            // Some elements are moved-from, so they are all removed.
+            clear();
+            SFL_RETHROW;
+        }
+
+        erase(nth(std::distance(data_.first_, d)), cend());
+    }
+
+    // Removes elements that are in `other`.
+    SFL_CONSTEXPR_20
+    void subtract(const static_flat_set& other)
+    {
+        if (this == &other)
+        {
+            clear();
+            return;
+        }
+
+        data_.clear_index();
+
+        pointer d = data_.first_;
+
+        SFL_TRY
+        {
+            sfl::dtl::for_each_difference
+            (
+                data_.first_,
+                data_.last_,
+                other.begin(),
+                other.end(),
+                data_.ref_to_comp(),
+                [&d](value_type& x)
+                {
+                    if (std::addressof(*d) != std::addressof(x))
+                    {
+                        *d = std::move(x);
+                    }
+                    ++d;
+                }
+            );
+        }
+        SFL_CATCH (...)
+        {
+            // Some elements are moved-from, so they are all removed.
+            clear();
+            SFL_RETHROW;
+        }
+
+        erase(nth(std::distance(data_.first_, d)), cend());
+    }
+
     //
     // ---- ELEMENT ACCESS ----------------------------------------------------
     //
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     value_type* data() noexcept
     {
         return data_.first_;
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     const value_type* data() const noexcept
     {
         return data_.first_;
@@ -809,10 +1296,239 @@ public:
 
 private:
 
+    SFL_CONSTEXPR_20
+    void build_index()
+    {
+        data_.build_index
+        (
+            data_.first_,
+            size(),
+            [](const value_type& x) -> const Key& { return x; }
+        );
+    }
+
+    SFL_CONSTEXPR_20
+    void build_model()
+    {
+        data_.fit_model
+        (
+            data_.first_,
+            size(),
+            [](const value_type& x) -> const Key& { return x; }
+        );
+    }
+
+    // Model predicts range of positions that contains the result, which is
+    // then found by binary search within that range.
+    template <typename K>
+    SFL_CONSTEXPR_20
+    size_type model_lower_bound_index(const K& x) const
+    {
+        const auto w = data_.model_window(x);
+
+        return std::distance
+        (
+            begin(),
+            sfl::dtl::lower_bound(nth(w.first), nth(w.second), x, data_.ref_to_comp())
+        );
+    }
+
+    template <typename K>
+    SFL_CONSTEXPR_20
+    size_type model_upper_bound_index(const K& x) const
+    {
+        const auto w = data_.model_window(x);
+
+        return std::distance
+        (
+            begin(),
+            sfl::dtl::upper_bound(nth(w.first), nth(w.second), x, data_.ref_to_comp())
+        );
+    }
+
+    template <typename K>
+    SFL_CONSTEXPR_20
+    size_type lower_bound_index(const K& x) const
+    {
+        if (data_.fitted())
+        {
+            return model_lower_bound_index(x);
+        }
+
+        if (data_.indexed())
+        {
+            return data_.index_lower_bound(x, data_.ref_to_comp());
+        }
+
+        return std::distance
+        (
+            begin(),
+            sfl::dtl::lower_bound(begin(), end(), x, data_.ref_to_comp())
+        );
+    }
+
+    template <typename K>
+    SFL_CONSTEXPR_20
+    size_type upper_bound_index(const K& x) const
+    {
+        if (data_.fitted())
+        {
+            return model_upper_bound_index(x);
+        }
+
+        if (data_.indexed())
+        {
+            return data_.index_upper_bound(x, data_.ref_to_comp());
+        }
+
+        return std::distance
+        (
+            begin(),
+            sfl::dtl::upper_bound(begin(), end(), x, data_.ref_to_comp())
+        );
+    }
+
+    SFL_CONSTEXPR_20
+    std::pair<size_type, size_type> equal_range_index(const Key& x) const
+    {
+        if (data_.fitted() || data_.indexed())
+        {
+            // Keys are unique, so the range contains at most one element.
+            const size_type i = data_.fitted()
+                ? model_lower_bound_index(x)
+                : data_.index_lower_bound(x, data_.ref_to_comp());
+
+            if (i != size() && !data_.ref_to_comp()(x, data_.first_[i]))
+            {
+                return std::make_pair(i, i + 1);
+            }
+
+            return std::make_pair(i, i);
+        }
+
+        const auto r = sfl::dtl::equal_range(begin(), end(), x, data_.ref_to_comp());
+
+        return std::make_pair
+        (
+            size_type(std::distance(begin(), r.first)),
+            size_type(std::distance(begin(), r.second))
+        );
+    }
+
+    // Several unique keys can be equivalent to `x` under transparent
+    // comparator, so the upper end is searched for too.
+    template <typename K>
+    SFL_CONSTEXPR_20
+    std::pair<size_type, size_type> equal_range_index(const K& x) const
+    {
+        if (data_.fitted() || data_.indexed())
+        {
+            return std::make_pair(lower_bound_index(x), upper_bound_index(x));
+        }
+
+        const auto r = sfl::dtl::equal_range(begin(), end(), x, data_.ref_to_comp());
+
+        return std::make_pair
+        (
+            size_type(std::distance(begin(), r.first)),
+            size_type(std::distance(begin(), r.second))
+        );
+    }
+
+    // Constructs new element at the end. Storage must be available and the
+    // new element must not be less than the last element.
+    template <typename... Args>
+    SFL_CONSTEXPR_20
+    void append_unchecked(Args&&... args)
+    {
+        SFL_ASSERT(data_.last_ != data_.first_ + N);
+
+        sfl::dtl::construct_at(data_.last_, std::forward<Args>(args)...);
+
+        ++data_.last_;
+    }
+
+    // Merges `other` into `*this` like std::set_union. Exactly `n` elements
+    // of `other` are not in `*this` and there is room for them after the
+    // last element. Elements are placed from back to front, starting at the
+    // new last position, so no element is moved more than once.
+    SFL_CONSTEXPR_20
+    void merge_backward(const static_flat_set& other, size_type n)
+    {
+        const pointer first = data_.first_;
+        const pointer old_last = data_.last_;
+        const pointer new_last = old_last + n;
+
+        const_pointer last2 = other.data_.last_;
+
+        pointer d = new_last;
+        pointer i = old_last;
+
+        // Elements in range [constructed, new_last) are constructed.
+        pointer constructed = new_last;
+
+        SFL_TRY
+        {
+            // Number of elements of `other` not yet placed is `d - i`.
+            while (d != i)
+            {
+                SFL_ASSERT(last2 != other.data_.first_);
+
+                --d;
+
+                if (i == first || data_.ref_to_comp()(*(i - 1), *(last2 - 1)))
+                {
+                    --last2;
+
+                    if (d < old_last)
+                    {
+                        *d = *last2;
+                    }
+                    else
+                    {
+                        sfl::dtl::construct_at(d, *last2);
+                        constructed = d;
+                    }
+                }
+                else
+                {
+                    if (!data_.ref_to_comp()(*(last2 - 1), *(i - 1)))
+                    {
+                        --last2;
+                    }
+
+                    --i;
+
+                    if (d < old_last)
+                    {
+                        *d = std::move(*i);
+                    }
+                    else
+                    {
+                        sfl::dtl::construct_at(d, std::move(*i));
+                        constructed = d;
+                    }
+                }
+            }
+        }
+        SFL_CATCH (...)
+        {
+            // Order of elements is unknown, so they are all removed.
+            sfl::dtl::destroy(constructed, new_last);
+            clear();
+            SFL_RETHROW;
+        }
+
+        data_.last_ = new_last;
+    }
+
     template <typename ForwardIt,
               sfl::dtl::enable_if_t<sfl::dtl::is_forward_iterator<ForwardIt>::value>* = nullptr>
+    SFL_CONSTEXPR_20
     void assign_range(ForwardIt first, ForwardIt last)
     {
+        data_.clear_index();
+
         SFL_ASSERT(size_type(std::distance(first, last)) <= capacity());
 
         const size_type n = std::distance(first, last);
@@ -856,7 +1572,42 @@ private:
         }
     }
 
+    // If the only argument is a key, it is inserted directly, without
+    // constructing a temporary element.
+    template <typename... Args,
+              sfl::dtl::enable_if_t<sfl::dtl::is_set_key_extractable<Key, Args...>::value>* = nullptr>
+    SFL_CONSTEXPR_20
+    std::pair<iterator, bool> emplace_aux(Args&&... args)
+    {
+        return insert_aux(std::forward<Args>(args)...);
+    }
+
+    template <typename... Args,
+              sfl::dtl::enable_if_t<!sfl::dtl::is_set_key_extractable<Key, Args...>::value>* = nullptr>
+    SFL_CONSTEXPR_20
+    std::pair<iterator, bool> emplace_aux(Args&&... args)
+    {
+        return insert_aux(value_type(std::forward<Args>(args)...));
+    }
+
+    template <typename... Args,
+              sfl::dtl::enable_if_t<sfl::dtl::is_set_key_extractable<Key, Args...>::value>* = nullptr>
+    SFL_CONSTEXPR_20
+    iterator emplace_hint_aux(const_iterator hint, Args&&... args)
+    {
+        return insert_aux(hint, std::forward<Args>(args)...);
+    }
+
+    template <typename... Args,
+              sfl::dtl::enable_if_t<!sfl::dtl::is_set_key_extractable<Key, Args...>::value>* = nullptr>
+    SFL_CONSTEXPR_20
+    iterator emplace_hint_aux(const_iterator hint, Args&&... args)
+    {
+        return insert_aux(hint, value_type(std::forward<Args>(args)...));
+    }
+
     template <typename Value>
+    SFL_CONSTEXPR_20
     std::pair<iterator, bool> insert_aux(Value&& value)
     {
         auto it = lower_bound(value);
@@ -870,6 +1621,7 @@ private:
     }
 
     template <typename Value>
+    SFL_CONSTEXPR_20
     iterator insert_aux(const_iterator hint, Value&& value)
     {
         if (is_insert_hint_good(hint, value))
@@ -882,6 +1634,7 @@ private:
     }
 
     template <typename K>
+    SFL_CONSTEXPR_20
     std::pair<iterator, bool> insert_aux_heterogeneous(K&& x)
     {
         auto it = lower_bound(x);
@@ -895,6 +1648,7 @@ private:
     }
 
     template <typename K>
+    SFL_CONSTEXPR_20
     iterator insert_aux_heterogeneous(const_iterator hint, K&& x)
     {
         if (is_insert_hint_good(hint, x))
@@ -906,9 +1660,129 @@ private:
         return insert_aux_heterogeneous(std::forward<K>(x)).first;
     }
 
+    // Appends as many elements as fit into internal storage and then sorts
+    // and merges them at once, which takes O(m * log(m)^2 + (n + m) *
+    // log(n + m)) element moves instead of O(n * m). Repeats until all
+    // elements are inserted.
+    template <typename InputIt>
+    SFL_CONSTEXPR_20
+    void insert_range_aux(InputIt first, InputIt last)
+    {
+        while (first != last)
+        {
+            if (full())
+            {
+                insert(*first);
+                ++first;
+                continue;
+            }
+
+            const size_type old_size = size();
+
+            SFL_TRY
+            {
+                while (first != last && !full())
+                {
+                    insert_exactly_at(cend(), *first);
+                    ++first;
+                }
+            }
+            SFL_CATCH (...)
+            {
+                erase(nth(old_size), cend());
+                SFL_RETHROW;
+            }
+
+            merge_appended(old_size);
+        }
+    }
+
+    // Appends as many elements as fit into internal storage and merges them
+    // with existing elements. Unlike `insert_range_aux`, appended elements
+    // are not sorted because they must already be in order. Remaining
+    // elements (if any) are inserted using `insert_range_aux`.
+    template <typename InputIt>
+    SFL_CONSTEXPR_20
+    void insert_sorted_range_aux(InputIt first, InputIt last)
+    {
+        const size_type old_size = size();
+
+        SFL_TRY
+        {
+            while (first != last && !full())
+            {
+                insert_exactly_at(cend(), *first);
+                ++first;
+            }
+        }
+        SFL_CATCH (...)
+        {
+            erase(nth(old_size), cend());
+            SFL_RETHROW;
+        }
+
+        SFL_ASSERT(sfl::dtl::is_sorted_unique(data_.first_ + old_size, data_.last_, data_.ref_to_comp()));
+
+        merge_sorted_appended(old_size);
+
+        insert_range_aux(first, last);
+    }
+
+    // Sorts elements at positions `pos` and above and merges them with
+    // preceding elements, keeping only the first of equivalent elements.
+    // Sorting and merging never allocate memory.
+    SFL_CONSTEXPR_20
+    void merge_appended(size_type pos)
+    {
+        const pointer mid = data_.first_ + pos;
+
+        SFL_TRY
+        {
+            sfl::dtl::stable_sort_in_place(mid, data_.last_, data_.ref_to_comp());
+        }
+        SFL_CATCH (...)
+        {
+            erase(nth(pos), cend());
+            SFL_RETHROW;
+        }
+
+        merge_sorted_appended(pos);
+    }
+
+    // Merges sorted elements at positions `pos` and above with preceding
+    // elements, keeping only the first of equivalent elements.
+    // Merging does not allocate memory, so if an exception is thrown, the
+    // order of elements is unknown and all elements are removed.
+    SFL_CONSTEXPR_20
+    void merge_sorted_appended(size_type pos)
+    {
+        SFL_TRY
+        {
+            sfl::dtl::merge_in_place(data_.first_, data_.first_ + pos, data_.last_, data_.ref_to_comp());
+
+            const pointer new_last = sfl::dtl::unique_sorted
+            (
+                data_.first_,
+                data_.last_,
+                data_.ref_to_comp()
+            );
+
+            erase(nth(std::distance(data_.first_, new_last)), cend());
+        }
+        SFL_CATCH (...)
+        {
+            // Order of elements is unknown, so they are all removed.
+            clear();
+            SFL_RETHROW;
+        }
+    }
+
     template <typename Value>
+    SFL_CONSTEXPR_20
     iterator insert_exactly_at(const_iterator pos, Value&& value)
     {
+        data_.clear_index();
+
         SFL_ASSERT(!full());
         SFL_ASSERT(cbegin() <= pos && pos <= cend());
 
@@ -952,6 +1826,7 @@ private:
     }
 
     template <typename Value>
+    SFL_CONSTEXPR_20
     bool is_insert_hint_good(const_iterator hint, const Value& value)
     {
         return (hint == begin() || data_.ref_to_comp()(*(hint - 1), value))
@@ -963,85 +1838,93 @@ private:
 // ---- NON-MEMBER FUNCTIONS --------------------------------------------------
 //
 
-template <typename K, std::size_t N, typename C>
+template <typename K, std::size_t N, typename C, bool F, bool L>
 SFL_NODISCARD
+SFL_CONSTEXPR_20
 bool operator==
 (
-    const static_flat_set<K, N, C>& x,
-    const static_flat_set<K, N, C>& y
+    const static_flat_set<K, N, C, F, L>& x,
+    const static_flat_set<K, N, C, F, L>& y
 )
 {
     return x.size() == y.size() && std::equal(x.begin(), x.end(), y.begin());
 }
 
-template <typename K, std::size_t N, typename C>
+template <typename K, std::size_t N, typename C, bool F, bool L>
 SFL_NODISCARD
+SFL_CONSTEXPR_20
 bool operator!=
 (
-    const static_flat_set<K, N, C>& x,
-    const static_flat_set<K, N, C>& y
+    const static_flat_set<K, N, C, F, L>& x,
+    const static_flat_set<K, N, C, F, L>& y
 )
 {
     return !(x == y);
 }
 
-template <typename K, std::size_t N, typename C>
+template <typename K, std::size_t N, typename C, bool F, bool L>
 SFL_NODISCARD
+SFL_CONSTEXPR_20
 bool operator<
 (
-    const static_flat_set<K, N, C>& x,
-    const static_flat_set<K, N, C>& y
+    const static_flat_set<K, N, C, F, L>& x,
+    const static_flat_set<K, N, C, F, L>& y
 )
 {
     return std::lexicographical_compare(x.begin(), x.end(), y.begin(), y.end());
 }
 
-template <typename K, std::size_t N, typename C>
+template <typename K, std::size_t N, typename C, bool F, bool L>
 SFL_NODISCARD
+SFL_CONSTEXPR_20
 bool operator>
 (
-    const static_flat_set<K, N, C>& x,
-    const static_flat_set<K, N, C>& y
+    const static_flat_set<K, N, C, F, L>& x,
+    const static_flat_set<K, N, C, F, L>& y
 )
 {
     return y < x;
 }
 
-template <typename K, std::size_t N, typename C>
+template <typename K, std::size_t N, typename C, bool F, bool L>
 SFL_NODISCARD
+SFL_CONSTEXPR_20
 bool operator<=
 (
-    const static_flat_set<K, N, C>& x,
-    const static_flat_set<K, N, C>& y
+    const static_flat_set<K, N, C, F, L>& x,
+    const static_flat_set<K, N, C, F, L>& y
 )
 {
     return !(y < x);
 }
 
-template <typename K, std::size_t N, typename C>
+template <typename K, std::size_t N, typename C, bool F, bool L>
 SFL_NODISCARD
+SFL_CONSTEXPR_20
 bool operator>=
 (
-    const static_flat_set<K, N, C>& x,
-    const static_flat_set<K, N, C>& y
+    const static_flat_set<K, N, C, F, L>& x,
+    const static_flat_set<K, N, C, F, L>& y
 )
 {
     return !(x < y);
 }
 
-template <typename K, std::size_t N, typename C>
+template <typename K, std::size_t N, typename C, bool F, bool L>
+SFL_CONSTEXPR_20
 void swap
 (
-    static_flat_set<K, N, C>& x,
-    static_flat_set<K, N, C>& y
+    static_flat_set<K, N, C, F, L>& x,
+    static_flat_set<K, N, C, F, L>& y
 )
 {
     x.swap(y);
 }
 
-template <typename K, std::size_t N, typename C, typename Predicate>
-typename static_flat_set<K, N, C>::size_type
-    erase_if(static_flat_set<K, N, C>& c, Predicate pred)
+template <typename K, std::size_t N, typename C, bool F, bool L, typename Predicate>
+SFL_CONSTEXPR_20
+typename static_flat_set<K, N, C, F, L>::size_type
+    erase_if(static_flat_set<K, N, C, F, L>& c, Predicate pred)
 {
     auto old_size = c.size();
 
@@ -1060,6 +1943,33 @@ typename static_flat_set<K, N, C>::size_type
     return old_size - c.size();
 }
 
+//
+// Creates static_flat_set whose capacity N is deduced from the number of
+// elements, e.g. `sfl::make_static_flat_set({3, 1, 2})`.
+// Elements need not be sorted. Duplicates are discarded.
+//
+template <typename Key, typename Compare = std::less<Key>, std::size_t N>
+SFL_NODISCARD
+SFL_CONSTEXPR_20
+static_flat_set<Key, N, Compare>
+    make_static_flat_set(const Key (&arr)[N])
+{
+    return static_flat_set<Key, N, Compare>(arr, arr + N);
+}
+
+template <typename Key, typename Compare = std::less<Key>, std::size_t N>
+SFL_NODISCARD
+SFL_CONSTEXPR_20
+static_flat_set<Key, N, Compare>
+    make_static_flat_set(Key (&&arr)[N])
+{
+    return static_flat_set<Key, N, Compare>
+    (
+        std::make_move_iterator(arr),
+        std::make_move_iterator(arr + N)
+    );
+}
+
 } // namespace sfl
 
 #endif // SFL_STATIC_FLAT_SET_HPP_INCLUDED
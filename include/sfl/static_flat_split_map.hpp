@@ -0,0 +1,1780 @@
+//
+// Copyright (c) 2022 Slaven Falandys
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+//
+
+#ifndef SFL_STATIC_FLAT_SPLIT_MAP_HPP_INCLUDED
+#define SFL_STATIC_FLAT_SPLIT_MAP_HPP_INCLUDED
+
+#include "private.hpp"
+#include "static_vector.hpp"
+
+#include <algorithm>        // copy, equal, lexicographical_compare, swap_ranges
+#include <cstddef>          // size_t
+#include <functional>       // less
+#include <initializer_list> // initializer_list
+#include <iterator>         // make_move_iterator, next, reverse_iterator
+#include <type_traits>      // is_same, is_nothrow_xxxxx
+#include <tuple>            // forward_as_tuple
+#include <utility>          // forward, move, pair
+
+#ifdef SFL_TEST_STATIC_FLAT_SPLIT_MAP
+void test_static_flat_split_map();
+#endif
+
+namespace sfl
+{
+
+template < typename Key,
+           typename T,
+           std::size_t N,
+           typename Compare = std::less<Key> >
+class static_flat_split_map
+{
+    #ifdef SFL_TEST_STATIC_FLAT_SPLIT_MAP
+    friend void ::test_static_flat_split_map();
+    #endif
+
+    static_assert(N > 0, "N must be greater than zero.");
+
+public:
+
+    using key_type               = Key;
+    using mapped_type            = T;
+    using value_type             = std::pair<Key, T>;
+    using size_type              = std::size_t;
+    using difference_type        = std::ptrdiff_t;
+    using key_compare            = Compare;
+    using reference              = std::pair<const Key&, T&>;
+    using const_reference        = std::pair<const Key&, const T&>;
+    using iterator               = sfl::dtl::split_iterator<Key, T, static_flat_split_map>;
+    using const_iterator         = sfl::dtl::split_iterator<Key, const T, static_flat_split_map>;
+    using reverse_iterator       = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    class value_compare : protected key_compare
+    {
+        friend class static_flat_split_map;
+
+    private:
+
+        value_compare(const key_compare& c)
+            : key_compare(c)
+        {}
+
+    public:
+
+        bool operator()(const_reference x, const_reference y) const
+        {
+            return key_compare::operator()(x.first, y.first);
+        }
+    };
+
+public:
+
+    static constexpr size_type static_capacity = N;
+
+    using key_container_type    = sfl::static_vector<Key, N>;
+    using mapped_container_type = sfl::static_vector<T, N>;
+
+    // Keys and mapped values moved out of the container by `extract`.
+    struct containers
+    {
+        key_container_type    keys;
+        mapped_container_type values;
+    };
+
+private:
+
+    // Iterator used to sort and merge keys and mapped values together.
+    using zip_iterator = sfl::dtl::split_zip_iterator<Key, T>;
+
+    // Compares elements referenced by `zip_iterator` by keys.
+    // For internal use only.
+    class element_compare
+    {
+    private:
+
+        const key_compare& comp_;
+
+    public:
+
+        explicit element_compare(const key_compare& comp) noexcept
+            : comp_(comp)
+        {}
+
+        template <typename X, typename Y>
+        bool operator()(const X& x, const Y& y) const
+        {
+            return comp_(x.first, y.first);
+        }
+    };
+
+    //
+    // Keys and mapped values are stored in two separate arrays.
+    //
+
+    class data_base
+    {
+    public:
+
+        union
+        {
+            Key keys_[N];
+        };
+
+        union
+        {
+            T mapped_[N];
+        };
+
+        size_type size_;
+
+        data_base() noexcept
+            : size_(0)
+        {}
+
+        #if defined(__clang__) && (__clang_major__ == 3) // For CentOS 7
+        ~data_base()
+        {}
+        #else
+        ~data_base() noexcept
+        {}
+        #endif
+    };
+
+    class data : public data_base, public key_compare
+    {
+    public:
+
+        data() noexcept(std::is_nothrow_default_constructible<key_compare>::value)
+            : key_compare()
+        {}
+
+        data(const key_compare& comp) noexcept(std::is_nothrow_copy_constructible<key_compare>::value)
+            : key_compare(comp)
+        {}
+
+        data(key_compare&& comp) noexcept(std::is_nothrow_move_constructible<key_compare>::value)
+            : key_compare(std::move(comp))
+        {}
+
+        key_compare& ref_to_comp() noexcept
+        {
+            return *this;
+        }
+
+        const key_compare& ref_to_comp() const noexcept
+        {
+            return *this;
+        }
+
+        Key* keys() noexcept
+        {
+            return this->keys_;
+        }
+
+        const Key* keys() const noexcept
+        {
+            return this->keys_;
+        }
+
+        T* mapped() noexcept
+        {
+            return this->mapped_;
+        }
+
+        const T* mapped() const noexcept
+        {
+            return this->mapped_;
+        }
+    };
+
+    data data_;
+
+public:
+
+    //
+    // ---- CONSTRUCTION AND DESTRUCTION --------------------------------------
+    //
+
+    static_flat_split_map() noexcept(std::is_nothrow_default_constructible<Compare>::value)
+        : data_()
+    {}
+
+    explicit static_flat_split_map(const Compare& comp) noexcept(std::is_nothrow_copy_constructible<Compare>::value)
+        : data_(comp)
+    {}
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    static_flat_split_map(InputIt first, InputIt last)
+        : data_()
+    {
+        SFL_TRY
+        {
+            insert(first, last);
+        }
+        SFL_CATCH (...)
+        {
+            destroy_all();
+            SFL_RETHROW;
+        }
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    static_flat_split_map(InputIt first, InputIt last, const Compare& comp)
+        : data_(comp)
+    {
+        SFL_TRY
+        {
+            insert(first, last);
+        }
+        SFL_CATCH (...)
+        {
+            destroy_all();
+            SFL_RETHROW;
+        }
+    }
+
+    static_flat_split_map(std::initializer_list<value_type> ilist)
+        : static_flat_split_map(ilist.begin(), ilist.end())
+    {}
+
+    static_flat_split_map(std::initializer_list<value_type> ilist, const Compare& comp)
+        : static_flat_split_map(ilist.begin(), ilist.end(), comp)
+    {}
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    static_flat_split_map(sfl::sorted_unique_t, InputIt first, InputIt last)
+        : data_()
+    {
+        SFL_TRY
+        {
+            insert(sfl::sorted_unique_t(), first, last);
+        }
+        SFL_CATCH (...)
+        {
+            destroy_all();
+            SFL_RETHROW;
+        }
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    static_flat_split_map(sfl::sorted_unique_t, InputIt first, InputIt last, const Compare& comp)
+        : data_(comp)
+    {
+        SFL_TRY
+        {
+            insert(sfl::sorted_unique_t(), first, last);
+        }
+        SFL_CATCH (...)
+        {
+            destroy_all();
+            SFL_RETHROW;
+        }
+    }
+
+    static_flat_split_map(sfl::sorted_unique_t, std::initializer_list<value_type> ilist)
+        : static_flat_split_map(sfl::sorted_unique_t(), ilist.begin(), ilist.end())
+    {}
+
+    static_flat_split_map(sfl::sorted_unique_t, std::initializer_list<value_type> ilist, const Compare& comp)
+        : static_flat_split_map(sfl::sorted_unique_t(), ilist.begin(), ilist.end(), comp)
+    {}
+
+    static_flat_split_map(const static_flat_split_map& other)
+        : data_(other.data_.ref_to_comp())
+    {
+        construct_all(other.data_.keys(), other.data_.mapped(), other.size());
+    }
+
+    static_flat_split_map(static_flat_split_map&& other)
+        : data_(std::move(other.data_.ref_to_comp()))
+    {
+        construct_all
+        (
+            std::make_move_iterator(other.data_.keys()),
+            std::make_move_iterator(other.data_.mapped()),
+            other.size()
+        );
+    }
+
+    ~static_flat_split_map()
+    {
+        destroy_all();
+    }
+
+    //
+    // ---- ASSIGNMENT --------------------------------------------------------
+    //
+
+    static_flat_split_map& operator=(const static_flat_split_map& other)
+    {
+        if (this != &other)
+        {
+            data_.ref_to_comp() = other.data_.ref_to_comp();
+
+            assign_range(other.data_.keys(), other.data_.mapped(), other.size());
+        }
+
+        return *this;
+    }
+
+    static_flat_split_map& operator=(static_flat_split_map&& other)
+    {
+        data_.ref_to_comp() = other.data_.ref_to_comp();
+
+        assign_range
+        (
+            std::make_move_iterator(other.data_.keys()),
+            std::make_move_iterator(other.data_.mapped()),
+            other.size()
+        );
+
+        return *this;
+    }
+
+    static_flat_split_map& operator=(std::initializer_list<value_type> ilist)
+    {
+        clear();
+        insert(ilist.begin(), ilist.end());
+        return *this;
+    }
+
+    //
+    // ---- KEY COMPARE -------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    key_compare key_comp() const
+    {
+        return data_.ref_to_comp();
+    }
+
+    //
+    // ---- VALUE COMPARE -----------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    value_compare value_comp() const
+    {
+        return value_compare(data_.ref_to_comp());
+    }
+
+    //
+    // ---- ITERATORS ---------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    iterator begin() noexcept
+    {
+        return nth(0);
+    }
+
+    SFL_NODISCARD
+    const_iterator begin() const noexcept
+    {
+        return nth(0);
+    }
+
+    SFL_NODISCARD
+    const_iterator cbegin() const noexcept
+    {
+        return nth(0);
+    }
+
+    SFL_NODISCARD
+    iterator end() noexcept
+    {
+        return nth(size());
+    }
+
+    SFL_NODISCARD
+    const_iterator end() const noexcept
+    {
+        return nth(size());
+    }
+
+    SFL_NODISCARD
+    const_iterator cend() const noexcept
+    {
+        return nth(size());
+    }
+
+    SFL_NODISCARD
+    reverse_iterator rbegin() noexcept
+    {
+        return reverse_iterator(end());
+    }
+
+    SFL_NODISCARD
+    const_reverse_iterator rbegin() const noexcept
+    {
+        return const_reverse_iterator(end());
+    }
+
+    SFL_NODISCARD
+    const_reverse_iterator crbegin() const noexcept
+    {
+        return const_reverse_iterator(end());
+    }
+
+    SFL_NODISCARD
+    reverse_iterator rend() noexcept
+    {
+        return reverse_iterator(begin());
+    }
+
+    SFL_NODISCARD
+    const_reverse_iterator rend() const noexcept
+    {
+        return const_reverse_iterator(begin());
+    }
+
+    SFL_NODISCARD
+    const_reverse_iterator crend() const noexcept
+    {
+        return const_reverse_iterator(begin());
+    }
+
+    SFL_NODISCARD
+    iterator nth(size_type pos) noexcept
+    {
+        SFL_ASSERT(pos <= size());
+        return iterator(data_.keys() + pos, data_.mapped() + pos);
+    }
+
+    SFL_NODISCARD
+    const_iterator nth(size_type pos) const noexcept
+    {
+        SFL_ASSERT(pos <= size());
+        return const_iterator(data_.keys() + pos, data_.mapped() + pos);
+    }
+
+    SFL_NODISCARD
+    size_type index_of(const_iterator pos) const noexcept
+    {
+        SFL_ASSERT(cbegin() <= pos && pos <= cend());
+        return pos.key_ - data_.keys();
+    }
+
+    //
+    // ---- SIZE AND CAPACITY -------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    bool empty() const noexcept
+    {
+        return data_.size_ == 0;
+    }
+
+    SFL_NODISCARD
+    bool full() const noexcept
+    {
+        return data_.size_ == N;
+    }
+
+    SFL_NODISCARD
+    size_type size() const noexcept
+    {
+        return data_.size_;
+    }
+
+    SFL_NODISCARD
+    static constexpr size_type max_size() noexcept
+    {
+        return N;
+    }
+
+    SFL_NODISCARD
+    static constexpr size_type capacity() noexcept
+    {
+        return N;
+    }
+
+    SFL_NODISCARD
+    size_type available() const noexcept
+    {
+        return capacity() - size();
+    }
+
+    //
+    // ---- MODIFIERS ---------------------------------------------------------
+    //
+
+    void clear() noexcept
+    {
+        destroy_all();
+        data_.size_ = 0;
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args)
+    {
+        SFL_ASSERT(!full());
+        return emplace_aux(std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    iterator emplace_hint(const_iterator hint, Args&&... args)
+    {
+        SFL_ASSERT(!full());
+        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        return emplace_hint_aux(hint, std::forward<Args>(args)...);
+    }
+
+    std::pair<iterator, bool> insert(const value_type& value)
+    {
+        SFL_ASSERT(!full());
+        return insert_aux(value);
+    }
+
+    std::pair<iterator, bool> insert(value_type&& value)
+    {
+        SFL_ASSERT(!full());
+        return insert_aux(std::move(value));
+    }
+
+    template <typename P,
+              sfl::dtl::enable_if_t<std::is_constructible<value_type, P&&>::value>* = nullptr>
+    std::pair<iterator, bool> insert(P&& value)
+    {
+        SFL_ASSERT(!full());
+        return insert_aux(value_type(std::forward<P>(value)));
+    }
+
+    iterator insert(const_iterator hint, const value_type& value)
+    {
+        SFL_ASSERT(!full());
+        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        return insert_aux(hint, value);
+    }
+
+    iterator insert(const_iterator hint, value_type&& value)
+    {
+        SFL_ASSERT(!full());
+        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        return insert_aux(hint, std::move(value));
+    }
+
+    template <typename P,
+              sfl::dtl::enable_if_t<std::is_constructible<value_type, P&&>::value>* = nullptr>
+    iterator insert(const_iterator hint, P&& value)
+    {
+        SFL_ASSERT(!full());
+        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        return insert_aux(hint, value_type(std::forward<P>(value)));
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    void insert(InputIt first, InputIt last)
+    {
+        insert_range_aux(first, last);
+    }
+
+    void insert(std::initializer_list<value_type> ilist)
+    {
+        insert(ilist.begin(), ilist.end());
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    void insert(sfl::sorted_unique_t, InputIt first, InputIt last)
+    {
+        insert_sorted_range_aux(first, last);
+    }
+
+    void insert(sfl::sorted_unique_t, std::initializer_list<value_type> ilist)
+    {
+        insert(sfl::sorted_unique_t(), ilist.begin(), ilist.end());
+    }
+
+    template <typename M,
+              sfl::dtl::enable_if_t<std::is_assignable<mapped_type&, M&&>::value>* = nullptr>
+    std::pair<iterator, bool> insert_or_assign(const Key& key, M&& obj)
+    {
+        SFL_ASSERT(!full());
+        return insert_or_assign_aux(key, std::forward<M>(obj));
+    }
+
+    template <typename M,
+              sfl::dtl::enable_if_t<std::is_assignable<mapped_type&, M&&>::value>* = nullptr>
+    std::pair<iterator, bool> insert_or_assign(Key&& key, M&& obj)
+    {
+        SFL_ASSERT(!full());
+        return insert_or_assign_aux(std::move(key), std::forward<M>(obj));
+    }
+
+    template <typename K, typename M,
+              sfl::dtl::enable_if_t< sfl::dtl::has_is_transparent<Compare, K>::value &&
+                                     std::is_assignable<mapped_type&, M&&>::value >* = nullptr>
+    std::pair<iterator, bool> insert_or_assign(K&& key, M&& obj)
+    {
+        SFL_ASSERT(!full());
+        return insert_or_assign_aux(std::forward<K>(key), std::forward<M>(obj));
+    }
+
+    template <typename M,
+              sfl::dtl::enable_if_t<std::is_assignable<mapped_type&, M&&>::value>* = nullptr>
+    iterator insert_or_assign(const_iterator hint, const Key& key, M&& obj)
+    {
+        SFL_ASSERT(!full());
+        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        return insert_or_assign_aux(hint, key, std::forward<M>(obj));
+    }
+
+    template <typename M,
+              sfl::dtl::enable_if_t<std::is_assignable<mapped_type&, M&&>::value>* = nullptr>
+    iterator insert_or_assign(const_iterator hint, Key&& key, M&& obj)
+    {
+        SFL_ASSERT(!full());
+        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        return insert_or_assign_aux(hint, std::move(key), std::forward<M>(obj));
+    }
+
+    template <typename K, typename M,
+              sfl::dtl::enable_if_t< sfl::dtl::has_is_transparent<Compare, K>::value &&
+                                     std::is_assignable<mapped_type&, M&&>::value >* = nullptr>
+    iterator insert_or_assign(const_iterator hint, K&& key, M&& obj)
+    {
+        SFL_ASSERT(!full());
+        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        return insert_or_assign_aux(hint, std::forward<K>(key), std::forward<M>(obj));
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args)
+    {
+        SFL_ASSERT(!full());
+        return try_emplace_aux(key, std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(Key&& key, Args&&... args)
+    {
+        SFL_ASSERT(!full());
+        return try_emplace_aux(std::move(key), std::forward<Args>(args)...);
+    }
+
+    template <typename K, typename... Args,
+              sfl::dtl::enable_if_t<
+                #if defined(__GNUC__) && !defined(__clang__) && (__GNUC__ < 7)
+                // This is workaround for GCC 4 bug on CentOS 7.
+                !std::is_same<sfl::dtl::remove_cvref_t<Key>, sfl::dtl::remove_cvref_t<K>>::value &&
+                #endif
+                sfl::dtl::has_is_transparent<Compare, K>::value &&
+                !std::is_convertible<K&&, const_iterator>::value &&
+                !std::is_convertible<K&&, iterator>::value
+              >* = nullptr>
+    std::pair<iterator, bool> try_emplace(K&& key, Args&&... args)
+    {
+        SFL_ASSERT(!full());
+        return try_emplace_aux(std::forward<K>(key), std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    iterator try_emplace(const_iterator hint, const Key& key, Args&&... args)
+    {
+        SFL_ASSERT(!full());
+        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        return try_emplace_aux(hint, key, std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    iterator try_emplace(const_iterator hint, Key&& key, Args&&... args)
+    {
+        SFL_ASSERT(!full());
+        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        return try_emplace_aux(hint, std::move(key), std::forward<Args>(args)...);
+    }
+
+    template <typename K, typename... Args,
+              sfl::dtl::enable_if_t<
+                #if defined(__GNUC__) && !defined(__clang__) && (__GNUC__ < 7)
+                // This is workaround for GCC 4 bug on CentOS 7.
+                !std::is_same<sfl::dtl::remove_cvref_t<Key>, sfl::dtl::remove_cvref_t<K>>::value &&
+                #endif
+                sfl::dtl::has_is_transparent<Compare, K>::value
+              >* = nullptr>
+    iterator try_emplace(const_iterator hint, K&& key, Args&&... args)
+    {
+        SFL_ASSERT(!full());
+        SFL_ASSERT(cbegin() <= hint && hint <= cend());
+        return try_emplace_aux(hint, std::forward<K>(key), std::forward<Args>(args)...);
+    }
+
+    iterator erase(iterator pos)
+    {
+        return erase(const_iterator(pos));
+    }
+
+    iterator erase(const_iterator pos)
+    {
+        SFL_ASSERT(cbegin() <= pos && pos < cend());
+
+        const size_type i = index_of(pos);
+
+        Key* const keys = data_.keys();
+        T* const mapped = data_.mapped();
+
+        sfl::dtl::move(keys + i + 1, keys + size(), keys + i);
+        sfl::dtl::move(mapped + i + 1, mapped + size(), mapped + i);
+
+        pop_back();
+
+        return nth(i);
+    }
+
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        SFL_ASSERT(cbegin() <= first && first <= last && last <= cend());
+
+        const size_type i = index_of(first);
+        const size_type j = index_of(last);
+
+        if (i == j)
+        {
+            return nth(i);
+        }
+
+        Key* const keys = data_.keys();
+        T* const mapped = data_.mapped();
+
+        sfl::dtl::move(keys + j, keys + size(), keys + i);
+        sfl::dtl::move(mapped + j, mapped + size(), mapped + i);
+
+        const size_type new_size = size() - (j - i);
+
+        sfl::dtl::destroy(keys + new_size, keys + size());
+        sfl::dtl::destroy(mapped + new_size, mapped + size());
+
+        data_.size_ = new_size;
+
+        return nth(i);
+    }
+
+    size_type erase(const Key& key)
+    {
+        auto it = find(key);
+
+        if (it == cend())
+        {
+            return 0;
+        }
+
+        erase(it);
+        return 1;
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    size_type erase(K&& x)
+    {
+        auto it = find(x);
+
+        if (it == cend())
+        {
+            return 0;
+        }
+
+        erase(it);
+        return 1;
+    }
+
+    void swap(static_flat_split_map& other)
+    {
+        if (this == &other)
+        {
+            return;
+        }
+
+        using std::swap;
+
+        swap(this->data_.ref_to_comp(), other.data_.ref_to_comp());
+
+        if (this->size() <= other.size())
+        {
+            this->swap_elements(other);
+        }
+        else
+        {
+            other.swap_elements(*this);
+        }
+    }
+
+    // Moves all keys and mapped values into two static vectors and leaves
+    // the container empty.
+    containers extract()
+    {
+        Key* const keys = data_.keys();
+        T* const mapped = data_.mapped();
+
+        containers result
+        {
+            key_container_type
+            (
+                std::make_move_iterator(keys),
+                std::make_move_iterator(keys + size())
+            ),
+            mapped_container_type
+            (
+                std::make_move_iterator(mapped),
+                std::make_move_iterator(mapped + size())
+            )
+        };
+
+        clear();
+
+        return result;
+    }
+
+    // Replaces all elements with keys and mapped values moved from `keys`
+    // and `values`.
+    void replace(key_container_type&& keys, mapped_container_type&& values)
+    {
+        SFL_ASSERT(keys.size() == values.size());
+        SFL_ASSERT(sfl::dtl::is_sorted_unique(keys.begin(), keys.end(), data_.ref_to_comp()));
+
+        assign_range
+        (
+            std::make_move_iterator(keys.begin()),
+            std::make_move_iterator(values.begin()),
+            keys.size()
+        );
+
+        keys.clear();
+        values.clear();
+    }
+
+    //
+    // ---- LOOKUP ------------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    iterator lower_bound(const Key& key)
+    {
+        return nth(lower_bound_index(key));
+    }
+
+    SFL_NODISCARD
+    const_iterator lower_bound(const Key& key) const
+    {
+        return nth(lower_bound_index(key));
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    SFL_NODISCARD
+    iterator lower_bound(const K& x)
+    {
+        return nth(lower_bound_index(x));
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    SFL_NODISCARD
+    const_iterator lower_bound(const K& x) const
+    {
+        return nth(lower_bound_index(x));
+    }
+
+    SFL_NODISCARD
+    iterator upper_bound(const Key& key)
+    {
+        return nth(upper_bound_index(key));
+    }
+
+    SFL_NODISCARD
+    const_iterator upper_bound(const Key& key) const
+    {
+        return nth(upper_bound_index(key));
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    SFL_NODISCARD
+    iterator upper_bound(const K& x)
+    {
+        return nth(upper_bound_index(x));
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    SFL_NODISCARD
+    const_iterator upper_bound(const K& x) const
+    {
+        return nth(upper_bound_index(x));
+    }
+
+    SFL_NODISCARD
+    std::pair<iterator, iterator> equal_range(const Key& key)
+    {
+        const auto r = equal_range_index(key);
+        return std::make_pair(nth(r.first), nth(r.second));
+    }
+
+    SFL_NODISCARD
+    std::pair<const_iterator, const_iterator> equal_range(const Key& key) const
+    {
+        const auto r = equal_range_index(key);
+        return std::make_pair(nth(r.first), nth(r.second));
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    SFL_NODISCARD
+    std::pair<iterator, iterator> equal_range(const K& x)
+    {
+        const auto r = equal_range_index(x);
+        return std::make_pair(nth(r.first), nth(r.second));
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    SFL_NODISCARD
+    std::pair<const_iterator, const_iterator> equal_range(const K& x) const
+    {
+        const auto r = equal_range_index(x);
+        return std::make_pair(nth(r.first), nth(r.second));
+    }
+
+    SFL_NODISCARD
+    iterator find(const Key& key)
+    {
+        return nth(find_index(key));
+    }
+
+    SFL_NODISCARD
+    const_iterator find(const Key& key) const
+    {
+        return nth(find_index(key));
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    SFL_NODISCARD
+    iterator find(const K& x)
+    {
+        return nth(find_index(x));
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    SFL_NODISCARD
+    const_iterator find(const K& x) const
+    {
+        return nth(find_index(x));
+    }
+
+    SFL_NODISCARD
+    size_type count(const Key& key) const
+    {
+        return find_index(key) != size();
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    SFL_NODISCARD
+    size_type count(const K& x) const
+    {
+        return find_index(x) != size();
+    }
+
+    SFL_NODISCARD
+    bool contains(const Key& key) const
+    {
+        return find_index(key) != size();
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    SFL_NODISCARD
+    bool contains(const K& x) const
+    {
+        return find_index(x) != size();
+    }
+
+    //
+    // ---- ELEMENT ACCESS ----------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    T& at(const Key& key)
+    {
+        const size_type i = find_index(key);
+
+        if (i == size())
+        {
+            sfl::dtl::throw_out_of_range("sfl::static_flat_split_map::at");
+        }
+
+        return data_.mapped()[i];
+    }
+
+    SFL_NODISCARD
+    const T& at(const Key& key) const
+    {
+        const size_type i = find_index(key);
+
+        if (i == size())
+        {
+            sfl::dtl::throw_out_of_range("sfl::static_flat_split_map::at");
+        }
+
+        return data_.mapped()[i];
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    SFL_NODISCARD
+    T& at(const K& x)
+    {
+        const size_type i = find_index(x);
+
+        if (i == size())
+        {
+            sfl::dtl::throw_out_of_range("sfl::static_flat_split_map::at");
+        }
+
+        return data_.mapped()[i];
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    SFL_NODISCARD
+    const T& at(const K& x) const
+    {
+        const size_type i = find_index(x);
+
+        if (i == size())
+        {
+            sfl::dtl::throw_out_of_range("sfl::static_flat_split_map::at");
+        }
+
+        return data_.mapped()[i];
+    }
+
+    SFL_NODISCARD
+    T& operator[](const Key& key)
+    {
+        return try_emplace(key).first->second;
+    }
+
+    SFL_NODISCARD
+    T& operator[](Key&& key)
+    {
+        return try_emplace(std::move(key)).first->second;
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    SFL_NODISCARD
+    T& operator[](K&& key)
+    {
+        return try_emplace(std::forward<K>(key)).first->second;
+    }
+
+    SFL_NODISCARD
+    const key_type* key_data() const noexcept
+    {
+        return data_.keys();
+    }
+
+    SFL_NODISCARD
+    mapped_type* mapped_data() noexcept
+    {
+        return data_.mapped();
+    }
+
+    SFL_NODISCARD
+    const mapped_type* mapped_data() const noexcept
+    {
+        return data_.mapped();
+    }
+
+private:
+
+    // Binary search touches only the array of keys.
+    template <typename K>
+    size_type lower_bound_index(const K& x) const
+    {
+        const Key* const keys = data_.keys();
+        return sfl::dtl::lower_bound(keys, keys + size(), x, data_.ref_to_comp()) - keys;
+    }
+
+    template <typename K>
+    size_type upper_bound_index(const K& x) const
+    {
+        const Key* const keys = data_.keys();
+        return sfl::dtl::upper_bound(keys, keys + size(), x, data_.ref_to_comp()) - keys;
+    }
+
+    std::pair<size_type, size_type> equal_range_index(const Key& key) const
+    {
+        // Keys are unique, so the range contains at most one element.
+        const size_type i = lower_bound_index(key);
+
+        if (i != size() && !data_.ref_to_comp()(key, data_.keys()[i]))
+        {
+            return std::make_pair(i, i + 1);
+        }
+
+        return std::make_pair(i, i);
+    }
+
+    // Several unique keys can be equivalent to `x` under transparent
+    // comparator, so upper end is searched for too.
+    template <typename K>
+    std::pair<size_type, size_type> equal_range_index(const K& x) const
+    {
+        const Key* const keys = data_.keys();
+        const size_type i = lower_bound_index(x);
+        const size_type j = sfl::dtl::upper_bound(keys + i, keys + size(), x, data_.ref_to_comp()) - keys;
+        return std::make_pair(i, j);
+    }
+
+    // Returns index of the element with key equivalent to `x`, or `size()`
+    // if there is no such element.
+    template <typename K>
+    size_type find_index(const K& x) const
+    {
+        const size_type i = lower_bound_index(x);
+
+        if (i != size() && data_.ref_to_comp()(x, data_.keys()[i]))
+        {
+            return size();
+        }
+
+        return i;
+    }
+
+    void destroy_all() noexcept
+    {
+        sfl::dtl::destroy(data_.keys(), data_.keys() + size());
+        sfl::dtl::destroy(data_.mapped(), data_.mapped() + size());
+    }
+
+    // Copies or moves `n` keys and mapped values into this container that
+    // must be empty.
+    template <typename KeyIt, typename MappedIt>
+    void construct_all(KeyIt key_first, MappedIt mapped_first, size_type n)
+    {
+        SFL_ASSERT(empty() && n <= capacity());
+
+        sfl::dtl::uninitialized_copy
+        (
+            key_first,
+            std::next(key_first, n),
+            data_.keys()
+        );
+
+        SFL_TRY
+        {
+            sfl::dtl::uninitialized_copy
+            (
+                mapped_first,
+                std::next(mapped_first, n),
+                data_.mapped()
+            );
+        }
+        SFL_CATCH (...)
+        {
+            sfl::dtl::destroy(data_.keys(), data_.keys() + n);
+            SFL_RETHROW;
+        }
+
+        data_.size_ = n;
+    }
+
+    template <typename KeyIt, typename MappedIt>
+    void assign_range(KeyIt key_first, MappedIt mapped_first, size_type n)
+    {
+        SFL_ASSERT(n <= capacity());
+
+        Key* const keys = data_.keys();
+        T* const mapped = data_.mapped();
+
+        const size_type s = size();
+
+        if (n <= s)
+        {
+            std::copy(key_first, std::next(key_first, n), keys);
+            std::copy(mapped_first, std::next(mapped_first, n), mapped);
+
+            sfl::dtl::destroy(keys + n, keys + s);
+            sfl::dtl::destroy(mapped + n, mapped + s);
+
+            data_.size_ = n;
+        }
+        else
+        {
+            const KeyIt key_mid = std::next(key_first, s);
+            const MappedIt mapped_mid = std::next(mapped_first, s);
+
+            std::copy(key_first, key_mid, keys);
+            std::copy(mapped_first, mapped_mid, mapped);
+
+            sfl::dtl::uninitialized_copy
+            (
+                key_mid,
+                std::next(key_mid, n - s),
+                keys + s
+            );
+
+            SFL_TRY
+            {
+                sfl::dtl::uninitialized_copy
+                (
+                    mapped_mid,
+                    std::next(mapped_mid, n - s),
+                    mapped + s
+                );
+            }
+            SFL_CATCH (...)
+            {
+                sfl::dtl::destroy(keys + s, keys + n);
+                SFL_RETHROW;
+            }
+
+            data_.size_ = n;
+        }
+    }
+
+    // Swaps elements of two containers. This container must not have more
+    // elements than `other`.
+    void swap_elements(static_flat_split_map& other)
+    {
+        const size_type this_size  = this->size();
+        const size_type other_size = other.size();
+
+        SFL_ASSERT(this_size <= other_size);
+
+        Key* const this_keys  = this->data_.keys();
+        Key* const other_keys = other.data_.keys();
+
+        T* const this_mapped  = this->data_.mapped();
+        T* const other_mapped = other.data_.mapped();
+
+        std::swap_ranges(this_keys, this_keys + this_size, other_keys);
+        std::swap_ranges(this_mapped, this_mapped + this_size, other_mapped);
+
+        sfl::dtl::uninitialized_copy
+        (
+            std::make_move_iterator(other_keys + this_size),
+            std::make_move_iterator(other_keys + other_size),
+            this_keys + this_size
+        );
+
+        sfl::dtl::uninitialized_copy
+        (
+            std::make_move_iterator(other_mapped + this_size),
+            std::make_move_iterator(other_mapped + other_size),
+            this_mapped + this_size
+        );
+
+        sfl::dtl::destroy(other_keys + this_size, other_keys + other_size);
+        sfl::dtl::destroy(other_mapped + this_size, other_mapped + other_size);
+
+        this->data_.size_ = other_size;
+        other.data_.size_ = this_size;
+    }
+
+    // Key is taken from arguments and searched for before the element is
+    // constructed, so nothing is constructed if the key already exists.
+    // Keys and mapped values are stored separately, so new element is still
+    // constructed as a temporary pair first.
+    template <typename... Args,
+              sfl::dtl::enable_if_t<sfl::dtl::is_map_key_extractable<Key, Args...>::value>* = nullptr>
+    std::pair<iterator, bool> emplace_aux(Args&&... args)
+    {
+        const Key& key = sfl::dtl::extract_map_key(args...);
+
+        const size_type i = lower_bound_index(key);
+
+        if (i == size() || data_.ref_to_comp()(key, data_.keys()[i]))
+        {
+            return std::make_pair(insert_exactly_at(nth(i), value_type(std::forward<Args>(args)...)), true);
+        }
+
+        return std::make_pair(nth(i), false);
+    }
+
+    template <typename... Args,
+              sfl::dtl::enable_if_t<!sfl::dtl::is_map_key_extractable<Key, Args...>::value>* = nullptr>
+    std::pair<iterator, bool> emplace_aux(Args&&... args)
+    {
+        return insert_aux(value_type(std::forward<Args>(args)...));
+    }
+
+    template <typename... Args,
+              sfl::dtl::enable_if_t<sfl::dtl::is_map_key_extractable<Key, Args...>::value>* = nullptr>
+    iterator emplace_hint_aux(const_iterator hint, Args&&... args)
+    {
+        if (is_insert_hint_good(hint, sfl::dtl::extract_map_key(args...)))
+        {
+            return insert_exactly_at(hint, value_type(std::forward<Args>(args)...));
+        }
+
+        // Hint is not good. Use non-hinted function.
+        return emplace_aux(std::forward<Args>(args)...).first;
+    }
+
+    template <typename... Args,
+              sfl::dtl::enable_if_t<!sfl::dtl::is_map_key_extractable<Key, Args...>::value>* = nullptr>
+    iterator emplace_hint_aux(const_iterator hint, Args&&... args)
+    {
+        return insert_aux(hint, value_type(std::forward<Args>(args)...));
+    }
+
+    template <typename Value>
+    std::pair<iterator, bool> insert_aux(Value&& value)
+    {
+        const size_type i = lower_bound_index(value.first);
+
+        if (i == size() || data_.ref_to_comp()(value.first, data_.keys()[i]))
+        {
+            return std::make_pair(insert_exactly_at(nth(i), std::forward<Value>(value)), true);
+        }
+
+        return std::make_pair(nth(i), false);
+    }
+
+    template <typename Value>
+    iterator insert_aux(const_iterator hint, Value&& value)
+    {
+        if (is_insert_hint_good(hint, value.first))
+        {
+            return insert_exactly_at(hint, std::forward<Value>(value));
+        }
+
+        // Hint is not good. Use non-hinted function.
+        return insert_aux(std::forward<Value>(value)).first;
+    }
+
+    template <typename K, typename M>
+    std::pair<iterator, bool> insert_or_assign_aux(K&& key, M&& obj)
+    {
+        const size_type i = lower_bound_index(key);
+
+        if (i == size() || data_.ref_to_comp()(key, data_.keys()[i]))
+        {
+            return std::make_pair
+            (
+                insert_exactly_at
+                (
+                    nth(i),
+                    value_type
+                    (
+                        std::piecewise_construct,
+                        std::forward_as_tuple(std::forward<K>(key)),
+                        std::forward_as_tuple(std::forward<M>(obj))
+                    )
+                ),
+                true
+            );
+        }
+
+        data_.mapped()[i] = std::forward<M>(obj);
+        return std::make_pair(nth(i), false);
+    }
+
+    template <typename K, typename M>
+    iterator insert_or_assign_aux(const_iterator hint, K&& key, M&& obj)
+    {
+        if (is_insert_hint_good(hint, key))
+        {
+            return insert_exactly_at
+            (
+                hint,
+                value_type
+                (
+                    std::piecewise_construct,
+                    std::forward_as_tuple(std::forward<K>(key)),
+                    std::forward_as_tuple(std::forward<M>(obj))
+                )
+            );
+        }
+
+        // Hint is not good. Use non-hinted function.
+        return insert_or_assign_aux(std::forward<K>(key), std::forward<M>(obj)).first;
+    }
+
+    template <typename K, typename... Args>
+    std::pair<iterator, bool> try_emplace_aux(K&& key, Args&&... args)
+    {
+        const size_type i = lower_bound_index(key);
+
+        if (i == size() || data_.ref_to_comp()(key, data_.keys()[i]))
+        {
+            return std::make_pair
+            (
+                insert_exactly_at
+                (
+                    nth(i),
+                    value_type
+                    (
+                        std::piecewise_construct,
+                        std::forward_as_tuple(std::forward<K>(key)),
+                        std::forward_as_tuple(std::forward<Args>(args)...)
+                    )
+                ),
+                true
+            );
+        }
+
+        return std::make_pair(nth(i), false);
+    }
+
+    template <typename K, typename... Args>
+    iterator try_emplace_aux(const_iterator hint, K&& key, Args&&... args)
+    {
+        if (is_insert_hint_good(hint, key))
+        {
+            return insert_exactly_at
+            (
+                hint,
+                value_type
+                (
+                    std::piecewise_construct,
+                    std::forward_as_tuple(std::forward<K>(key)),
+                    std::forward_as_tuple(std::forward<Args>(args)...)
+                )
+            );
+        }
+
+        // Hint is not good. Use non-hinted function.
+        return try_emplace_aux(std::forward<K>(key), std::forward<Args>(args)...).first;
+    }
+
+    // Returns iterator that dereferences to modifiable key and mapped value
+    // at position `pos`.
+    zip_iterator zip(size_type pos) noexcept
+    {
+        return zip_iterator(data_.keys() + pos, data_.mapped() + pos);
+    }
+
+    // Appends as many elements as fit into internal storage and then sorts
+    // and merges them at once, which takes O(m * log(m)^2 + (n + m) *
+    // log(n + m)) element moves instead of O(n * m). Repeats until all
+    // elements are inserted.
+    template <typename InputIt>
+    void insert_range_aux(InputIt first, InputIt last)
+    {
+        while (first != last)
+        {
+            if (full())
+            {
+                insert(*first);
+                ++first;
+                continue;
+            }
+
+            const size_type old_size = size();
+
+            SFL_TRY
+            {
+                while (first != last && !full())
+                {
+                    insert_exactly_at(cend(), *first);
+                    ++first;
+                }
+            }
+            SFL_CATCH (...)
+            {
+                erase(nth(old_size), cend());
+                SFL_RETHROW;
+            }
+
+            merge_appended(old_size);
+        }
+    }
+
+    // Appends as many elements as fit into internal storage and merges them
+    // with existing elements. Unlike `insert_range_aux`, appended elements
+    // are not sorted because they must already be in order. Remaining
+    // elements (if any) are inserted using `insert_range_aux`.
+    template <typename InputIt>
+    void insert_sorted_range_aux(InputIt first, InputIt last)
+    {
+        const size_type old_size = size();
+
+        SFL_TRY
+        {
+            while (first != last && !full())
+            {
+                insert_exactly_at(cend(), *first);
+                ++first;
+            }
+        }
+        SFL_CATCH (...)
+        {
+            erase(nth(old_size), cend());
+            SFL_RETHROW;
+        }
+
+        SFL_ASSERT(sfl::dtl::is_sorted_unique(data_.keys() + old_size, data_.keys() + size(), data_.ref_to_comp()));
+
+        merge_sorted_appended(old_size);
+
+        insert_range_aux(first, last);
+    }
+
+    // Sorts elements at positions `pos` and above and merges them with
+    // preceding elements, keeping only the first of equivalent elements.
+    // Sorting and merging never allocate memory.
+    void merge_appended(size_type pos)
+    {
+        element_compare comp(data_.ref_to_comp());
+
+        SFL_TRY
+        {
+            sfl::dtl::stable_sort_in_place(zip(pos), zip(size()), comp);
+        }
+        SFL_CATCH (...)
+        {
+            erase(nth(pos), cend());
+            SFL_RETHROW;
+        }
+
+        merge_sorted_appended(pos);
+    }
+
+    // Merges sorted elements at positions `pos` and above with preceding
+    // elements, keeping only the first of equivalent elements.
+    // Merging does not allocate memory, so if an exception is thrown, the
+    // order of elements is unknown and all elements are removed.
+    void merge_sorted_appended(size_type pos)
+    {
+        element_compare comp(data_.ref_to_comp());
+
+        SFL_TRY
+        {
+            sfl::dtl::merge_in_place(zip(0), zip(pos), zip(size()), comp);
+
+            const zip_iterator new_last = sfl::dtl::unique_sorted(zip(0), zip(size()), comp);
+
+            erase(nth(new_last - zip(0)), cend());
+        }
+        SFL_CATCH (...)
+        {
+            // Order of elements is unknown, so they are all removed.
+            clear();
+            SFL_RETHROW;
+        }
+    }
+
+    // Constructs key from `key` at `k` and mapped value from `args` at `m`.
+    template <typename K, typename... Args>
+    void construct_element(Key* k, T* m, K&& key, Args&&... args)
+    {
+        sfl::dtl::construct_at(k, std::forward<K>(key));
+
+        SFL_TRY
+        {
+            sfl::dtl::construct_at(m, std::forward<Args>(args)...);
+        }
+        SFL_CATCH (...)
+        {
+            sfl::dtl::destroy_at(k);
+            SFL_RETHROW;
+        }
+    }
+
+    template <typename Value>
+    iterator insert_exactly_at(const_iterator pos, Value&& value)
+    {
+        SFL_ASSERT(!full());
+        SFL_ASSERT(cbegin() <= pos && pos <= cend());
+
+        const size_type i = index_of(pos);
+
+        const size_type n = size();
+
+        Key* const keys = data_.keys();
+        T* const mapped = data_.mapped();
+
+        if (i == n)
+        {
+            construct_element
+            (
+                keys + n,
+                mapped + n,
+                std::forward<Value>(value).first,
+                std::forward<Value>(value).second
+            );
+
+            ++data_.size_;
+        }
+        else
+        {
+            construct_element
+            (
+                keys + n,
+                mapped + n,
+                std::move(keys[n - 1]),
+                std::move(mapped[n - 1])
+            );
+
+            ++data_.size_;
+
+            sfl::dtl::move_backward(keys + i, keys + n - 1, keys + n);
+            sfl::dtl::move_backward(mapped + i, mapped + n - 1, mapped + n);
+
+            keys[i]   = std::forward<Value>(value).first;
+            mapped[i] = std::forward<Value>(value).second;
+        }
+
+        return nth(i);
+    }
+
+    void pop_back()
+    {
+        SFL_ASSERT(!empty());
+
+        --data_.size_;
+
+        sfl::dtl::destroy_at(data_.keys() + data_.size_);
+        sfl::dtl::destroy_at(data_.mapped() + data_.size_);
+    }
+
+    template <typename K>
+    bool is_insert_hint_good(const_iterator hint, const K& key)
+    {
+        const size_type i = index_of(hint);
+
+        const Key* const keys = data_.keys();
+
+        return (i == 0      || data_.ref_to_comp()(keys[i - 1], key))
+            && (i == size() || data_.ref_to_comp()(key, keys[i]));
+    }
+};
+
+//
+// ---- NON-MEMBER FUNCTIONS --------------------------------------------------
+//
+
+template <typename K, typename T, std::size_t N, typename C>
+SFL_NODISCARD
+bool operator==
+(
+    const static_flat_split_map<K, T, N, C>& x,
+    const static_flat_split_map<K, T, N, C>& y
+)
+{
+    return x.size() == y.size() && std::equal(x.begin(), x.end(), y.begin());
+}
+
+template <typename K, typename T, std::size_t N, typename C>
+SFL_NODISCARD
+bool operator!=
+(
+    const static_flat_split_map<K, T, N, C>& x,
+    const static_flat_split_map<K, T, N, C>& y
+)
+{
+    return !(x == y);
+}
+
+template <typename K, typename T, std::size_t N, typename C>
+SFL_NODISCARD
+bool operator<
+(
+    const static_flat_split_map<K, T, N, C>& x,
+    const static_flat_split_map<K, T, N, C>& y
+)
+{
+    return std::lexicographical_compare(x.begin(), x.end(), y.begin(), y.end());
+}
+
+template <typename K, typename T, std::size_t N, typename C>
+SFL_NODISCARD
+bool operator>
+(
+    const static_flat_split_map<K, T, N, C>& x,
+    const static_flat_split_map<K, T, N, C>& y
+)
+{
+    return y < x;
+}
+
+template <typename K, typename T, std::size_t N, typename C>
+SFL_NODISCARD
+bool operator<=
+(
+    const static_flat_split_map<K, T, N, C>& x,
+    const static_flat_split_map<K, T, N, C>& y
+)
+{
+    return !(y < x);
+}
+
+template <typename K, typename T, std::size_t N, typename C>
+SFL_NODISCARD
+bool operator>=
+(
+    const static_flat_split_map<K, T, N, C>& x,
+    const static_flat_split_map<K, T, N, C>& y
+)
+{
+    return !(x < y);
+}
+
+template <typename K, typename T, std::size_t N, typename C>
+void swap
+(
+    static_flat_split_map<K, T, N, C>& x,
+    static_flat_split_map<K, T, N, C>& y
+)
+{
+    x.swap(y);
+}
+
+template <typename K, typename T, std::size_t N, typename C, typename Predicate>
+typename static_flat_split_map<K, T, N, C>::size_type
+    erase_if(static_flat_split_map<K, T, N, C>& c, Predicate pred)
+{
+    using const_reference =
+        typename static_flat_split_map<K, T, N, C>::const_reference;
+
+    auto old_size = c.size();
+
+    for (auto it = c.begin(); it != c.end(); )
+    {
+        const_reference value = *it;
+
+        if (pred(value))
+        {
+            it = c.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    return old_size - c.size();
+}
+
+} // namespace sfl
+
+#endif // SFL_STATIC_FLAT_SPLIT_MAP_HPP_INCLUDED
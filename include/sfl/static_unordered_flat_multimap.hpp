@@ -22,6 +22,7 @@
 #define SFL_STATIC_UNORDERED_FLAT_MULTIMAP_HPP_INCLUDED
 
 #include "private.hpp"
+#include "static_vector.hpp"
 
 #include <algorithm>        // copy, move, lower_bound, swap, swap_ranges
 #include <cstddef>          // size_t
@@ -43,7 +44,8 @@ namespace sfl
 template < typename Key,
            typename T,
            std::size_t N,
-           typename KeyEqual = std::equal_to<Key> >
+           typename KeyEqual = std::equal_to<Key>,
+           bool Grouped = false >
 class static_unordered_flat_multimap
 {
     #ifdef SFL_TEST_STATIC_UNORDERED_FLAT_MULTIMAP
@@ -52,6 +54,16 @@ class static_unordered_flat_multimap
 
     static_assert(N > 0, "N must be greater than zero.");
 
+    static_assert
+    (
+        !Grouped ||
+        (
+            std::is_nothrow_move_constructible<std::pair<Key, T>>::value &&
+            std::is_nothrow_move_assignable<std::pair<Key, T>>::value
+        ),
+        "Grouped layout requires nothrow move construction and assignment of value_type."
+    );
+
 public:
 
     using key_type         = Key;
@@ -89,6 +101,8 @@ public:
 
     static constexpr size_type static_capacity = N;
 
+    static constexpr bool grouped = Grouped;
+
 private:
 
     // Like `value_equal` but with additional operators.
@@ -303,7 +317,7 @@ public:
 
     static_unordered_flat_multimap& operator=(std::initializer_list<value_type> ilist)
     {
-        assign_range(ilist.begin(), ilist.end());
+        assign_range_aux(ilist.begin(), ilist.end(), is_grouped());
         return *this;
     }
 
@@ -442,7 +456,7 @@ public:
     iterator emplace(Args&&... args)
     {
         SFL_ASSERT(!full());
-        return emplace_back(std::forward<Args>(args)...);
+        return emplace_aux(std::forward<Args>(args)...);
     }
 
     template <typename... Args>
@@ -451,19 +465,19 @@ public:
         SFL_ASSERT(!full());
         SFL_ASSERT(cbegin() <= hint && hint <= cend());
         sfl::dtl::ignore_unused(hint);
-        return emplace_back(std::forward<Args>(args)...);
+        return emplace_aux(std::forward<Args>(args)...);
     }
 
     iterator insert(const value_type& value)
     {
         SFL_ASSERT(!full());
-        return emplace_back(value);
+        return emplace_aux(value);
     }
 
     iterator insert(value_type&& value)
     {
         SFL_ASSERT(!full());
-        return emplace_back(std::move(value));
+        return emplace_aux(std::move(value));
     }
 
     template <typename P,
@@ -471,7 +485,7 @@ public:
     iterator insert(P&& value)
     {
         SFL_ASSERT(!full());
-        return emplace_back(std::forward<P>(value));
+        return emplace_aux(std::forward<P>(value));
     }
 
     iterator insert(const_iterator hint, const value_type& value)
@@ -479,7 +493,7 @@ public:
         SFL_ASSERT(!full());
         SFL_ASSERT(cbegin() <= hint && hint <= cend());
         sfl::dtl::ignore_unused(hint);
-        return emplace_back(value);
+        return emplace_aux(value);
     }
 
     iterator insert(const_iterator hint, value_type&& value)
@@ -487,7 +501,7 @@ public:
         SFL_ASSERT(!full());
         SFL_ASSERT(cbegin() <= hint && hint <= cend());
         sfl::dtl::ignore_unused(hint);
-        return emplace_back(std::move(value));
+        return emplace_aux(std::move(value));
     }
 
     template <typename P,
@@ -497,7 +511,7 @@ public:
         SFL_ASSERT(!full());
         SFL_ASSERT(cbegin() <= hint && hint <= cend());
         sfl::dtl::ignore_unused(hint);
-        return emplace_back(std::forward<P>(value));
+        return emplace_aux(std::forward<P>(value));
     }
 
     template <typename InputIt,
@@ -524,21 +538,7 @@ public:
     iterator erase(const_iterator pos)
     {
         SFL_ASSERT(cbegin() <= pos && pos < cend());
-
-        const difference_type offset = std::distance(cbegin(), pos);
-
-        const pointer p = data_.first_ + offset;
-
-        if (p < data_.last_ - 1)
-        {
-            *p = std::move(*(data_.last_ - 1));
-        }
-
-        --data_.last_;
-
-        sfl::dtl::destroy_at(data_.last_);
-
-        return iterator(p);
+        return erase_aux(pos, is_grouped());
     }
 
     iterator erase(const_iterator first, const_iterator last)
@@ -557,7 +557,9 @@ public:
 
         const pointer p1 = data_.first_ + offset;
 
-        if (count1 >= count2)
+        // Grouped layout: Removing contiguous range and shifting following
+        // elements to the left keeps groups contiguous.
+        if (count1 >= count2 || Grouped)
         {
             const pointer p2 = p1 + count1;
 
@@ -585,44 +587,14 @@ public:
 
     size_type erase(const Key& key)
     {
-        size_type n = 0;
-
-        for (auto it = begin(); it != end();)
-        {
-            if (data_.ref_to_equal()(*it, key))
-            {
-                it = erase(it);
-                ++n;
-            }
-            else
-            {
-                ++it;
-            }
-        }
-
-        return n;
+        return erase_key_aux(key, is_grouped());
     }
 
     template <typename K,
               sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<KeyEqual, K>::value>* = nullptr>
     size_type erase(K&& x)
     {
-        size_type n = 0;
-
-        for (auto it = begin(); it != end();)
-        {
-            if (data_.ref_to_equal()(*it, x))
-            {
-                it = erase(it);
-                ++n;
-            }
-            else
-            {
-                ++it;
-            }
-        }
-
-        return n;
+        return erase_transparent_aux(x, is_grouped());
     }
 
     void swap(static_unordered_flat_multimap& other)
@@ -688,6 +660,33 @@ public:
         other.data_.last_ = other.data_.first_ + this_size;
     }
 
+    // Moves all elements into a static vector and leaves the container empty.
+    sfl::static_vector<value_type, N> extract()
+    {
+        sfl::static_vector<value_type, N> result
+        (
+            std::make_move_iterator(data_.first_),
+            std::make_move_iterator(data_.last_)
+        );
+
+        clear();
+
+        return result;
+    }
+
+    // Replaces all elements with elements moved from `cont`.
+    void replace(sfl::static_vector<value_type, N>&& cont)
+    {
+        assign_range_aux
+        (
+            std::make_move_iterator(cont.begin()),
+            std::make_move_iterator(cont.end()),
+            is_grouped()
+        );
+
+        cont.clear();
+    }
+
     //
     // ---- LOOKUP ------------------------------------------------------------
     //
@@ -695,29 +694,13 @@ public:
     SFL_NODISCARD
     iterator find(const Key& key)
     {
-        for (auto it = begin(); it != end(); ++it)
-        {
-            if (data_.ref_to_equal()(*it, key))
-            {
-                return it;
-            }
-        }
-
-        return end();
+        return nth(find_index(key));
     }
 
     SFL_NODISCARD
     const_iterator find(const Key& key) const
     {
-        for (auto it = begin(); it != end(); ++it)
-        {
-            if (data_.ref_to_equal()(*it, key))
-            {
-                return it;
-            }
-        }
-
-        return end();
+        return nth(find_index(key));
     }
 
     template <typename K,
@@ -755,17 +738,7 @@ public:
     SFL_NODISCARD
     size_type count(const Key& key) const
     {
-        size_type n = 0;
-
-        for (auto it = begin(); it != end(); ++it)
-        {
-            if (data_.ref_to_equal()(*it, key))
-            {
-                ++n;
-            }
-        }
-
-        return n;
+        return count_aux(key, is_grouped());
     }
 
     template <typename K,
@@ -773,17 +746,9 @@ public:
     SFL_NODISCARD
     size_type count(const K& x) const
     {
-        size_type n = 0;
-
-        for (auto it = begin(); it != end(); ++it)
-        {
-            if (data_.ref_to_equal()(*it, x))
-            {
-                ++n;
-            }
-        }
-
-        return n;
+        // Several groups can be equivalent to `x`, so all elements are
+        // scanned even in grouped layout.
+        return count_aux(x, std::false_type());
     }
 
     SFL_NODISCARD
@@ -800,6 +765,56 @@ public:
         return find(x) != end();
     }
 
+    // Available only if `Grouped` is true. Elements with equivalent keys are
+    // adjacent, so the range is found by scanning up to the end of the group.
+    // There are no overloads for heterogeneous keys because several groups
+    // can be equivalent to one such key.
+    template <bool G = Grouped,
+              sfl::dtl::enable_if_t<G>* = nullptr>
+    SFL_NODISCARD
+    std::pair<iterator, iterator> equal_range(const Key& key)
+    {
+        const size_type i = find_index(key);
+        return std::make_pair(nth(i), nth(group_end(i)));
+    }
+
+    template <bool G = Grouped,
+              sfl::dtl::enable_if_t<G>* = nullptr>
+    SFL_NODISCARD
+    std::pair<const_iterator, const_iterator> equal_range(const Key& key) const
+    {
+        const size_type i = find_index(key);
+        return std::make_pair(nth(i), nth(group_end(i)));
+    }
+
+    // Batched lookup. For each key in range [first, last), in order, writes
+    // `find(key)` into `out`. Integral, enumeration and pointer keys compared
+    // using `std::equal_to` are hashed, and elements are scanned once per
+    // batch of up to 64 keys.
+    template <typename ForwardIt, typename OutputIt>
+    OutputIt find_many(ForwardIt first, ForwardIt last, OutputIt out)
+    {
+        find_many_aux(first, last, [&](size_type i) { *out = nth(i); ++out; });
+        return out;
+    }
+
+    template <typename ForwardIt, typename OutputIt>
+    OutputIt find_many(ForwardIt first, ForwardIt last, OutputIt out) const
+    {
+        find_many_aux(first, last, [&](size_type i) { *out = nth(i); ++out; });
+        return out;
+    }
+
+    // Batched lookup. For each key in range [first, last), in order, writes
+    // `contains(key)` into `out`.
+    template <typename ForwardIt, typename OutputIt>
+    OutputIt contains_many(ForwardIt first, ForwardIt last, OutputIt out) const
+    {
+        const size_type n = size();
+        find_many_aux(first, last, [&](size_type i) { *out = i != n; ++out; });
+        return out;
+    }
+
     //
     // ---- ELEMENT ACCESS ----------------------------------------------------
     //
@@ -818,6 +833,295 @@ public:
 
 private:
 
+    // Keys can be searched for using SIMD instructions if they are integral,
+    // enumeration or pointer keys compared using `std::equal_to` and if
+    // mapped values have the same size as keys, so keys are evenly strided.
+    using is_simd_searchable = std::integral_constant
+    <
+        bool,
+        sfl::dtl::is_simd_searchable<Key, KeyEqual>::value &&
+        std::is_standard_layout<value_type>::value &&
+        sizeof(value_type) == 2 * sizeof(Key)
+    >;
+
+    // Calls `fn(find_index(key))` for each key in range [first, last).
+    template <typename ForwardIt, typename Function>
+    void find_many_aux(ForwardIt first, ForwardIt last, Function&& fn) const
+    {
+        const value_type* elements = data_.first_;
+
+        sfl::dtl::find_many<Key>
+        (
+            static_cast<const key_equal&>(data_.ref_to_equal()),
+            size(),
+            [elements](size_type i) -> const Key& { return elements[i].first; },
+            [this](const Key& key) { return find_index(key); },
+            first,
+            last,
+            std::forward<Function>(fn)
+        );
+    }
+
+    // Returns index of the element with key equivalent to `key`, or `size()`
+    // if there is no such element.
+    size_type find_index(const Key& key) const
+    {
+        return find_index(key, is_simd_searchable());
+    }
+
+    size_type find_index(const Key& key, std::true_type) const noexcept
+    {
+        return sfl::dtl::find_equal<2>
+        (
+            reinterpret_cast<const Key*>(data_.first_),
+            size(),
+            key
+        );
+    }
+
+    size_type find_index(const Key& key, std::false_type) const
+    {
+        const value_type* first = data_.first_;
+
+        const size_type n = size();
+
+        for (size_type i = 0; i < n; ++i)
+        {
+            if (data_.ref_to_equal()(first[i], key))
+            {
+                return i;
+            }
+        }
+
+        return n;
+    }
+
+    using is_grouped = std::integral_constant<bool, Grouped>;
+
+    // Returns index one past the last element of the group of element `i`,
+    // or `size()` if `i` is `size()`. Used only if `Grouped` is true.
+    size_type group_end(size_type i) const
+    {
+        return group_end(i, size());
+    }
+
+    // Like above, but considers only the first `n` elements.
+    size_type group_end(size_type i, size_type n) const
+    {
+        if (i == n)
+        {
+            return n;
+        }
+
+        size_type j = i + 1;
+
+        while (j < n && data_.ref_to_equal()(data_.first_[j], data_.first_[i]))
+        {
+            ++j;
+        }
+
+        return j;
+    }
+
+    template <typename... Args>
+    iterator emplace_aux(Args&&... args)
+    {
+        return emplace_aux(is_grouped(), std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    iterator emplace_aux(std::false_type, Args&&... args)
+    {
+        return emplace_back(std::forward<Args>(args)...);
+    }
+
+    // Grouped layout: New element is appended and then exchanged with the
+    // first element of each following group, so it ends up after the last
+    // element of its group, and each following group gives its first
+    // element to the preceding group. The number of moved elements is
+    // proportional to the number of following groups, not to the number of
+    // following elements. Moves cannot throw (see static_assert above), so
+    // if constructing the new element throws, nothing changes.
+    template <typename... Args>
+    iterator emplace_aux(std::true_type, Args&&... args)
+    {
+        const size_type n = size();
+
+        emplace_back(std::forward<Args>(args)...);
+
+        const pointer p = data_.first_ + n;
+
+        const size_type pos = group_end(find_index(p->first), n);
+
+        for (size_type i = pos; i < n; )
+        {
+            const size_type j = group_end(i, n);
+
+            value_type tmp(std::move(data_.first_[i]));
+            data_.first_[i] = std::move(*p);
+            *p = std::move(tmp);
+
+            i = j;
+        }
+
+        return nth(pos);
+    }
+
+    iterator erase_aux(const_iterator pos, std::false_type)
+    {
+        const difference_type offset = std::distance(cbegin(), pos);
+
+        const pointer p = data_.first_ + offset;
+
+        if (p < data_.last_ - 1)
+        {
+            *p = std::move(*(data_.last_ - 1));
+        }
+
+        --data_.last_;
+
+        sfl::dtl::destroy_at(data_.last_);
+
+        return iterator(p);
+    }
+
+    // Grouped layout: The last element of the group fills the hole, so the
+    // hole moves to the end of the group. Then the last element of each
+    // following group moves one position back, into the hole left before
+    // that group.
+    iterator erase_aux(const_iterator pos, std::true_type)
+    {
+        const size_type n = size();
+
+        const size_type i = index_of(pos);
+
+        size_type hole = i;
+        size_type last = group_end(i);
+
+        while (true)
+        {
+            if (hole != last - 1)
+            {
+                data_.first_[hole] = std::move(data_.first_[last - 1]);
+            }
+
+            hole = last - 1;
+
+            if (last == n)
+            {
+                break;
+            }
+
+            last = group_end(last);
+        }
+
+        --data_.last_;
+
+        sfl::dtl::destroy_at(data_.last_);
+
+        return nth(i);
+    }
+
+    template <typename K>
+    size_type erase_key_aux(const K& x, std::false_type)
+    {
+        size_type n = 0;
+
+        for (auto it = begin(); it != end();)
+        {
+            if (data_.ref_to_equal()(*it, x))
+            {
+                it = erase(it);
+                ++n;
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        return n;
+    }
+
+    template <typename K>
+    size_type erase_key_aux(const K& x, std::true_type)
+    {
+        const size_type i = index_of(find(x));
+        const size_type j = group_end(i);
+        erase(nth(i), nth(j));
+        return j - i;
+    }
+
+    template <typename K>
+    size_type erase_transparent_aux(const K& x, std::false_type)
+    {
+        return erase_key_aux(x, std::false_type());
+    }
+
+    // Grouped layout, heterogeneous key: Several groups can be equivalent
+    // to `x`, so every group is checked and each equivalent group is erased
+    // as a contiguous range.
+    template <typename K>
+    size_type erase_transparent_aux(const K& x, std::true_type)
+    {
+        size_type n = 0;
+
+        size_type i = 0;
+
+        while (i != size())
+        {
+            const size_type j = group_end(i);
+
+            if (data_.ref_to_equal()(data_.first_[i], x))
+            {
+                erase(nth(i), nth(j));
+                n += j - i;
+            }
+            else
+            {
+                i = j;
+            }
+        }
+
+        return n;
+    }
+
+    template <typename K>
+    size_type count_aux(const K& x, std::false_type) const
+    {
+        size_type n = 0;
+
+        for (auto it = begin(); it != end(); ++it)
+        {
+            if (data_.ref_to_equal()(*it, x))
+            {
+                ++n;
+            }
+        }
+
+        return n;
+    }
+
+    template <typename K>
+    size_type count_aux(const K& x, std::true_type) const
+    {
+        const size_type i = index_of(find(x));
+        return group_end(i) - i;
+    }
+
+    template <typename ForwardIt>
+    void assign_range_aux(ForwardIt first, ForwardIt last, std::false_type)
+    {
+        assign_range(first, last);
+    }
+
+    template <typename ForwardIt>
+    void assign_range_aux(ForwardIt first, ForwardIt last, std::true_type)
+    {
+        clear();
+        insert(first, last);
+    }
+
     template <typename ForwardIt,
               sfl::dtl::enable_if_t<sfl::dtl::is_forward_iterator<ForwardIt>::value>* = nullptr>
     void assign_range(ForwardIt first, ForwardIt last)
@@ -888,41 +1192,41 @@ private:
 // ---- NON-MEMBER FUNCTIONS --------------------------------------------------
 //
 
-template <typename K, typename T, std::size_t N, typename E>
+template <typename K, typename T, std::size_t N, typename E, bool G>
 SFL_NODISCARD
 bool operator==
 (
-    const static_unordered_flat_multimap<K, T, N, E>& x,
-    const static_unordered_flat_multimap<K, T, N, E>& y
+    const static_unordered_flat_multimap<K, T, N, E, G>& x,
+    const static_unordered_flat_multimap<K, T, N, E, G>& y
 )
 {
     return x.size() == y.size() && std::is_permutation(x.begin(), x.end(), y.begin());
 }
 
-template <typename K, typename T, std::size_t N, typename E>
+template <typename K, typename T, std::size_t N, typename E, bool G>
 SFL_NODISCARD
 bool operator!=
 (
-    const static_unordered_flat_multimap<K, T, N, E>& x,
-    const static_unordered_flat_multimap<K, T, N, E>& y
+    const static_unordered_flat_multimap<K, T, N, E, G>& x,
+    const static_unordered_flat_multimap<K, T, N, E, G>& y
 )
 {
     return !(x == y);
 }
 
-template <typename K, typename T, std::size_t N, typename E>
+template <typename K, typename T, std::size_t N, typename E, bool G>
 void swap
 (
-    static_unordered_flat_multimap<K, T, N, E>& x,
-    static_unordered_flat_multimap<K, T, N, E>& y
+    static_unordered_flat_multimap<K, T, N, E, G>& x,
+    static_unordered_flat_multimap<K, T, N, E, G>& y
 )
 {
     x.swap(y);
 }
 
-template <typename K, typename T, std::size_t N, typename E, typename Predicate>
-typename static_unordered_flat_multimap<K, T, N, E>::size_type
-    erase_if(static_unordered_flat_multimap<K, T, N, E>& c, Predicate pred)
+template <typename K, typename T, std::size_t N, typename E, bool G, typename Predicate>
+typename static_unordered_flat_multimap<K, T, N, E, G>::size_type
+    erase_if(static_unordered_flat_multimap<K, T, N, E, G>& c, Predicate pred)
 {
     auto old_size = c.size();
 
@@ -22,6 +22,7 @@
 #define SFL_STATIC_UNORDERED_FLAT_SET_HPP_INCLUDED
 
 #include "private.hpp"
+#include "static_vector.hpp"
 
 #include <algorithm>        // copy, move, lower_bound, swap, swap_ranges
 #include <cstddef>          // size_t
@@ -437,11 +438,7 @@ public:
               sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
     void insert(InputIt first, InputIt last)
     {
-        while (first != last)
-        {
-            insert(*first);
-            ++first;
-        }
+        insert_range_aux(first, last, is_bulk_insertable<InputIt>());
     }
 
     void insert(std::initializer_list<value_type> ilist)
@@ -602,6 +599,32 @@ public:
         other.data_.last_ = other.data_.first_ + this_size;
     }
 
+    // Moves all elements into a static vector and leaves the container empty.
+    sfl::static_vector<value_type, N> extract()
+    {
+        sfl::static_vector<value_type, N> result
+        (
+            std::make_move_iterator(data_.first_),
+            std::make_move_iterator(data_.last_)
+        );
+
+        clear();
+
+        return result;
+    }
+
+    // Replaces all elements with elements moved from `cont`.
+    void replace(sfl::static_vector<value_type, N>&& cont)
+    {
+        assign_range
+        (
+            std::make_move_iterator(cont.begin()),
+            std::make_move_iterator(cont.end())
+        );
+
+        cont.clear();
+    }
+
     //
     // ---- LOOKUP ------------------------------------------------------------
     //
@@ -609,29 +632,13 @@ public:
     SFL_NODISCARD
     iterator find(const Key& key)
     {
-        for (auto it = begin(); it != end(); ++it)
-        {
-            if (data_.ref_to_equal()(*it, key))
-            {
-                return it;
-            }
-        }
-
-        return end();
+        return nth(find_index(key));
     }
 
     SFL_NODISCARD
     const_iterator find(const Key& key) const
     {
-        for (auto it = begin(); it != end(); ++it)
-        {
-            if (data_.ref_to_equal()(*it, key))
-            {
-                return it;
-            }
-        }
-
-        return end();
+        return nth(find_index(key));
     }
 
     template <typename K,
@@ -694,6 +701,34 @@ public:
         return find(x) != end();
     }
 
+    // Batched lookup. For each key in range [first, last), in order, writes
+    // `find(key)` into `out`. Integral, enumeration and pointer keys compared
+    // using `std::equal_to` are hashed, and elements are scanned once per
+    // batch of up to 64 keys.
+    template <typename ForwardIt, typename OutputIt>
+    OutputIt find_many(ForwardIt first, ForwardIt last, OutputIt out)
+    {
+        find_many_aux(first, last, [&](size_type i) { *out = nth(i); ++out; });
+        return out;
+    }
+
+    template <typename ForwardIt, typename OutputIt>
+    OutputIt find_many(ForwardIt first, ForwardIt last, OutputIt out) const
+    {
+        find_many_aux(first, last, [&](size_type i) { *out = nth(i); ++out; });
+        return out;
+    }
+
+    // Batched lookup. For each key in range [first, last), in order, writes
+    // `contains(key)` into `out`.
+    template <typename ForwardIt, typename OutputIt>
+    OutputIt contains_many(ForwardIt first, ForwardIt last, OutputIt out) const
+    {
+        const size_type n = size();
+        find_many_aux(first, last, [&](size_type i) { *out = i != n; ++out; });
+        return out;
+    }
+
     //
     // ---- ELEMENT ACCESS ----------------------------------------------------
     //
@@ -712,6 +747,54 @@ public:
 
 private:
 
+    // Calls `fn(find_index(key))` for each key in range [first, last).
+    template <typename ForwardIt, typename Function>
+    void find_many_aux(ForwardIt first, ForwardIt last, Function&& fn) const
+    {
+        const value_type* elements = data_.first_;
+
+        sfl::dtl::find_many<Key>
+        (
+            static_cast<const key_equal&>(data_.ref_to_equal()),
+            size(),
+            [elements](size_type i) -> const Key& { return elements[i]; },
+            [this](const Key& key) { return find_index(key); },
+            first,
+            last,
+            std::forward<Function>(fn)
+        );
+    }
+
+    // Returns index of the element equivalent to `key`, or `size()` if there
+    // is no such element. Integral, enumeration and pointer keys compared
+    // using `std::equal_to` are searched for using SIMD instructions.
+    size_type find_index(const Key& key) const
+    {
+        return find_index(key, sfl::dtl::is_simd_searchable<Key, KeyEqual>());
+    }
+
+    size_type find_index(const Key& key, std::true_type) const noexcept
+    {
+        return sfl::dtl::find_equal<1>(data_.first_, size(), key);
+    }
+
+    size_type find_index(const Key& key, std::false_type) const
+    {
+        const value_type* first = data_.first_;
+
+        const size_type n = size();
+
+        for (size_type i = 0; i < n; ++i)
+        {
+            if (data_.ref_to_equal()(first[i], key))
+            {
+                return i;
+            }
+        }
+
+        return n;
+    }
+
     template <typename ForwardIt,
               sfl::dtl::enable_if_t<sfl::dtl::is_forward_iterator<ForwardIt>::value>* = nullptr>
     void assign_range(ForwardIt first, ForwardIt last)
@@ -759,7 +842,19 @@ private:
         }
     }
 
-    template <typename... Args>
+    // If the only argument is a key, it is searched for before the element
+    // is constructed, so nothing is constructed if the key already exists.
+    template <typename... Args,
+              sfl::dtl::enable_if_t<sfl::dtl::is_set_key_extractable<Key, Args...>::value>* = nullptr>
+    std::pair<iterator, bool> emplace_aux(Args&&... args)
+    {
+        return insert_aux(std::forward<Args>(args)...);
+    }
+
+    // Key cannot be taken from arguments, so the element is constructed at
+    // the end first and removed if its key already exists.
+    template <typename... Args,
+              sfl::dtl::enable_if_t<!sfl::dtl::is_set_key_extractable<Key, Args...>::value>* = nullptr>
     std::pair<iterator, bool> emplace_aux(Args&&... args)
     {
         const auto it1 = emplace_back(std::forward<Args>(args)...);
@@ -782,6 +877,50 @@ private:
         return emplace_aux(std::forward<Args>(args)...).first;
     }
 
+    // Forward ranges are inserted in bulk if keys are integral, enumeration
+    // or pointer types compared using `std::equal_to`, or if they are
+    // compared using `std::equal_to` and `std::hash<Key>` is enabled.
+    template <typename InputIt>
+    using is_bulk_insertable = std::integral_constant
+    <
+        bool,
+        sfl::dtl::is_forward_iterator<InputIt>::value &&
+        sfl::dtl::is_hash_searchable<Key, KeyEqual>::value &&
+        std::is_same<typename std::iterator_traits<InputIt>::value_type, value_type>::value
+    >;
+
+    template <typename InputIt>
+    void insert_range_aux(InputIt first, InputIt last, std::false_type)
+    {
+        while (first != last)
+        {
+            insert(*first);
+            ++first;
+        }
+    }
+
+    // Finds duplicates of existing and preceding elements in batches of up
+    // to 64 elements using small hash table on stack, so existing elements
+    // are scanned once per batch instead of once per element.
+    template <typename ForwardIt>
+    void insert_range_aux(ForwardIt first, ForwardIt last, std::true_type)
+    {
+        using reference = typename std::iterator_traits<ForwardIt>::reference;
+
+        const value_type* const elements = data_.first_;
+
+        sfl::dtl::insert_unique_batched<Key>
+        (
+            data_.ref_to_equal(),
+            size(),
+            [elements](size_type i) -> const Key& { return elements[i]; },
+            [](reference x) -> const Key& { return x; },
+            [this](reference x) { emplace_back(std::forward<reference>(x)); },
+            first,
+            last
+        );
+    }
+
     template <typename Value>
     std::pair<iterator, bool> insert_aux(Value&& value)
     {
@@ -69,10 +69,14 @@ private:
 
         pointer last_;
 
+        SFL_CONSTEXPR_20
         data() noexcept
             : last_(first_)
-        {}
+        {
+            sfl::dtl::initialize_static_storage(first_, N);
+        }
 
+        SFL_CONSTEXPR_20
         ~data() noexcept
         {}
     };
@@ -85,9 +89,11 @@ public:
     // ---- CONSTRUCTION AND DESTRUCTION --------------------------------------
     //
 
+    SFL_CONSTEXPR_20
     static_vector() noexcept
     {}
 
+    SFL_CONSTEXPR_20
     static_vector(size_type n)
     {
         SFL_ASSERT(n <= capacity());
@@ -99,6 +105,7 @@ public:
         );
     }
 
+    SFL_CONSTEXPR_20
     static_vector(size_type n, sfl::default_init_t)
     {
         SFL_ASSERT(n <= capacity());
@@ -110,6 +117,7 @@ public:
         );
     }
 
+    SFL_CONSTEXPR_20
     static_vector(size_type n, const T& value)
     {
         SFL_ASSERT(n <= capacity());
@@ -124,6 +132,7 @@ public:
 
     template <typename InputIt,
               sfl::dtl::enable_if_t<sfl::dtl::is_exactly_input_iterator<InputIt>::value>* = nullptr>
+    SFL_CONSTEXPR_20
     static_vector(InputIt first, InputIt last)
     {
         SFL_TRY
@@ -143,6 +152,7 @@ public:
 
     template <typename ForwardIt,
               sfl::dtl::enable_if_t<sfl::dtl::is_forward_iterator<ForwardIt>::value>* = nullptr>
+    SFL_CONSTEXPR_20
     static_vector(ForwardIt first, ForwardIt last)
     {
         SFL_ASSERT(size_type(std::distance(first, last)) <= capacity());
@@ -155,10 +165,12 @@ public:
         );
     }
 
+    SFL_CONSTEXPR_20
     static_vector(std::initializer_list<T> ilist)
         : static_vector(ilist.begin(), ilist.end())
     {}
 
+    SFL_CONSTEXPR_20
     static_vector(const static_vector& other)
     {
         data_.last_ = sfl::dtl::uninitialized_copy
@@ -169,6 +181,7 @@ public:
         );
     }
 
+    SFL_CONSTEXPR_20
     static_vector(static_vector&& other)
     {
         data_.last_ = sfl::dtl::uninitialized_move
@@ -179,6 +192,7 @@ public:
         );
     }
 
+    SFL_CONSTEXPR_20
     ~static_vector() noexcept
     {
         sfl::dtl::destroy(data_.first_, data_.last_);
@@ -188,6 +202,7 @@ public:
     // ---- ASSIGNMENT --------------------------------------------------------
     //
 
+    SFL_CONSTEXPR_20
     void assign(size_type n, const T& value)
     {
         SFL_ASSERT(n <= capacity());
@@ -233,6 +248,7 @@ public:
 
     template <typename InputIt,
               sfl::dtl::enable_if_t<sfl::dtl::is_exactly_input_iterator<InputIt>::value>* = nullptr>
+    SFL_CONSTEXPR_20
     void assign(InputIt first, InputIt last)
     {
         pointer curr = data_.first_;
@@ -262,6 +278,7 @@ public:
 
     template <typename ForwardIt,
               sfl::dtl::enable_if_t<sfl::dtl::is_forward_iterator<ForwardIt>::value>* = nullptr>
+    SFL_CONSTEXPR_20
     void assign(ForwardIt first, ForwardIt last)
     {
         SFL_ASSERT(size_type(std::distance(first, last)) <= capacity());
@@ -307,11 +324,13 @@ public:
         }
     }
 
+    SFL_CONSTEXPR_20
     void assign(std::initializer_list<T> ilist)
     {
         assign(ilist.begin(), ilist.end());
     }
 
+    SFL_CONSTEXPR_20
     static_vector& operator=(const static_vector& other)
     {
         if (this != &other)
@@ -325,6 +344,7 @@ public:
         return *this;
     }
 
+    SFL_CONSTEXPR_20
     static_vector& operator=(static_vector&& other)
     {
         assign
@@ -335,6 +355,7 @@ public:
         return *this;
     }
 
+    SFL_CONSTEXPR_20
     static_vector& operator=(std::initializer_list<T> ilist)
     {
         assign(ilist.begin(), ilist.end());
@@ -346,78 +367,91 @@ public:
     //
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     iterator begin() noexcept
     {
         return iterator(data_.first_);
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     const_iterator begin() const noexcept
     {
         return const_iterator(data_.first_);
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     const_iterator cbegin() const noexcept
     {
         return const_iterator(data_.first_);
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     iterator end() noexcept
     {
         return iterator(data_.last_);
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     const_iterator end() const noexcept
     {
         return const_iterator(data_.last_);
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     const_iterator cend() const noexcept
     {
         return const_iterator(data_.last_);
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     reverse_iterator rbegin() noexcept
     {
         return reverse_iterator(end());
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     const_reverse_iterator rbegin() const noexcept
     {
         return const_reverse_iterator(end());
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     const_reverse_iterator crbegin() const noexcept
     {
         return const_reverse_iterator(end());
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     reverse_iterator rend() noexcept
     {
         return reverse_iterator(begin());
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     const_reverse_iterator rend() const noexcept
     {
         return const_reverse_iterator(begin());
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     const_reverse_iterator crend() const noexcept
     {
         return const_reverse_iterator(begin());
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     iterator nth(size_type pos) noexcept
     {
         SFL_ASSERT(pos <= size());
@@ -425,6 +459,7 @@ public:
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     const_iterator nth(size_type pos) const noexcept
     {
         SFL_ASSERT(pos <= size());
@@ -432,6 +467,7 @@ public:
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     size_type index_of(const_iterator pos) const noexcept
     {
         SFL_ASSERT(cbegin() <= pos && pos <= cend());
@@ -443,18 +479,21 @@ public:
     //
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     bool empty() const noexcept
     {
         return data_.first_ == data_.last_;
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     bool full() const noexcept
     {
         return std::distance(begin(), end()) == N;
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     size_type size() const noexcept
     {
         return std::distance(begin(), end());
@@ -473,6 +512,7 @@ public:
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     size_type available() const noexcept
     {
         return capacity() - size();
@@ -483,6 +523,7 @@ public:
     //
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     reference at(size_type pos)
     {
         if (pos >= size())
@@ -494,6 +535,7 @@ public:
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     const_reference at(size_type pos) const
     {
         if (pos >= size())
@@ -505,6 +547,7 @@ public:
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     reference operator[](size_type pos) noexcept
     {
         SFL_ASSERT(pos < size());
@@ -512,6 +555,7 @@ public:
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     const_reference operator[](size_type pos) const noexcept
     {
         SFL_ASSERT(pos < size());
@@ -519,6 +563,7 @@ public:
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     reference front() noexcept
     {
         SFL_ASSERT(!empty());
@@ -526,6 +571,7 @@ public:
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     const_reference front() const noexcept
     {
         SFL_ASSERT(!empty());
@@ -533,6 +579,7 @@ public:
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     reference back() noexcept
     {
         SFL_ASSERT(!empty());
@@ -540,6 +587,7 @@ public:
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     const_reference back() const noexcept
     {
         SFL_ASSERT(!empty());
@@ -547,12 +595,14 @@ public:
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     T* data() noexcept
     {
         return data_.first_;
     }
 
     SFL_NODISCARD
+    SFL_CONSTEXPR_20
     const T* data() const noexcept
     {
         return data_.first_;
@@ -562,6 +612,7 @@ public:
     // ---- MODIFIERS ---------------------------------------------------------
     //
 
+    SFL_CONSTEXPR_20
     void clear() noexcept
     {
         sfl::dtl::destroy(data_.first_, data_.last_);
@@ -569,6 +620,7 @@ public:
     }
 
     template <typename... Args>
+    SFL_CONSTEXPR_20
     iterator emplace(const_iterator pos, Args&&... args)
     {
         SFL_ASSERT(!full());
@@ -617,16 +669,19 @@ public:
         return iterator(p1);
     }
 
+    SFL_CONSTEXPR_20
     iterator insert(const_iterator pos, const T& value)
     {
         return emplace(pos, value);
     }
 
+    SFL_CONSTEXPR_20
     iterator insert(const_iterator pos, T&& value)
     {
         return emplace(pos, std::move(value));
     }
 
+    SFL_CONSTEXPR_20
     iterator insert(const_iterator pos, size_type n, const T& value)
     {
         SFL_ASSERT(n <= available());
@@ -702,6 +757,7 @@ public:
 
     template <typename InputIt,
               sfl::dtl::enable_if_t<sfl::dtl::is_exactly_input_iterator<InputIt>::value>* = nullptr>
+    SFL_CONSTEXPR_20
     iterator insert(const_iterator pos, InputIt first, InputIt last)
     {
         const difference_type offset = std::distance(cbegin(), pos);
@@ -718,6 +774,7 @@ public:
 
     template <typename ForwardIt,
               sfl::dtl::enable_if_t<sfl::dtl::is_forward_iterator<ForwardIt>::value>* = nullptr>
+    SFL_CONSTEXPR_20
     iterator insert(const_iterator pos, ForwardIt first, ForwardIt last)
     {
         SFL_ASSERT(size_type(std::distance(first, last)) <= available());
@@ -791,12 +848,14 @@ public:
         return iterator(p1);
     }
 
+    SFL_CONSTEXPR_20
     iterator insert(const_iterator pos, std::initializer_list<T> ilist)
     {
         return insert(pos, ilist.begin(), ilist.end());
     }
 
     template <typename... Args>
+    SFL_CONSTEXPR_20
     reference emplace_back(Args&&... args)
     {
         SFL_ASSERT(!full());
@@ -810,16 +869,19 @@ public:
         return *old_last;
     }
 
+    SFL_CONSTEXPR_20
     void push_back(const T& value)
     {
         emplace_back(value);
     }
 
+    SFL_CONSTEXPR_20
     void push_back(T&& value)
     {
         emplace_back(std::move(value));
     }
 
+    SFL_CONSTEXPR_20
     void pop_back()
     {
         SFL_ASSERT(!empty());
@@ -829,6 +891,7 @@ public:
         sfl::dtl::destroy_at(data_.last_);
     }
 
+    SFL_CONSTEXPR_20
     iterator erase(const_iterator pos)
     {
         SFL_ASSERT(cbegin() <= pos && pos < cend());
@@ -842,6 +905,7 @@ public:
         return iterator(p);
     }
 
+    SFL_CONSTEXPR_20
     iterator erase(const_iterator first, const_iterator last)
     {
         SFL_ASSERT(cbegin() <= first && first <= last && last <= cend());
@@ -863,6 +927,7 @@ public:
         return iterator(p1);
     }
 
+    SFL_CONSTEXPR_20
     void resize(size_type n)
     {
         SFL_ASSERT(n <= capacity());
@@ -893,6 +958,7 @@ public:
         }
     }
 
+    SFL_CONSTEXPR_20
     void resize(size_type n, sfl::default_init_t)
     {
         SFL_ASSERT(n <= capacity());
@@ -923,6 +989,7 @@ public:
         }
     }
 
+    SFL_CONSTEXPR_20
     void resize(size_type n, const T& value)
     {
         SFL_ASSERT(n <= capacity());
@@ -954,6 +1021,7 @@ public:
         }
     }
 
+    SFL_CONSTEXPR_20
     void swap(static_vector& other)
     {
         if (this == &other)
@@ -1020,6 +1088,7 @@ public:
 
 template <typename T, std::size_t N>
 SFL_NODISCARD
+SFL_CONSTEXPR_20
 bool operator==
 (
     const static_vector<T, N>& x,
@@ -1031,6 +1100,7 @@ bool operator==
 
 template <typename T, std::size_t N>
 SFL_NODISCARD
+SFL_CONSTEXPR_20
 bool operator!=
 (
     const static_vector<T, N>& x,
@@ -1042,6 +1112,7 @@ bool operator!=
 
 template <typename T, std::size_t N>
 SFL_NODISCARD
+SFL_CONSTEXPR_20
 bool operator<
 (
     const static_vector<T, N>& x,
@@ -1053,6 +1124,7 @@ bool operator<
 
 template <typename T, std::size_t N>
 SFL_NODISCARD
+SFL_CONSTEXPR_20
 bool operator>
 (
     const static_vector<T, N>& x,
@@ -1064,6 +1136,7 @@ bool operator>
 
 template <typename T, std::size_t N>
 SFL_NODISCARD
+SFL_CONSTEXPR_20
 bool operator<=
 (
     const static_vector<T, N>& x,
@@ -1075,6 +1148,7 @@ bool operator<=
 
 template <typename T, std::size_t N>
 SFL_NODISCARD
+SFL_CONSTEXPR_20
 bool operator>=
 (
     const static_vector<T, N>& x,
@@ -1085,6 +1159,7 @@ bool operator>=
 }
 
 template <typename T, std::size_t N>
+SFL_CONSTEXPR_20
 void swap
 (
     static_vector<T, N>& x,
@@ -1095,6 +1170,7 @@ void swap
 }
 
 template <typename T, std::size_t N, typename U>
+SFL_CONSTEXPR_20
 typename static_vector<T, N>::size_type
     erase(static_vector<T, N>& c, const U& value)
 {
@@ -1105,6 +1181,7 @@ typename static_vector<T, N>::size_type
 }
 
 template <typename T, std::size_t N, typename Predicate>
+SFL_CONSTEXPR_20
 typename static_vector<T, N>::size_type
     erase_if(static_vector<T, N>& c, Predicate pred)
 {
@@ -0,0 +1,2529 @@
+//
+// Copyright (c) 2022 Slaven Falandys
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+//
+
+#ifndef SFL_TINY_VECTOR_HPP_INCLUDED
+#define SFL_TINY_VECTOR_HPP_INCLUDED
+
+#include "private.hpp"
+
+#include <algorithm>        // copy, move, swap, swap_ranges
+#include <cstddef>          // size_t
+#include <cstdint>          // uint32_t
+#include <initializer_list> // initializer_list
+#include <iterator>         // distance, next, reverse_iterator
+#include <limits>           // numeric_limits
+#include <memory>           // addressof, allocator, allocator_traits, pointer_traits
+#include <new>              // placement new
+#include <type_traits>      // is_same, is_nothrow_xxxxx, is_trivially_destructible
+#include <utility>          // forward, move, pair
+
+namespace sfl
+{
+
+template < typename T,
+           std::size_t N,
+           typename Allocator = std::allocator<T>,
+           typename GrowthPolicy = sfl::geometric_growth<> >
+class tiny_vector
+{
+public:
+
+    using allocator_type         = Allocator;
+    using allocator_traits       = std::allocator_traits<Allocator>;
+    using growth_policy          = GrowthPolicy;
+    using value_type             = T;
+    using size_type              = typename allocator_traits::size_type;
+    using difference_type        = typename allocator_traits::difference_type;
+    using reference              = T&;
+    using const_reference        = const T&;
+    using pointer                = typename allocator_traits::pointer;
+    using const_pointer          = typename allocator_traits::const_pointer;
+    using iterator               = sfl::dtl::normal_iterator<pointer, tiny_vector>;
+    using const_iterator         = sfl::dtl::normal_iterator<const_pointer, tiny_vector>;
+    using reverse_iterator       = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    static_assert
+    (
+        std::is_same<typename Allocator::value_type, value_type>::value,
+        "Allocator::value_type must be same as sfl::tiny_vector::value_type."
+    );
+
+    static_assert
+    (
+        std::is_trivially_destructible<pointer>::value,
+        "Allocator::pointer must be trivially destructible."
+    );
+
+    static_assert
+    (
+        N <= std::numeric_limits<std::uint32_t>::max(),
+        "N must be less than or equal to 2^32 - 1."
+    );
+
+public:
+
+    static constexpr size_type static_capacity = N;
+
+private:
+
+    // Size and capacity are stored as 32-bit integers. When elements are
+    // stored in allocated storage, the pointer to that storage is stored in
+    // the bytes of internal storage, which are not used at that time.
+    // Container uses internal storage if and only if capacity is N.
+
+    using stored_size_type = std::uint32_t;
+
+    template <bool WithInternalStorage = true, typename = void>
+    class data_base
+    {
+    private:
+
+        union
+        {
+            value_type internal_storage_[N];
+            pointer    external_storage_;
+        };
+
+    public:
+
+        stored_size_type size_;
+        stored_size_type capacity_;
+
+        data_base() noexcept
+            : size_(0)
+            , capacity_(N)
+        {}
+
+        ~data_base() noexcept
+        {}
+
+        pointer internal_storage() const noexcept
+        {
+            return std::pointer_traits<pointer>::pointer_to
+            (
+                const_cast<value_type&>(*internal_storage_)
+            );
+        }
+
+        pointer external_storage() const noexcept
+        {
+            return external_storage_;
+        }
+
+        void set_external_storage(pointer p) noexcept
+        {
+            ::new (static_cast<void*>(std::addressof(external_storage_))) pointer(p);
+        }
+    };
+
+    template <typename Dummy>
+    class data_base<false, Dummy>
+    {
+    private:
+
+        union
+        {
+            pointer external_storage_;
+        };
+
+    public:
+
+        stored_size_type size_;
+        stored_size_type capacity_;
+
+        data_base() noexcept
+            : size_(0)
+            , capacity_(0)
+        {}
+
+        ~data_base() noexcept
+        {}
+
+        pointer internal_storage() const noexcept
+        {
+            return nullptr;
+        }
+
+        pointer external_storage() const noexcept
+        {
+            return external_storage_;
+        }
+
+        void set_external_storage(pointer p) noexcept
+        {
+            ::new (static_cast<void*>(std::addressof(external_storage_))) pointer(p);
+        }
+    };
+
+    class data : public data_base<(N > 0)> , public allocator_type
+    {
+    public:
+
+        data() noexcept(std::is_nothrow_default_constructible<allocator_type>::value)
+            : allocator_type()
+        {}
+
+        data(const allocator_type& alloc) noexcept(std::is_nothrow_copy_constructible<allocator_type>::value)
+            : allocator_type(alloc)
+        {}
+
+        data(allocator_type&& other) noexcept(std::is_nothrow_move_constructible<allocator_type>::value)
+            : allocator_type(std::move(other))
+        {}
+
+        allocator_type& ref_to_alloc() noexcept
+        {
+            return *this;
+        }
+
+        const allocator_type& ref_to_alloc() const noexcept
+        {
+            return *this;
+        }
+
+        pointer first() const noexcept
+        {
+            return this->capacity_ == N ? this->internal_storage() : this->external_storage();
+        }
+
+        pointer last() const noexcept
+        {
+            return first() + this->size_;
+        }
+
+        pointer eos() const noexcept
+        {
+            return first() + this->capacity_;
+        }
+
+        void set_last(pointer last) noexcept
+        {
+            this->size_ = stored_size_type(std::distance(first(), last));
+        }
+
+        // Pointer `first` must point to internal storage or to allocated
+        // storage of capacity greater than N. If it points to allocated
+        // storage, elements in internal storage must be destroyed already.
+        void set(pointer first, pointer last, pointer eos) noexcept
+        {
+            if (first != this->internal_storage())
+            {
+                this->set_external_storage(first);
+            }
+
+            // Allocator can return more storage than requested, but it is
+            // valid to deallocate it using any size between the requested
+            // and the returned size, so capacity is clamped to max value.
+            this->size_     = stored_size_type(std::distance(first, last));
+            this->capacity_ = stored_size_type
+            (
+                std::min<size_type>
+                (
+                    std::distance(first, eos),
+                    std::numeric_limits<stored_size_type>::max()
+                )
+            );
+
+            SFL_ASSERT((first == this->internal_storage()) == (this->capacity_ == N));
+        }
+
+        void set_internal_storage() noexcept
+        {
+            this->size_     = 0;
+            this->capacity_ = N;
+        }
+    };
+
+    data data_;
+
+public:
+
+    //
+    // ---- CONSTRUCTION AND DESTRUCTION --------------------------------------
+    //
+
+    tiny_vector() noexcept
+    (
+        std::is_nothrow_default_constructible<Allocator>::value
+    )
+        : data_()
+    {}
+
+    explicit tiny_vector(const Allocator& alloc) noexcept
+    (
+        std::is_nothrow_copy_constructible<Allocator>::value
+    )
+        : data_(alloc)
+    {}
+
+    tiny_vector(size_type n)
+        : data_()
+    {
+        initialize_default_n(n);
+    }
+
+    explicit tiny_vector(size_type n, const Allocator& alloc)
+        : data_(alloc)
+    {
+        initialize_default_n(n);
+    }
+
+    tiny_vector(size_type n, const T& value)
+        : data_()
+    {
+        initialize_fill_n(n, value);
+    }
+
+    tiny_vector(size_type n, const T& value, const Allocator& alloc)
+        : data_(alloc)
+    {
+        initialize_fill_n(n, value);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    tiny_vector(InputIt first, InputIt last)
+        : data_()
+    {
+        initialize_range(first, last);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    tiny_vector(InputIt first, InputIt last, const Allocator& alloc)
+        : data_(alloc)
+    {
+        initialize_range(first, last);
+    }
+
+    tiny_vector(std::initializer_list<T> ilist)
+        : tiny_vector(ilist.begin(), ilist.end())
+    {}
+
+    tiny_vector(std::initializer_list<T> ilist, const Allocator& alloc)
+        : tiny_vector(ilist.begin(), ilist.end(), alloc)
+    {}
+
+    tiny_vector(const tiny_vector& other)
+        : data_
+        (
+            allocator_traits::select_on_container_copy_construction
+            (
+                other.data_.ref_to_alloc()
+            )
+        )
+    {
+        initialize_copy(other);
+    }
+
+    tiny_vector(const tiny_vector& other, const Allocator& alloc)
+        : data_(alloc)
+    {
+        initialize_copy(other);
+    }
+
+    tiny_vector(tiny_vector&& other)
+        : data_(std::move(other.data_.ref_to_alloc()))
+    {
+        initialize_move(other);
+    }
+
+    tiny_vector(tiny_vector&& other, const Allocator& alloc)
+        : data_(alloc)
+    {
+        initialize_move(other);
+    }
+
+    ~tiny_vector()
+    {
+        sfl::dtl::destroy_a
+        (
+            data_.ref_to_alloc(),
+            data_.first(),
+            data_.last()
+        );
+
+        if (data_.first() != data_.internal_storage())
+        {
+            sfl::dtl::deallocate
+            (
+                data_.ref_to_alloc(),
+                data_.first(),
+                std::distance(data_.first(), data_.eos())
+            );
+        }
+    }
+
+    //
+    // ---- ASSIGNMENT --------------------------------------------------------
+    //
+
+    void assign(size_type n, const T& value)
+    {
+        assign_fill_n(n, value);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    void assign(InputIt first, InputIt last)
+    {
+        assign_range(first, last);
+    }
+
+    void assign(std::initializer_list<T> ilist)
+    {
+        assign_range(ilist.begin(), ilist.end());
+    }
+
+    tiny_vector& operator=(const tiny_vector& other)
+    {
+        assign_copy(other);
+        return *this;
+    }
+
+    tiny_vector& operator=(tiny_vector&& other)
+    {
+        assign_move(other);
+        return *this;
+    }
+
+    tiny_vector& operator=(std::initializer_list<T> ilist)
+    {
+        assign_range(ilist.begin(), ilist.end());
+        return *this;
+    }
+
+    //
+    // ---- ALLOCATOR ---------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    allocator_type get_allocator() const noexcept
+    {
+        return data_.ref_to_alloc();
+    }
+
+    //
+    // ---- ITERATORS ---------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    iterator begin() noexcept
+    {
+        return iterator(data_.first());
+    }
+
+    SFL_NODISCARD
+    const_iterator begin() const noexcept
+    {
+        return const_iterator(data_.first());
+    }
+
+    SFL_NODISCARD
+    const_iterator cbegin() const noexcept
+    {
+        return const_iterator(data_.first());
+    }
+
+    SFL_NODISCARD
+    iterator end() noexcept
+    {
+        return iterator(data_.last());
+    }
+
+    SFL_NODISCARD
+    const_iterator end() const noexcept
+    {
+        return const_iterator(data_.last());
+    }
+
+    SFL_NODISCARD
+    const_iterator cend() const noexcept
+    {
+        return const_iterator(data_.last());
+    }
+
+    SFL_NODISCARD
+    reverse_iterator rbegin() noexcept
+    {
+        return reverse_iterator(end());
+    }
+
+    SFL_NODISCARD
+    const_reverse_iterator rbegin() const noexcept
+    {
+        return const_reverse_iterator(end());
+    }
+
+    SFL_NODISCARD
+    const_reverse_iterator crbegin() const noexcept
+    {
+        return const_reverse_iterator(end());
+    }
+
+    SFL_NODISCARD
+    reverse_iterator rend() noexcept
+    {
+        return reverse_iterator(begin());
+    }
+
+    SFL_NODISCARD
+    const_reverse_iterator rend() const noexcept
+    {
+        return const_reverse_iterator(begin());
+    }
+
+    SFL_NODISCARD
+    const_reverse_iterator crend() const noexcept
+    {
+        return const_reverse_iterator(begin());
+    }
+
+    SFL_NODISCARD
+    iterator nth(size_type pos) noexcept
+    {
+        SFL_ASSERT(pos <= size());
+        return iterator(data_.first() + pos);
+    }
+
+    SFL_NODISCARD
+    const_iterator nth(size_type pos) const noexcept
+    {
+        SFL_ASSERT(pos <= size());
+        return const_iterator(data_.first() + pos);
+    }
+
+    SFL_NODISCARD
+    size_type index_of(const_iterator pos) const noexcept
+    {
+        SFL_ASSERT(cbegin() <= pos && pos <= cend());
+        return std::distance(cbegin(), pos);
+    }
+
+    //
+    // ---- SIZE AND CAPACITY -------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    bool empty() const noexcept
+    {
+        return data_.size_ == 0;
+    }
+
+    SFL_NODISCARD
+    size_type size() const noexcept
+    {
+        return data_.size_;
+    }
+
+    SFL_NODISCARD
+    size_type max_size() const noexcept
+    {
+        return std::min<size_type>
+        (
+            std::min<size_type>
+            (
+                allocator_traits::max_size(data_.ref_to_alloc()),
+                std::numeric_limits<difference_type>::max() / sizeof(value_type)
+            ),
+            std::numeric_limits<stored_size_type>::max()
+        );
+    }
+
+    SFL_NODISCARD
+    size_type capacity() const noexcept
+    {
+        return data_.capacity_;
+    }
+
+    SFL_NODISCARD
+    size_type available() const noexcept
+    {
+        return data_.capacity_ - data_.size_;
+    }
+
+    void reserve(size_type new_cap)
+    {
+        check_size(new_cap, "sfl::tiny_vector::reserve");
+
+        if (new_cap > capacity())
+        {
+            new_cap = GrowthPolicy::round(new_cap, max_size(), sizeof(value_type));
+
+            pointer new_first = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), new_cap);
+            pointer new_last  = new_first;
+            pointer new_eos   = new_first + new_cap;
+
+            SFL_TRY
+            {
+                new_last = sfl::dtl::uninitialized_relocate_a
+                (
+                    data_.ref_to_alloc(),
+                    data_.first(),
+                    data_.last(),
+                    new_first
+                );
+            }
+            SFL_CATCH (...)
+            {
+                sfl::dtl::deallocate
+                (
+                    data_.ref_to_alloc(),
+                    new_first,
+                    new_cap
+                );
+
+                SFL_RETHROW;
+            }
+
+            sfl::dtl::destroy_relocated_a
+            (
+                data_.ref_to_alloc(),
+                data_.first(),
+                data_.last()
+            );
+
+            if (data_.first() != data_.internal_storage())
+            {
+                sfl::dtl::deallocate
+                (
+                    data_.ref_to_alloc(),
+                    data_.first(),
+                    std::distance(data_.first(), data_.eos())
+                );
+            }
+
+            data_.set(new_first, new_last, new_eos);
+        }
+    }
+
+    void shrink_to_fit()
+    {
+        const size_type new_cap = size();
+
+        if (new_cap < capacity())
+        {
+            if (new_cap <= N)
+            {
+                if (data_.first() == data_.internal_storage())
+                {
+                    // Do nothing. We are already using internal storage.
+                }
+                else
+                {
+                    // We are not using internal storage but new capacity
+                    // can fit in internal storage. Pointer to allocated
+                    // storage must be read before elements are relocated
+                    // into internal storage because they share bytes, and
+                    // it must be written back if relocation throws.
+
+                    const pointer old_first = data_.first();
+                    const pointer old_last  = data_.last();
+                    const pointer old_eos   = data_.eos();
+
+                    pointer new_first = data_.internal_storage();
+                    pointer new_last  = new_first;
+                    pointer new_eos   = new_first + N;
+
+                    SFL_TRY
+                    {
+                        new_last = sfl::dtl::uninitialized_relocate_a
+                        (
+                            data_.ref_to_alloc(),
+                            old_first,
+                            old_last,
+                            new_first
+                        );
+                    }
+                    SFL_CATCH (...)
+                    {
+                        data_.set_external_storage(old_first);
+                        SFL_RETHROW;
+                    }
+
+                    sfl::dtl::destroy_relocated_a
+                    (
+                        data_.ref_to_alloc(),
+                        old_first,
+                        old_last
+                    );
+
+                    sfl::dtl::deallocate
+                    (
+                        data_.ref_to_alloc(),
+                        old_first,
+                        std::distance(old_first, old_eos)
+                    );
+
+                    data_.set(new_first, new_last, new_eos);
+                }
+            }
+            else
+            {
+                pointer new_first = sfl::dtl::allocate(data_.ref_to_alloc(), new_cap);
+                pointer new_last  = new_first;
+                pointer new_eos   = new_first + new_cap;
+
+                SFL_TRY
+                {
+                    new_last = sfl::dtl::uninitialized_relocate_a
+                    (
+                        data_.ref_to_alloc(),
+                        data_.first(),
+                        data_.last(),
+                        new_first
+                    );
+                }
+                SFL_CATCH (...)
+                {
+                    sfl::dtl::deallocate
+                    (
+                        data_.ref_to_alloc(),
+                        new_first,
+                        new_cap
+                    );
+
+                    SFL_RETHROW;
+                }
+
+                sfl::dtl::destroy_relocated_a
+                (
+                    data_.ref_to_alloc(),
+                    data_.first(),
+                    data_.last()
+                );
+
+                if (data_.first() != data_.internal_storage())
+                {
+                    sfl::dtl::deallocate
+                    (
+                        data_.ref_to_alloc(),
+                        data_.first(),
+                        std::distance(data_.first(), data_.eos())
+                    );
+                }
+
+                data_.set(new_first, new_last, new_eos);
+            }
+        }
+    }
+
+    //
+    // ---- ELEMENT ACCESS ----------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    reference at(size_type pos)
+    {
+        if (pos >= size())
+        {
+            sfl::dtl::throw_out_of_range("sfl::tiny_vector::at");
+        }
+
+        return *(data_.first() + pos);
+    }
+
+    SFL_NODISCARD
+    const_reference at(size_type pos) const
+    {
+        if (pos >= size())
+        {
+            sfl::dtl::throw_out_of_range("sfl::tiny_vector::at");
+        }
+
+        return *(data_.first() + pos);
+    }
+
+    SFL_NODISCARD
+    reference operator[](size_type pos) noexcept
+    {
+        SFL_ASSERT(pos < size());
+        return *(data_.first() + pos);
+    }
+
+    SFL_NODISCARD
+    const_reference operator[](size_type pos) const noexcept
+    {
+        SFL_ASSERT(pos < size());
+        return *(data_.first() + pos);
+    }
+
+    SFL_NODISCARD
+    reference front() noexcept
+    {
+        SFL_ASSERT(!empty());
+        return *data_.first();
+    }
+
+    SFL_NODISCARD
+    const_reference front() const noexcept
+    {
+        SFL_ASSERT(!empty());
+        return *data_.first();
+    }
+
+    SFL_NODISCARD
+    reference back() noexcept
+    {
+        SFL_ASSERT(!empty());
+        return *(data_.last() - 1);
+    }
+
+    SFL_NODISCARD
+    const_reference back() const noexcept
+    {
+        SFL_ASSERT(!empty());
+        return *(data_.last() - 1);
+    }
+
+    SFL_NODISCARD
+    T* data() noexcept
+    {
+        return sfl::dtl::to_address(data_.first());
+    }
+
+    SFL_NODISCARD
+    const T* data() const noexcept
+    {
+        return sfl::dtl::to_address(data_.first());
+    }
+
+    //
+    // ---- MODIFIERS ---------------------------------------------------------
+    //
+
+    void clear() noexcept
+    {
+        sfl::dtl::destroy_a
+        (
+            data_.ref_to_alloc(),
+            data_.first(),
+            data_.last()
+        );
+
+        data_.set_last(data_.first());
+    }
+
+    template <typename... Args>
+    iterator emplace(const_iterator pos, Args&&... args)
+    {
+        SFL_ASSERT(cbegin() <= pos && pos <= cend());
+
+        if (data_.last() != data_.eos())
+        {
+            const pointer p1 = data_.first() + std::distance(cbegin(), pos);
+
+            if (p1 == data_.last())
+            {
+                sfl::dtl::construct_at_a
+                (
+                    data_.ref_to_alloc(),
+                    p1,
+                    std::forward<Args>(args)...
+                );
+
+                ++data_.size_;
+            }
+            else
+            {
+                // This container can contain duplicates so we must
+                // create new element now as a temporary value.
+                value_type tmp(std::forward<Args>(args)...);
+
+                pointer new_last = data_.last();
+
+                sfl::dtl::insert_shift_right_a
+                (
+                    data_.ref_to_alloc(),
+                    p1,
+                    new_last,
+                    std::move(tmp)
+                );
+
+                data_.set_last(new_last);
+            }
+
+            return iterator(p1);
+        }
+        else
+        {
+            const difference_type offset = std::distance(cbegin(), pos);
+
+            size_type new_cap =
+                calculate_new_capacity(1, "sfl::tiny_vector::emplace");
+
+            pointer new_first = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), new_cap);
+            pointer new_last  = new_first;
+            pointer new_eos   = new_first + new_cap;
+
+            const pointer p = new_first + offset;
+
+            SFL_TRY
+            {
+                sfl::dtl::construct_at_a
+                (
+                    data_.ref_to_alloc(),
+                    p,
+                    std::forward<Args>(args)...
+                );
+
+                new_last = nullptr;
+
+                const pointer mid = data_.first() + offset;
+
+                new_last = sfl::dtl::uninitialized_relocate_a
+                (
+                    data_.ref_to_alloc(),
+                    data_.first(),
+                    mid,
+                    new_first
+                );
+
+                ++new_last;
+
+                new_last = sfl::dtl::uninitialized_relocate_a
+                (
+                    data_.ref_to_alloc(),
+                    mid,
+                    data_.last(),
+                    new_last
+                );
+            }
+            SFL_CATCH (...)
+            {
+                if (new_last == nullptr)
+                {
+                    sfl::dtl::destroy_at_a
+                    (
+                        data_.ref_to_alloc(),
+                        p
+                    );
+                }
+                else
+                {
+                    sfl::dtl::destroy_a
+                    (
+                        data_.ref_to_alloc(),
+                        new_first,
+                        new_last
+                    );
+                }
+
+                sfl::dtl::deallocate
+                (
+                    data_.ref_to_alloc(),
+                    new_first,
+                    new_cap
+                );
+
+                SFL_RETHROW;
+            }
+
+            sfl::dtl::destroy_relocated_a
+            (
+                data_.ref_to_alloc(),
+                data_.first(),
+                data_.last()
+            );
+
+            if (data_.first() != data_.internal_storage())
+            {
+                sfl::dtl::deallocate
+                (
+                    data_.ref_to_alloc(),
+                    data_.first(),
+                    std::distance(data_.first(), data_.eos())
+                );
+            }
+
+            data_.set(new_first, new_last, new_eos);
+
+            return iterator(p);
+        }
+    }
+
+    iterator insert(const_iterator pos, const T& value)
+    {
+        SFL_ASSERT(cbegin() <= pos && pos <= cend());
+        return emplace(pos, value);
+    }
+
+    iterator insert(const_iterator pos, T&& value)
+    {
+        SFL_ASSERT(cbegin() <= pos && pos <= cend());
+        return emplace(pos, std::move(value));
+    }
+
+    iterator insert(const_iterator pos, size_type n, const T& value)
+    {
+        SFL_ASSERT(cbegin() <= pos && pos <= cend());
+        return insert_fill_n(pos, n, value);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    iterator insert(const_iterator pos, InputIt first, InputIt last)
+    {
+        SFL_ASSERT(cbegin() <= pos && pos <= cend());
+        return insert_range(pos, first, last);
+    }
+
+    iterator insert(const_iterator pos, std::initializer_list<T> ilist)
+    {
+        SFL_ASSERT(cbegin() <= pos && pos <= cend());
+        return insert_range(pos, ilist.begin(), ilist.end());
+    }
+
+    template <typename... Args>
+    reference emplace_back(Args&&... args)
+    {
+        if (data_.size_ != data_.capacity_)
+        {
+            const pointer old_last = data_.last();
+
+            sfl::dtl::construct_at_a
+            (
+                data_.ref_to_alloc(),
+                old_last,
+                std::forward<Args>(args)...
+            );
+
+            ++data_.size_;
+
+            return *old_last;
+        }
+        else
+        {
+            size_type new_cap =
+                calculate_new_capacity(1, "sfl::tiny_vector::emplace_back");
+
+            pointer new_first = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), new_cap);
+            pointer new_last  = new_first;
+            pointer new_eos   = new_first + new_cap;
+
+            const pointer p = new_first + size();
+
+            SFL_TRY
+            {
+                sfl::dtl::construct_at_a
+                (
+                    data_.ref_to_alloc(),
+                    p,
+                    std::forward<Args>(args)...
+                );
+
+                new_last = nullptr;
+
+                new_last = sfl::dtl::uninitialized_relocate_a
+                (
+                    data_.ref_to_alloc(),
+                    data_.first(),
+                    data_.last(),
+                    new_first
+                );
+
+                ++new_last;
+            }
+            SFL_CATCH (...)
+            {
+                if (new_last == nullptr)
+                {
+                    sfl::dtl::destroy_at_a
+                    (
+                        data_.ref_to_alloc(),
+                        p
+                    );
+                }
+                else
+                {
+                    // Nothing to do
+                }
+
+                sfl::dtl::deallocate
+                (
+                    data_.ref_to_alloc(),
+                    new_first,
+                    new_cap
+                );
+
+                SFL_RETHROW;
+            }
+
+            sfl::dtl::destroy_relocated_a
+            (
+                data_.ref_to_alloc(),
+                data_.first(),
+                data_.last()
+            );
+
+            if (data_.first() != data_.internal_storage())
+            {
+                sfl::dtl::deallocate
+                (
+                    data_.ref_to_alloc(),
+                    data_.first(),
+                    std::distance(data_.first(), data_.eos())
+                );
+            }
+
+            data_.set(new_first, new_last, new_eos);
+
+            return *p;
+        }
+    }
+
+    void push_back(const T& value)
+    {
+        emplace_back(value);
+    }
+
+    void push_back(T&& value)
+    {
+        emplace_back(std::move(value));
+    }
+
+    void pop_back()
+    {
+        SFL_ASSERT(!empty());
+
+        --data_.size_;
+
+        sfl::dtl::destroy_at_a(data_.ref_to_alloc(), data_.last());
+    }
+
+    iterator erase(const_iterator pos)
+    {
+        SFL_ASSERT(cbegin() <= pos && pos < cend());
+
+        const pointer p = data_.first() + std::distance(cbegin(), pos);
+
+        data_.set_last(sfl::dtl::erase_shift_left_a(data_.ref_to_alloc(), p, p + 1, data_.last()));
+
+        return iterator(p);
+    }
+
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        SFL_ASSERT(cbegin() <= first && first <= last && last <= cend());
+
+        if (first == last)
+        {
+            return begin() + std::distance(cbegin(), first);
+        }
+
+        const pointer p1 = data_.first() + std::distance(cbegin(), first);
+        const pointer p2 = data_.first() + std::distance(cbegin(), last);
+
+        data_.set_last(sfl::dtl::erase_shift_left_a(data_.ref_to_alloc(), p1, p2, data_.last()));
+
+        return iterator(p1);
+    }
+
+    void resize(size_type n)
+    {
+        check_size(n, "sfl::tiny_vector::resize");
+
+        const size_type size = this->size();
+
+        if (n < size)
+        {
+            const pointer new_last = data_.first() + n;
+
+            sfl::dtl::destroy_a
+            (
+                data_.ref_to_alloc(),
+                new_last,
+                data_.last()
+            );
+
+            data_.set_last(new_last);
+        }
+        else if (n > size)
+        {
+            const size_type delta = n - size;
+
+            if (n > capacity())
+            {
+                pointer new_first = sfl::dtl::allocate(data_.ref_to_alloc(), n);
+                pointer new_last  = new_first;
+                pointer new_eos   = new_first + n;
+
+                SFL_TRY
+                {
+                    sfl::dtl::uninitialized_default_construct_n_a
+                    (
+                        data_.ref_to_alloc(),
+                        new_first + size,
+                        delta
+                    );
+
+                    new_last = nullptr;
+
+                    new_last = sfl::dtl::uninitialized_relocate_a
+                    (
+                        data_.ref_to_alloc(),
+                        data_.first(),
+                        data_.last(),
+                        new_first
+                    );
+
+                    new_last += delta;
+                }
+                SFL_CATCH (...)
+                {
+                    if (new_last == nullptr)
+                    {
+                        sfl::dtl::destroy_n_a
+                        (
+                            data_.ref_to_alloc(),
+                            new_first + size,
+                            delta
+                        );
+                    }
+                    else
+                    {
+                        sfl::dtl::destroy_a
+                        (
+                            data_.ref_to_alloc(),
+                            new_first,
+                            new_last
+                        );
+                    }
+
+                    sfl::dtl::deallocate
+                    (
+                        data_.ref_to_alloc(),
+                        new_first,
+                        n
+                    );
+
+                    SFL_RETHROW;
+                }
+
+                sfl::dtl::destroy_relocated_a
+                (
+                    data_.ref_to_alloc(),
+                    data_.first(),
+                    data_.last()
+                );
+
+                if (data_.first() != data_.internal_storage())
+                {
+                    sfl::dtl::deallocate
+                    (
+                        data_.ref_to_alloc(),
+                        data_.first(),
+                        std::distance(data_.first(), data_.eos())
+                    );
+                }
+
+                data_.set(new_first, new_last, new_eos);
+            }
+            else
+            {
+                data_.set_last(sfl::dtl::uninitialized_default_construct_n_a
+                (
+                    data_.ref_to_alloc(),
+                    data_.last(),
+                    delta
+                ));
+            }
+        }
+    }
+
+    void resize(size_type n, const T& value)
+    {
+        check_size(n, "sfl::tiny_vector::resize");
+
+        const size_type size = this->size();
+
+        if (n < size)
+        {
+            const pointer new_last = data_.first() + n;
+
+            sfl::dtl::destroy_a
+            (
+                data_.ref_to_alloc(),
+                new_last,
+                data_.last()
+            );
+
+            data_.set_last(new_last);
+        }
+        else if (n > size)
+        {
+            const size_type delta = n - size;
+
+            if (n > capacity())
+            {
+                pointer new_first = sfl::dtl::allocate(data_.ref_to_alloc(), n);
+                pointer new_last  = new_first;
+                pointer new_eos   = new_first + n;
+
+                SFL_TRY
+                {
+                    sfl::dtl::uninitialized_fill_n_a
+                    (
+                        data_.ref_to_alloc(),
+                        new_first + size,
+                        delta,
+                        value
+                    );
+
+                    new_last = nullptr;
+
+                    new_last = sfl::dtl::uninitialized_relocate_a
+                    (
+                        data_.ref_to_alloc(),
+                        data_.first(),
+                        data_.last(),
+                        new_first
+                    );
+
+                    new_last += delta;
+                }
+                SFL_CATCH (...)
+                {
+                    if (new_last == nullptr)
+                    {
+                        sfl::dtl::destroy_n_a
+                        (
+                            data_.ref_to_alloc(),
+                            new_first + size,
+                            delta
+                        );
+                    }
+                    else
+                    {
+                        sfl::dtl::destroy_a
+                        (
+                            data_.ref_to_alloc(),
+                            new_first,
+                            new_last
+                        );
+                    }
+
+                    sfl::dtl::deallocate
+                    (
+                        data_.ref_to_alloc(),
+                        new_first,
+                        n
+                    );
+
+                    SFL_RETHROW;
+                }
+
+                sfl::dtl::destroy_relocated_a
+                (
+                    data_.ref_to_alloc(),
+                    data_.first(),
+                    data_.last()
+                );
+
+                if (data_.first() != data_.internal_storage())
+                {
+                    sfl::dtl::deallocate
+                    (
+                        data_.ref_to_alloc(),
+                        data_.first(),
+                        std::distance(data_.first(), data_.eos())
+                    );
+                }
+
+                data_.set(new_first, new_last, new_eos);
+            }
+            else
+            {
+                data_.set_last(sfl::dtl::uninitialized_fill_n_a
+                (
+                    data_.ref_to_alloc(),
+                    data_.last(),
+                    delta,
+                    value
+                ));
+            }
+        }
+    }
+
+    void swap(tiny_vector& other)
+    {
+        if (this == &other)
+        {
+            return;
+        }
+
+        using std::swap;
+
+        SFL_ASSERT
+        (
+            allocator_traits::propagate_on_container_swap::value ||
+            this->data_.ref_to_alloc() == other.data_.ref_to_alloc()
+        );
+
+        // If this and other allocator compares equal then one allocator
+        // can deallocate memory allocated by another allocator.
+        // One allocator can safely destroy_a elements constructed by other
+        // allocator regardless the two allocators compare equal or not.
+
+        if (allocator_traits::propagate_on_container_swap::value)
+        {
+            swap(this->data_.ref_to_alloc(), other.data_.ref_to_alloc());
+        }
+
+        if
+        (
+            this->data_.first() == this->data_.internal_storage() &&
+            other.data_.first() == other.data_.internal_storage()
+        )
+        {
+            const size_type this_size  = this->size();
+            const size_type other_size = other.size();
+
+            if (this_size <= other_size)
+            {
+                std::swap_ranges
+                (
+                    this->data_.first(),
+                    this->data_.first() + this_size,
+                    other.data_.first()
+                );
+
+                sfl::dtl::uninitialized_move_a
+                (
+                    this->data_.ref_to_alloc(),
+                    other.data_.first() + this_size,
+                    other.data_.first() + other_size,
+                    this->data_.first() + this_size
+                );
+
+                sfl::dtl::destroy_a
+                (
+                    other.data_.ref_to_alloc(),
+                    other.data_.first() + this_size,
+                    other.data_.first() + other_size
+                );
+            }
+            else
+            {
+                std::swap_ranges
+                (
+                    other.data_.first(),
+                    other.data_.first() + other_size,
+                    this->data_.first()
+                );
+
+                sfl::dtl::uninitialized_move_a
+                (
+                    other.data_.ref_to_alloc(),
+                    this->data_.first() + other_size,
+                    this->data_.first() + this_size,
+                    other.data_.first() + other_size
+                );
+
+                sfl::dtl::destroy_a
+                (
+                    this->data_.ref_to_alloc(),
+                    this->data_.first() + other_size,
+                    this->data_.first() + this_size
+                );
+            }
+
+            this->data_.set_last(this->data_.first() + other_size);
+            other.data_.set_last(other.data_.first() + this_size);
+        }
+        else if
+        (
+            this->data_.first() == this->data_.internal_storage() &&
+            other.data_.first() != other.data_.internal_storage()
+        )
+        {
+            // Pointer to allocated storage must be read before elements are
+            // moved into internal storage because they share bytes, and it
+            // must be written back if moving throws.
+
+            const pointer old_other_first = other.data_.first();
+            const pointer old_other_last  = other.data_.last();
+            const pointer old_other_eos   = other.data_.eos();
+
+            pointer new_other_first = other.data_.internal_storage();
+            pointer new_other_last  = new_other_first;
+            pointer new_other_eos   = new_other_first + N;
+
+            SFL_TRY
+            {
+                new_other_last = sfl::dtl::uninitialized_move_a
+                (
+                    other.data_.ref_to_alloc(),
+                    this->data_.first(),
+                    this->data_.last(),
+                    new_other_first
+                );
+            }
+            SFL_CATCH (...)
+            {
+                other.data_.set_external_storage(old_other_first);
+                SFL_RETHROW;
+            }
+
+            sfl::dtl::destroy_a
+            (
+                this->data_.ref_to_alloc(),
+                this->data_.first(),
+                this->data_.last()
+            );
+
+            this->data_.set(old_other_first, old_other_last, old_other_eos);
+
+            other.data_.set(new_other_first, new_other_last, new_other_eos);
+        }
+        else if
+        (
+            this->data_.first() != this->data_.internal_storage() &&
+            other.data_.first() == other.data_.internal_storage()
+        )
+        {
+            // Pointer to allocated storage must be read before elements are
+            // moved into internal storage because they share bytes, and it
+            // must be written back if moving throws.
+
+            const pointer old_this_first = this->data_.first();
+            const pointer old_this_last  = this->data_.last();
+            const pointer old_this_eos   = this->data_.eos();
+
+            pointer new_this_first = this->data_.internal_storage();
+            pointer new_this_last  = new_this_first;
+            pointer new_this_eos   = new_this_first + N;
+
+            SFL_TRY
+            {
+                new_this_last = sfl::dtl::uninitialized_move_a
+                (
+                    this->data_.ref_to_alloc(),
+                    other.data_.first(),
+                    other.data_.last(),
+                    new_this_first
+                );
+            }
+            SFL_CATCH (...)
+            {
+                this->data_.set_external_storage(old_this_first);
+                SFL_RETHROW;
+            }
+
+            sfl::dtl::destroy_a
+            (
+                other.data_.ref_to_alloc(),
+                other.data_.first(),
+                other.data_.last()
+            );
+
+            other.data_.set(old_this_first, old_this_last, old_this_eos);
+
+            this->data_.set(new_this_first, new_this_last, new_this_eos);
+        }
+        else
+        {
+            const pointer old_this_first = this->data_.first();
+            const pointer old_this_last  = this->data_.last();
+            const pointer old_this_eos   = this->data_.eos();
+
+            this->data_.set(other.data_.first(), other.data_.last(), other.data_.eos());
+
+            other.data_.set(old_this_first, old_this_last, old_this_eos);
+        }
+    }
+
+private:
+
+    void check_size(size_type n, const char* msg)
+    {
+        if (n > max_size())
+        {
+            sfl::dtl::throw_length_error(msg);
+        }
+    }
+
+    size_type calculate_new_capacity(size_type num_additional_elements, const char* msg)
+    {
+        const size_type size = this->size();
+        const size_type max_size = this->max_size();
+
+        if (max_size - size < num_additional_elements)
+        {
+            sfl::dtl::throw_length_error(msg);
+        }
+
+        const size_type min_cap = size + num_additional_elements;
+
+        const size_type new_cap = GrowthPolicy::grow
+        (
+            capacity(),
+            min_cap,
+            max_size,
+            sizeof(value_type)
+        );
+
+        SFL_ASSERT(min_cap <= new_cap && new_cap <= max_size);
+
+        return std::max(N, new_cap);
+    }
+
+    void reset(size_type new_cap = N)
+    {
+        sfl::dtl::destroy_a
+        (
+            data_.ref_to_alloc(),
+            data_.first(),
+            data_.last()
+        );
+
+        if (data_.first() != data_.internal_storage())
+        {
+            sfl::dtl::deallocate
+            (
+                data_.ref_to_alloc(),
+                data_.first(),
+                std::distance(data_.first(), data_.eos())
+            );
+        }
+
+        data_.set_internal_storage();
+
+        if (new_cap > N)
+        {
+            const pointer new_first = sfl::dtl::allocate(data_.ref_to_alloc(), new_cap);
+
+            data_.set(new_first, new_first, new_first + new_cap);
+
+            // If allocation throws, size and capacity will be valid
+            // (container will be using internal storage).
+        }
+    }
+
+    void initialize_default_n(size_type n)
+    {
+        check_size(n, "sfl::tiny_vector::initialize_default_n");
+
+        if (n > N)
+        {
+            const pointer new_first = sfl::dtl::allocate(data_.ref_to_alloc(), n);
+
+            data_.set(new_first, new_first, new_first + n);
+        }
+
+        SFL_TRY
+        {
+            data_.set_last(sfl::dtl::uninitialized_default_construct_n_a
+            (
+                data_.ref_to_alloc(),
+                data_.first(),
+                n
+            ));
+        }
+        SFL_CATCH (...)
+        {
+            if (n > N)
+            {
+                sfl::dtl::deallocate(data_.ref_to_alloc(), data_.first(), n);
+            }
+
+            SFL_RETHROW;
+        }
+    }
+
+    void initialize_fill_n(size_type n, const T& value)
+    {
+        check_size(n, "sfl::tiny_vector::initialize_fill_n");
+
+        if (n > N)
+        {
+            const pointer new_first = sfl::dtl::allocate(data_.ref_to_alloc(), n);
+
+            data_.set(new_first, new_first, new_first + n);
+        }
+
+        SFL_TRY
+        {
+            data_.set_last(sfl::dtl::uninitialized_fill_n_a
+            (
+                data_.ref_to_alloc(),
+                data_.first(),
+                n,
+                value
+            ));
+        }
+        SFL_CATCH (...)
+        {
+            if (n > N)
+            {
+                sfl::dtl::deallocate(data_.ref_to_alloc(), data_.first(), n);
+            }
+
+            SFL_RETHROW;
+        }
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_exactly_input_iterator<InputIt>::value>* = nullptr>
+    void initialize_range(InputIt first, InputIt last)
+    {
+        SFL_TRY
+        {
+            while (first != last)
+            {
+                emplace_back(*first);
+                ++first;
+            }
+        }
+        SFL_CATCH (...)
+        {
+            sfl::dtl::destroy_a
+            (
+                data_.ref_to_alloc(),
+                data_.first(),
+                data_.last()
+            );
+
+            if (data_.first() != data_.internal_storage())
+            {
+                sfl::dtl::deallocate
+                (
+                    data_.ref_to_alloc(),
+                    data_.first(),
+                    std::distance(data_.first(), data_.eos())
+                );
+            }
+
+            SFL_RETHROW;
+        }
+    }
+
+    template <typename ForwardIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_forward_iterator<ForwardIt>::value>* = nullptr>
+    void initialize_range(ForwardIt first, ForwardIt last)
+    {
+        const size_type n = std::distance(first, last);
+
+        check_size(n, "sfl::tiny_vector::initialize_range");
+
+        if (n > N)
+        {
+            const pointer new_first = sfl::dtl::allocate(data_.ref_to_alloc(), n);
+
+            data_.set(new_first, new_first, new_first + n);
+        }
+
+        SFL_TRY
+        {
+            data_.set_last(sfl::dtl::uninitialized_copy_a
+            (
+                data_.ref_to_alloc(),
+                first,
+                last,
+                data_.first()
+            ));
+        }
+        SFL_CATCH (...)
+        {
+            if (n > N)
+            {
+                sfl::dtl::deallocate(data_.ref_to_alloc(), data_.first(), n);
+            }
+
+            SFL_RETHROW;
+        }
+    }
+
+    void initialize_copy(const tiny_vector& other)
+    {
+        const size_type n = other.size();
+
+        check_size(n, "sfl::tiny_vector::initialize_copy");
+
+        if (n > N)
+        {
+            const pointer new_first = sfl::dtl::allocate(data_.ref_to_alloc(), n);
+
+            data_.set(new_first, new_first, new_first + n);
+        }
+
+        SFL_TRY
+        {
+            data_.set_last(sfl::dtl::uninitialized_copy_a
+            (
+                data_.ref_to_alloc(),
+                other.data_.first(),
+                other.data_.last(),
+                data_.first()
+            ));
+        }
+        SFL_CATCH (...)
+        {
+            if (n > N)
+            {
+                sfl::dtl::deallocate(data_.ref_to_alloc(), data_.first(), n);
+            }
+
+            SFL_RETHROW;
+        }
+    }
+
+    void initialize_move(tiny_vector& other)
+    {
+        if (other.data_.first() == other.data_.internal_storage())
+        {
+            data_.set_last(sfl::dtl::uninitialized_move_a
+            (
+                data_.ref_to_alloc(),
+                other.data_.first(),
+                other.data_.last(),
+                data_.first()
+            ));
+        }
+        else if (data_.ref_to_alloc() == other.data_.ref_to_alloc())
+        {
+            data_.set(other.data_.first(), other.data_.last(), other.data_.eos());
+
+            other.data_.set_internal_storage();
+        }
+        else
+        {
+            const size_type n = other.size();
+
+            check_size(n, "sfl::tiny_vector::initialize_move");
+
+            if (n > N)
+            {
+                const pointer new_first = sfl::dtl::allocate(data_.ref_to_alloc(), n);
+
+                data_.set(new_first, new_first, new_first + n);
+            }
+
+            SFL_TRY
+            {
+                data_.set_last(sfl::dtl::uninitialized_move_a
+                (
+                    data_.ref_to_alloc(),
+                    other.data_.first(),
+                    other.data_.last(),
+                    data_.first()
+                ));
+            }
+            SFL_CATCH (...)
+            {
+                if (n > N)
+                {
+                    sfl::dtl::deallocate(data_.ref_to_alloc(), data_.first(), n);
+                }
+
+                SFL_RETHROW;
+            }
+        }
+    }
+
+    void assign_fill_n(size_type n, const T& value)
+    {
+        check_size(n, "sfl::tiny_vector::assign_fill_n");
+
+        if (n <= capacity())
+        {
+            const size_type size = this->size();
+
+            const pointer new_last = data_.first() + n;
+
+            if (n <= size)
+            {
+                sfl::dtl::fill
+                (
+                    data_.first(),
+                    new_last,
+                    value
+                );
+
+                sfl::dtl::destroy_a
+                (
+                    data_.ref_to_alloc(),
+                    new_last,
+                    data_.last()
+                );
+            }
+            else
+            {
+                sfl::dtl::fill
+                (
+                    data_.first(),
+                    data_.last(),
+                    value
+                );
+
+                sfl::dtl::uninitialized_fill_a
+                (
+                    data_.ref_to_alloc(),
+                    data_.last(),
+                    new_last,
+                    value
+                );
+            }
+
+            data_.set_last(new_last);
+        }
+        else
+        {
+            reset(n);
+
+            data_.set_last(sfl::dtl::uninitialized_fill_n_a
+            (
+                data_.ref_to_alloc(),
+                data_.first(),
+                n,
+                value
+            ));
+        }
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_exactly_input_iterator<InputIt>::value>* = nullptr>
+    void assign_range(InputIt first, InputIt last)
+    {
+        pointer curr = data_.first();
+
+        while (first != last && curr != data_.last())
+        {
+            *curr = *first;
+            ++curr;
+            ++first;
+        }
+
+        if (first != last)
+        {
+            do
+            {
+                emplace_back(*first);
+                ++first;
+            }
+            while (first != last);
+        }
+        else if (curr < data_.last())
+        {
+            sfl::dtl::destroy_a(data_.ref_to_alloc(), curr, data_.last());
+            data_.set_last(curr);
+        }
+    }
+
+    template <typename ForwardIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_forward_iterator<ForwardIt>::value>* = nullptr>
+    void assign_range(ForwardIt first, ForwardIt last)
+    {
+        const size_type n = std::distance(first, last);
+
+        check_size(n, "sfl::tiny_vector::assign_range");
+
+        if (n <= capacity())
+        {
+            const size_type size = this->size();
+
+            if (n <= size)
+            {
+                const pointer new_last = sfl::dtl::copy
+                (
+                    first,
+                    last,
+                    data_.first()
+                );
+
+                sfl::dtl::destroy_a
+                (
+                    data_.ref_to_alloc(),
+                    new_last,
+                    data_.last()
+                );
+
+                data_.set_last(new_last);
+            }
+            else
+            {
+                const ForwardIt mid = std::next(first, size);
+
+                sfl::dtl::copy
+                (
+                    first,
+                    mid,
+                    data_.first()
+                );
+
+                data_.set_last(sfl::dtl::uninitialized_copy_a
+                (
+                    data_.ref_to_alloc(),
+                    mid,
+                    last,
+                    data_.last()
+                ));
+            }
+        }
+        else
+        {
+            reset(n);
+
+            data_.set_last(sfl::dtl::uninitialized_copy_a
+            (
+                data_.ref_to_alloc(),
+                first,
+                last,
+                data_.first()
+            ));
+        }
+    }
+
+    void assign_copy(const tiny_vector& other)
+    {
+        if (this != &other)
+        {
+            if (allocator_traits::propagate_on_container_copy_assignment::value)
+            {
+                if (data_.ref_to_alloc() != other.data_.ref_to_alloc())
+                {
+                    reset();
+                }
+
+                data_.ref_to_alloc() = other.data_.ref_to_alloc();
+            }
+
+            assign_range
+            (
+                other.data_.first(),
+                other.data_.last()
+            );
+        }
+    }
+
+    void assign_move(tiny_vector& other)
+    {
+        if (allocator_traits::propagate_on_container_move_assignment::value)
+        {
+            if (data_.ref_to_alloc() != other.data_.ref_to_alloc())
+            {
+                reset();
+            }
+
+            data_.ref_to_alloc() = std::move(other.data_.ref_to_alloc());
+        }
+
+        if (other.data_.first() == other.data_.internal_storage())
+        {
+            assign_range
+            (
+                std::make_move_iterator(other.data_.first()),
+                std::make_move_iterator(other.data_.last())
+            );
+        }
+        else if (data_.ref_to_alloc() == other.data_.ref_to_alloc())
+        {
+            reset();
+
+            data_.set(other.data_.first(), other.data_.last(), other.data_.eos());
+
+            other.data_.set_internal_storage();
+        }
+        else
+        {
+            assign_range
+            (
+                std::make_move_iterator(other.data_.first()),
+                std::make_move_iterator(other.data_.last())
+            );
+        }
+    }
+
+    iterator insert_fill_n(const_iterator pos, size_type n, const T& value)
+    {
+        if (n == 0)
+        {
+            return begin() + std::distance(cbegin(), pos);
+        }
+
+        if (available() >= n)
+        {
+            const value_type tmp(value);
+
+            const pointer p1 = data_.first() + std::distance(cbegin(), pos);
+            const pointer p2 = p1 + n;
+
+            if (p2 <= data_.last())
+            {
+                const pointer p3 = data_.last() - n;
+
+                const pointer old_last = data_.last();
+
+                data_.set_last(sfl::dtl::uninitialized_move_a
+                (
+                    data_.ref_to_alloc(),
+                    p3,
+                    data_.last(),
+                    data_.last()
+                ));
+
+                sfl::dtl::move_backward
+                (
+                    p1,
+                    p3,
+                    old_last
+                );
+
+                sfl::dtl::fill
+                (
+                    p1,
+                    p2,
+                    tmp
+                );
+            }
+            else
+            {
+                const pointer old_last = data_.last();
+
+                sfl::dtl::uninitialized_fill_a
+                (
+                    data_.ref_to_alloc(),
+                    data_.last(),
+                    p2,
+                    tmp
+                );
+
+                data_.set_last(p2);
+
+                data_.set_last(sfl::dtl::uninitialized_move_a
+                (
+                    data_.ref_to_alloc(),
+                    p1,
+                    old_last,
+                    data_.last()
+                ));
+
+                sfl::dtl::fill
+                (
+                    p1,
+                    old_last,
+                    tmp
+                );
+            }
+
+            return iterator(p1);
+        }
+        else
+        {
+            const difference_type offset = std::distance(cbegin(), pos);
+
+            size_type new_cap =
+                calculate_new_capacity(n, "sfl::tiny_vector::insert_fill_n");
+
+            pointer new_first = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), new_cap);
+            pointer new_last  = new_first;
+            pointer new_eos   = new_first + new_cap;
+
+            const pointer p = new_first + offset;
+
+            SFL_TRY
+            {
+                // `value` can be a reference to an element in this
+                // container. First we will create `n` copies of `value`
+                // and ffter that we can move elements.
+
+                sfl::dtl::uninitialized_fill_n_a
+                (
+                    data_.ref_to_alloc(),
+                    p,
+                    n,
+                    value
+                );
+
+                new_last = nullptr;
+
+                const pointer mid = data_.first() + offset;
+
+                new_last = sfl::dtl::uninitialized_relocate_a
+                (
+                    data_.ref_to_alloc(),
+                    data_.first(),
+                    mid,
+                    new_first
+                );
+
+                new_last += n;
+
+                new_last = sfl::dtl::uninitialized_relocate_a
+                (
+                    data_.ref_to_alloc(),
+                    mid,
+                    data_.last(),
+                    new_last
+                );
+            }
+            SFL_CATCH (...)
+            {
+                if (new_last == nullptr)
+                {
+                    sfl::dtl::destroy_n_a
+                    (
+                        data_.ref_to_alloc(),
+                        p,
+                        n
+                    );
+                }
+                else
+                {
+                    sfl::dtl::destroy_a
+                    (
+                        data_.ref_to_alloc(),
+                        new_first,
+                        new_last
+                    );
+                }
+
+                sfl::dtl::deallocate
+                (
+                    data_.ref_to_alloc(),
+                    new_first,
+                    new_cap
+                );
+
+                SFL_RETHROW;
+            }
+
+            sfl::dtl::destroy_relocated_a
+            (
+                data_.ref_to_alloc(),
+                data_.first(),
+                data_.last()
+            );
+
+            if (data_.first() != data_.internal_storage())
+            {
+                sfl::dtl::deallocate
+                (
+                    data_.ref_to_alloc(),
+                    data_.first(),
+                    std::distance(data_.first(), data_.eos())
+                );
+            }
+
+            data_.set(new_first, new_last, new_eos);
+
+            return iterator(p);
+        }
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_exactly_input_iterator<InputIt>::value>* = nullptr>
+    iterator insert_range(const_iterator pos, InputIt first, InputIt last)
+    {
+        const difference_type offset = std::distance(cbegin(), pos);
+
+        while (first != last)
+        {
+            pos = insert(pos, *first);
+            ++pos;
+            ++first;
+        }
+
+        return begin() + offset;
+    }
+
+    template <typename ForwardIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_forward_iterator<ForwardIt>::value>* = nullptr>
+    iterator insert_range(const_iterator pos, ForwardIt first, ForwardIt last)
+    {
+        if (first == last)
+        {
+            return begin() + std::distance(cbegin(), pos);
+        }
+
+        const size_type n = std::distance(first, last);
+
+        if (available() >= n)
+        {
+            const pointer p1 = data_.first() + std::distance(cbegin(), pos);
+            const pointer p2 = p1 + n;
+
+            if (p2 <= data_.last())
+            {
+                const pointer p3 = data_.last() - n;
+
+                const pointer old_last = data_.last();
+
+                data_.set_last(sfl::dtl::uninitialized_move_a
+                (
+                    data_.ref_to_alloc(),
+                    p3,
+                    data_.last(),
+                    data_.last()
+                ));
+
+                sfl::dtl::move_backward
+                (
+                    p1,
+                    p3,
+                    old_last
+                );
+
+                sfl::dtl::copy
+                (
+                    first,
+                    last,
+                    p1
+                );
+            }
+            else
+            {
+                const pointer old_last = data_.last();
+
+                const ForwardIt mid = std::next(first, std::distance(pos, cend()));
+
+                data_.set_last(sfl::dtl::uninitialized_copy_a
+                (
+                    data_.ref_to_alloc(),
+                    mid,
+                    last,
+                    data_.last()
+                ));
+
+                data_.set_last(sfl::dtl::uninitialized_move_a
+                (
+                    data_.ref_to_alloc(),
+                    p1,
+                    old_last,
+                    data_.last()
+                ));
+
+                sfl::dtl::copy
+                (
+                    first,
+                    mid,
+                    p1
+                );
+            }
+
+            return iterator(p1);
+        }
+        else
+        {
+            const difference_type offset = std::distance(cbegin(), pos);
+
+            size_type new_cap =
+                calculate_new_capacity(n, "sfl::tiny_vector::insert_range");
+
+            pointer new_first = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), new_cap);
+            pointer new_last  = new_first;
+            pointer new_eos   = new_first + new_cap;
+
+            const pointer p = new_first + offset;
+
+            SFL_TRY
+            {
+                // New elements are created first so that existing elements
+                // can be relocated after that without further exceptions.
+
+                const pointer mid = data_.first() + offset;
+
+                sfl::dtl::uninitialized_copy_a
+                (
+                    data_.ref_to_alloc(),
+                    first,
+                    last,
+                    p
+                );
+
+                new_last = nullptr;
+
+                new_last = sfl::dtl::uninitialized_relocate_a
+                (
+                    data_.ref_to_alloc(),
+                    data_.first(),
+                    mid,
+                    new_first
+                );
+
+                new_last += n;
+
+                new_last = sfl::dtl::uninitialized_relocate_a
+                (
+                    data_.ref_to_alloc(),
+                    mid,
+                    data_.last(),
+                    new_last
+                );
+            }
+            SFL_CATCH (...)
+            {
+                if (new_last == nullptr)
+                {
+                    sfl::dtl::destroy_n_a
+                    (
+                        data_.ref_to_alloc(),
+                        p,
+                        n
+                    );
+                }
+                else
+                {
+                    sfl::dtl::destroy_a
+                    (
+                        data_.ref_to_alloc(),
+                        new_first,
+                        new_last
+                    );
+                }
+
+                sfl::dtl::deallocate
+                (
+                    data_.ref_to_alloc(),
+                    new_first,
+                    new_cap
+                );
+
+                SFL_RETHROW;
+            }
+
+            sfl::dtl::destroy_relocated_a
+            (
+                data_.ref_to_alloc(),
+                data_.first(),
+                data_.last()
+            );
+
+            if (data_.first() != data_.internal_storage())
+            {
+                sfl::dtl::deallocate
+                (
+                    data_.ref_to_alloc(),
+                    data_.first(),
+                    std::distance(data_.first(), data_.eos())
+                );
+            }
+
+            data_.set(new_first, new_last, new_eos);
+
+            return iterator(p);
+        }
+    }
+};
+
+//
+// ---- NON-MEMBER FUNCTIONS --------------------------------------------------
+//
+
+template <typename T, std::size_t N, typename A, typename G>
+SFL_NODISCARD
+bool operator==
+(
+    const tiny_vector<T, N, A, G>& x,
+    const tiny_vector<T, N, A, G>& y
+)
+{
+    return x.size() == y.size() && std::equal(x.begin(), x.end(), y.begin());
+}
+
+template <typename T, std::size_t N, typename A, typename G>
+SFL_NODISCARD
+bool operator!=
+(
+    const tiny_vector<T, N, A, G>& x,
+    const tiny_vector<T, N, A, G>& y
+)
+{
+    return !(x == y);
+}
+
+template <typename T, std::size_t N, typename A, typename G>
+SFL_NODISCARD
+bool operator<
+(
+    const tiny_vector<T, N, A, G>& x,
+    const tiny_vector<T, N, A, G>& y
+)
+{
+    return std::lexicographical_compare(x.begin(), x.end(), y.begin(), y.end());
+}
+
+template <typename T, std::size_t N, typename A, typename G>
+SFL_NODISCARD
+bool operator>
+(
+    const tiny_vector<T, N, A, G>& x,
+    const tiny_vector<T, N, A, G>& y
+)
+{
+    return y < x;
+}
+
+template <typename T, std::size_t N, typename A, typename G>
+SFL_NODISCARD
+bool operator<=
+(
+    const tiny_vector<T, N, A, G>& x,
+    const tiny_vector<T, N, A, G>& y
+)
+{
+    return !(y < x);
+}
+
+template <typename T, std::size_t N, typename A, typename G>
+SFL_NODISCARD
+bool operator>=
+(
+    const tiny_vector<T, N, A, G>& x,
+    const tiny_vector<T, N, A, G>& y
+)
+{
+    return !(x < y);
+}
+
+template <typename T, std::size_t N, typename A, typename G>
+void swap
+(
+    tiny_vector<T, N, A, G>& x,
+    tiny_vector<T, N, A, G>& y
+)
+{
+    x.swap(y);
+}
+
+template <typename T, std::size_t N, typename A, typename G, typename U>
+typename tiny_vector<T, N, A, G>::size_type
+    erase(tiny_vector<T, N, A, G>& c, const U& value)
+{
+    auto it = std::remove(c.begin(), c.end(), value);
+    auto r = std::distance(it, c.end());
+    c.erase(it, c.end());
+    return r;
+}
+
+template <typename T, std::size_t N, typename A, typename G, typename Predicate>
+typename tiny_vector<T, N, A, G>::size_type
+    erase_if(tiny_vector<T, N, A, G>& c, Predicate pred)
+{
+    auto it = std::remove_if(c.begin(), c.end(), pred);
+    auto r = std::distance(it, c.end());
+    c.erase(it, c.end());
+    return r;
+}
+
+} // namespace sfl
+
+#endif // SFL_TINY_VECTOR_HPP_INCLUDED
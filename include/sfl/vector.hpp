@@ -34,13 +34,25 @@
 namespace sfl
 {
 
-template <typename T, typename Allocator = std::allocator<T>>
+namespace dtl
+{
+
+struct vector_access;
+
+} // namespace dtl
+
+template < typename T,
+           typename Allocator = std::allocator<T>,
+           typename GrowthPolicy = sfl::geometric_growth<> >
 class vector
 {
+    friend struct sfl::dtl::vector_access;
+
 public:
 
     using allocator_type         = Allocator;
     using allocator_traits       = std::allocator_traits<Allocator>;
+    using growth_policy          = GrowthPolicy;
     using value_type             = T;
     using size_type              = typename allocator_traits::size_type;
     using difference_type        = typename allocator_traits::difference_type;
@@ -404,13 +416,20 @@ public:
 
         if (new_cap > capacity())
         {
-            pointer new_first = sfl::dtl::allocate(data_.ref_to_alloc(), new_cap);
+            new_cap = GrowthPolicy::round(new_cap, max_size(), sizeof(value_type));
+
+            if (reallocate_storage(new_cap))
+            {
+                return;
+            }
+
+            pointer new_first = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), new_cap);
             pointer new_last  = new_first;
             pointer new_eos   = new_first + new_cap;
 
             SFL_TRY
             {
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -430,7 +449,7 @@ public:
                 SFL_RETHROW;
             }
 
-            sfl::dtl::destroy_a
+            sfl::dtl::destroy_relocated_a
             (
                 data_.ref_to_alloc(),
                 data_.first_,
@@ -462,7 +481,7 @@ public:
 
             SFL_TRY
             {
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -482,7 +501,7 @@ public:
                 SFL_RETHROW;
             }
 
-            sfl::dtl::destroy_a
+            sfl::dtl::destroy_relocated_a
             (
                 data_.ref_to_alloc(),
                 data_.first_,
@@ -624,27 +643,13 @@ public:
                 // create new element now as a temporary value.
                 value_type tmp(std::forward<Args>(args)...);
 
-                const pointer p2 = data_.last_ - 1;
-
-                const pointer old_last = data_.last_;
-
-                sfl::dtl::construct_at_a
+                sfl::dtl::insert_shift_right_a
                 (
                     data_.ref_to_alloc(),
-                    data_.last_,
-                    std::move(*p2)
-                );
-
-                ++data_.last_;
-
-                sfl::dtl::move_backward
-                (
                     p1,
-                    p2,
-                    old_last
+                    data_.last_,
+                    std::move(tmp)
                 );
-
-                *p1 = std::move(tmp);
             }
 
             return iterator(p1);
@@ -653,92 +658,16 @@ public:
         {
             const difference_type offset = std::distance(cbegin(), pos);
 
-            const size_type new_cap = calculate_new_capacity(1, "sfl::vector::emplace");
-
-            pointer new_first = sfl::dtl::allocate(data_.ref_to_alloc(), new_cap);
-            pointer new_last  = new_first;
-            pointer new_eos   = new_first + new_cap;
-
-            const pointer p = new_first + offset;
-
-            SFL_TRY
-            {
-                sfl::dtl::construct_at_a
+            return iterator
+            (
+                grow_storage_and_emplace
                 (
-                    data_.ref_to_alloc(),
-                    p,
+                    offset,
+                    "sfl::vector::emplace",
+                    sfl::dtl::is_reallocatable_a<allocator_type>(),
                     std::forward<Args>(args)...
-                );
-
-                new_last = nullptr;
-
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
-                (
-                    data_.ref_to_alloc(),
-                    data_.first_,
-                    data_.first_ + offset,
-                    new_first
-                );
-
-                ++new_last;
-
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
-                (
-                    data_.ref_to_alloc(),
-                    data_.first_ + offset,
-                    data_.last_,
-                    new_last
-                );
-            }
-            SFL_CATCH (...)
-            {
-                if (new_last == nullptr)
-                {
-                    sfl::dtl::destroy_at_a
-                    (
-                        data_.ref_to_alloc(),
-                        p
-                    );
-                }
-                else
-                {
-                    sfl::dtl::destroy_a
-                    (
-                        data_.ref_to_alloc(),
-                        new_first,
-                        new_last
-                    );
-                }
-
-                sfl::dtl::deallocate
-                (
-                    data_.ref_to_alloc(),
-                    new_first,
-                    new_cap
-                );
-
-                SFL_RETHROW;
-            }
-
-            sfl::dtl::destroy_a
-            (
-                data_.ref_to_alloc(),
-                data_.first_,
-                data_.last_
-            );
-
-            sfl::dtl::deallocate
-            (
-                data_.ref_to_alloc(),
-                data_.first_,
-                std::distance(data_.first_, data_.eos_)
+                )
             );
-
-            data_.first_ = new_first;
-            data_.last_  = new_last;
-            data_.eos_   = new_eos;
-
-            return iterator(p);
         }
     }
 
@@ -794,79 +723,13 @@ public:
         }
         else
         {
-            const size_type new_cap = calculate_new_capacity(1, "sfl::vector::emplace_back");
-
-            pointer new_first = sfl::dtl::allocate(data_.ref_to_alloc(), new_cap);
-            pointer new_last  = new_first;
-            pointer new_eos   = new_first + new_cap;
-
-            const pointer p = new_first + size();
-
-            SFL_TRY
-            {
-                sfl::dtl::construct_at_a
-                (
-                    data_.ref_to_alloc(),
-                    p,
-                    std::forward<Args>(args)...
-                );
-
-                new_last = nullptr;
-
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
-                (
-                    data_.ref_to_alloc(),
-                    data_.first_,
-                    data_.last_,
-                    new_first
-                );
-
-                ++new_last;
-            }
-            SFL_CATCH (...)
-            {
-                if (new_last == nullptr)
-                {
-                    sfl::dtl::destroy_at_a
-                    (
-                        data_.ref_to_alloc(),
-                        p
-                    );
-                }
-                else
-                {
-                    // Nothing to do
-                }
-
-                sfl::dtl::deallocate
-                (
-                    data_.ref_to_alloc(),
-                    new_first,
-                    new_cap
-                );
-
-                SFL_RETHROW;
-            }
-
-            sfl::dtl::destroy_a
+            return *grow_storage_and_emplace
             (
-                data_.ref_to_alloc(),
-                data_.first_,
-                data_.last_
-            );
-
-            sfl::dtl::deallocate
-            (
-                data_.ref_to_alloc(),
-                data_.first_,
-                std::distance(data_.first_, data_.eos_)
+                size(),
+                "sfl::vector::emplace_back",
+                sfl::dtl::is_reallocatable_a<allocator_type>(),
+                std::forward<Args>(args)...
             );
-
-            data_.first_ = new_first;
-            data_.last_  = new_last;
-            data_.eos_   = new_eos;
-
-            return *p;
         }
     }
 
@@ -895,9 +758,7 @@ public:
 
         const pointer p = data_.first_ + std::distance(cbegin(), pos);
 
-        data_.last_ = sfl::dtl::move(p + 1, data_.last_, p);
-
-        sfl::dtl::destroy_at_a(data_.ref_to_alloc(), data_.last_);
+        data_.last_ = sfl::dtl::erase_shift_left_a(data_.ref_to_alloc(), p, p + 1, data_.last_);
 
         return iterator(p);
     }
@@ -914,11 +775,7 @@ public:
         const pointer p1 = data_.first_ + std::distance(cbegin(), first);
         const pointer p2 = data_.first_ + std::distance(cbegin(), last);
 
-        const pointer new_last = sfl::dtl::move(p2, data_.last_, p1);
-
-        sfl::dtl::destroy_a(data_.ref_to_alloc(), new_last, data_.last_);
-
-        data_.last_ = new_last;
+        data_.last_ = sfl::dtl::erase_shift_left_a(data_.ref_to_alloc(), p1, p2, data_.last_);
 
         return iterator(p1);
     }
@@ -946,7 +803,9 @@ public:
         {
             const size_type delta = n - size;
 
-            if (n > capacity())
+            // If storage is reallocated in place, new elements are
+            // constructed in the else branch.
+            if (n > capacity() && !reallocate_storage(n))
             {
                 pointer new_first = sfl::dtl::allocate(data_.ref_to_alloc(), n);
                 pointer new_last  = new_first;
@@ -965,7 +824,7 @@ public:
 
                     new_last = nullptr;
 
-                    new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                    new_last = sfl::dtl::uninitialized_relocate_a
                     (
                         data_.ref_to_alloc(),
                         data_.first_,
@@ -1006,7 +865,7 @@ public:
                     SFL_RETHROW;
                 }
 
-                sfl::dtl::destroy_a
+                sfl::dtl::destroy_relocated_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -1059,7 +918,10 @@ public:
         {
             const size_type delta = n - size;
 
-            if (n > capacity())
+            // If storage is reallocated in place, new elements are
+            // constructed in the else branch. `value` can be a reference
+            // to an element in this container, which would be invalidated.
+            if (n > capacity() && (is_element(value) || !reallocate_storage(n)))
             {
                 pointer new_first = sfl::dtl::allocate(data_.ref_to_alloc(), n);
                 pointer new_last  = new_first;
@@ -1079,7 +941,7 @@ public:
 
                     new_last = nullptr;
 
-                    new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                    new_last = sfl::dtl::uninitialized_relocate_a
                     (
                         data_.ref_to_alloc(),
                         data_.first_,
@@ -1120,7 +982,7 @@ public:
                     SFL_RETHROW;
                 }
 
-                sfl::dtl::destroy_a
+                sfl::dtl::destroy_relocated_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -1194,25 +1056,207 @@ private:
     size_type calculate_new_capacity(size_type num_additional_elements, const char* msg)
     {
         const size_type size = this->size();
-        const size_type capacity = this->capacity();
         const size_type max_size = this->max_size();
 
         if (max_size - size < num_additional_elements)
         {
             sfl::dtl::throw_length_error(msg);
         }
-        else if (max_size - capacity < capacity / 2)
+
+        const size_type min_cap = size + num_additional_elements;
+
+        const size_type new_cap = GrowthPolicy::grow
+        (
+            capacity(),
+            min_cap,
+            max_size,
+            sizeof(value_type)
+        );
+
+        SFL_ASSERT(min_cap <= new_cap && new_cap <= max_size);
+
+        return new_cap;
+    }
+
+    // Grows storage and constructs new element at position `offset`.
+    // Returns pointer to new element.
+    template <typename... Args>
+    pointer grow_storage_and_emplace(difference_type offset, const char* msg, std::false_type, Args&&... args)
+    {
+        size_type new_cap = calculate_new_capacity(1, msg);
+
+        pointer new_first = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), new_cap);
+        pointer new_last  = new_first;
+        pointer new_eos   = new_first + new_cap;
+
+        const pointer p = new_first + offset;
+
+        SFL_TRY
         {
-            return max_size;
+            sfl::dtl::construct_at_a
+            (
+                data_.ref_to_alloc(),
+                p,
+                std::forward<Args>(args)...
+            );
+
+            new_last = nullptr;
+
+            new_last = sfl::dtl::uninitialized_relocate_a
+            (
+                data_.ref_to_alloc(),
+                data_.first_,
+                data_.first_ + offset,
+                new_first
+            );
+
+            ++new_last;
+
+            new_last = sfl::dtl::uninitialized_relocate_a
+            (
+                data_.ref_to_alloc(),
+                data_.first_ + offset,
+                data_.last_,
+                new_last
+            );
         }
-        else if (size + num_additional_elements < capacity + capacity / 2)
+        SFL_CATCH (...)
         {
-            return capacity + capacity / 2;
+            if (new_last == nullptr)
+            {
+                sfl::dtl::destroy_at_a
+                (
+                    data_.ref_to_alloc(),
+                    p
+                );
+            }
+            else
+            {
+                sfl::dtl::destroy_a
+                (
+                    data_.ref_to_alloc(),
+                    new_first,
+                    new_last
+                );
+            }
+
+            sfl::dtl::deallocate
+            (
+                data_.ref_to_alloc(),
+                new_first,
+                new_cap
+            );
+
+            SFL_RETHROW;
         }
-        else
+
+        sfl::dtl::destroy_relocated_a
+        (
+            data_.ref_to_alloc(),
+            data_.first_,
+            data_.last_
+        );
+
+        sfl::dtl::deallocate
+        (
+            data_.ref_to_alloc(),
+            data_.first_,
+            std::distance(data_.first_, data_.eos_)
+        );
+
+        data_.first_ = new_first;
+        data_.last_  = new_last;
+        data_.eos_   = new_eos;
+
+        return p;
+    }
+
+    template <typename... Args>
+    pointer grow_storage_and_emplace(difference_type offset, const char* msg, std::true_type, Args&&... args)
+    {
+        const size_type new_cap = calculate_new_capacity(1, msg);
+
+        // `args...` can contain reference to element in this container, so
+        // we will construct new element in temporary storage first, then
+        // reallocate storage, and then relocate new element into place.
+
+        alignas(value_type) unsigned char buffer[sizeof(value_type)];
+
+        const pointer tmp = reinterpret_cast<pointer>(buffer);
+
+        sfl::dtl::construct_at_a
+        (
+            data_.ref_to_alloc(),
+            tmp,
+            std::forward<Args>(args)...
+        );
+
+        SFL_TRY
         {
-            return size + num_additional_elements;
+            reallocate_storage(new_cap);
+        }
+        SFL_CATCH (...)
+        {
+            sfl::dtl::destroy_at_a
+            (
+                data_.ref_to_alloc(),
+                tmp
+            );
+
+            SFL_RETHROW;
         }
+
+        const pointer p = data_.first_ + offset;
+
+        data_.last_ = sfl::dtl::relocate_bytes(p, data_.last_, p + 1);
+
+        sfl::dtl::relocate_bytes(tmp, tmp + 1, p);
+
+        return p;
+    }
+
+    // Changes capacity to `new_cap` using member function `reallocate` of
+    // the allocator (e.g. `realloc`), which does not need to copy elements.
+    // Returns false and does nothing if elements are not trivially
+    // relocatable or the allocator does not have `reallocate`.
+    bool reallocate_storage(size_type new_cap)
+    {
+        return reallocate_storage(new_cap, sfl::dtl::is_reallocatable_a<allocator_type>());
+    }
+
+    bool reallocate_storage(size_type /*new_cap*/, std::false_type)
+    {
+        return false;
+    }
+
+    bool reallocate_storage(size_type new_cap, std::true_type)
+    {
+        const size_type size = this->size();
+
+        const pointer new_first = sfl::dtl::reallocate
+        (
+            data_.ref_to_alloc(),
+            data_.first_,
+            capacity(),
+            new_cap
+        );
+
+        data_.first_ = new_first;
+        data_.last_  = new_first + size;
+        data_.eos_   = new_first + new_cap;
+
+        return true;
+    }
+
+    // Checks if `x` refers to an element of this container.
+    bool is_element(const value_type& x) const noexcept
+    {
+        const std::less<const value_type*> less;
+
+        const value_type* p = std::addressof(x);
+
+        return !less(p, sfl::dtl::to_address(data_.first_)) &&
+               less(p, sfl::dtl::to_address(data_.last_));
     }
 
     void reset(size_type new_cap = 0)
@@ -1710,9 +1754,16 @@ private:
         {
             const difference_type offset = std::distance(cbegin(), pos);
 
-            const size_type new_cap = calculate_new_capacity(n, "sfl::vector::insert_fill_n");
+            size_type new_cap = calculate_new_capacity(n, "sfl::vector::insert_fill_n");
 
-            pointer new_first = sfl::dtl::allocate(data_.ref_to_alloc(), new_cap);
+            // `value` can be a reference to an element in this container,
+            // which would be invalidated by `reallocate_storage`.
+            if (!is_element(value) && reallocate_storage(new_cap))
+            {
+                return insert_fill_n(nth(offset), n, value);
+            }
+
+            pointer new_first = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), new_cap);
             pointer new_last  = new_first;
             pointer new_eos   = new_first + new_cap;
 
@@ -1734,7 +1785,7 @@ private:
 
                 new_last = nullptr;
 
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -1744,7 +1795,7 @@ private:
 
                 new_last += n;
 
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_ + offset,
@@ -1783,7 +1834,7 @@ private:
                 SFL_RETHROW;
             }
 
-            sfl::dtl::destroy_a
+            sfl::dtl::destroy_relocated_a
             (
                 data_.ref_to_alloc(),
                 data_.first_,
@@ -1901,9 +1952,14 @@ private:
         {
             const difference_type offset = std::distance(cbegin(), pos);
 
-            const size_type new_cap = calculate_new_capacity(n, "sfl::vector::insert_range");
+            size_type new_cap = calculate_new_capacity(n, "sfl::vector::insert_range");
 
-            pointer new_first = sfl::dtl::allocate(data_.ref_to_alloc(), new_cap);
+            if (reallocate_storage(new_cap))
+            {
+                return insert_range(nth(offset), first, last);
+            }
+
+            pointer new_first = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), new_cap);
             pointer new_last  = new_first;
             pointer new_eos   = new_first + new_cap;
 
@@ -1911,23 +1967,30 @@ private:
 
             SFL_TRY
             {
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                // New elements are created first so that existing elements
+                // can be relocated after that without further exceptions.
+
+                sfl::dtl::uninitialized_copy_a
                 (
                     data_.ref_to_alloc(),
-                    data_.first_,
-                    data_.first_ + offset,
-                    new_first
+                    first,
+                    last,
+                    p
                 );
 
-                new_last = sfl::dtl::uninitialized_copy_a
+                new_last = nullptr;
+
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
-                    first,
-                    last,
-                    new_last
+                    data_.first_,
+                    data_.first_ + offset,
+                    new_first
                 );
 
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last += n;
+
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_ + offset,
@@ -1937,12 +2000,24 @@ private:
             }
             SFL_CATCH (...)
             {
-                sfl::dtl::destroy_a
-                (
-                    data_.ref_to_alloc(),
-                    new_first,
-                    new_last
-                );
+                if (new_last == nullptr)
+                {
+                    sfl::dtl::destroy_n_a
+                    (
+                        data_.ref_to_alloc(),
+                        p,
+                        n
+                    );
+                }
+                else
+                {
+                    sfl::dtl::destroy_a
+                    (
+                        data_.ref_to_alloc(),
+                        new_first,
+                        new_last
+                    );
+                }
 
                 sfl::dtl::deallocate
                 (
@@ -1954,7 +2029,7 @@ private:
                 SFL_RETHROW;
             }
 
-            sfl::dtl::destroy_a
+            sfl::dtl::destroy_relocated_a
             (
                 data_.ref_to_alloc(),
                 data_.first_,
@@ -1977,89 +2052,131 @@ private:
     }
 };
 
+namespace dtl
+{
+
+// Gives other containers direct access to the storage of `sfl::vector`,
+// so they can hand over a buffer without moving elements. The buffer must
+// be allocated by an allocator that compares equal to the allocator of
+// the vector.
+struct vector_access
+{
+    // Makes the vector own buffer [first, eos) with elements in range
+    // [first, last). The vector must not own any buffer.
+    template <typename T, typename A, typename G>
+    static void adopt(sfl::vector<T, A, G>& v,
+                      typename sfl::vector<T, A, G>::pointer first,
+                      typename sfl::vector<T, A, G>::pointer last,
+                      typename sfl::vector<T, A, G>::pointer eos) noexcept
+    {
+        SFL_ASSERT(v.data_.first_ == nullptr);
+        v.data_.first_ = first;
+        v.data_.last_  = last;
+        v.data_.eos_   = eos;
+    }
+
+    // Takes the buffer owned by the vector. The vector becomes empty and
+    // does not own any buffer.
+    template <typename T, typename A, typename G>
+    static void release(sfl::vector<T, A, G>& v,
+                        typename sfl::vector<T, A, G>::pointer& first,
+                        typename sfl::vector<T, A, G>::pointer& last,
+                        typename sfl::vector<T, A, G>::pointer& eos) noexcept
+    {
+        first = v.data_.first_;
+        last  = v.data_.last_;
+        eos   = v.data_.eos_;
+        v.data_.first_ = nullptr;
+        v.data_.last_  = nullptr;
+        v.data_.eos_   = nullptr;
+    }
+};
+
+} // namespace dtl
+
 //
 // ---- NON-MEMBER FUNCTIONS --------------------------------------------------
 //
 
-template <typename T, typename A>
+template <typename T, typename A, typename G>
 SFL_NODISCARD
 bool operator==
 (
-    const vector<T, A>& x,
-    const vector<T, A>& y
+    const vector<T, A, G>& x,
+    const vector<T, A, G>& y
 )
 {
     return x.size() == y.size() && std::equal(x.begin(), x.end(), y.begin());
 }
 
-template <typename T, typename A>
+template <typename T, typename A, typename G>
 SFL_NODISCARD
 bool operator!=
 (
-    const vector<T, A>& x,
-    const vector<T, A>& y
+    const vector<T, A, G>& x,
+    const vector<T, A, G>& y
 )
 {
     return !(x == y);
 }
 
-template <typename T, typename A>
+template <typename T, typename A, typename G>
 SFL_NODISCARD
 bool operator<
 (
-    const vector<T, A>& x,
-    const vector<T, A>& y
+    const vector<T, A, G>& x,
+    const vector<T, A, G>& y
 )
 {
     return std::lexicographical_compare(x.begin(), x.end(), y.begin(), y.end());
 }
 
-template <typename T, typename A>
+template <typename T, typename A, typename G>
 SFL_NODISCARD
 bool operator>
 (
-    const vector<T, A>& x,
-    const vector<T, A>& y
+    const vector<T, A, G>& x,
+    const vector<T, A, G>& y
 )
 {
     return y < x;
 }
 
-template <typename T, typename A>
+template <typename T, typename A, typename G>
 SFL_NODISCARD
 bool operator<=
 (
-    const vector<T, A>& x,
-    const vector<T, A>& y
+    const vector<T, A, G>& x,
+    const vector<T, A, G>& y
 )
 {
     return !(y < x);
 }
 
-template <typename T, typename A>
+template <typename T, typename A, typename G>
 SFL_NODISCARD
 bool operator>=
 (
-    const vector<T, A>& x,
-    const vector<T, A>& y
+    const vector<T, A, G>& x,
+    const vector<T, A, G>& y
 )
 {
     return !(x < y);
 }
 
-template <typename T, typename A>
+template <typename T, typename A, typename G>
 void swap
 (
-    vector<T, A>& x,
-    vector<T, A>& y
+    vector<T, A, G>& x,
+    vector<T, A, G>& y
 )
 {
     x.swap(y);
 }
 
-template <typename T, typename A, typename U>
-typename vector<T, A>::size_type
-    erase(vector<T, A>& c, const U& value)
+template <typename T, typename A, typename G, typename U>
+typename vector<T, A, G>::size_type
+    erase(vector<T, A, G>& c, const U& value)
 {
     auto it = std::remove(c.begin(), c.end(), value);
     auto r = std::distance(it, c.end());
@@ -2067,9 +2184,9 @@ typename vector<T, A>::size_type
     return r;
 }
 
-template <typename T, typename A, typename Predicate>
-typename vector<T, A>::size_type
-    erase_if(vector<T, A>& c, Predicate pred)
+template <typename T, typename A, typename G, typename Predicate>
+typename vector<T, A, G>::size_type
+    erase_if(vector<T, A, G>& c, Predicate pred)
 {
     auto it = std::remove_if(c.begin(), c.end(), pred);
     auto r = std::distance(it, c.end());
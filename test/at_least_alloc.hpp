@@ -0,0 +1,142 @@
+#ifndef SFL_TEST_AT_LEAST_ALLOC_HPP
+#define SFL_TEST_AT_LEAST_ALLOC_HPP
+
+#include "sfl/private.hpp"
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+namespace sfl
+{
+namespace test
+{
+
+//
+// Allocator with member function `allocate_at_least` (C++23). It rounds
+// the number of elements up to the multiple of 8.
+//
+template <typename T>
+class at_least_alloc
+{
+public:
+
+    using value_type = T;
+    using size_type  = std::size_t;
+
+    template <typename U>
+    struct rebind
+    {
+        using other = at_least_alloc<U>;
+    };
+
+    struct allocation_result
+    {
+        T*        ptr;
+        size_type count;
+    };
+
+    static int allocations;
+
+    at_least_alloc() noexcept
+    {}
+
+    template <typename U>
+    at_least_alloc(const at_least_alloc<U>& /*other*/) noexcept
+    {}
+
+    allocation_result allocate_at_least(size_type n)
+    {
+        const size_type count = (n + 7) / 8 * 8;
+        ++allocations;
+        return {static_cast<T*>(::operator new(count * sizeof(T))), count};
+    }
+
+    T* allocate(size_type n)
+    {
+        ++allocations;
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+
+    void deallocate(T* p, size_type /*n*/) noexcept
+    {
+        ::operator delete(p);
+    }
+
+    friend bool operator==(const at_least_alloc&, const at_least_alloc&) noexcept
+    {
+        return true;
+    }
+
+    friend bool operator!=(const at_least_alloc&, const at_least_alloc&) noexcept
+    {
+        return false;
+    }
+};
+
+template <typename T>
+int at_least_alloc<T>::allocations = 0;
+
+//
+// Allocator without member function `allocate_at_least`. It always
+// allocates memory for 4 more elements than requested and reports that
+// through `sfl::allocator_usable_size`.
+//
+template <typename T>
+class usable_size_alloc
+{
+public:
+
+    using value_type = T;
+    using size_type  = std::size_t;
+
+    template <typename U>
+    struct rebind
+    {
+        using other = usable_size_alloc<U>;
+    };
+
+    usable_size_alloc() noexcept
+    {}
+
+    template <typename U>
+    usable_size_alloc(const usable_size_alloc<U>& /*other*/) noexcept
+    {}
+
+    T* allocate(size_type n)
+    {
+        return static_cast<T*>(::operator new((n + 4) * sizeof(T)));
+    }
+
+    void deallocate(T* p, size_type /*n*/) noexcept
+    {
+        ::operator delete(p);
+    }
+
+    friend bool operator==(const usable_size_alloc&, const usable_size_alloc&) noexcept
+    {
+        return true;
+    }
+
+    friend bool operator!=(const usable_size_alloc&, const usable_size_alloc&) noexcept
+    {
+        return false;
+    }
+};
+
+} // namespace test
+
+template <typename T>
+struct allocator_usable_size<sfl::test::usable_size_alloc<T>>
+{
+    static std::size_t usable_size(const sfl::test::usable_size_alloc<T>& /*a*/,
+                                   T* /*p*/,
+                                   std::size_t n) noexcept
+    {
+        return n + 4;
+    }
+};
+
+} // namespace sfl
+
+#endif // SFL_TEST_AT_LEAST_ALLOC_HPP
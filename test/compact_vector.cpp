@@ -12,6 +12,7 @@
 
 #include "xint.hpp"
 
+#include "counting_realloc_alloc.hpp"
 #include "statefull_alloc.hpp"
 #include "stateless_alloc.hpp"
 #include "stateless_alloc_no_prop.hpp"
@@ -64,6 +65,80 @@ void test_compact_vector_5()
     #include "compact_vector.inc"
 }
 
+void test_compact_vector_realloc_allocator()
+{
+    using sfl::test::counting_realloc_alloc;
+    using sfl::test::xint;
+
+    PRINT("Test compact_vector with realloc_allocator");
+    {
+        sfl::compact_vector<int, counting_realloc_alloc<int>> vec;
+
+        counting_realloc_alloc<int>::reset_counters();
+
+        for (int i = 0; i < 100; ++i)
+        {
+            vec.push_back(i);
+        }
+
+        CHECK(counting_realloc_alloc<int>::allocations == 1);
+        CHECK(counting_realloc_alloc<int>::reallocations == 99);
+
+        vec.resize(200);
+        vec.resize(300, 7);
+        vec.insert(vec.begin() + 1, 2, -1);
+        vec.emplace(vec.begin(), 42);
+
+        CHECK(counting_realloc_alloc<int>::allocations == 1);
+        CHECK(counting_realloc_alloc<int>::reallocations == 103);
+
+        // Value is an element of this container.
+        vec.insert(vec.begin(), 3, vec[1]);
+        vec.resize(310, vec[0]);
+
+        CHECK(counting_realloc_alloc<int>::allocations == 3);
+
+        vec.emplace(vec.begin(), vec[1]);
+
+        CHECK(vec.size() == 311);
+        CHECK(vec.capacity() == 311);
+        CHECK(vec[0] == 0);
+        CHECK(vec[3] == 0);
+        CHECK(vec[4] == 42);
+        CHECK(vec[5] == 0);
+        CHECK(vec[6] == -1);
+        CHECK(vec[7] == -1);
+        CHECK(vec[8] == 1);
+        CHECK(vec[106] == 99);
+        CHECK(vec[107] == 0);
+        CHECK(vec[206] == 0);
+        CHECK(vec[207] == 7);
+        CHECK(vec[300] == 7);
+        CHECK(vec[306] == 7);
+        CHECK(vec[307] == 0);
+        CHECK(vec[310] == 0);
+    }
+
+    PRINT("Test compact_vector with realloc_allocator and value type that is not trivially relocatable");
+    {
+        sfl::compact_vector<xint, counting_realloc_alloc<xint>> vec;
+
+        counting_realloc_alloc<xint>::reset_counters();
+
+        for (int i = 0; i < 100; ++i)
+        {
+            vec.emplace_back(i);
+        }
+
+        CHECK(counting_realloc_alloc<xint>::reallocations == 0);
+
+        for (int i = 0; i < 100; ++i)
+        {
+            CHECK(vec[i] == i);
+        }
+    }
+}
+
 int main()
 {
     test_compact_vector_1();
@@ -71,4 +146,5 @@ int main()
     test_compact_vector_3();
     test_compact_vector_4();
     test_compact_vector_5();
+    test_compact_vector_realloc_allocator();
 }
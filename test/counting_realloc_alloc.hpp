@@ -0,0 +1,68 @@
+#ifndef SFL_TEST_COUNTING_REALLOC_ALLOC_HPP
+#define SFL_TEST_COUNTING_REALLOC_ALLOC_HPP
+
+#include "sfl/realloc_allocator.hpp"
+
+#include <cstddef>
+
+namespace sfl
+{
+namespace test
+{
+
+//
+// sfl::realloc_allocator that counts calls of `allocate` and `reallocate`.
+//
+template <typename T>
+class counting_realloc_alloc : public sfl::realloc_allocator<T>
+{
+public:
+
+    using size_type = std::size_t;
+
+    template <typename U>
+    struct rebind
+    {
+        using other = counting_realloc_alloc<U>;
+    };
+
+    static int allocations;
+
+    static int reallocations;
+
+    counting_realloc_alloc() noexcept
+    {}
+
+    template <typename U>
+    counting_realloc_alloc(const counting_realloc_alloc<U>& /*other*/) noexcept
+    {}
+
+    T* allocate(size_type n)
+    {
+        ++allocations;
+        return sfl::realloc_allocator<T>::allocate(n);
+    }
+
+    T* reallocate(T* p, size_type old_n, size_type new_n)
+    {
+        ++reallocations;
+        return sfl::realloc_allocator<T>::reallocate(p, old_n, new_n);
+    }
+
+    static void reset_counters()
+    {
+        allocations = 0;
+        reallocations = 0;
+    }
+};
+
+template <typename T>
+int counting_realloc_alloc<T>::allocations = 0;
+
+template <typename T>
+int counting_realloc_alloc<T>::reallocations = 0;
+
+} // namespace test
+} // namespace sfl
+
+#endif // SFL_TEST_COUNTING_REALLOC_ALLOC_HPP
@@ -0,0 +1,29 @@
+#ifndef SFL_TEST_DECADE_HPP
+#define SFL_TEST_DECADE_HPP
+
+namespace sfl
+{
+namespace test
+{
+
+// Compares with int by tens only, so with std::less<> several unique ints
+// can be equivalent to one decade.
+struct decade
+{
+    int value;
+};
+
+inline bool operator<(int a, decade b)
+{
+    return a / 10 < b.value;
+}
+
+inline bool operator<(decade a, int b)
+{
+    return a.value < b / 10;
+}
+
+} // namespace test
+} // namespace sfl
+
+#endif // SFL_TEST_DECADE_HPP
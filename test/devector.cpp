@@ -11,8 +11,10 @@
 #include "check.hpp"
 #include "print.hpp"
 
+#include "xhandle.hpp"
 #include "xint.hpp"
 
+#include "at_least_alloc.hpp"
 #include "statefull_alloc.hpp"
 #include "stateless_alloc.hpp"
 #include "stateless_alloc_no_prop.hpp"
@@ -61,6 +63,182 @@ void test_devector<5>()
     #include "devector.inc"
 }
 
+void test_devector_relocation()
+{
+    using sfl::test::xhandle;
+
+    PRINT("Test trivially relocatable value type");
+    {
+        sfl::devector<xhandle> vec;
+
+        std::vector<int> expected;
+
+        xhandle::moves = 0;
+
+        int num_reallocations = 0;
+
+        for (int i = 0; i < 100; ++i)
+        {
+            const auto old_capacity = vec.capacity();
+
+            vec.emplace_back(i);
+            expected.push_back(i);
+
+            if (vec.capacity() != old_capacity)
+            {
+                ++num_reallocations;
+            }
+        }
+
+        // Growth relocates elements without calling move constructor. Only
+        // the new element is moved from a temporary value on reallocation.
+        CHECK(xhandle::moves == num_reallocations);
+
+        xhandle::moves = 0;
+
+        vec.erase(vec.begin() + 10);
+        expected.erase(expected.begin() + 10);
+
+        vec.erase(vec.begin() + 80);
+        expected.erase(expected.begin() + 80);
+
+        vec.erase(vec.begin() + 20, vec.begin() + 30);
+        expected.erase(expected.begin() + 20, expected.begin() + 30);
+
+        vec.erase(vec.begin() + 70, vec.begin() + 75);
+        expected.erase(expected.begin() + 70, expected.begin() + 75);
+
+        CHECK(xhandle::moves == 0);
+
+        vec.shrink_to_fit();
+
+        CHECK(xhandle::moves == 0);
+
+        vec.emplace(vec.begin() + 5, 1000);
+        expected.insert(expected.begin() + 5, 1000);
+
+        CHECK(vec.size() == expected.size());
+
+        for (std::size_t i = 0; i < expected.size(); ++i)
+        {
+            CHECK(vec[i].value() == expected[i]);
+        }
+    }
+
+    PRINT("Test trivially relocatable value type with allocator that has construct and destroy");
+    {
+        sfl::devector<xhandle, sfl::test::statefull_alloc<xhandle>> vec;
+
+        xhandle::moves = 0;
+
+        for (int i = 0; i < 100; ++i)
+        {
+            vec.emplace_back(i);
+        }
+
+        vec.erase(vec.begin() + 10);
+
+        // Elements are moved one by one.
+        CHECK(xhandle::moves > 0);
+
+        CHECK(vec.size() == 99);
+
+        for (int i = 0; i < 99; ++i)
+        {
+            CHECK(vec[i].value() == (i < 10 ? i : i + 1));
+        }
+    }
+}
+
+void test_devector_growth_policy()
+{
+    PRINT("Test devector with growth policy");
+    {
+        sfl::devector<int, std::allocator<int>, sfl::geometric_growth<2, 1>> vec;
+
+        vec.push_back(1);
+
+        for (int i = 0; i < 50; ++i)
+        {
+            const auto old_capacity_back = vec.size() + vec.available_back();
+
+            vec.push_back(i);
+
+            const auto new_capacity_back = vec.size() + vec.available_back();
+
+            if (new_capacity_back != old_capacity_back)
+            {
+                CHECK(new_capacity_back == 2 * old_capacity_back);
+            }
+        }
+
+        for (int i = 0; i < 50; ++i)
+        {
+            const auto old_capacity_front = vec.size() + vec.available_front();
+
+            vec.push_front(i);
+
+            const auto new_capacity_front = vec.size() + vec.available_front();
+
+            if (new_capacity_front != old_capacity_front)
+            {
+                CHECK(new_capacity_front == 2 * old_capacity_front);
+            }
+        }
+
+        CHECK(vec.size() == 101);
+    }
+
+    PRINT("Test devector with rounding growth policy");
+    {
+        sfl::devector<int, std::allocator<int>, sfl::page_rounded_growth<>> vec;
+
+        vec.reserve_back(1500);
+        CHECK(vec.available_back() == 2048);
+
+        vec.reserve_front(3000);
+        CHECK(vec.available_front() == 3072);
+    }
+}
+
+void test_devector_allocate_at_least()
+{
+    PRINT("Test devector with allocator that has allocate_at_least");
+    {
+        sfl::devector<int, sfl::test::at_least_alloc<int>> vec;
+
+        vec.push_back(0);
+        CHECK(vec.capacity() == 8);
+        CHECK(vec.available_back() == 7);
+
+        vec.reserve_front(10);
+        CHECK(vec.available_front() == 16);
+        CHECK(vec.available_back() == 7);
+
+        for (int i = 1; i < 50; ++i)
+        {
+            vec.push_front(-i);
+            vec.push_back(i);
+            CHECK(vec.capacity() % 8 == 0);
+        }
+
+        CHECK(vec.size() == 99);
+
+        for (int i = 0; i < 99; ++i)
+        {
+            CHECK(vec[i] == i - 49);
+        }
+    }
+
+    PRINT("Test devector with specialization of allocator_usable_size");
+    {
+        sfl::devector<int, sfl::test::usable_size_alloc<int>> vec;
+
+        vec.reserve_back(10);
+        CHECK(vec.available_back() == 14);
+    }
+}
+
 int main()
 {
     test_devector<1>();
@@ -68,4 +246,7 @@ int main()
     test_devector<3>();
     test_devector<4>();
     test_devector<5>();
+    test_devector_relocation();
+    test_devector_growth_policy();
+    test_devector_allocate_at_least();
 }
@@ -0,0 +1,256 @@
+//
+// g++ -std=c++11 -g -O0 -Wall -Wextra -Wpedantic -Werror -Wfatal-errors -I ../include frozen_unordered_map.cpp
+// valgrind --leak-check=full ./a.out
+//
+
+#undef NDEBUG // This is very important. Must be in the first line.
+
+#define SFL_TEST_FROZEN_UNORDERED_MAP
+#include "sfl/frozen_unordered_map.hpp"
+#include "sfl/static_flat_map.hpp"
+#include "sfl/static_unordered_flat_map.hpp"
+
+#include "check.hpp"
+#include "print.hpp"
+
+#include "xint.hpp"
+#include "xobj.hpp"
+
+#include <map>
+#include <string>
+#include <vector>
+
+#if __cplusplus >= 201703L
+#include <string_view>
+#endif
+
+void test_frozen_unordered_map()
+{
+    using sfl::test::xint;
+    using sfl::test::xobj;
+
+    PRINT("Test frozen_unordered_map()");
+    {
+        sfl::frozen_unordered_map<xint, xint, 5> map;
+
+        CHECK(map.empty() == true);
+        CHECK(map.size() == 0);
+        CHECK(map.capacity() == 5);
+        CHECK(map.perfect() == true);
+        CHECK(map.find(10) == map.end());
+        CHECK(map.contains(10) == false);
+    }
+
+    PRINT("Test frozen_unordered_map(InputIt, InputIt)");
+    {
+        // Random keys with duplicates. The first occurrence of a key wins.
+        for (int n = 0; n <= 100; ++n)
+        {
+            std::vector<std::pair<xint, xint>> values;
+            std::map<int, int> reference;
+
+            unsigned state = unsigned(n) + 1;
+
+            for (int i = 0; i < n; ++i)
+            {
+                state = state * 1103515245u + 12345u;
+                const int key = int((state >> 16) % 150);
+                values.emplace_back(key, i);
+                reference.emplace(key, i);
+            }
+
+            sfl::frozen_unordered_map<xint, xint, 100> map(values.begin(), values.end());
+
+            CHECK(map.perfect() == true);
+            CHECK(map.size() == reference.size());
+
+            for (int key = -1; key <= 151; ++key)
+            {
+                const auto it = map.find(key);
+                const auto ref = reference.find(key);
+
+                if (ref == reference.end())
+                {
+                    CHECK(it == map.end());
+                    CHECK(map.count(key) == 0);
+                    CHECK(map.contains(key) == false);
+                }
+                else
+                {
+                    CHECK(it != map.end());
+                    CHECK(it->first == ref->first);
+                    CHECK(it->second == ref->second);
+                    CHECK(map.count(key) == 1);
+                    CHECK(map.contains(key) == true);
+                    CHECK(map.at(key) == ref->second);
+                }
+            }
+        }
+    }
+
+    PRINT("Test frozen_unordered_map(InputIt, InputIt) from other containers");
+    {
+        sfl::static_unordered_flat_map<std::string, int, 5> umap
+        (
+            {{"one", 1}, {"two", 2}, {"three", 3}, {"four", 4}}
+        );
+
+        sfl::static_flat_map<std::string, int, 5> fmap
+        (
+            {{"one", 1}, {"two", 2}, {"three", 3}, {"four", 4}}
+        );
+
+        sfl::frozen_unordered_map<std::string, int, 5> map1(umap.begin(), umap.end());
+        sfl::frozen_unordered_map<std::string, int, 5> map2(fmap.begin(), fmap.end());
+
+        CHECK(map1.perfect() == true);
+        CHECK(map1.size() == 4);
+        CHECK(map1.at("one") == 1);
+        CHECK(map1.at("two") == 2);
+        CHECK(map1.at("three") == 3);
+        CHECK(map1.at("four") == 4);
+        CHECK(map1.contains("five") == false);
+
+        CHECK(map1 == map2);
+        CHECK(!(map1 != map2));
+    }
+
+    PRINT("Test frozen_unordered_map(std::initializer_list)");
+    {
+        sfl::frozen_unordered_map<xint, xint, 5> map({{10, 1}, {20, 2}, {10, 3}, {30, 3}});
+
+        CHECK(map.perfect() == true);
+        CHECK(map.size() == 3);
+        CHECK(map.at(10) == 1);
+        CHECK(map.at(20) == 2);
+        CHECK(map.at(30) == 3);
+
+        map.find(20)->second = 22;
+        CHECK(map.at(20) == 22);
+
+        #if !defined(SFL_NO_EXCEPTIONS)
+        bool caught = false;
+
+        try
+        {
+            (void)map.at(40);
+        }
+        catch (const std::out_of_range&)
+        {
+            caught = true;
+        }
+
+        CHECK(caught == true);
+        #endif
+    }
+
+    PRINT("Test hash collisions");
+    {
+        struct bad_hash
+        {
+            std::size_t operator()(const xint&) const
+            {
+                return 42;
+            }
+        };
+
+        // Different keys with the same hash. The map falls back to
+        // linear search.
+        sfl::frozen_unordered_map<xint, xint, 5, bad_hash> map({{10, 1}, {20, 2}, {10, 3}});
+
+        CHECK(map.perfect() == false);
+        CHECK(map.size() == 2);
+        CHECK(map.at(10) == 1);
+        CHECK(map.at(20) == 2);
+        CHECK(map.find(30) == map.end());
+    }
+
+    PRINT("Test heterogeneous lookup");
+    {
+        sfl::frozen_unordered_map<xobj, xint, 5, xobj::hash, xobj::equal> map;
+
+        {
+            std::vector<std::pair<xobj, xint>> values;
+            values.emplace_back(xobj(10), 1);
+            values.emplace_back(xobj(20), 2);
+            values.emplace_back(xobj(30), 3);
+
+            map = sfl::frozen_unordered_map<xobj, xint, 5, xobj::hash, xobj::equal>(values.begin(), values.end());
+        }
+
+        CHECK(map.perfect() == true);
+        CHECK(map.size() == 3);
+        CHECK(map.find(20) != map.end());
+        CHECK(map.find(20)->second == 2);
+        CHECK(map.count(30) == 1);
+        CHECK(map.contains(40) == false);
+        CHECK(map.at(10) == 1);
+    }
+
+    PRINT("Test copy and move");
+    {
+        sfl::frozen_unordered_map<xint, xint, 5> map1({{10, 1}, {20, 2}, {30, 3}});
+
+        sfl::frozen_unordered_map<xint, xint, 5> map2(map1);
+
+        CHECK(map2.perfect() == true);
+        CHECK(map2.size() == 3);
+        CHECK(map2.at(10) == 1);
+        CHECK(map2.at(20) == 2);
+        CHECK(map2.at(30) == 3);
+
+        sfl::frozen_unordered_map<xint, xint, 5> map3(std::move(map2));
+
+        CHECK(map3.size() == 3);
+        CHECK(map3.at(30) == 3);
+
+        sfl::frozen_unordered_map<xint, xint, 5> map4({{40, 4}});
+
+        map4 = map1;
+
+        CHECK(map4.perfect() == true);
+        CHECK(map4.size() == 3);
+        CHECK(map4.at(20) == 2);
+        CHECK(map4.contains(40) == false);
+
+        map4 = sfl::frozen_unordered_map<xint, xint, 5>({{50, 5}});
+
+        CHECK(map4.size() == 1);
+        CHECK(map4.at(50) == 5);
+        CHECK(map4.contains(20) == false);
+    }
+
+    PRINT("Test frozen_hash");
+    {
+        CHECK(sfl::frozen_hash<int>()(42) == 42);
+        CHECK(sfl::frozen_hash<std::string>()("abc") == sfl::frozen_hash<std::string>()("abc"));
+        CHECK(sfl::frozen_hash<std::string>()("abc") != sfl::frozen_hash<std::string>()("abd"));
+        CHECK(sfl::frozen_hash<xint>()(42) == std::hash<xint>()(42));
+    }
+
+    PRINT("Test constexpr (C++20)");
+    #if __cplusplus >= 202002L
+    {
+        using namespace std::literals;
+
+        static constexpr sfl::frozen_unordered_map<std::string_view, int, 4> map
+        {
+            {"red"sv, 1}, {"green"sv, 2}, {"blue"sv, 3}, {"red"sv, 4}
+        };
+
+        static_assert(map.perfect());
+        static_assert(map.size() == 3);
+        static_assert(map.at("red"sv) == 1);
+        static_assert(map.at("green"sv) == 2);
+        static_assert(map.at("blue"sv) == 3);
+        static_assert(!map.contains("pink"sv));
+
+        CHECK(map.at("green"sv) == 2);
+    }
+    #endif
+}
+
+int main()
+{
+    test_frozen_unordered_map();
+}
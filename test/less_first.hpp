@@ -0,0 +1,36 @@
+#ifndef SFL_TEST_LESS_FIRST_HPP
+#define SFL_TEST_LESS_FIRST_HPP
+
+#include <utility>
+
+namespace sfl
+{
+namespace test
+{
+
+// Orders pairs lexicographically. Transparent overloads compare only the
+// first member, so several unique pairs can be equivalent to one int.
+struct less_first
+{
+    using is_transparent = void;
+
+    bool operator()(const std::pair<int, int>& a, const std::pair<int, int>& b) const
+    {
+        return a < b;
+    }
+
+    bool operator()(const std::pair<int, int>& a, int b) const
+    {
+        return a.first < b;
+    }
+
+    bool operator()(int a, const std::pair<int, int>& b) const
+    {
+        return a < b.first;
+    }
+};
+
+} // namespace test
+} // namespace sfl
+
+#endif // SFL_TEST_LESS_FIRST_HPP
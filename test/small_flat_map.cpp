@@ -18,7 +18,12 @@
 #include "stateless_alloc.hpp"
 #include "stateless_alloc_no_prop.hpp"
 #include "stateless_fancy_alloc.hpp"
+#include "less_first.hpp"
+#include "throwing_less.hpp"
 
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
 #include <vector>
 
 #if 0 // TODO: Review this
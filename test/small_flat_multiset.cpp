@@ -19,7 +19,10 @@
 #include "stateless_alloc.hpp"
 #include "stateless_alloc_no_prop.hpp"
 #include "stateless_fancy_alloc.hpp"
+#include "throwing_less.hpp"
 
+#include <algorithm>
+#include <iterator>
 #include <vector>
 
 #if 0 // TODO: Review this
@@ -20,6 +20,7 @@
 #include "stateless_alloc_no_prop.hpp"
 #include "stateless_fancy_alloc.hpp"
 
+#include <string>
 #include <vector>
 
 #if 0 // TODO: Review this
@@ -10,8 +10,10 @@
 #include "check.hpp"
 #include "print.hpp"
 
+#include "xhandle.hpp"
 #include "xint.hpp"
 
+#include "at_least_alloc.hpp"
 #include "statefull_alloc.hpp"
 #include "stateless_alloc.hpp"
 #include "stateless_alloc_no_prop.hpp"
@@ -72,6 +74,150 @@ void test_small_vector_5()
     #include "small_vector.inc"
 }
 
+void test_small_vector_relocation()
+{
+    using sfl::test::xhandle;
+
+    PRINT("Test trivially relocatable value type");
+    {
+        sfl::small_vector<xhandle, 8> vec;
+
+        std::vector<int> expected;
+
+        xhandle::moves = 0;
+
+        for (int i = 0; i < 100; ++i)
+        {
+            vec.emplace_back(i);
+            expected.push_back(i);
+        }
+
+        // Growth relocates elements without calling move constructor.
+        CHECK(xhandle::moves == 0);
+
+        vec.erase(vec.begin() + 10);
+        expected.erase(expected.begin() + 10);
+
+        vec.erase(vec.begin() + 80);
+        expected.erase(expected.begin() + 80);
+
+        vec.erase(vec.begin() + 20, vec.begin() + 30);
+        expected.erase(expected.begin() + 20, expected.begin() + 30);
+
+        vec.erase(vec.begin() + 70, vec.begin() + 75);
+        expected.erase(expected.begin() + 70, expected.begin() + 75);
+
+        CHECK(xhandle::moves == 0);
+
+        vec.shrink_to_fit();
+
+        CHECK(xhandle::moves == 0);
+
+        vec.emplace(vec.begin() + 5, 1000);
+        expected.insert(expected.begin() + 5, 1000);
+
+        CHECK(vec.size() == expected.size());
+
+        for (std::size_t i = 0; i < expected.size(); ++i)
+        {
+            CHECK(vec[i].value() == expected[i]);
+        }
+    }
+
+    PRINT("Test trivially relocatable value type with allocator that has construct and destroy");
+    {
+        sfl::small_vector<xhandle, 8, sfl::test::statefull_alloc<xhandle>> vec;
+
+        xhandle::moves = 0;
+
+        for (int i = 0; i < 100; ++i)
+        {
+            vec.emplace_back(i);
+        }
+
+        vec.erase(vec.begin() + 10);
+
+        // Elements are moved one by one.
+        CHECK(xhandle::moves > 0);
+
+        CHECK(vec.size() == 99);
+
+        for (int i = 0; i < 99; ++i)
+        {
+            CHECK(vec[i].value() == (i < 10 ? i : i + 1));
+        }
+    }
+}
+
+void test_small_vector_growth_policy()
+{
+    PRINT("Test small_vector with growth policy");
+    {
+        sfl::small_vector<int, 4, std::allocator<int>, sfl::geometric_growth<2, 1>> vec;
+
+        for (int i = 0; i < 100; ++i)
+        {
+            const auto old_capacity = vec.capacity();
+
+            vec.push_back(i);
+
+            if (vec.capacity() != old_capacity)
+            {
+                CHECK(vec.capacity() == 2 * old_capacity);
+            }
+        }
+
+        CHECK(vec.size() == 100);
+        CHECK(vec.capacity() == 128);
+    }
+
+    PRINT("Test small_vector with rounding growth policy");
+    {
+        sfl::small_vector<char, 8, std::allocator<char>, sfl::size_class_rounded_growth<>> vec;
+
+        vec.reserve(4);
+        CHECK(vec.capacity() == 8);
+
+        vec.reserve(129);
+        CHECK(vec.capacity() == 160);
+    }
+}
+
+void test_small_vector_allocate_at_least()
+{
+    PRINT("Test small_vector with allocator that has allocate_at_least");
+    {
+        sfl::small_vector<int, 4, sfl::test::at_least_alloc<int>> vec;
+
+        for (int i = 0; i < 5; ++i)
+        {
+            vec.push_back(i);
+        }
+
+        CHECK(vec.capacity() == 8);
+
+        vec.reserve(9);
+        CHECK(vec.capacity() == 16);
+
+        vec.insert(vec.begin(), 20, -1);
+        CHECK(vec.size() == 25);
+        CHECK(vec.capacity() == 32);
+
+        for (int i = 0; i < 25; ++i)
+        {
+            CHECK(vec[i] == (i < 20 ? -1 : i - 20));
+        }
+    }
+
+    PRINT("Test small_vector with specialization of allocator_usable_size");
+    {
+        sfl::small_vector<int, 4, sfl::test::usable_size_alloc<int>> vec;
+
+        vec.reserve(10);
+        CHECK(vec.capacity() == 14);
+    }
+}
+
 int main()
 {
     test_small_vector_1();
@@ -79,4 +225,7 @@ int main()
     test_small_vector_3();
     test_small_vector_4();
     test_small_vector_5();
+    test_small_vector_relocation();
+    test_small_vector_growth_policy();
+    test_small_vector_allocate_at_least();
 }
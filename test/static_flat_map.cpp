@@ -11,9 +11,13 @@
 #include "check.hpp"
 #include "print.hpp"
 
+#include "decade.hpp"
+#include "less_first.hpp"
 #include "xint.hpp"
 #include "xobj.hpp"
 
+#include <algorithm>
+#include <cstdint>
 #include <vector>
 
 void test_static_flat_map()
@@ -755,6 +759,305 @@ void test_static_flat_map()
 
     ///////////////////////////////////////////////////////////////////////////////
 
+    PRINT("Test lower_bound, upper_bound, equal_range, find, contains (large ranges)");
+    {
+        for (int n = 0; n <= 100; ++n)
+        {
+            sfl::static_flat_map<xint, xint, 100, std::less<xint>> map;
+
+            for (int i = 0; i < n; ++i)
+            {
+                map.insert({2 * i, i});
+            }
+
+            for (int x = -1; x <= 2 * n + 1; ++x)
+            {
+                // Keys are 0, 2, 4, ..., 2 * (n - 1).
+                const int lb = x < 0 ? 0 : std::min(n, (x + 1) / 2);
+                const int ub = x < 0 ? 0 : std::min(n, x / 2 + 1);
+
+                CHECK(map.lower_bound(x) == map.nth(lb));
+                CHECK(map.upper_bound(x) == map.nth(ub));
+                CHECK(map.equal_range(x) == std::make_pair(map.nth(lb), map.nth(ub)));
+                CHECK(map.find(x) == (lb != ub ? map.nth(lb) : map.end()));
+                CHECK(map.contains(x) == (lb != ub));
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+
+    PRINT("Test freeze()");
+    {
+        using container_type = sfl::static_flat_map<xint, xint, 100, std::less<xint>, true>;
+
+        static_assert(container_type::freezable, "Must be freezable.");
+
+        // Trees of all sizes, including incomplete ones.
+        for (int n = 0; n <= 100; ++n)
+        {
+            container_type map;
+
+            for (int i = 0; i < n; ++i)
+            {
+                map.insert({2 * i, i});
+            }
+
+            CHECK(map.frozen() == false);
+
+            map.freeze();
+
+            CHECK(map.frozen() == true);
+            CHECK(map.size() == std::size_t(n));
+
+            for (int x = -1; x <= 2 * n + 1; ++x)
+            {
+                // Keys are 0, 2, 4, ..., 2 * (n - 1).
+                const int lb = x < 0 ? 0 : std::min(n, (x + 1) / 2);
+                const int ub = x < 0 ? 0 : std::min(n, x / 2 + 1);
+
+                CHECK(map.lower_bound(x) == map.nth(lb));
+                CHECK(map.upper_bound(x) == map.nth(ub));
+                CHECK(map.equal_range(x) == std::make_pair(map.nth(lb), map.nth(ub)));
+                CHECK(map.find(x) == (lb != ub ? map.nth(lb) : map.end()));
+                CHECK(map.contains(x) == (lb != ub));
+            }
+        }
+
+        {
+            container_type map({{10, 1}, {20, 1}, {30, 1}});
+
+            map.freeze();
+
+            container_type copy(map);
+
+            CHECK(copy.frozen() == true);
+            CHECK(copy.find(20) == copy.nth(1));
+
+            container_type other;
+
+            other.insert({40, 1});
+            other.swap(copy);
+
+            CHECK(other.frozen() == true);
+            CHECK(other.find(30) == other.nth(2));
+            CHECK(copy.frozen() == false);
+            CHECK(copy.find(40) == copy.nth(0));
+
+            // Any modification discards the index.
+
+            map.insert({25, 1});
+
+            CHECK(map.frozen() == false);
+            CHECK(map.find(25) == map.nth(2));
+
+            map.freeze();
+            map.erase(20);
+
+            CHECK(map.frozen() == false);
+            CHECK(map.find(30) == map.nth(2));
+
+            map.freeze();
+            map.clear();
+
+            CHECK(map.frozen() == false);
+            CHECK(map.find(10) == map.end());
+        }
+    }
+
+    PRINT("Test fit()");
+    {
+        using container_type = sfl::static_flat_map<int, int, 200, std::less<int>, false, true>;
+
+        static_assert(container_type::learned, "Must be learned.");
+
+        // Evenly spaced, quadratic and clustered keys, including negative
+        // keys. Every value in range of keys is looked up.
+        for (int d = 0; d < 3; ++d)
+        {
+            for (int n = 0; n <= 200; n += 7)
+            {
+                container_type map;
+
+                std::vector<int> keys;
+
+                for (int i = 0; i < n; ++i)
+                {
+                    const int key = d == 0 ? 3 * i - 100
+                                  : d == 1 ? i * i
+                                  : i % 10 + 1000 * (i / 10);
+
+                    map.insert({key, i});
+                    keys.push_back(key);
+                }
+
+                CHECK(map.fitted() == false);
+
+                map.fit();
+
+                CHECK(map.fitted() == true);
+                CHECK(map.size() == std::size_t(n));
+
+                const int first = keys.empty() ? -2 : keys.front() - 2;
+                const int last  = keys.empty() ? +2 : keys.back() + 2;
+
+                for (int x = first; x <= last; ++x)
+                {
+                    const auto lb = std::lower_bound(keys.begin(), keys.end(), x) - keys.begin();
+                    const auto ub = std::upper_bound(keys.begin(), keys.end(), x) - keys.begin();
+
+                    CHECK(map.lower_bound(x) == map.nth(lb));
+                    CHECK(map.upper_bound(x) == map.nth(ub));
+                    CHECK(map.equal_range(x) == std::make_pair(map.nth(lb), map.nth(ub)));
+                    CHECK(map.find(x) == (lb != ub ? map.nth(lb) : map.end()));
+                    CHECK(map.contains(x) == (lb != ub));
+                }
+            }
+        }
+
+        // Keys far apart at both ends of the range of the type.
+        {
+            sfl::static_flat_map<std::uint64_t, int, 100, std::less<std::uint64_t>, false, true> map;
+
+            map.insert(std::make_pair(0, 1));
+            map.insert(std::make_pair(UINT64_MAX, 1));
+
+            for (std::uint64_t i = 0; i < 90; ++i)
+            {
+                map.insert(std::make_pair((std::uint64_t(1) << 63) + i * i * 12345, 1));
+            }
+
+            map.fit();
+
+            for (std::size_t i = 0; i < map.size(); ++i)
+            {
+                CHECK(map.find(map.nth(i)->first) == map.nth(i));
+
+                if (map.nth(i)->first != UINT64_MAX)
+                {
+                    CHECK(map.find(map.nth(i)->first + 1) == map.end());
+                    CHECK(map.lower_bound(map.nth(i)->first + 1) == map.nth(i + 1));
+                }
+            }
+        }
+
+        // Floating point keys.
+        {
+            sfl::static_flat_map<double, int, 100, std::less<double>, false, true> map;
+
+            for (int i = -50; i < 50; ++i)
+            {
+                map.insert(std::make_pair(i * 0.5, 1));
+            }
+
+            map.fit();
+
+            for (int i = -50; i < 50; ++i)
+            {
+                CHECK(map.find(i * 0.5) == map.nth(std::size_t(i + 50)));
+                CHECK(map.find(i * 0.5 + 0.25) == map.end());
+                CHECK(map.upper_bound(i * 0.5 + 0.25) == map.nth(std::size_t(i + 51)));
+            }
+
+            CHECK(map.lower_bound(-100.0) == map.begin());
+            CHECK(map.lower_bound(+100.0) == map.end());
+        }
+
+        {
+            container_type map({{10, 1}, {20, 1}, {30, 1}});
+
+            map.fit();
+
+            container_type copy(map);
+
+            CHECK(copy.fitted() == true);
+            CHECK(copy.find(20) == copy.nth(1));
+
+            container_type other;
+
+            other.insert({40, 1});
+            other.swap(copy);
+
+            CHECK(other.fitted() == true);
+            CHECK(other.find(30) == other.nth(2));
+            CHECK(copy.fitted() == false);
+            CHECK(copy.find(40) == copy.nth(0));
+
+            // Any modification discards the model.
+
+            map.insert({25, 1});
+
+            CHECK(map.fitted() == false);
+            CHECK(map.find(25) == map.nth(2));
+
+            map.fit();
+            map.erase(20);
+
+            CHECK(map.fitted() == false);
+            CHECK(map.find(30) == map.nth(2));
+
+            map.fit();
+            map.clear();
+
+            CHECK(map.fitted() == false);
+            CHECK(map.find(10) == map.end());
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////////
+
+    PRINT("Test equal_range(const K&) with several equivalent keys");
+    {
+        using key_type = std::pair<int, int>;
+
+        sfl::static_flat_map<key_type, int, 10, sfl::test::less_first, true> map
+        (
+            {{key_type(1, 1), 10}, {key_type(2, 1), 20}, {key_type(2, 2), 30}, {key_type(2, 3), 40}, {key_type(3, 1), 50}}
+        );
+
+        #if __cplusplus >= 201402L
+        using sfl::test::decade;
+
+        sfl::static_flat_map<int, int, 10, std::less<>, false, true> learned_map
+        (
+            {{5, 1}, {21, 2}, {22, 3}, {23, 4}, {31, 5}}
+        );
+        #endif
+
+        for (int frozen = 0; frozen < 2; ++frozen)
+        {
+            if (frozen)
+            {
+                map.freeze();
+                #if __cplusplus >= 201402L
+                learned_map.fit();
+                #endif
+            }
+
+            CHECK(map.frozen() == bool(frozen));
+
+            CHECK(map.equal_range(0) == std::make_pair(map.nth(0), map.nth(0)));
+            CHECK(map.equal_range(1) == std::make_pair(map.nth(0), map.nth(1)));
+            CHECK(map.equal_range(2) == std::make_pair(map.nth(1), map.nth(4)));
+            CHECK(map.equal_range(3) == std::make_pair(map.nth(4), map.nth(5)));
+            CHECK(map.equal_range(4) == std::make_pair(map.nth(5), map.nth(5)));
+            CHECK(map.equal_range(key_type(2, 2)) == std::make_pair(map.nth(2), map.nth(3)));
+
+            #if __cplusplus >= 201402L
+            CHECK(learned_map.fitted() == bool(frozen));
+            CHECK(learned_map.equal_range(decade{0}) == std::make_pair(learned_map.nth(0), learned_map.nth(1)));
+            CHECK(learned_map.equal_range(decade{1}) == std::make_pair(learned_map.nth(1), learned_map.nth(1)));
+            CHECK(learned_map.equal_range(decade{2}) == std::make_pair(learned_map.nth(1), learned_map.nth(4)));
+            CHECK(learned_map.equal_range(decade{3}) == std::make_pair(learned_map.nth(4), learned_map.nth(5)));
+            CHECK(learned_map.equal_range(22) == std::make_pair(learned_map.nth(2), learned_map.nth(3)));
+            #endif
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+
     PRINT("Test clear()");
     {
         sfl::static_flat_map<xint, xint, 100, std::less<xint>> map;
@@ -872,6 +1175,55 @@ void test_static_flat_map()
         }
     }
 
+    PRINT("Test emplace(Args&&...) and emplace_hint(const_iterator, Args&&...) with existing key");
+    {
+        struct counted
+        {
+            counted(int* n)
+            {
+                ++*n;
+            }
+        };
+
+        sfl::static_flat_map<xint, counted, 100, std::less<xint>> map;
+
+        int n = 0;
+
+        CHECK(map.emplace(xint(10), &n).second == true);
+        CHECK(map.emplace(xint(20), &n).second == true);
+        CHECK(n == 2);
+
+        // Mapped value is not constructed if key already exists.
+        {
+            CHECK(map.emplace(xint(10), &n) == std::make_pair(map.nth(0), false));
+
+            CHECK
+            (
+                map.emplace
+                (
+                    std::piecewise_construct,
+                    std::forward_as_tuple(xint(20)),
+                    std::forward_as_tuple(&n)
+                ) == std::make_pair(map.nth(1), false)
+            );
+
+            CHECK(map.emplace_hint(map.begin(), xint(20), &n) == map.nth(1));
+
+            CHECK(map.size() == 2);
+            CHECK(n == 2);
+        }
+
+        // Key is not moved from if it already exists.
+        {
+            xint key(10);
+
+            CHECK(map.emplace(std::move(key), &n) == std::make_pair(map.nth(0), false));
+
+            CHECK(key == 10);
+            CHECK(n == 2);
+        }
+    }
+
     PRINT("Test insert(const value_type&)");
     {
         sfl::static_flat_map<xint, xint, 100, std::less<xint>> map;
@@ -1389,6 +1741,40 @@ void test_static_flat_map()
         }
     }
 
+    PRINT("Test insert(InputIt, InputIt) (bulk)");
+    {
+        sfl::static_flat_map<xint, xint, 100, std::less<xint>> map, expected;
+
+        for (int i = 0; i < 20; ++i)
+        {
+            map.insert(std::pair<xint, xint>(i * 2, 1));
+            expected.insert(std::pair<xint, xint>(i * 2, 1));
+        }
+
+        std::vector<std::pair<xint, xint>> data;
+
+        for (int i = 0; i < 200; ++i)
+        {
+            data.push_back(std::pair<xint, xint>((i * 37) % 80, i + 2));
+        }
+
+        map.insert(data.begin(), data.end());
+
+        // Result must be the same as after inserting elements one by one.
+        for (const auto& value : data)
+        {
+            expected.insert(value);
+        }
+
+        CHECK(map.size() == expected.size());
+
+        for (std::size_t i = 0; i < expected.size(); ++i)
+        {
+            CHECK(map.nth(i)->first == expected.nth(i)->first);
+            CHECK(map.nth(i)->second == expected.nth(i)->second);
+        }
+    }
+
     PRINT("Test insert(std::initializer_list)");
     {
         sfl::static_flat_map<xint, xint, 100, std::less<xint>> map;
@@ -1448,6 +1834,58 @@ void test_static_flat_map()
         }
     }
 
+    PRINT("Test insert(sorted_unique_t, InputIt, InputIt)");
+    {
+        sfl::static_flat_map<xint, xint, 100, std::less<xint>> map;
+
+        std::vector<std::pair<xint, xint>> data1
+        (
+            {
+                {20, 1},
+                {40, 1},
+                {60, 1}
+            }
+        );
+
+        std::vector<std::pair<xint, xint>> data2
+        (
+            {
+                {10, 2},
+                {20, 2},
+                {30, 2},
+                {60, 2},
+                {70, 2}
+            }
+        );
+
+        map.insert(sfl::sorted_unique_t(), data1.begin(), data1.end());
+        map.insert(sfl::sorted_unique_t(), data2.begin(), data2.end());
+
+        CHECK(map.size() == 6);
+        CHECK(map.nth(0)->first == 10); CHECK(map.nth(0)->second == 2);
+        CHECK(map.nth(1)->first == 20); CHECK(map.nth(1)->second == 1);
+        CHECK(map.nth(2)->first == 30); CHECK(map.nth(2)->second == 2);
+        CHECK(map.nth(3)->first == 40); CHECK(map.nth(3)->second == 1);
+        CHECK(map.nth(4)->first == 60); CHECK(map.nth(4)->second == 1);
+        CHECK(map.nth(5)->first == 70); CHECK(map.nth(5)->second == 2);
+    }
+
+    PRINT("Test insert(sorted_unique_t, std::initializer_list)");
+    {
+        sfl::static_flat_map<xint, xint, 100, std::less<xint>> map;
+
+        map.insert(sfl::sorted_unique_t(), {{20, 1}, {40, 1}, {60, 1}});
+        map.insert(sfl::sorted_unique_t(), {{10, 2}, {20, 2}, {30, 2}, {60, 2}, {70, 2}});
+
+        CHECK(map.size() == 6);
+        CHECK(map.nth(0)->first == 10); CHECK(map.nth(0)->second == 2);
+        CHECK(map.nth(1)->first == 20); CHECK(map.nth(1)->second == 1);
+        CHECK(map.nth(2)->first == 30); CHECK(map.nth(2)->second == 2);
+        CHECK(map.nth(3)->first == 40); CHECK(map.nth(3)->second == 1);
+        CHECK(map.nth(4)->first == 60); CHECK(map.nth(4)->second == 1);
+        CHECK(map.nth(5)->first == 70); CHECK(map.nth(5)->second == 2);
+    }
+
     PRINT("Test insert_or_assign(const Key&, M&&)");
     {
         sfl::static_flat_map<xint, xint, 100, std::less<xint>> map;
@@ -3150,6 +3588,42 @@ void test_static_flat_map()
         CHECK(map.nth(5)->first == 60); CHECK(map.nth(5)->second == 1);
     }
 
+    PRINT("Test container(sorted_unique_t, InputIt, InputIt)");
+    {
+        std::vector<std::pair<xint, xint>> data
+        (
+            {
+                {10, 1},
+                {20, 1},
+                {30, 1}
+            }
+        );
+
+        sfl::static_flat_map<xint, xint, 100, std::less<xint>> map(sfl::sorted_unique_t(), data.begin(), data.end());
+
+        CHECK(map.size() == 3);
+        CHECK(map.nth(0)->first == 10); CHECK(map.nth(0)->second == 1);
+        CHECK(map.nth(1)->first == 20); CHECK(map.nth(1)->second == 1);
+        CHECK(map.nth(2)->first == 30); CHECK(map.nth(2)->second == 1);
+    }
+
+    PRINT("Test container(sorted_unique_t, std::initializer_list)");
+    {
+        std::initializer_list<std::pair<xint, xint>> ilist
+        {
+            {10, 1},
+            {20, 1},
+            {30, 1}
+        };
+
+        sfl::static_flat_map<xint, xint, 100, std::less<xint>> map(sfl::sorted_unique_t(), ilist);
+
+        CHECK(map.size() == 3);
+        CHECK(map.nth(0)->first == 10); CHECK(map.nth(0)->second == 1);
+        CHECK(map.nth(1)->first == 20); CHECK(map.nth(1)->second == 1);
+        CHECK(map.nth(2)->first == 30); CHECK(map.nth(2)->second == 1);
+    }
+
     PRINT("Test container(std::initializer_list)");
     {
         std::initializer_list<std::pair<xint, xint>> ilist
@@ -3651,6 +4125,50 @@ void test_static_flat_map()
 
     ///////////////////////////////////////////////////////////////////////////////
 
+    PRINT("Test extract(), replace(static_vector&&)");
+    {
+        using container_type =
+            sfl::static_flat_map< xint,
+                                  xint,
+                                  5,
+                                  std::less<xint> >;
+
+        using vector_type = sfl::static_vector<typename container_type::value_type, 5>;
+
+        ///////////////////////////////////////////////////////////////////////////
+
+        container_type c;
+
+        for (int i = 1; i <= 3; ++i)
+        {
+            c.emplace(10 * i, i);
+        }
+
+        vector_type vec = c.extract();
+
+        CHECK(c.empty());
+        CHECK(vec.size() == 3);
+
+        for (int i = 0; i < 3; ++i)
+        {
+            CHECK(vec[i].first == 10 * (i + 1)); CHECK(vec[i].second == i + 1);
+        }
+
+        ///////////////////////////////////////////////////////////////////////////
+
+        c.emplace(90, 9);
+
+        c.replace(std::move(vec));
+
+        CHECK(vec.empty());
+        CHECK(c.size() == 3);
+
+        for (int i = 0; i < 3; ++i)
+        {
+            CHECK(c.nth(i)->first == 10 * (i + 1)); CHECK(c.nth(i)->second == i + 1);
+        }
+    }
+
     PRINT("Test NON-MEMBER comparison operators");
     {
         sfl::static_flat_map<xint, xint, 100, std::less<xint>> map1, map2;
@@ -3773,6 +4291,50 @@ void test_static_flat_map()
         CHECK(map.nth(0)->first == 10); CHECK(map.nth(0)->second == 1);
         CHECK(map.nth(1)->first == 30); CHECK(map.nth(1)->second == 1);
     }
+
+    PRINT("Test constexpr (C++20)");
+    #if __cplusplus >= 202002L
+    {
+        // Unsorted input with duplicate key. First occurrence wins.
+        static constexpr sfl::static_flat_map<int, int, 8> map{{50, 5}, {10, 1}, {30, 3}, {10, 9}, {40, 4}};
+
+        static_assert(map.size() == 4);
+        static_assert(map.begin()->first == 10);
+        static_assert(map.find(10)->second == 1);
+        static_assert(map.find(30)->second == 3);
+        static_assert(map.find(20) == map.end());
+        static_assert(map.lower_bound(20)->first == 30);
+        static_assert(map.upper_bound(40)->first == 50);
+        static_assert(map.contains(50));
+        static_assert(map.at(40) == 4);
+
+        constexpr auto sum = []()
+        {
+            sfl::static_flat_map<int, int, 8> m{{2, 20}, {1, 10}};
+            m.emplace(3, 30);
+            m[0] = 5;
+            m.erase(2);
+            int s = 0;
+            for (const auto& p : m)
+            {
+                s += p.second;
+            }
+            for (const auto& p : map)
+            {
+                s += p.first;
+            }
+            return s;
+        };
+
+        static_assert(sum() == 45 + 130);
+
+        static_assert(sfl::make_static_flat_map<int, int>({{3, 30}, {1, 10}, {2, 20}}).capacity() == 3);
+        static_assert(sfl::make_static_flat_map<int, int>({{3, 30}, {1, 10}, {2, 20}}).find(2)->second == 20);
+        static_assert(sfl::make_static_flat_map<int, int>({{3, 30}, {1, 10}, {3, 20}}).size() == 2);
+
+        CHECK(map.find(30)->second == 3);
+    }
+    #endif
 }
 
 int main()
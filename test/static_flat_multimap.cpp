@@ -1461,6 +1461,40 @@ void test_static_flat_multimap()
         }
     }
 
+    PRINT("Test insert(InputIt, InputIt) (bulk)");
+    {
+        sfl::static_flat_multimap<xint, xint, 100, std::less<xint>> map, expected;
+
+        for (int i = 0; i < 20; ++i)
+        {
+            map.insert(std::pair<xint, xint>(i * 2, 1));
+            expected.insert(std::pair<xint, xint>(i * 2, 1));
+        }
+
+        std::vector<std::pair<xint, xint>> data;
+
+        for (int i = 0; i < 60; ++i)
+        {
+            data.push_back(std::pair<xint, xint>((i * 37) % 30, i + 2));
+        }
+
+        map.insert(data.begin(), data.end());
+
+        // Result must be the same as after inserting elements one by one.
+        for (const auto& value : data)
+        {
+            expected.insert(value);
+        }
+
+        CHECK(map.size() == expected.size());
+
+        for (std::size_t i = 0; i < expected.size(); ++i)
+        {
+            CHECK(map.nth(i)->first == expected.nth(i)->first);
+            CHECK(map.nth(i)->second == expected.nth(i)->second);
+        }
+    }
+
     PRINT("Test insert(std::initializer_list)");
     {
         sfl::static_flat_multimap<xint, xint, 100, std::less<xint>> map;
@@ -1526,6 +1560,62 @@ void test_static_flat_multimap()
         }
     }
 
+    PRINT("Test insert(sorted_equivalent_t, InputIt, InputIt)");
+    {
+        sfl::static_flat_multimap<xint, xint, 100, std::less<xint>> map;
+
+        std::vector<std::pair<xint, xint>> data1
+        (
+            {
+                {20, 1},
+                {40, 1},
+                {60, 1}
+            }
+        );
+
+        std::vector<std::pair<xint, xint>> data2
+        (
+            {
+                {10, 2},
+                {20, 2},
+                {30, 2},
+                {60, 2},
+                {70, 2}
+            }
+        );
+
+        map.insert(sfl::sorted_equivalent_t(), data1.begin(), data1.end());
+        map.insert(sfl::sorted_equivalent_t(), data2.begin(), data2.end());
+
+        CHECK(map.size() == 8);
+        CHECK(map.nth(0)->first == 10); CHECK(map.nth(0)->second == 2);
+        CHECK(map.nth(1)->first == 20); CHECK(map.nth(1)->second == 2);
+        CHECK(map.nth(2)->first == 20); CHECK(map.nth(2)->second == 1);
+        CHECK(map.nth(3)->first == 30); CHECK(map.nth(3)->second == 2);
+        CHECK(map.nth(4)->first == 40); CHECK(map.nth(4)->second == 1);
+        CHECK(map.nth(5)->first == 60); CHECK(map.nth(5)->second == 2);
+        CHECK(map.nth(6)->first == 60); CHECK(map.nth(6)->second == 1);
+        CHECK(map.nth(7)->first == 70); CHECK(map.nth(7)->second == 2);
+    }
+
+    PRINT("Test insert(sorted_equivalent_t, std::initializer_list)");
+    {
+        sfl::static_flat_multimap<xint, xint, 100, std::less<xint>> map;
+
+        map.insert(sfl::sorted_equivalent_t(), {{20, 1}, {40, 1}, {60, 1}});
+        map.insert(sfl::sorted_equivalent_t(), {{10, 2}, {20, 2}, {30, 2}, {60, 2}, {70, 2}});
+
+        CHECK(map.size() == 8);
+        CHECK(map.nth(0)->first == 10); CHECK(map.nth(0)->second == 2);
+        CHECK(map.nth(1)->first == 20); CHECK(map.nth(1)->second == 2);
+        CHECK(map.nth(2)->first == 20); CHECK(map.nth(2)->second == 1);
+        CHECK(map.nth(3)->first == 30); CHECK(map.nth(3)->second == 2);
+        CHECK(map.nth(4)->first == 40); CHECK(map.nth(4)->second == 1);
+        CHECK(map.nth(5)->first == 60); CHECK(map.nth(5)->second == 2);
+        CHECK(map.nth(6)->first == 60); CHECK(map.nth(6)->second == 1);
+        CHECK(map.nth(7)->first == 70); CHECK(map.nth(7)->second == 2);
+    }
+
     PRINT("Test erase(const_iterator)");
     {
         // Erase at the end
@@ -2291,6 +2381,46 @@ void test_static_flat_multimap()
         CHECK(map.nth(11)->first == 60); CHECK(map.nth(11)->second == 1);
     }
 
+    PRINT("Test container(sorted_equivalent_t, InputIt, InputIt)");
+    {
+        std::vector<std::pair<xint, xint>> data
+        (
+            {
+                {10, 1},
+                {20, 1},
+                {20, 2},
+                {30, 1}
+            }
+        );
+
+        sfl::static_flat_multimap<xint, xint, 100, std::less<xint>> map(sfl::sorted_equivalent_t(), data.begin(), data.end());
+
+        CHECK(map.size() == 4);
+        CHECK(map.nth(0)->first == 10); CHECK(map.nth(0)->second == 1);
+        CHECK(map.nth(1)->first == 20); CHECK(map.nth(1)->second == 1);
+        CHECK(map.nth(2)->first == 20); CHECK(map.nth(2)->second == 2);
+        CHECK(map.nth(3)->first == 30); CHECK(map.nth(3)->second == 1);
+    }
+
+    PRINT("Test container(sorted_equivalent_t, std::initializer_list)");
+    {
+        std::initializer_list<std::pair<xint, xint>> ilist
+        {
+            {10, 1},
+            {20, 1},
+            {20, 2},
+            {30, 1}
+        };
+
+        sfl::static_flat_multimap<xint, xint, 100, std::less<xint>> map(sfl::sorted_equivalent_t(), ilist);
+
+        CHECK(map.size() == 4);
+        CHECK(map.nth(0)->first == 10); CHECK(map.nth(0)->second == 1);
+        CHECK(map.nth(1)->first == 20); CHECK(map.nth(1)->second == 1);
+        CHECK(map.nth(2)->first == 20); CHECK(map.nth(2)->second == 2);
+        CHECK(map.nth(3)->first == 30); CHECK(map.nth(3)->second == 1);
+    }
+
     PRINT("Test container(std::initializer_list)");
     {
         std::initializer_list<std::pair<xint, xint>> ilist
@@ -2804,6 +2934,50 @@ void test_static_flat_multimap()
 
     ///////////////////////////////////////////////////////////////////////////////
 
+    PRINT("Test extract(), replace(static_vector&&)");
+    {
+        using container_type =
+            sfl::static_flat_multimap< xint,
+                                       xint,
+                                       5,
+                                       std::less<xint> >;
+
+        using vector_type = sfl::static_vector<typename container_type::value_type, 5>;
+
+        ///////////////////////////////////////////////////////////////////////////
+
+        container_type c;
+
+        for (int i = 1; i <= 3; ++i)
+        {
+            c.emplace(10 * i, i);
+        }
+
+        vector_type vec = c.extract();
+
+        CHECK(c.empty());
+        CHECK(vec.size() == 3);
+
+        for (int i = 0; i < 3; ++i)
+        {
+            CHECK(vec[i].first == 10 * (i + 1)); CHECK(vec[i].second == i + 1);
+        }
+
+        ///////////////////////////////////////////////////////////////////////////
+
+        c.emplace(90, 9);
+
+        c.replace(std::move(vec));
+
+        CHECK(vec.empty());
+        CHECK(c.size() == 3);
+
+        for (int i = 0; i < 3; ++i)
+        {
+            CHECK(c.nth(i)->first == 10 * (i + 1)); CHECK(c.nth(i)->second == i + 1);
+        }
+    }
+
     PRINT("Test NON-MEMBER comparison operators");
     {
         sfl::static_flat_multimap<xint, xint, 100, std::less<xint>> map1, map2;
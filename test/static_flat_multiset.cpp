@@ -775,6 +775,37 @@ void test_static_flat_multiset()
 
     ///////////////////////////////////////////////////////////////////////////////
 
+    PRINT("Test lower_bound, upper_bound, equal_range, count (large ranges)");
+    {
+        // Arithmetic keys compared using std::less use fast path.
+        sfl::static_flat_multiset<int, 300, std::less<int>> set;
+
+        // Key `k` is stored `k % 3` times.
+        for (int k = 0; k < 150; ++k)
+        {
+            for (int i = 0; i < k % 3; ++i)
+            {
+                set.insert(k);
+            }
+        }
+
+        CHECK(set.size() == 150);
+
+        for (int x = -1; x <= 150; ++x)
+        {
+            // Number of keys less than `x` and number of copies of `x`.
+            const int less = x < 0 ? 0 : (x / 3) * 3 + (x % 3 == 2 ? 1 : 0);
+            const int copies = x < 0 || x >= 150 ? 0 : x % 3;
+
+            CHECK(set.lower_bound(x) == set.nth(less));
+            CHECK(set.upper_bound(x) == set.nth(less + copies));
+            CHECK(set.equal_range(x) == std::make_pair(set.nth(less), set.nth(less + copies)));
+            CHECK(set.count(x) == std::size_t(copies));
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+
     PRINT("Test clear()");
     {
         sfl::static_flat_multiset<xint_xint, 100, std::less<xint_xint>> set;
@@ -1301,6 +1332,40 @@ void test_static_flat_multiset()
         }
     }
 
+    PRINT("Test insert(InputIt, InputIt) (bulk)");
+    {
+        sfl::static_flat_multiset<xint_xint, 100, std::less<xint_xint>> set, expected;
+
+        for (int i = 0; i < 20; ++i)
+        {
+            set.insert(xint_xint(i * 2, 1));
+            expected.insert(xint_xint(i * 2, 1));
+        }
+
+        std::vector<xint_xint> data;
+
+        for (int i = 0; i < 60; ++i)
+        {
+            data.push_back(xint_xint((i * 37) % 30, i + 2));
+        }
+
+        set.insert(data.begin(), data.end());
+
+        // Result must be the same as after inserting elements one by one.
+        for (const auto& value : data)
+        {
+            expected.insert(value);
+        }
+
+        CHECK(set.size() == expected.size());
+
+        for (std::size_t i = 0; i < expected.size(); ++i)
+        {
+            CHECK(set.nth(i)->first == expected.nth(i)->first);
+            CHECK(set.nth(i)->second == expected.nth(i)->second);
+        }
+    }
+
     PRINT("Test insert(std::initializer_list)");
     {
         sfl::static_flat_multiset<xint_xint, 100, std::less<xint_xint>> set;
@@ -1366,6 +1431,62 @@ void test_static_flat_multiset()
         }
     }
 
+    PRINT("Test insert(sorted_equivalent_t, InputIt, InputIt)");
+    {
+        sfl::static_flat_multiset<xint_xint, 100, std::less<xint_xint>> set;
+
+        std::vector<xint_xint> data1
+        (
+            {
+                {20, 1},
+                {40, 1},
+                {60, 1}
+            }
+        );
+
+        std::vector<xint_xint> data2
+        (
+            {
+                {10, 2},
+                {20, 2},
+                {30, 2},
+                {60, 2},
+                {70, 2}
+            }
+        );
+
+        set.insert(sfl::sorted_equivalent_t(), data1.begin(), data1.end());
+        set.insert(sfl::sorted_equivalent_t(), data2.begin(), data2.end());
+
+        CHECK(set.size() == 8);
+        CHECK(set.nth(0)->first == 10); CHECK(set.nth(0)->second == 2);
+        CHECK(set.nth(1)->first == 20); CHECK(set.nth(1)->second == 2);
+        CHECK(set.nth(2)->first == 20); CHECK(set.nth(2)->second == 1);
+        CHECK(set.nth(3)->first == 30); CHECK(set.nth(3)->second == 2);
+        CHECK(set.nth(4)->first == 40); CHECK(set.nth(4)->second == 1);
+        CHECK(set.nth(5)->first == 60); CHECK(set.nth(5)->second == 2);
+        CHECK(set.nth(6)->first == 60); CHECK(set.nth(6)->second == 1);
+        CHECK(set.nth(7)->first == 70); CHECK(set.nth(7)->second == 2);
+    }
+
+    PRINT("Test insert(sorted_equivalent_t, std::initializer_list)");
+    {
+        sfl::static_flat_multiset<xint_xint, 100, std::less<xint_xint>> set;
+
+        set.insert(sfl::sorted_equivalent_t(), {{20, 1}, {40, 1}, {60, 1}});
+        set.insert(sfl::sorted_equivalent_t(), {{10, 2}, {20, 2}, {30, 2}, {60, 2}, {70, 2}});
+
+        CHECK(set.size() == 8);
+        CHECK(set.nth(0)->first == 10); CHECK(set.nth(0)->second == 2);
+        CHECK(set.nth(1)->first == 20); CHECK(set.nth(1)->second == 2);
+        CHECK(set.nth(2)->first == 20); CHECK(set.nth(2)->second == 1);
+        CHECK(set.nth(3)->first == 30); CHECK(set.nth(3)->second == 2);
+        CHECK(set.nth(4)->first == 40); CHECK(set.nth(4)->second == 1);
+        CHECK(set.nth(5)->first == 60); CHECK(set.nth(5)->second == 2);
+        CHECK(set.nth(6)->first == 60); CHECK(set.nth(6)->second == 1);
+        CHECK(set.nth(7)->first == 70); CHECK(set.nth(7)->second == 2);
+    }
+
     PRINT("Test erase(const_iterator)");
     {
         // Erase at the end
@@ -2131,6 +2252,46 @@ void test_static_flat_multiset()
         CHECK(set.nth(11)->first == 60); CHECK(set.nth(11)->second == 1);
     }
 
+    PRINT("Test container(sorted_equivalent_t, InputIt, InputIt)");
+    {
+        std::vector<xint_xint> data
+        (
+            {
+                {10, 1},
+                {20, 1},
+                {20, 2},
+                {30, 1}
+            }
+        );
+
+        sfl::static_flat_multiset<xint_xint, 100, std::less<xint_xint>> set(sfl::sorted_equivalent_t(), data.begin(), data.end());
+
+        CHECK(set.size() == 4);
+        CHECK(set.nth(0)->first == 10); CHECK(set.nth(0)->second == 1);
+        CHECK(set.nth(1)->first == 20); CHECK(set.nth(1)->second == 1);
+        CHECK(set.nth(2)->first == 20); CHECK(set.nth(2)->second == 2);
+        CHECK(set.nth(3)->first == 30); CHECK(set.nth(3)->second == 1);
+    }
+
+    PRINT("Test container(sorted_equivalent_t, std::initializer_list)");
+    {
+        std::initializer_list<xint_xint> ilist
+        {
+            {10, 1},
+            {20, 1},
+            {20, 2},
+            {30, 1}
+        };
+
+        sfl::static_flat_multiset<xint_xint, 100, std::less<xint_xint>> set(sfl::sorted_equivalent_t(), ilist);
+
+        CHECK(set.size() == 4);
+        CHECK(set.nth(0)->first == 10); CHECK(set.nth(0)->second == 1);
+        CHECK(set.nth(1)->first == 20); CHECK(set.nth(1)->second == 1);
+        CHECK(set.nth(2)->first == 20); CHECK(set.nth(2)->second == 2);
+        CHECK(set.nth(3)->first == 30); CHECK(set.nth(3)->second == 1);
+    }
+
     PRINT("Test container(std::initializer_list)");
     {
         std::initializer_list<xint_xint> ilist
@@ -2644,6 +2805,49 @@ void test_static_flat_multiset()
 
     ///////////////////////////////////////////////////////////////////////////////
 
+    PRINT("Test extract(), replace(static_vector&&)");
+    {
+        using container_type =
+            sfl::static_flat_multiset< xint,
+                                       5,
+                                       std::less<xint> >;
+
+        using vector_type = sfl::static_vector<typename container_type::value_type, 5>;
+
+        ///////////////////////////////////////////////////////////////////////////
+
+        container_type c;
+
+        for (int i = 1; i <= 3; ++i)
+        {
+            c.emplace(10 * i);
+        }
+
+        vector_type vec = c.extract();
+
+        CHECK(c.empty());
+        CHECK(vec.size() == 3);
+
+        for (int i = 0; i < 3; ++i)
+        {
+            CHECK(vec[i] == 10 * (i + 1));
+        }
+
+        ///////////////////////////////////////////////////////////////////////////
+
+        c.emplace(90);
+
+        c.replace(std::move(vec));
+
+        CHECK(vec.empty());
+        CHECK(c.size() == 3);
+
+        for (int i = 0; i < 3; ++i)
+        {
+            CHECK(*c.nth(i) == 10 * (i + 1));
+        }
+    }
+
     PRINT("Test NON-MEMBER comparison operators");
     {
         sfl::static_flat_multiset<xint_xint, 100, std::less<xint_xint>> set1, set2;
@@ -11,10 +11,15 @@
 #include "check.hpp"
 #include "print.hpp"
 
+#include "decade.hpp"
+#include "less_first.hpp"
 #include "xint.hpp"
 #include "xint_xint.hpp"
 #include "xobj.hpp"
 
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
 #include <vector>
 
 void test_static_flat_set()
@@ -757,6 +762,277 @@ void test_static_flat_set()
 
     ///////////////////////////////////////////////////////////////////////////////
 
+    PRINT("Test freeze()");
+    {
+        using container_type = sfl::static_flat_set<xint, 100, std::less<xint>, true>;
+
+        static_assert(container_type::freezable, "Must be freezable.");
+
+        // Trees of all sizes, including incomplete ones.
+        for (int n = 0; n <= 100; ++n)
+        {
+            container_type set;
+
+            for (int i = 0; i < n; ++i)
+            {
+                set.insert(2 * i);
+            }
+
+            CHECK(set.frozen() == false);
+
+            set.freeze();
+
+            CHECK(set.frozen() == true);
+            CHECK(set.size() == std::size_t(n));
+
+            for (int x = -1; x <= 2 * n + 1; ++x)
+            {
+                // Keys are 0, 2, 4, ..., 2 * (n - 1).
+                const int lb = x < 0 ? 0 : std::min(n, (x + 1) / 2);
+                const int ub = x < 0 ? 0 : std::min(n, x / 2 + 1);
+
+                CHECK(set.lower_bound(x) == set.nth(lb));
+                CHECK(set.upper_bound(x) == set.nth(ub));
+                CHECK(set.equal_range(x) == std::make_pair(set.nth(lb), set.nth(ub)));
+                CHECK(set.find(x) == (lb != ub ? set.nth(lb) : set.end()));
+                CHECK(set.contains(x) == (lb != ub));
+            }
+        }
+
+        {
+            container_type set({10, 20, 30});
+
+            set.freeze();
+
+            container_type copy(set);
+
+            CHECK(copy.frozen() == true);
+            CHECK(copy.find(20) == copy.nth(1));
+
+            container_type other;
+
+            other.insert(40);
+            other.swap(copy);
+
+            CHECK(other.frozen() == true);
+            CHECK(other.find(30) == other.nth(2));
+            CHECK(copy.frozen() == false);
+            CHECK(copy.find(40) == copy.nth(0));
+
+            // Any modification discards the index.
+
+            set.insert(25);
+
+            CHECK(set.frozen() == false);
+            CHECK(set.find(25) == set.nth(2));
+
+            set.freeze();
+            set.erase(20);
+
+            CHECK(set.frozen() == false);
+            CHECK(set.find(30) == set.nth(2));
+
+            set.freeze();
+            set.clear();
+
+            CHECK(set.frozen() == false);
+            CHECK(set.find(10) == set.end());
+        }
+    }
+
+    PRINT("Test fit()");
+    {
+        using container_type = sfl::static_flat_set<int, 200, std::less<int>, false, true>;
+
+        static_assert(container_type::learned, "Must be learned.");
+
+        // Evenly spaced, quadratic and clustered keys, including negative
+        // keys. Every value in range of keys is looked up.
+        for (int d = 0; d < 3; ++d)
+        {
+            for (int n = 0; n <= 200; n += 7)
+            {
+                container_type set;
+
+                std::vector<int> keys;
+
+                for (int i = 0; i < n; ++i)
+                {
+                    const int key = d == 0 ? 3 * i - 100
+                                  : d == 1 ? i * i
+                                  : i % 10 + 1000 * (i / 10);
+
+                    set.insert(key);
+                    keys.push_back(key);
+                }
+
+                CHECK(set.fitted() == false);
+
+                set.fit();
+
+                CHECK(set.fitted() == true);
+                CHECK(set.size() == std::size_t(n));
+
+                const int first = keys.empty() ? -2 : keys.front() - 2;
+                const int last  = keys.empty() ? +2 : keys.back() + 2;
+
+                for (int x = first; x <= last; ++x)
+                {
+                    const auto lb = std::lower_bound(keys.begin(), keys.end(), x) - keys.begin();
+                    const auto ub = std::upper_bound(keys.begin(), keys.end(), x) - keys.begin();
+
+                    CHECK(set.lower_bound(x) == set.nth(lb));
+                    CHECK(set.upper_bound(x) == set.nth(ub));
+                    CHECK(set.equal_range(x) == std::make_pair(set.nth(lb), set.nth(ub)));
+                    CHECK(set.find(x) == (lb != ub ? set.nth(lb) : set.end()));
+                    CHECK(set.contains(x) == (lb != ub));
+                }
+            }
+        }
+
+        // Keys far apart at both ends of the range of the type.
+        {
+            sfl::static_flat_set<std::uint64_t, 100, std::less<std::uint64_t>, false, true> set;
+
+            set.insert(0);
+            set.insert(UINT64_MAX);
+
+            for (std::uint64_t i = 0; i < 90; ++i)
+            {
+                set.insert((std::uint64_t(1) << 63) + i * i * 12345);
+            }
+
+            set.fit();
+
+            for (std::size_t i = 0; i < set.size(); ++i)
+            {
+                CHECK(set.find(*set.nth(i)) == set.nth(i));
+
+                if (*set.nth(i) != UINT64_MAX)
+                {
+                    CHECK(set.find(*set.nth(i) + 1) == set.end());
+                    CHECK(set.lower_bound(*set.nth(i) + 1) == set.nth(i + 1));
+                }
+            }
+        }
+
+        // Floating point keys.
+        {
+            sfl::static_flat_set<double, 100, std::less<double>, false, true> set;
+
+            for (int i = -50; i < 50; ++i)
+            {
+                set.insert(i * 0.5);
+            }
+
+            set.fit();
+
+            for (int i = -50; i < 50; ++i)
+            {
+                CHECK(set.find(i * 0.5) == set.nth(std::size_t(i + 50)));
+                CHECK(set.find(i * 0.5 + 0.25) == set.end());
+                CHECK(set.upper_bound(i * 0.5 + 0.25) == set.nth(std::size_t(i + 51)));
+            }
+
+            CHECK(set.lower_bound(-100.0) == set.begin());
+            CHECK(set.lower_bound(+100.0) == set.end());
+        }
+
+        {
+            container_type set({10, 20, 30});
+
+            set.fit();
+
+            container_type copy(set);
+
+            CHECK(copy.fitted() == true);
+            CHECK(copy.find(20) == copy.nth(1));
+
+            container_type other;
+
+            other.insert(40);
+            other.swap(copy);
+
+            CHECK(other.fitted() == true);
+            CHECK(other.find(30) == other.nth(2));
+            CHECK(copy.fitted() == false);
+            CHECK(copy.find(40) == copy.nth(0));
+
+            // Any modification discards the model.
+
+            set.insert(25);
+
+            CHECK(set.fitted() == false);
+            CHECK(set.find(25) == set.nth(2));
+
+            set.fit();
+            set.erase(20);
+
+            CHECK(set.fitted() == false);
+            CHECK(set.find(30) == set.nth(2));
+
+            set.fit();
+            set.clear();
+
+            CHECK(set.fitted() == false);
+            CHECK(set.find(10) == set.end());
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////////
+
+    PRINT("Test equal_range(const K&) with several equivalent keys");
+    {
+        using key_type = std::pair<int, int>;
+
+        sfl::static_flat_set<key_type, 10, sfl::test::less_first, true> set
+        (
+            {key_type(1, 1), key_type(2, 1), key_type(2, 2), key_type(2, 3), key_type(3, 1)}
+        );
+
+        #if __cplusplus >= 201402L
+        using sfl::test::decade;
+
+        sfl::static_flat_set<int, 10, std::less<>, false, true> learned_set
+        (
+            {5, 21, 22, 23, 31}
+        );
+        #endif
+
+        for (int frozen = 0; frozen < 2; ++frozen)
+        {
+            if (frozen)
+            {
+                set.freeze();
+                #if __cplusplus >= 201402L
+                learned_set.fit();
+                #endif
+            }
+
+            CHECK(set.frozen() == bool(frozen));
+
+            CHECK(set.equal_range(0) == std::make_pair(set.nth(0), set.nth(0)));
+            CHECK(set.equal_range(1) == std::make_pair(set.nth(0), set.nth(1)));
+            CHECK(set.equal_range(2) == std::make_pair(set.nth(1), set.nth(4)));
+            CHECK(set.equal_range(3) == std::make_pair(set.nth(4), set.nth(5)));
+            CHECK(set.equal_range(4) == std::make_pair(set.nth(5), set.nth(5)));
+            CHECK(set.equal_range(key_type(2, 2)) == std::make_pair(set.nth(2), set.nth(3)));
+
+            #if __cplusplus >= 201402L
+            CHECK(learned_set.fitted() == bool(frozen));
+            CHECK(learned_set.equal_range(decade{0}) == std::make_pair(learned_set.nth(0), learned_set.nth(1)));
+            CHECK(learned_set.equal_range(decade{1}) == std::make_pair(learned_set.nth(1), learned_set.nth(1)));
+            CHECK(learned_set.equal_range(decade{2}) == std::make_pair(learned_set.nth(1), learned_set.nth(4)));
+            CHECK(learned_set.equal_range(decade{3}) == std::make_pair(learned_set.nth(4), learned_set.nth(5)));
+            CHECK(learned_set.equal_range(22) == std::make_pair(learned_set.nth(2), learned_set.nth(3)));
+            #endif
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+
     PRINT("Test clear()");
     {
         sfl::static_flat_set<xint_xint, 100, std::less<xint_xint>> set;
@@ -874,6 +1150,27 @@ void test_static_flat_set()
         }
     }
 
+    PRINT("Test emplace(Args&&...) and emplace_hint(const_iterator, Args&&...) with existing key");
+    {
+        sfl::static_flat_set<xint, 100, std::less<xint>> set;
+
+        CHECK(set.emplace(10) == std::make_pair(set.nth(0), true));
+        CHECK(set.emplace(20) == std::make_pair(set.nth(1), true));
+
+        // Key is not moved from if it already exists.
+        {
+            xint key(10);
+
+            CHECK(set.emplace(std::move(key)) == std::make_pair(set.nth(0), false));
+            CHECK(key == 10);
+
+            CHECK(set.emplace_hint(set.begin(), std::move(key)) == set.nth(0));
+            CHECK(key == 10);
+
+            CHECK(set.size() == 2);
+        }
+    }
+
     PRINT("Test insert(const value_type&)");
     {
         sfl::static_flat_set<xint_xint, 100, std::less<xint_xint>> set;
@@ -1323,6 +1620,40 @@ void test_static_flat_set()
         }
     }
 
+    PRINT("Test insert(InputIt, InputIt) (bulk)");
+    {
+        sfl::static_flat_set<xint_xint, 100, std::less<xint_xint>> set, expected;
+
+        for (int i = 0; i < 20; ++i)
+        {
+            set.insert(xint_xint(i * 2, 1));
+            expected.insert(xint_xint(i * 2, 1));
+        }
+
+        std::vector<xint_xint> data;
+
+        for (int i = 0; i < 200; ++i)
+        {
+            data.push_back(xint_xint((i * 37) % 80, i + 2));
+        }
+
+        set.insert(data.begin(), data.end());
+
+        // Result must be the same as after inserting elements one by one.
+        for (const auto& value : data)
+        {
+            expected.insert(value);
+        }
+
+        CHECK(set.size() == expected.size());
+
+        for (std::size_t i = 0; i < expected.size(); ++i)
+        {
+            CHECK(set.nth(i)->first == expected.nth(i)->first);
+            CHECK(set.nth(i)->second == expected.nth(i)->second);
+        }
+    }
+
     PRINT("Test insert(std::initializer_list)");
     {
         sfl::static_flat_set<xint_xint, 100, std::less<xint_xint>> set;
@@ -1382,6 +1713,58 @@ void test_static_flat_set()
         }
     }
 
+    PRINT("Test insert(sorted_unique_t, InputIt, InputIt)");
+    {
+        sfl::static_flat_set<xint_xint, 100, std::less<xint_xint>> set;
+
+        std::vector<xint_xint> data1
+        (
+            {
+                {20, 1},
+                {40, 1},
+                {60, 1}
+            }
+        );
+
+        std::vector<xint_xint> data2
+        (
+            {
+                {10, 2},
+                {20, 2},
+                {30, 2},
+                {60, 2},
+                {70, 2}
+            }
+        );
+
+        set.insert(sfl::sorted_unique_t(), data1.begin(), data1.end());
+        set.insert(sfl::sorted_unique_t(), data2.begin(), data2.end());
+
+        CHECK(set.size() == 6);
+        CHECK(set.nth(0)->first == 10); CHECK(set.nth(0)->second == 2);
+        CHECK(set.nth(1)->first == 20); CHECK(set.nth(1)->second == 1);
+        CHECK(set.nth(2)->first == 30); CHECK(set.nth(2)->second == 2);
+        CHECK(set.nth(3)->first == 40); CHECK(set.nth(3)->second == 1);
+        CHECK(set.nth(4)->first == 60); CHECK(set.nth(4)->second == 1);
+        CHECK(set.nth(5)->first == 70); CHECK(set.nth(5)->second == 2);
+    }
+
+    PRINT("Test insert(sorted_unique_t, std::initializer_list)");
+    {
+        sfl::static_flat_set<xint_xint, 100, std::less<xint_xint>> set;
+
+        set.insert(sfl::sorted_unique_t(), {{20, 1}, {40, 1}, {60, 1}});
+        set.insert(sfl::sorted_unique_t(), {{10, 2}, {20, 2}, {30, 2}, {60, 2}, {70, 2}});
+
+        CHECK(set.size() == 6);
+        CHECK(set.nth(0)->first == 10); CHECK(set.nth(0)->second == 2);
+        CHECK(set.nth(1)->first == 20); CHECK(set.nth(1)->second == 1);
+        CHECK(set.nth(2)->first == 30); CHECK(set.nth(2)->second == 2);
+        CHECK(set.nth(3)->first == 40); CHECK(set.nth(3)->second == 1);
+        CHECK(set.nth(4)->first == 60); CHECK(set.nth(4)->second == 1);
+        CHECK(set.nth(5)->first == 70); CHECK(set.nth(5)->second == 2);
+    }
+
     PRINT("Test erase(const_iterator)");
     {
         // Erase at the end
@@ -2123,6 +2506,42 @@ void test_static_flat_set()
         CHECK(set.nth(5)->first == 60); CHECK(set.nth(5)->second == 1);
     }
 
+    PRINT("Test container(sorted_unique_t, InputIt, InputIt)");
+    {
+        std::vector<xint_xint> data
+        (
+            {
+                {10, 1},
+                {20, 1},
+                {30, 1}
+            }
+        );
+
+        sfl::static_flat_set<xint_xint, 100, std::less<xint_xint>> set(sfl::sorted_unique_t(), data.begin(), data.end());
+
+        CHECK(set.size() == 3);
+        CHECK(set.nth(0)->first == 10); CHECK(set.nth(0)->second == 1);
+        CHECK(set.nth(1)->first == 20); CHECK(set.nth(1)->second == 1);
+        CHECK(set.nth(2)->first == 30); CHECK(set.nth(2)->second == 1);
+    }
+
+    PRINT("Test container(sorted_unique_t, std::initializer_list)");
+    {
+        std::initializer_list<xint_xint> ilist
+        {
+            {10, 1},
+            {20, 1},
+            {30, 1}
+        };
+
+        sfl::static_flat_set<xint_xint, 100, std::less<xint_xint>> set(sfl::sorted_unique_t(), ilist);
+
+        CHECK(set.size() == 3);
+        CHECK(set.nth(0)->first == 10); CHECK(set.nth(0)->second == 1);
+        CHECK(set.nth(1)->first == 20); CHECK(set.nth(1)->second == 1);
+        CHECK(set.nth(2)->first == 30); CHECK(set.nth(2)->second == 1);
+    }
+
     PRINT("Test container(std::initializer_list)");
     {
         std::initializer_list<xint_xint> ilist
@@ -2624,6 +3043,223 @@ void test_static_flat_set()
 
     ///////////////////////////////////////////////////////////////////////////////
 
+    PRINT("Test extract(), replace(static_vector&&)");
+    {
+        using container_type =
+            sfl::static_flat_set< xint,
+                                  5,
+                                  std::less<xint> >;
+
+        using vector_type = sfl::static_vector<typename container_type::value_type, 5>;
+
+        ///////////////////////////////////////////////////////////////////////////
+
+        container_type c;
+
+        for (int i = 1; i <= 3; ++i)
+        {
+            c.emplace(10 * i);
+        }
+
+        vector_type vec = c.extract();
+
+        CHECK(c.empty());
+        CHECK(vec.size() == 3);
+
+        for (int i = 0; i < 3; ++i)
+        {
+            CHECK(vec[i] == 10 * (i + 1));
+        }
+
+        ///////////////////////////////////////////////////////////////////////////
+
+        c.emplace(90);
+
+        c.replace(std::move(vec));
+
+        CHECK(vec.empty());
+        CHECK(c.size() == 3);
+
+        for (int i = 0; i < 3; ++i)
+        {
+            CHECK(*c.nth(i) == 10 * (i + 1));
+        }
+    }
+
+    PRINT("Test set_union(), set_intersection(), set_difference(), merge_from(), intersect_with(), subtract()");
+    {
+        // Results are compared with results of standard algorithms. Large
+        // differences in size exercise galloping search.
+
+        {
+            using container_type =
+                sfl::static_flat_set< xint,
+                                      800 >;
+
+            using vector_type = std::vector<xint>;
+
+            for (int n1 : {0, 1, 7, 40, 400})
+            {
+                for (int n2 : {0, 1, 7, 40, 400})
+                {
+                    container_type a;
+                    container_type b;
+
+                    for (int i = 0; i < n1; ++i)
+                    {
+                        a.emplace(2 * (i / 2));
+                    }
+
+                    for (int i = 0; i < n2; ++i)
+                    {
+                        b.emplace(3 * (i / 3));
+                    }
+
+                    vector_type expected_union;
+                    vector_type expected_intersection;
+                    vector_type expected_difference;
+
+                    std::set_union(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected_union));
+                    std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected_intersection));
+                    std::set_difference(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected_difference));
+
+                    {
+                        const container_type c = a.set_union(b);
+                        CHECK(c.size() == expected_union.size());
+                        CHECK(std::equal(c.begin(), c.end(), expected_union.begin()));
+                    }
+
+                    {
+                        const container_type c = a.set_intersection(b);
+                        CHECK(c.size() == expected_intersection.size());
+                        CHECK(std::equal(c.begin(), c.end(), expected_intersection.begin()));
+                    }
+
+                    {
+                        const container_type c = a.set_difference(b);
+                        CHECK(c.size() == expected_difference.size());
+                        CHECK(std::equal(c.begin(), c.end(), expected_difference.begin()));
+                    }
+
+                    {
+                        container_type c(a);
+                        c.merge_from(b);
+                        CHECK(c.size() == expected_union.size());
+                        CHECK(std::equal(c.begin(), c.end(), expected_union.begin()));
+                    }
+
+                    {
+                        container_type c(a);
+                        c.intersect_with(b);
+                        CHECK(c.size() == expected_intersection.size());
+                        CHECK(std::equal(c.begin(), c.end(), expected_intersection.begin()));
+                    }
+
+                    {
+                        container_type c(a);
+                        c.subtract(b);
+                        CHECK(c.size() == expected_difference.size());
+                        CHECK(std::equal(c.begin(), c.end(), expected_difference.begin()));
+                    }
+
+                    {
+                        container_type c(a);
+                        c.merge_from(c);
+                        CHECK(c == a);
+                        c.intersect_with(c);
+                        CHECK(c == a);
+                        c.subtract(c);
+                        CHECK(c.empty());
+                    }
+                }
+            }
+        }
+
+        {
+            using container_type =
+                sfl::static_flat_set< int,
+                                      800 >;
+
+            using vector_type = std::vector<int>;
+
+            for (int n1 : {0, 1, 7, 40, 400})
+            {
+                for (int n2 : {0, 1, 7, 40, 400})
+                {
+                    container_type a;
+                    container_type b;
+
+                    for (int i = 0; i < n1; ++i)
+                    {
+                        a.emplace(2 * (i / 2));
+                    }
+
+                    for (int i = 0; i < n2; ++i)
+                    {
+                        b.emplace(3 * (i / 3));
+                    }
+
+                    vector_type expected_union;
+                    vector_type expected_intersection;
+                    vector_type expected_difference;
+
+                    std::set_union(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected_union));
+                    std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected_intersection));
+                    std::set_difference(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected_difference));
+
+                    {
+                        const container_type c = a.set_union(b);
+                        CHECK(c.size() == expected_union.size());
+                        CHECK(std::equal(c.begin(), c.end(), expected_union.begin()));
+                    }
+
+                    {
+                        const container_type c = a.set_intersection(b);
+                        CHECK(c.size() == expected_intersection.size());
+                        CHECK(std::equal(c.begin(), c.end(), expected_intersection.begin()));
+                    }
+
+                    {
+                        const container_type c = a.set_difference(b);
+                        CHECK(c.size() == expected_difference.size());
+                        CHECK(std::equal(c.begin(), c.end(), expected_difference.begin()));
+                    }
+
+                    {
+                        container_type c(a);
+                        c.merge_from(b);
+                        CHECK(c.size() == expected_union.size());
+                        CHECK(std::equal(c.begin(), c.end(), expected_union.begin()));
+                    }
+
+                    {
+                        container_type c(a);
+                        c.intersect_with(b);
+                        CHECK(c.size() == expected_intersection.size());
+                        CHECK(std::equal(c.begin(), c.end(), expected_intersection.begin()));
+                    }
+
+                    {
+                        container_type c(a);
+                        c.subtract(b);
+                        CHECK(c.size() == expected_difference.size());
+                        CHECK(std::equal(c.begin(), c.end(), expected_difference.begin()));
+                    }
+
+                    {
+                        container_type c(a);
+                        c.merge_from(c);
+                        CHECK(c == a);
+                        c.intersect_with(c);
+                        CHECK(c == a);
+                        c.subtract(c);
+                        CHECK(c.empty());
+                    }
+                }
+            }
+        }
+    }
+
     PRINT("Test NON-MEMBER comparison operators");
     {
         sfl::static_flat_set<xint_xint, 100, std::less<xint_xint>> set1, set2;
@@ -2746,6 +3382,48 @@ void test_static_flat_set()
         CHECK(set.nth(0)->first == 10); CHECK(set.nth(0)->second == 1);
         CHECK(set.nth(1)->first == 30); CHECK(set.nth(1)->second == 1);
     }
+
+    PRINT("Test constexpr (C++20)");
+    #if __cplusplus >= 202002L
+    {
+        // Unsorted input with duplicate key.
+        static constexpr sfl::static_flat_set<int, 8> set{50, 10, 30, 10, 40};
+
+        static_assert(set.size() == 4);
+        static_assert(*set.begin() == 10);
+        static_assert(*set.find(30) == 30);
+        static_assert(set.find(20) == set.end());
+        static_assert(*set.lower_bound(20) == 30);
+        static_assert(*set.upper_bound(40) == 50);
+        static_assert(set.contains(50));
+
+        constexpr auto sum = []()
+        {
+            sfl::static_flat_set<int, 8> s{2, 1};
+            s.emplace(3);
+            s.insert(0);
+            s.erase(2);
+            int r = 0;
+            for (int x : s)
+            {
+                r += x;
+            }
+            for (int x : set)
+            {
+                r += x;
+            }
+            return r;
+        };
+
+        static_assert(sum() == 4 + 130);
+
+        static_assert(sfl::make_static_flat_set({3, 1, 2}).capacity() == 3);
+        static_assert(*sfl::make_static_flat_set({3, 1, 2}).begin() == 1);
+        static_assert(sfl::make_static_flat_set({3, 1, 3}).size() == 2);
+
+        CHECK(*set.find(30) == 30);
+    }
+    #endif
 }
 
 int main()
@@ -14,8 +14,50 @@
 #include "xint.hpp"
 #include "xobj.hpp"
 
+#include <cstdint>
 #include <vector>
 
+// Inserts elements `{gen(i), gen(i + 1)}` for i = 0, ..., N - 1 one by one
+// and checks that each key is found. Mapped value of the last inserted
+// element is never a key, so it must not be found. Then erases elements one
+// by one (erase moves the last element into the hole) and checks again.
+template <typename Key, typename T, std::size_t N, typename Generator>
+void test_static_unordered_flat_map_simd_find(Generator gen)
+{
+    sfl::static_unordered_flat_map<Key, T, N> map;
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        CHECK(map.emplace(gen(i), T(gen(i + 1))).second == true);
+
+        for (std::size_t j = 0; j <= i; ++j)
+        {
+            CHECK(map.find(gen(j)) == map.nth(j));
+            CHECK(map.count(gen(j)) == 1);
+            CHECK(map.contains(gen(j)) == true);
+        }
+
+        CHECK(map.find(gen(i + 1)) == map.end());
+        CHECK(map.count(gen(i + 1)) == 0);
+        CHECK(map.contains(gen(i + 1)) == false);
+    }
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        CHECK(map.erase(gen(i)) == 1);
+        CHECK(map.find(gen(i)) == map.end());
+
+        for (std::size_t j = i + 1; j < N; ++j)
+        {
+            CHECK(map.find(gen(j)) != map.end());
+            CHECK(map.find(gen(j))->first == gen(j));
+            CHECK(map.find(gen(j))->second == T(gen(j + 1)));
+        }
+    }
+
+    CHECK(map.empty());
+}
+
 void test_static_unordered_flat_map()
 {
     using sfl::test::xint;
@@ -341,6 +383,100 @@ void test_static_unordered_flat_map()
 
     ///////////////////////////////////////////////////////////////////////////////
 
+    PRINT("Test find_many, contains_many");
+    {
+        // xint
+        {
+            sfl::static_unordered_flat_map<xint, xint, 100, std::equal_to<xint>> map;
+
+            map.emplace_back(20, 1);
+            map.emplace_back(40, 1);
+            map.emplace_back(60, 1);
+
+            const xint keys[] = {10, 20, 30, 40, 50, 60, 70, 40};
+
+            decltype(map)::const_iterator its[8];
+            bool found[8];
+
+            CHECK(map.find_many(std::begin(keys), std::end(keys), its) == its + 8);
+            CHECK(map.contains_many(std::begin(keys), std::end(keys), found) == found + 8);
+
+            CHECK(its[0] == map.end());   CHECK(found[0] == false);
+            CHECK(its[1] == map.nth(0));  CHECK(found[1] == true);
+            CHECK(its[2] == map.end());   CHECK(found[2] == false);
+            CHECK(its[3] == map.nth(1));  CHECK(found[3] == true);
+            CHECK(its[4] == map.end());   CHECK(found[4] == false);
+            CHECK(its[5] == map.nth(2));  CHECK(found[5] == true);
+            CHECK(its[6] == map.end());   CHECK(found[6] == false);
+            CHECK(its[7] == map.nth(1));  CHECK(found[7] == true);
+        }
+
+        // int, more keys than fit into one batch
+        {
+            sfl::static_unordered_flat_map<int, int, 100, std::equal_to<int>> map;
+
+            for (int i = 0; i < 100; ++i)
+            {
+                map.emplace_back(i * 3, i);
+            }
+
+            int keys[150];
+
+            for (int i = 0; i < 150; ++i)
+            {
+                keys[i] = i * 7 % 128;
+            }
+
+            decltype(map)::iterator its[150];
+            bool found[150];
+
+            CHECK(map.find_many(std::begin(keys), std::end(keys), its) == its + 150);
+            CHECK(map.contains_many(std::begin(keys), std::end(keys), found) == found + 150);
+
+            for (int i = 0; i < 150; ++i)
+            {
+                CHECK(its[i] == map.find(keys[i]));
+                CHECK(found[i] == map.contains(keys[i]));
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+
+    PRINT("Test find, count, contains (SIMD search)");
+    {
+        // Keys and mapped values have the same size.
+
+        test_static_unordered_flat_map_simd_find<std::int8_t, std::uint8_t, 100>
+        (
+            [](std::size_t i) { return std::int8_t(int(i) - 50); }
+        );
+
+        test_static_unordered_flat_map_simd_find<std::uint16_t, std::uint16_t, 100>
+        (
+            [](std::size_t i) { return std::uint16_t((i << 8) | 0x5A); }
+        );
+
+        test_static_unordered_flat_map_simd_find<int, int, 100>
+        (
+            [](std::size_t i) { return int((i << 16) | 0x5A5A); }
+        );
+
+        test_static_unordered_flat_map_simd_find<std::uint64_t, double, 100>
+        (
+            [](std::size_t i) { return (std::uint64_t(i) << 32) | 0x5A5A5A5A; }
+        );
+
+        // Keys and mapped values have different sizes.
+
+        test_static_unordered_flat_map_simd_find<int, std::uint64_t, 100>
+        (
+            [](std::size_t i) { return int(i); }
+        );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+
     PRINT("Test clear()");
     {
         sfl::static_unordered_flat_map<xint, xint, 100, std::equal_to<xint>> map;
@@ -428,6 +564,55 @@ void test_static_unordered_flat_map()
         }
     }
 
+    PRINT("Test emplace(Args&&...) and emplace_hint(const_iterator, Args&&...) with existing key");
+    {
+        struct counted
+        {
+            counted(int* n)
+            {
+                ++*n;
+            }
+        };
+
+        sfl::static_unordered_flat_map<xint, counted, 100, std::equal_to<xint>> map;
+
+        int n = 0;
+
+        CHECK(map.emplace(xint(10), &n).second == true);
+        CHECK(map.emplace(xint(20), &n).second == true);
+        CHECK(n == 2);
+
+        // Mapped value is not constructed if key already exists.
+        {
+            CHECK(map.emplace(xint(10), &n) == std::make_pair(map.nth(0), false));
+
+            CHECK
+            (
+                map.emplace
+                (
+                    std::piecewise_construct,
+                    std::forward_as_tuple(xint(20)),
+                    std::forward_as_tuple(&n)
+                ) == std::make_pair(map.nth(1), false)
+            );
+
+            CHECK(map.emplace_hint(map.begin(), xint(20), &n) == map.nth(1));
+
+            CHECK(map.size() == 2);
+            CHECK(n == 2);
+        }
+
+        // Key is not moved from if it already exists.
+        {
+            xint key(10);
+
+            CHECK(map.emplace(std::move(key), &n) == std::make_pair(map.nth(0), false));
+
+            CHECK(key == 10);
+            CHECK(n == 2);
+        }
+    }
+
     PRINT("Test insert(const value_type&)");
     {
         sfl::static_unordered_flat_map<xint, xint, 100, std::equal_to<xint>> map;
@@ -739,6 +924,48 @@ void test_static_unordered_flat_map()
         }
     }
 
+    PRINT("Test insert(InputIt, InputIt) (bulk)");
+    {
+        sfl::static_unordered_flat_map<int, int, 200, std::equal_to<int>> map;
+
+        for (int i = 0; i < 50; ++i)
+        {
+            map.insert(std::make_pair(i * 2, -1));
+        }
+
+        // Keys 0..149 followed by duplicates 0..49. Even keys below 100
+        // already exist.
+
+        std::vector<std::pair<int, int>> data;
+
+        for (int i = 0; i < 200; ++i)
+        {
+            data.emplace_back(i % 150, i);
+        }
+
+        map.insert(data.begin(), data.end());
+
+        CHECK(map.size() == 150);
+
+        for (int i = 0; i < 50; ++i)
+        {
+            CHECK(map.nth(i)->first == i * 2);
+            CHECK(map.nth(i)->second == -1);
+        }
+
+        int pos = 50;
+
+        for (int k = 0; k < 150; ++k)
+        {
+            if (k >= 100 || k % 2 != 0)
+            {
+                CHECK(map.nth(pos)->first == k);
+                CHECK(map.nth(pos)->second == k);
+                ++pos;
+            }
+        }
+    }
+
     PRINT("Test insert(std::initializer_list)");
     {
         sfl::static_unordered_flat_map<xint, xint, 100, std::equal_to<xint>> map;
@@ -2639,6 +2866,50 @@ void test_static_unordered_flat_map()
 
     ///////////////////////////////////////////////////////////////////////////////
 
+    PRINT("Test extract(), replace(static_vector&&)");
+    {
+        using container_type =
+            sfl::static_unordered_flat_map< xint,
+                                            xint,
+                                            5,
+                                            std::equal_to<xint> >;
+
+        using vector_type = sfl::static_vector<typename container_type::value_type, 5>;
+
+        ///////////////////////////////////////////////////////////////////////////
+
+        container_type c;
+
+        for (int i = 1; i <= 3; ++i)
+        {
+            c.emplace(10 * i, i);
+        }
+
+        vector_type vec = c.extract();
+
+        CHECK(c.empty());
+        CHECK(vec.size() == 3);
+
+        for (int i = 0; i < 3; ++i)
+        {
+            CHECK(vec[i].first == 10 * (i + 1)); CHECK(vec[i].second == i + 1);
+        }
+
+        ///////////////////////////////////////////////////////////////////////////
+
+        c.emplace(90, 9);
+
+        c.replace(std::move(vec));
+
+        CHECK(vec.empty());
+        CHECK(c.size() == 3);
+
+        for (int i = 0; i < 3; ++i)
+        {
+            CHECK(c.nth(i)->first == 10 * (i + 1)); CHECK(c.nth(i)->second == i + 1);
+        }
+    }
+
     PRINT("Test NON-MEMBER comparison operators");
     {
         sfl::static_unordered_flat_map<xint, xint, 100, std::equal_to<xint>> map1, map2, map3;
@@ -11,11 +11,78 @@
 #include "check.hpp"
 #include "print.hpp"
 
+#include "decade.hpp"
 #include "xint.hpp"
 #include "xobj.hpp"
 
+#include <iterator>
+#include <stdexcept>
 #include <vector>
 
+// Compares ints for equality, and by tens with `decade`, so several groups
+// of unique ints can be equivalent to one decade.
+struct equal_decade
+{
+    using is_transparent = void;
+
+    bool operator()(int a, int b) const
+    {
+        return a == b;
+    }
+
+    bool operator()(int a, sfl::test::decade b) const
+    {
+        return a / 10 == b.value;
+    }
+
+    bool operator()(sfl::test::decade a, int b) const
+    {
+        return a.value == b / 10;
+    }
+};
+
+// Throws from construction with negative value. Moves cannot throw.
+struct nonnegative
+{
+    int value;
+
+    explicit nonnegative(int v)
+        : value(v)
+    {
+        if (v < 0)
+        {
+            throw std::invalid_argument("nonnegative");
+        }
+    }
+};
+
+// Returns true if elements with equivalent keys are adjacent.
+template <typename Map>
+bool is_grouped(const Map& map)
+{
+    for (auto it = map.begin(); it != map.end(); ++it)
+    {
+        auto next = it + 1;
+
+        while (next != map.end() && next->first == it->first)
+        {
+            ++next;
+        }
+
+        for (auto it2 = next; it2 != map.end(); ++it2)
+        {
+            if (it2->first == it->first)
+            {
+                return false;
+            }
+        }
+
+        it = next - 1;
+    }
+
+    return true;
+}
+
 void test_static_unordered_flat_multimap()
 {
     using sfl::test::xint;
@@ -341,6 +408,66 @@ void test_static_unordered_flat_multimap()
 
     ///////////////////////////////////////////////////////////////////////////////
 
+    PRINT("Test find_many, contains_many");
+    {
+        // xint
+        {
+            sfl::static_unordered_flat_multimap<xint, xint, 100, std::equal_to<xint>> map;
+
+            map.emplace_back(20, 1);
+            map.emplace_back(40, 1);
+            map.emplace_back(60, 1);
+
+            const xint keys[] = {10, 20, 30, 40, 50, 60, 70, 40};
+
+            decltype(map)::const_iterator its[8];
+            bool found[8];
+
+            CHECK(map.find_many(std::begin(keys), std::end(keys), its) == its + 8);
+            CHECK(map.contains_many(std::begin(keys), std::end(keys), found) == found + 8);
+
+            CHECK(its[0] == map.end());   CHECK(found[0] == false);
+            CHECK(its[1] == map.nth(0));  CHECK(found[1] == true);
+            CHECK(its[2] == map.end());   CHECK(found[2] == false);
+            CHECK(its[3] == map.nth(1));  CHECK(found[3] == true);
+            CHECK(its[4] == map.end());   CHECK(found[4] == false);
+            CHECK(its[5] == map.nth(2));  CHECK(found[5] == true);
+            CHECK(its[6] == map.end());   CHECK(found[6] == false);
+            CHECK(its[7] == map.nth(1));  CHECK(found[7] == true);
+        }
+
+        // int, more keys than fit into one batch
+        {
+            sfl::static_unordered_flat_multimap<int, int, 100, std::equal_to<int>> map;
+
+            for (int i = 0; i < 100; ++i)
+            {
+                map.emplace_back(i % 50 * 3, i);
+            }
+
+            int keys[150];
+
+            for (int i = 0; i < 150; ++i)
+            {
+                keys[i] = i * 7 % 128;
+            }
+
+            decltype(map)::iterator its[150];
+            bool found[150];
+
+            CHECK(map.find_many(std::begin(keys), std::end(keys), its) == its + 150);
+            CHECK(map.contains_many(std::begin(keys), std::end(keys), found) == found + 150);
+
+            for (int i = 0; i < 150; ++i)
+            {
+                CHECK(its[i] == map.find(keys[i]));
+                CHECK(found[i] == map.contains(keys[i]));
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+
     PRINT("Test clear()");
     {
         sfl::static_unordered_flat_multimap<xint, xint, 100, std::equal_to<xint>> map;
@@ -2028,6 +2155,50 @@ void test_static_unordered_flat_multimap()
 
     ///////////////////////////////////////////////////////////////////////////////
 
+    PRINT("Test extract(), replace(static_vector&&)");
+    {
+        using container_type =
+            sfl::static_unordered_flat_multimap< xint,
+                                                 xint,
+                                                 5,
+                                                 std::equal_to<xint> >;
+
+        using vector_type = sfl::static_vector<typename container_type::value_type, 5>;
+
+        ///////////////////////////////////////////////////////////////////////////
+
+        container_type c;
+
+        for (int i = 1; i <= 3; ++i)
+        {
+            c.emplace(10 * i, i);
+        }
+
+        vector_type vec = c.extract();
+
+        CHECK(c.empty());
+        CHECK(vec.size() == 3);
+
+        for (int i = 0; i < 3; ++i)
+        {
+            CHECK(vec[i].first == 10 * (i + 1)); CHECK(vec[i].second == i + 1);
+        }
+
+        ///////////////////////////////////////////////////////////////////////////
+
+        c.emplace(90, 9);
+
+        c.replace(std::move(vec));
+
+        CHECK(vec.empty());
+        CHECK(c.size() == 3);
+
+        for (int i = 0; i < 3; ++i)
+        {
+            CHECK(c.nth(i)->first == 10 * (i + 1)); CHECK(c.nth(i)->second == i + 1);
+        }
+    }
+
     PRINT("Test NON-MEMBER comparison operators");
     {
         sfl::static_unordered_flat_multimap<xint, xint, 100, std::equal_to<xint>> map1, map2, map3;
@@ -2145,6 +2316,269 @@ void test_static_unordered_flat_multimap()
         CHECK(map.nth(0)->first == 10); CHECK(map.nth(0)->second == 1);
         CHECK(map.nth(1)->first == 30); CHECK(map.nth(1)->second == 1);
     }
+
+    PRINT("Test grouped layout");
+    {
+        using map_type = sfl::static_unordered_flat_multimap<xint, xint, 100, std::equal_to<xint>, true>;
+
+        static_assert(map_type::grouped, "");
+
+        map_type map;
+
+        map.emplace(10, 1);
+        map.emplace(20, 1);
+        map.emplace(30, 1);
+        map.emplace(20, 2);
+        map.emplace(10, 2);
+        map.emplace(20, 3);
+
+        CHECK(map.size() == 6);
+        CHECK(is_grouped(map));
+        // Order of elements within a group is unspecified.
+        CHECK(map.nth(0)->first == 10);
+        CHECK(map.nth(1)->first == 10);
+        CHECK(map.nth(2)->first == 20);
+        CHECK(map.nth(3)->first == 20);
+        CHECK(map.nth(4)->first == 20);
+        CHECK(map.nth(5)->first == 30);
+
+        CHECK(map.count(10) == 2);
+        CHECK(map.count(20) == 3);
+        CHECK(map.count(30) == 1);
+        CHECK(map.count(40) == 0);
+
+        {
+            auto er = map.equal_range(20);
+            CHECK(er.first == map.nth(2));
+            CHECK(er.second == map.nth(5));
+        }
+
+        {
+            const map_type& cmap = map;
+            auto er = cmap.equal_range(40);
+            CHECK(er.first == cmap.end());
+            CHECK(er.second == cmap.end());
+        }
+
+        ///////////////////////////////////////////////////////////////////////////
+
+        {
+            auto it = map.insert({20, 4});
+            CHECK(it == map.nth(5));
+            CHECK(it->first == 20); CHECK(it->second == 4);
+            CHECK(map.size() == 7);
+            CHECK(is_grouped(map));
+            CHECK(map.nth(6)->first == 30); CHECK(map.nth(6)->second == 1);
+        }
+
+        ///////////////////////////////////////////////////////////////////////////
+
+        {
+            // Erase the first element of the first group.
+            auto it = map.erase(map.nth(0));
+            CHECK(it == map.nth(0));
+            CHECK(map.size() == 6);
+            CHECK(is_grouped(map));
+            CHECK(map.count(10) == 1);
+            CHECK(map.count(20) == 4);
+            CHECK(map.count(30) == 1);
+            CHECK(map.nth(0)->first == 10);
+        }
+
+        {
+            // Erase the last element in the container.
+            auto it = map.erase(map.nth(5));
+            CHECK(it == map.end());
+            CHECK(map.size() == 5);
+            CHECK(is_grouped(map));
+            CHECK(map.count(30) == 0);
+        }
+
+        {
+            auto it = map.erase(map.nth(1), map.nth(3));
+            CHECK(it == map.nth(1));
+            CHECK(map.size() == 3);
+            CHECK(is_grouped(map));
+            CHECK(map.count(10) == 1);
+            CHECK(map.count(20) == 2);
+        }
+
+        CHECK(map.erase(20) == 2);
+        CHECK(map.erase(20) == 0);
+        CHECK(map.size() == 1);
+        CHECK(map.nth(0)->first == 10);
+
+        ///////////////////////////////////////////////////////////////////////////
+
+        map = {{1, 1}, {2, 1}, {1, 2}, {3, 1}, {2, 2}, {1, 3}};
+        CHECK(map.size() == 6);
+        CHECK(is_grouped(map));
+        CHECK(map.count(1) == 3);
+        CHECK(map.count(2) == 2);
+        CHECK(map.count(3) == 1);
+
+        CHECK(erase_if(map, [](const std::pair<const xint, xint>& value){ return value.second == 1; }) == 3);
+        CHECK(map.size() == 3);
+        CHECK(is_grouped(map));
+        CHECK(map.count(1) == 2);
+        CHECK(map.count(2) == 1);
+        CHECK(map.count(3) == 0);
+
+        ///////////////////////////////////////////////////////////////////////////
+
+        // Random sequence of insertions and erasures.
+
+        map.clear();
+
+        unsigned seed = 12345;
+
+        auto next_random = [&seed]()
+        {
+            seed = seed * 1103515245 + 12345;
+            return int((seed >> 16) % 32768);
+        };
+
+        for (int i = 0; i < 2000; ++i)
+        {
+            const int r = next_random();
+
+            if (r % 3 != 0 && !map.full())
+            {
+                map.emplace(r % 13, i);
+            }
+            else if (!map.empty())
+            {
+                switch (r % 4)
+                {
+                case 0:
+                    map.erase(map.nth(r % map.size()));
+                    break;
+                case 1:
+                    {
+                        const int pos = r % int(map.size());
+                        map.erase(map.nth(pos), map.nth(pos + (r >> 3) % (int(map.size()) - pos + 1)));
+                    }
+                    break;
+                case 2:
+                    map.erase(r % 13);
+                    break;
+                default:
+                    {
+                        auto er = map.equal_range(r % 13);
+                        CHECK(std::distance(er.first, er.second) == std::ptrdiff_t(map.count(r % 13)));
+                    }
+                    break;
+                }
+            }
+
+            CHECK(is_grouped(map));
+        }
+    }
+
+    PRINT("Test grouped layout (transparent)");
+    {
+        sfl::static_unordered_flat_multimap<xobj, xint, 100, xobj::equal, true> map;
+
+        map.emplace(std::piecewise_construct, std::forward_as_tuple(10), std::forward_as_tuple(1));
+        map.emplace(std::piecewise_construct, std::forward_as_tuple(20), std::forward_as_tuple(1));
+        map.emplace(std::piecewise_construct, std::forward_as_tuple(10), std::forward_as_tuple(2));
+
+        CHECK(map.nth(0)->first.value() == 10);
+        CHECK(map.nth(1)->first.value() == 10);
+        CHECK(map.nth(2)->first.value() == 20);
+
+        CHECK(map.count(10) == 2);
+        CHECK(map.count(30) == 0);
+
+        {
+            auto er = map.equal_range(xobj(10));
+            CHECK(er.first == map.nth(0));
+            CHECK(er.second == map.nth(2));
+        }
+
+        CHECK(map.erase(10) == 2);
+        CHECK(map.size() == 1);
+        CHECK(map.nth(0)->first.value() == 20);
+    }
+
+    PRINT("Test grouped layout (several groups equivalent to one key)");
+    {
+        using sfl::test::decade;
+
+        sfl::static_unordered_flat_multimap<int, int, 100, equal_decade, false> map1;
+        sfl::static_unordered_flat_multimap<int, int, 100, equal_decade, true> map2;
+
+        for (int key : {10, 11, 20, 12, 11, 30, 10, 13, 21, 11})
+        {
+            map1.emplace(key, 1);
+            map2.emplace(key, 1);
+        }
+
+        CHECK(is_grouped(map2));
+
+        for (int d = 0; d < 5; ++d)
+        {
+            CHECK(map1.count(decade{d}) == map2.count(decade{d}));
+            CHECK(map1.contains(decade{d}) == map2.contains(decade{d}));
+        }
+
+        CHECK(map2.count(decade{1}) == 7);
+        CHECK(map2.count(decade{2}) == 2);
+        CHECK(map2.count(11) == 3);
+
+        {
+            auto er = map2.equal_range(11);
+            CHECK(std::distance(er.first, er.second) == 3);
+        }
+
+        CHECK(map1.erase(decade{1}) == 7);
+        CHECK(map2.erase(decade{1}) == 7);
+
+        CHECK(map1.size() == 3);
+        CHECK(map2.size() == 3);
+        CHECK(map1.count(decade{1}) == 0);
+        CHECK(map2.count(decade{1}) == 0);
+        CHECK(map2.count(decade{2}) == 2);
+        CHECK(map2.count(decade{3}) == 1);
+        CHECK(is_grouped(map2));
+
+        CHECK(map2.erase(decade{4}) == 0);
+        CHECK(map2.size() == 3);
+    }
+
+    PRINT("Test grouped layout (throwing construction)");
+    {
+        sfl::static_unordered_flat_multimap<int, nonnegative, 100, std::equal_to<int>, true> map;
+
+        map.emplace(1, 1);
+        map.emplace(2, 1);
+        map.emplace(3, 1);
+        map.emplace(1, 2);
+
+        bool thrown = false;
+
+        try
+        {
+            map.emplace(2, -1);
+        }
+        catch (const std::invalid_argument&)
+        {
+            thrown = true;
+        }
+
+        CHECK(thrown);
+        CHECK(map.size() == 4);
+        CHECK(map.count(1) == 2);
+        CHECK(map.count(2) == 1);
+        CHECK(map.count(3) == 1);
+        CHECK(is_grouped(map));
+
+        map.emplace(2, 2);
+
+        CHECK(map.size() == 5);
+        CHECK(map.count(2) == 2);
+        CHECK(is_grouped(map));
+    }
 }
 
 int main()
@@ -316,6 +316,66 @@ void test_static_unordered_flat_multiset()
 
     ///////////////////////////////////////////////////////////////////////////////
 
+    PRINT("Test find_many, contains_many");
+    {
+        // xint
+        {
+            sfl::static_unordered_flat_multiset<xint, 100, std::equal_to<xint>> set;
+
+            set.emplace_back(20);
+            set.emplace_back(40);
+            set.emplace_back(60);
+
+            const xint keys[] = {10, 20, 30, 40, 50, 60, 70, 40};
+
+            decltype(set)::const_iterator its[8];
+            bool found[8];
+
+            CHECK(set.find_many(std::begin(keys), std::end(keys), its) == its + 8);
+            CHECK(set.contains_many(std::begin(keys), std::end(keys), found) == found + 8);
+
+            CHECK(its[0] == set.end());   CHECK(found[0] == false);
+            CHECK(its[1] == set.nth(0));  CHECK(found[1] == true);
+            CHECK(its[2] == set.end());   CHECK(found[2] == false);
+            CHECK(its[3] == set.nth(1));  CHECK(found[3] == true);
+            CHECK(its[4] == set.end());   CHECK(found[4] == false);
+            CHECK(its[5] == set.nth(2));  CHECK(found[5] == true);
+            CHECK(its[6] == set.end());   CHECK(found[6] == false);
+            CHECK(its[7] == set.nth(1));  CHECK(found[7] == true);
+        }
+
+        // int, more keys than fit into one batch
+        {
+            sfl::static_unordered_flat_multiset<int, 100, std::equal_to<int>> set;
+
+            for (int i = 0; i < 100; ++i)
+            {
+                set.emplace_back(i % 50 * 3);
+            }
+
+            int keys[150];
+
+            for (int i = 0; i < 150; ++i)
+            {
+                keys[i] = i * 7 % 128;
+            }
+
+            decltype(set)::iterator its[150];
+            bool found[150];
+
+            CHECK(set.find_many(std::begin(keys), std::end(keys), its) == its + 150);
+            CHECK(set.contains_many(std::begin(keys), std::end(keys), found) == found + 150);
+
+            for (int i = 0; i < 150; ++i)
+            {
+                CHECK(its[i] == set.find(keys[i]));
+                CHECK(found[i] == set.contains(keys[i]));
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+
     PRINT("Test clear()");
     {
         sfl::static_unordered_flat_multiset<xint_xint, 100, std::equal_to<xint_xint>> set;
@@ -1884,6 +1944,49 @@ void test_static_unordered_flat_multiset()
 
     ///////////////////////////////////////////////////////////////////////////////
 
+    PRINT("Test extract(), replace(static_vector&&)");
+    {
+        using container_type =
+            sfl::static_unordered_flat_multiset< xint,
+                                                 5,
+                                                 std::equal_to<xint> >;
+
+        using vector_type = sfl::static_vector<typename container_type::value_type, 5>;
+
+        ///////////////////////////////////////////////////////////////////////////
+
+        container_type c;
+
+        for (int i = 1; i <= 3; ++i)
+        {
+            c.emplace(10 * i);
+        }
+
+        vector_type vec = c.extract();
+
+        CHECK(c.empty());
+        CHECK(vec.size() == 3);
+
+        for (int i = 0; i < 3; ++i)
+        {
+            CHECK(vec[i] == 10 * (i + 1));
+        }
+
+        ///////////////////////////////////////////////////////////////////////////
+
+        c.emplace(90);
+
+        c.replace(std::move(vec));
+
+        CHECK(vec.empty());
+        CHECK(c.size() == 3);
+
+        for (int i = 0; i < 3; ++i)
+        {
+            CHECK(*c.nth(i) == 10 * (i + 1));
+        }
+    }
+
     PRINT("Test NON-MEMBER comparison operators");
     {
         sfl::static_unordered_flat_multiset<xint_xint, 100, std::equal_to<xint_xint>> set1, set2, set3;
@@ -15,8 +15,51 @@
 #include "xint_xint.hpp"
 #include "xobj.hpp"
 
+#include <cstdint>
+#include <string>
 #include <vector>
 
+// Inserts keys `gen(0)`, ..., `gen(N - 1)` one by one and checks that each
+// of them is found and that `gen(N)` is never found. Then erases keys one by
+// one (erase moves the last element into the hole) and checks again.
+template <typename Key, std::size_t N, typename KeyEqual, typename Generator>
+void test_static_unordered_flat_set_simd_find(Generator gen)
+{
+    static_assert(sfl::dtl::is_simd_searchable<Key, KeyEqual>::value, "");
+
+    sfl::static_unordered_flat_set<Key, N, KeyEqual> set;
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        CHECK(set.emplace(gen(i)).second == true);
+
+        for (std::size_t j = 0; j <= i; ++j)
+        {
+            CHECK(set.find(gen(j)) == set.nth(j));
+            CHECK(set.count(gen(j)) == 1);
+            CHECK(set.contains(gen(j)) == true);
+        }
+
+        CHECK(set.find(gen(N)) == set.end());
+        CHECK(set.count(gen(N)) == 0);
+        CHECK(set.contains(gen(N)) == false);
+    }
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        CHECK(set.erase(gen(i)) == 1);
+        CHECK(set.find(gen(i)) == set.end());
+
+        for (std::size_t j = i + 1; j < N; ++j)
+        {
+            CHECK(set.find(gen(j)) != set.end());
+            CHECK(*set.find(gen(j)) == gen(j));
+        }
+    }
+
+    CHECK(set.empty());
+}
+
 void test_static_unordered_flat_set()
 {
     using sfl::test::xint;
@@ -316,6 +359,149 @@ void test_static_unordered_flat_set()
 
     ///////////////////////////////////////////////////////////////////////////////
 
+    PRINT("Test find_many, contains_many");
+    {
+        // xint
+        {
+            sfl::static_unordered_flat_set<xint, 100, std::equal_to<xint>> set;
+
+            set.emplace_back(20);
+            set.emplace_back(40);
+            set.emplace_back(60);
+
+            const xint keys[] = {10, 20, 30, 40, 50, 60, 70, 40};
+
+            decltype(set)::const_iterator its[8];
+            bool found[8];
+
+            CHECK(set.find_many(std::begin(keys), std::end(keys), its) == its + 8);
+            CHECK(set.contains_many(std::begin(keys), std::end(keys), found) == found + 8);
+
+            CHECK(its[0] == set.end());   CHECK(found[0] == false);
+            CHECK(its[1] == set.nth(0));  CHECK(found[1] == true);
+            CHECK(its[2] == set.end());   CHECK(found[2] == false);
+            CHECK(its[3] == set.nth(1));  CHECK(found[3] == true);
+            CHECK(its[4] == set.end());   CHECK(found[4] == false);
+            CHECK(its[5] == set.nth(2));  CHECK(found[5] == true);
+            CHECK(its[6] == set.end());   CHECK(found[6] == false);
+            CHECK(its[7] == set.nth(1));  CHECK(found[7] == true);
+        }
+
+        // int, more keys than fit into one batch
+        {
+            sfl::static_unordered_flat_set<int, 100, std::equal_to<int>> set;
+
+            for (int i = 0; i < 100; ++i)
+            {
+                set.emplace_back(i * 3);
+            }
+
+            int keys[150];
+
+            for (int i = 0; i < 150; ++i)
+            {
+                keys[i] = i * 7 % 128;
+            }
+
+            decltype(set)::iterator its[150];
+            bool found[150];
+
+            CHECK(set.find_many(std::begin(keys), std::end(keys), its) == its + 150);
+            CHECK(set.contains_many(std::begin(keys), std::end(keys), found) == found + 150);
+
+            for (int i = 0; i < 150; ++i)
+            {
+                CHECK(its[i] == set.find(keys[i]));
+                CHECK(found[i] == set.contains(keys[i]));
+            }
+        }
+
+        // std::string, more keys than fit into one batch
+        {
+            sfl::static_unordered_flat_set<std::string, 100, std::equal_to<std::string>> set;
+
+            for (int i = 0; i < 100; ++i)
+            {
+                set.emplace_back(std::to_string(i * 3));
+            }
+
+            std::vector<std::string> keys;
+
+            for (int i = 0; i < 150; ++i)
+            {
+                keys.push_back(std::to_string(i * 7 % 128));
+            }
+
+            decltype(set)::iterator its[150];
+            bool found[150];
+
+            CHECK(set.find_many(keys.begin(), keys.end(), its) == its + 150);
+            CHECK(set.contains_many(keys.begin(), keys.end(), found) == found + 150);
+
+            for (int i = 0; i < 150; ++i)
+            {
+                CHECK(its[i] == set.find(keys[i]));
+                CHECK(found[i] == set.contains(keys[i]));
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+
+    PRINT("Test find, count, contains (SIMD search)");
+    {
+        enum class color : std::uint16_t {};
+
+        static int ints[101];
+
+        // Values of generated keys differ only in the high-order bytes,
+        // so keys cannot be found by comparing the low-order bytes.
+
+        test_static_unordered_flat_set_simd_find<std::int8_t, 100, std::equal_to<std::int8_t>>
+        (
+            [](std::size_t i) { return std::int8_t(int(i) - 50); }
+        );
+
+        test_static_unordered_flat_set_simd_find<std::uint16_t, 100, std::equal_to<std::uint16_t>>
+        (
+            [](std::size_t i) { return std::uint16_t((i << 8) | 0x5A); }
+        );
+
+        test_static_unordered_flat_set_simd_find<color, 100, std::equal_to<color>>
+        (
+            [](std::size_t i) { return color((i << 8) | 0x5A); }
+        );
+
+        test_static_unordered_flat_set_simd_find<int, 100, std::equal_to<int>>
+        (
+            [](std::size_t i) { return int((i << 16) | 0x5A5A); }
+        );
+
+        test_static_unordered_flat_set_simd_find<std::uint64_t, 100, std::equal_to<std::uint64_t>>
+        (
+            [](std::size_t i) { return (std::uint64_t(i) << 32) | 0x5A5A5A5A; }
+        );
+
+        test_static_unordered_flat_set_simd_find<const int*, 100, std::equal_to<const int*>>
+        (
+            [](std::size_t i) { return static_cast<const int*>(&ints[i]); }
+        );
+
+        test_static_unordered_flat_set_simd_find<int, 7, std::equal_to<int>>
+        (
+            [](std::size_t i) { return int(i); }
+        );
+
+        #if __cplusplus >= 201402L
+        test_static_unordered_flat_set_simd_find<long long, 50, std::equal_to<>>
+        (
+            [](std::size_t i) { return (static_cast<long long>(i) << 40) - 1; }
+        );
+        #endif
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+
     PRINT("Test clear()");
     {
         sfl::static_unordered_flat_set<xint_xint, 100, std::equal_to<xint_xint>> set;
@@ -403,6 +589,27 @@ void test_static_unordered_flat_set()
         }
     }
 
+    PRINT("Test emplace(Args&&...) and emplace_hint(const_iterator, Args&&...) with existing key");
+    {
+        sfl::static_unordered_flat_set<xint, 100, std::equal_to<xint>> set;
+
+        CHECK(set.emplace(10) == std::make_pair(set.nth(0), true));
+        CHECK(set.emplace(20) == std::make_pair(set.nth(1), true));
+
+        // Key is not moved from if it already exists.
+        {
+            xint key(10);
+
+            CHECK(set.emplace(std::move(key)) == std::make_pair(set.nth(0), false));
+            CHECK(key == 10);
+
+            CHECK(set.emplace_hint(set.begin(), std::move(key)) == set.nth(0));
+            CHECK(key == 10);
+
+            CHECK(set.size() == 2);
+        }
+    }
+
     PRINT("Test insert(const value_type&)");
     {
         sfl::static_unordered_flat_set<xint_xint, 100, std::equal_to<xint_xint>> set;
@@ -678,6 +885,86 @@ void test_static_unordered_flat_set()
         }
     }
 
+    PRINT("Test insert(InputIt, InputIt) (bulk)");
+    {
+        sfl::static_unordered_flat_set<int, 200, std::equal_to<int>> set;
+
+        for (int i = 0; i < 50; ++i)
+        {
+            set.insert(i * 2);
+        }
+
+        // Keys 0..149 followed by duplicates 0..49. Even keys below 100
+        // already exist.
+
+        std::vector<int> data;
+
+        for (int i = 0; i < 200; ++i)
+        {
+            data.push_back(i % 150);
+        }
+
+        set.insert(data.begin(), data.end());
+
+        CHECK(set.size() == 150);
+
+        for (int i = 0; i < 50; ++i)
+        {
+            CHECK(*set.nth(i) == i * 2);
+        }
+
+        int pos = 50;
+
+        for (int k = 0; k < 150; ++k)
+        {
+            if (k >= 100 || k % 2 != 0)
+            {
+                CHECK(*set.nth(pos) == k);
+                ++pos;
+            }
+        }
+    }
+
+    PRINT("Test insert(InputIt, InputIt) (bulk, std::string)");
+    {
+        sfl::static_unordered_flat_set<std::string, 200, std::equal_to<std::string>> set;
+
+        for (int i = 0; i < 50; ++i)
+        {
+            set.insert(std::to_string(i * 2));
+        }
+
+        // Keys "0".."149" followed by duplicates "0".."49". Even keys below 100
+        // already exist.
+
+        std::vector<std::string> data;
+
+        for (int i = 0; i < 200; ++i)
+        {
+            data.push_back(std::to_string(i % 150));
+        }
+
+        set.insert(data.begin(), data.end());
+
+        CHECK(set.size() == 150);
+
+        for (int i = 0; i < 50; ++i)
+        {
+            CHECK(*set.nth(i) == std::to_string(i * 2));
+        }
+
+        int pos = 50;
+
+        for (int k = 0; k < 150; ++k)
+        {
+            if (k >= 100 || k % 2 != 0)
+            {
+                CHECK(*set.nth(pos) == std::to_string(k));
+                ++pos;
+            }
+        }
+    }
+
     PRINT("Test insert(std::initializer_list)");
     {
         sfl::static_unordered_flat_set<xint_xint, 100, std::equal_to<xint_xint>> set;
@@ -1913,6 +2200,49 @@ void test_static_unordered_flat_set()
 
     ///////////////////////////////////////////////////////////////////////////////
 
+    PRINT("Test extract(), replace(static_vector&&)");
+    {
+        using container_type =
+            sfl::static_unordered_flat_set< xint,
+                                            5,
+                                            std::equal_to<xint> >;
+
+        using vector_type = sfl::static_vector<typename container_type::value_type, 5>;
+
+        ///////////////////////////////////////////////////////////////////////////
+
+        container_type c;
+
+        for (int i = 1; i <= 3; ++i)
+        {
+            c.emplace(10 * i);
+        }
+
+        vector_type vec = c.extract();
+
+        CHECK(c.empty());
+        CHECK(vec.size() == 3);
+
+        for (int i = 0; i < 3; ++i)
+        {
+            CHECK(vec[i] == 10 * (i + 1));
+        }
+
+        ///////////////////////////////////////////////////////////////////////////
+
+        c.emplace(90);
+
+        c.replace(std::move(vec));
+
+        CHECK(vec.empty());
+        CHECK(c.size() == 3);
+
+        for (int i = 0; i < 3; ++i)
+        {
+            CHECK(*c.nth(i) == 10 * (i + 1));
+        }
+    }
+
     PRINT("Test NON-MEMBER comparison operators");
     {
         sfl::static_unordered_flat_set<xint_xint, 100, std::equal_to<xint_xint>> set1, set2, set3;
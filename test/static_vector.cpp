@@ -3730,6 +3730,43 @@ void test_static_vector()
         CHECK(*vec.nth(0) == 10);
         CHECK(*vec.nth(1) == 30);
     }
+
+    PRINT("Test constexpr (C++20)");
+    #if __cplusplus >= 202002L
+    {
+        static constexpr sfl::static_vector<int, 8> vec{3, 1, 2};
+
+        static_assert(vec.size() == 3);
+        static_assert(vec.front() == 3);
+        static_assert(vec[1] == 1);
+        static_assert(vec.back() == 2);
+
+        constexpr auto sum = []()
+        {
+            sfl::static_vector<int, 8> v{1, 2, 3};
+            v.push_back(4);
+            v.erase(v.begin());
+            v.insert(v.begin(), 10);
+            v.pop_back();
+            auto w = v;
+            w.resize(6);
+            int s = 0;
+            for (int x : w)
+            {
+                s += x;
+            }
+            for (int x : vec)
+            {
+                s += x;
+            }
+            return s;
+        };
+
+        static_assert(sum() == 15 + 6);
+
+        CHECK(vec[1] == 1);
+    }
+    #endif
 }
 
 int main()
@@ -0,0 +1,37 @@
+#ifndef SFL_TEST_THROWING_LESS_HPP
+#define SFL_TEST_THROWING_LESS_HPP
+
+#include <stdexcept>
+
+namespace sfl
+{
+namespace test
+{
+
+// Compares ints like std::less, but throws when `*countdown` reaches zero.
+// Each comparison decrements `*countdown` if it is positive, so negative
+// countdown never throws.
+struct throwing_less
+{
+    int* countdown;
+
+    bool operator()(int a, int b) const
+    {
+        if (*countdown == 0)
+        {
+            throw std::runtime_error("throwing_less");
+        }
+
+        if (*countdown > 0)
+        {
+            --*countdown;
+        }
+
+        return a < b;
+    }
+};
+
+} // namespace test
+} // namespace sfl
+
+#endif // SFL_TEST_THROWING_LESS_HPP
@@ -0,0 +1,95 @@
+#ifndef SFL_TEST_THROWING_MOVE_HPP
+#define SFL_TEST_THROWING_MOVE_HPP
+
+#include <stdexcept>
+
+namespace sfl
+{
+namespace test
+{
+
+// Holds an int. Copy and move constructors throw when `*countdown` reaches
+// zero. Each copy or move decrements `*countdown` if it is positive, so
+// negative countdown never throws. Number of live objects is counted.
+class throwing_move
+{
+private:
+
+    int* countdown_;
+    int  value_;
+
+    void tick() const
+    {
+        if (*countdown_ == 0)
+        {
+            throw std::runtime_error("throwing_move");
+        }
+
+        if (*countdown_ > 0)
+        {
+            --*countdown_;
+        }
+    }
+
+public:
+
+    static int& num_live()
+    {
+        static int n = 0;
+        return n;
+    }
+
+    throwing_move(int* countdown, int value)
+        : countdown_(countdown)
+        , value_(value)
+    {
+        ++num_live();
+    }
+
+    throwing_move(const throwing_move& other)
+        : countdown_(other.countdown_)
+        , value_(other.value_)
+    {
+        tick();
+        ++num_live();
+    }
+
+    throwing_move(throwing_move&& other)
+        : countdown_(other.countdown_)
+        , value_(other.value_)
+    {
+        tick();
+        ++num_live();
+    }
+
+    throwing_move& operator=(const throwing_move& other)
+    {
+        other.tick();
+        countdown_ = other.countdown_;
+        value_ = other.value_;
+        return *this;
+    }
+
+    throwing_move& operator=(throwing_move&& other)
+    {
+        other.tick();
+        countdown_ = other.countdown_;
+        value_ = other.value_;
+        return *this;
+    }
+
+    ~throwing_move()
+    {
+        --num_live();
+    }
+
+    int value() const
+    {
+        return value_;
+    }
+};
+
+} // namespace test
+} // namespace sfl
+
+#endif // SFL_TEST_THROWING_MOVE_HPP
@@ -0,0 +1,185 @@
+//
+// g++ -std=c++11 -g -O0 -Wall -Wextra -Wpedantic -Werror -Wfatal-errors -I ../include tiny_vector.cpp
+// valgrind --leak-check=full ./a.out
+//
+
+#undef NDEBUG // This is very important. Must be in the first line.
+
+#include "sfl/tiny_vector.hpp"
+
+#include "check.hpp"
+#include "print.hpp"
+
+#include "xhandle.hpp"
+#include "xint.hpp"
+
+#include "statefull_alloc.hpp"
+#include "stateless_alloc.hpp"
+#include "stateless_alloc_no_prop.hpp"
+#include "stateless_fancy_alloc.hpp"
+#include "throwing_move.hpp"
+
+#include <cstdint>
+#include <sstream>
+#include <vector>
+
+static_assert
+(
+    sizeof(sfl::tiny_vector<std::uint32_t, 4>) ==
+        2 * sizeof(std::uint32_t) +
+        (sizeof(void*) > 4 * sizeof(std::uint32_t) ? sizeof(void*) : 4 * sizeof(std::uint32_t)),
+    "Invalid size"
+);
+
+static_assert
+(
+    sizeof(sfl::tiny_vector<double, 0>) ==
+        2 * sizeof(std::uint32_t) + sizeof(void*),
+    "Invalid size"
+);
+
+void test_tiny_vector_1()
+{
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR std::allocator
+    #include "tiny_vector.inc"
+}
+
+void test_tiny_vector_2()
+{
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::statefull_alloc
+    #include "tiny_vector.inc"
+}
+
+void test_tiny_vector_3()
+{
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::stateless_alloc
+    #include "tiny_vector.inc"
+}
+
+void test_tiny_vector_4()
+{
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::stateless_alloc_no_prop
+    #include "tiny_vector.inc"
+}
+
+void test_tiny_vector_5()
+{
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::stateless_fancy_alloc
+    #include "tiny_vector.inc"
+}
+
+void test_tiny_vector_storage()
+{
+    using sfl::test::xhandle;
+
+    PRINT("Test transitions between internal and external storage");
+    {
+        sfl::tiny_vector<std::uint32_t, 4> vec;
+
+        CHECK(vec.capacity() == 4);
+
+        for (std::uint32_t i = 0; i < 4; ++i)
+        {
+            vec.push_back(i);
+        }
+
+        CHECK(vec.capacity() == 4);
+
+        vec.push_back(4);
+
+        CHECK(vec.size() == 5);
+        CHECK(vec.capacity() > 4);
+
+        for (std::uint32_t i = 0; i < 5; ++i)
+        {
+            CHECK(vec[i] == i);
+        }
+
+        vec.pop_back();
+        vec.shrink_to_fit();
+
+        CHECK(vec.size() == 4);
+        CHECK(vec.capacity() == 4);
+
+        for (std::uint32_t i = 0; i < 4; ++i)
+        {
+            CHECK(vec[i] == i);
+        }
+
+        vec.clear();
+        vec.shrink_to_fit();
+
+        CHECK(vec.empty());
+        CHECK(vec.capacity() == 4);
+    }
+
+    PRINT("Test swap of containers using internal and external storage");
+    {
+        sfl::tiny_vector<xhandle, 4> vec1;
+        sfl::tiny_vector<xhandle, 4> vec2;
+
+        for (int i = 0; i < 3; ++i)
+        {
+            vec1.emplace_back(i);
+        }
+
+        for (int i = 0; i < 10; ++i)
+        {
+            vec2.emplace_back(100 + i);
+        }
+
+        vec1.swap(vec2);
+
+        CHECK(vec1.size() == 10);
+        CHECK(vec2.size() == 3);
+        CHECK(vec2.capacity() == 4);
+
+        for (int i = 0; i < 10; ++i)
+        {
+            CHECK(vec1[i].value() == 100 + i);
+        }
+
+        for (int i = 0; i < 3; ++i)
+        {
+            CHECK(vec2[i].value() == i);
+        }
+
+        vec1.swap(vec2);
+
+        CHECK(vec1.size() == 3);
+        CHECK(vec1.capacity() == 4);
+        CHECK(vec2.size() == 10);
+
+        for (int i = 0; i < 3; ++i)
+        {
+            CHECK(vec1[i].value() == i);
+        }
+
+        for (int i = 0; i < 10; ++i)
+        {
+            CHECK(vec2[i].value() == 100 + i);
+        }
+    }
+
+    PRINT("Test max_size");
+    {
+        sfl::tiny_vector<char, 4> vec;
+
+        CHECK(vec.max_size() <= std::numeric_limits<std::uint32_t>::max());
+    }
+}
+
+int main()
+{
+    test_tiny_vector_1();
+    test_tiny_vector_2();
+    test_tiny_vector_3();
+    test_tiny_vector_4();
+    test_tiny_vector_5();
+    test_tiny_vector_storage();
+}
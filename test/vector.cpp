@@ -10,8 +10,11 @@
 #include "check.hpp"
 #include "print.hpp"
 
+#include "xhandle.hpp"
 #include "xint.hpp"
 
+#include "at_least_alloc.hpp"
+#include "counting_realloc_alloc.hpp"
 #include "statefull_alloc.hpp"
 #include "stateless_alloc.hpp"
 #include "stateless_alloc_no_prop.hpp"
@@ -55,6 +58,302 @@ void test_vector_5()
     #include "vector.inc"
 }
 
+void test_vector_relocation()
+{
+    using sfl::test::xhandle;
+
+    PRINT("Test trivially relocatable value type");
+    {
+        sfl::vector<xhandle> vec;
+
+        std::vector<int> expected;
+
+        xhandle::moves = 0;
+
+        for (int i = 0; i < 100; ++i)
+        {
+            vec.emplace_back(i);
+            expected.push_back(i);
+        }
+
+        // Growth relocates elements without calling move constructor.
+        CHECK(xhandle::moves == 0);
+
+        vec.erase(vec.begin() + 10);
+        expected.erase(expected.begin() + 10);
+
+        vec.erase(vec.begin() + 80);
+        expected.erase(expected.begin() + 80);
+
+        vec.erase(vec.begin() + 20, vec.begin() + 30);
+        expected.erase(expected.begin() + 20, expected.begin() + 30);
+
+        vec.erase(vec.begin() + 70, vec.begin() + 75);
+        expected.erase(expected.begin() + 70, expected.begin() + 75);
+
+        CHECK(xhandle::moves == 0);
+
+        vec.shrink_to_fit();
+
+        CHECK(xhandle::moves == 0);
+
+        vec.emplace(vec.begin() + 5, 1000);
+        expected.insert(expected.begin() + 5, 1000);
+
+        CHECK(vec.size() == expected.size());
+
+        for (std::size_t i = 0; i < expected.size(); ++i)
+        {
+            CHECK(vec[i].value() == expected[i]);
+        }
+    }
+
+    PRINT("Test trivially relocatable value type with allocator that has construct and destroy");
+    {
+        sfl::vector<xhandle, sfl::test::statefull_alloc<xhandle>> vec;
+
+        xhandle::moves = 0;
+
+        for (int i = 0; i < 100; ++i)
+        {
+            vec.emplace_back(i);
+        }
+
+        vec.erase(vec.begin() + 10);
+
+        // Elements are moved one by one.
+        CHECK(xhandle::moves > 0);
+
+        CHECK(vec.size() == 99);
+
+        for (int i = 0; i < 99; ++i)
+        {
+            CHECK(vec[i].value() == (i < 10 ? i : i + 1));
+        }
+    }
+}
+
+void test_vector_growth_policy()
+{
+    PRINT("Test growth policies");
+    {
+        using policy_1 = sfl::geometric_growth<>;
+        using policy_2 = sfl::geometric_growth<5, 4>;
+        using policy_3 = sfl::page_rounded_growth<sfl::geometric_growth<2, 1>>;
+        using policy_4 = sfl::size_class_rounded_growth<>;
+
+        CHECK(policy_1::grow(0, 1, 1000, 4) == 1);
+        CHECK(policy_1::grow(10, 11, 1000, 4) == 15);
+        CHECK(policy_1::grow(10, 20, 1000, 4) == 20);
+        CHECK(policy_1::grow(900, 901, 1000, 4) == 1000);
+        CHECK(policy_1::round(17, 1000, 4) == 17);
+
+        CHECK(policy_2::grow(100, 101, 1000, 4) == 125);
+
+        CHECK(policy_3::grow(100, 101, 100000, 4) == 200);
+        CHECK(policy_3::grow(1000, 1001, 100000, 4) == 2048);
+        CHECK(policy_3::round(1500, 100000, 4) == 2048);
+        CHECK(policy_3::round(1500, 1600, 4) == 1600);
+
+        CHECK(policy_4::round(10, 1000, 1) == 16);
+        CHECK(policy_4::round(129, 1000, 1) == 160);
+        CHECK(policy_4::round(300, 1000, 1) == 320);
+        CHECK(policy_4::round(5, 1000, 8) == 6);
+        CHECK(policy_4::grow(100, 101, 1000, 1) == 160);
+    }
+
+    PRINT("Test vector with growth policy");
+    {
+        sfl::vector<int, std::allocator<int>, sfl::geometric_growth<2, 1>> vec;
+
+        for (int i = 0; i < 100; ++i)
+        {
+            const auto old_capacity = vec.capacity();
+
+            vec.push_back(i);
+
+            if (old_capacity != 0 && vec.capacity() != old_capacity)
+            {
+                CHECK(vec.capacity() == 2 * old_capacity);
+            }
+        }
+
+        CHECK(vec.size() == 100);
+        CHECK(vec.capacity() == 128);
+
+        vec.insert(vec.begin(), 100, 0);
+        CHECK(vec.capacity() == 256);
+
+        vec.reserve(300);
+        CHECK(vec.capacity() == 300);
+    }
+
+    PRINT("Test vector with rounding growth policy");
+    {
+        sfl::vector<int, std::allocator<int>, sfl::page_rounded_growth<>> vec;
+
+        vec.reserve(1500);
+        CHECK(vec.capacity() == 2048);
+
+        vec.assign(2048, 1);
+        vec.push_back(2);
+        CHECK(vec.capacity() == 3072);
+    }
+}
+
+void test_vector_allocate_at_least()
+{
+    PRINT("Test vector with allocator that has allocate_at_least");
+    {
+        sfl::vector<int, sfl::test::at_least_alloc<int>> vec;
+
+        vec.push_back(0);
+        CHECK(vec.capacity() == 8);
+
+        for (int i = 1; i < 9; ++i)
+        {
+            vec.push_back(i);
+        }
+
+        CHECK(vec.capacity() == 16);
+
+        vec.insert(vec.begin(), 10, -1);
+        CHECK(vec.size() == 19);
+        CHECK(vec.capacity() == 24);
+
+        vec.reserve(25);
+        CHECK(vec.capacity() == 32);
+
+        vec.shrink_to_fit();
+        CHECK(vec.capacity() == 19);
+
+        for (int i = 0; i < 19; ++i)
+        {
+            CHECK(vec[i] == (i < 10 ? -1 : i - 10));
+        }
+    }
+
+    PRINT("Test vector with specialization of allocator_usable_size");
+    {
+        sfl::vector<int, sfl::test::usable_size_alloc<int>> vec;
+
+        vec.push_back(0);
+        CHECK(vec.capacity() == 5);
+
+        vec.reserve(10);
+        CHECK(vec.capacity() == 14);
+    }
+}
+
+void test_vector_realloc_allocator()
+{
+    using sfl::test::counting_realloc_alloc;
+    using sfl::test::xhandle;
+    using sfl::test::xint;
+
+    PRINT("Test vector with realloc_allocator");
+    {
+        sfl::vector<int, counting_realloc_alloc<int>> vec;
+
+        counting_realloc_alloc<int>::reset_counters();
+
+        for (int i = 0; i < 100; ++i)
+        {
+            vec.push_back(i);
+        }
+
+        CHECK(counting_realloc_alloc<int>::allocations == 1);
+        CHECK(counting_realloc_alloc<int>::reallocations > 0);
+
+        const int num_reallocations = counting_realloc_alloc<int>::reallocations;
+
+        vec.reserve(1000);
+        CHECK(vec.capacity() == 1000);
+        CHECK(counting_realloc_alloc<int>::reallocations == num_reallocations + 1);
+
+        vec.resize(2000);
+        CHECK(vec.size() == 2000);
+        CHECK(counting_realloc_alloc<int>::reallocations == num_reallocations + 2);
+
+        vec.resize(100);
+        vec.shrink_to_fit();
+
+        CHECK(counting_realloc_alloc<int>::allocations == 2);
+
+        // Value is an element of this container, so storage is not
+        // reallocated in place.
+        vec.insert(vec.begin(), 10, vec[5]);
+        CHECK(counting_realloc_alloc<int>::allocations == 3);
+
+        vec.emplace(vec.begin() + 1, vec[15]);
+        vec.emplace_back(vec[0]);
+
+        CHECK(vec.size() == 112);
+        CHECK(vec[0] == 5);
+        CHECK(vec[1] == 5);
+        CHECK(vec[10] == 5);
+        CHECK(vec[11] == 0);
+        CHECK(vec[110] == 99);
+        CHECK(vec[111] == 5);
+
+        const int arr[3] = {-1, -2, -3};
+
+        vec.shrink_to_fit();
+        vec.insert(vec.begin() + 2, arr, arr + 3);
+        vec.insert(vec.end(), 5, 42);
+
+        CHECK(vec.size() == 120);
+        CHECK(vec[1] == 5);
+        CHECK(vec[2] == -1);
+        CHECK(vec[4] == -3);
+        CHECK(vec[5] == 5);
+        CHECK(vec[114] == 5);
+        CHECK(vec[115] == 42);
+        CHECK(vec[119] == 42);
+    }
+
+    PRINT("Test vector with realloc_allocator and trivially relocatable value type");
+    {
+        sfl::vector<xhandle, counting_realloc_alloc<xhandle>> vec;
+
+        counting_realloc_alloc<xhandle>::reset_counters();
+
+        xhandle::moves = 0;
+
+        for (int i = 0; i < 100; ++i)
+        {
+            vec.emplace_back(i);
+        }
+
+        CHECK(xhandle::moves == 0);
+        CHECK(counting_realloc_alloc<xhandle>::reallocations > 0);
+
+        for (int i = 0; i < 100; ++i)
+        {
+            CHECK(vec[i].value() == i);
+        }
+    }
+
+    PRINT("Test vector with realloc_allocator and value type that is not trivially relocatable");
+    {
+        sfl::vector<xint, counting_realloc_alloc<xint>> vec;
+
+        counting_realloc_alloc<xint>::reset_counters();
+
+        for (int i = 0; i < 100; ++i)
+        {
+            vec.emplace_back(i);
+        }
+
+        CHECK(counting_realloc_alloc<xint>::reallocations == 0);
+
+        for (int i = 0; i < 100; ++i)
+        {
+            CHECK(vec[i] == i);
+        }
+    }
+}
+
 int main()
 {
     test_vector_1();
@@ -62,4 +361,8 @@ int main()
     test_vector_3();
     test_vector_4();
     test_vector_5();
+    test_vector_relocation();
+    test_vector_growth_policy();
+    test_vector_allocate_at_least();
+    test_vector_realloc_allocator();
 }
@@ -0,0 +1,72 @@
+#ifndef SFL_TEST_XHANDLE_HPP
+#define SFL_TEST_XHANDLE_HPP
+
+#include "sfl/private.hpp"
+
+#include <type_traits>
+
+namespace sfl
+{
+namespace test
+{
+
+//
+// Move-only type that owns a heap allocated int. It is not trivially
+// copyable, but it is trivially relocatable. Counts calls of its move
+// constructor and move assignment operator.
+//
+class xhandle
+{
+private:
+
+    int* value_;
+
+public:
+
+    static int moves;
+
+    explicit xhandle(int value)
+        : value_(new int(value))
+    {}
+
+    xhandle(const xhandle&) = delete;
+
+    xhandle(xhandle&& other) noexcept
+        : value_(other.value_)
+    {
+        other.value_ = nullptr;
+        ++moves;
+    }
+
+    xhandle& operator=(const xhandle&) = delete;
+
+    xhandle& operator=(xhandle&& other) noexcept
+    {
+        int* tmp = value_;
+        value_ = other.value_;
+        other.value_ = tmp;
+        ++moves;
+        return *this;
+    }
+
+    ~xhandle()
+    {
+        delete value_;
+    }
+
+    int value() const
+    {
+        return *value_;
+    }
+};
+
+int xhandle::moves = 0;
+
+} // namespace test
+
+template <>
+struct is_trivially_relocatable<sfl::test::xhandle> : std::true_type {};
+
+} // namespace sfl
+
+#endif // SFL_TEST_XHANDLE_HPP
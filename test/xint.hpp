@@ -3,6 +3,8 @@
 
 #include "print.hpp"
 
+#include <functional>
+
 #define SFL_TEST_XINT_DEFAULT_VALUE 789456123
 
 namespace sfl
@@ -77,6 +79,11 @@ public:
         }
     }
 
+    int value() const
+    {
+        return *value_;
+    }
+
     friend bool operator==(const xint& x, const xint& y)
     {
         return *x.value_ == *y.value_;
@@ -113,4 +120,18 @@ int xint::counter_ = 0;
 } // namespace test
 } // namespace sfl
 
+namespace std
+{
+
+template <>
+struct hash<sfl::test::xint>
+{
+    std::size_t operator()(const sfl::test::xint& x) const noexcept
+    {
+        return std::hash<int>()(x.value());
+    }
+};
+
+} // namespace std
+
 #endif // SFL_TEST_XINT_HPP
@@ -1,6 +1,8 @@
 #ifndef SFL_TEST_XOBJ_HPP
 #define SFL_TEST_XOBJ_HPP
 
+#include <functional>
+
 namespace sfl
 {
 namespace test
@@ -75,6 +77,21 @@ public:
         }
     };
 
+    struct hash
+    {
+        using is_transparent = void;
+
+        std::size_t operator()(const xobj& a) const
+        {
+            return std::hash<int>()(a.value());
+        }
+
+        std::size_t operator()(int a) const
+        {
+            return std::hash<int>()(a);
+        }
+    };
+
     struct equal
     {
         using is_transparent = void;